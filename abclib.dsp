@@ -1311,6 +1311,10 @@ SOURCE=.\src\bdd\llb\llb4Nonlin.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\llb\llb4Par.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\llb\llb4Sweep.c
 # End Source File
 # Begin Source File
@@ -1959,6 +1963,10 @@ SOURCE=.\src\sat\cnf\cnfFast.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfFile.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfMan.c
 # End Source File
 # Begin Source File
@@ -2079,6 +2087,10 @@ SOURCE=.\src\sat\bmc\bmcICheck.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\bmc\bmcKind.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\bmc\bmcInse.c
 # End Source File
 # Begin Source File
@@ -2155,6 +2167,10 @@ SOURCE=.\src\sat\satoko\utils\heap.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\satoko\inproc.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\satoko\utils\mem.h
 # End Source File
 # Begin Source File
@@ -2567,6 +2583,10 @@ SOURCE=.\src\opt\rwr\rwrExp.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\rwr\rwrImg.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\rwr\rwrLib.c
 # End Source File
 # Begin Source File
@@ -2859,6 +2879,10 @@ SOURCE=.\src\opt\mfs\mfsSat.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\mfs\mfsSim.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\mfs\mfsStrash.c
 # End Source File
 # Begin Source File
@@ -3175,6 +3199,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -4795,6 +4823,10 @@ SOURCE=.\src\aig\saig\saigScl.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\saig\saigSimCkpt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\saig\saigSimFast.c
 # End Source File
 # Begin Source File
@@ -4915,6 +4947,10 @@ SOURCE=.\src\aig\gia\giaCut.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCutRw.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaDeep.c
 # End Source File
 # Begin Source File
@@ -5103,6 +5139,10 @@ SOURCE=.\src\aig\gia\giaRetime.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaRetMin.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaRex.c
 # End Source File
 # Begin Source File
@@ -5603,6 +5643,10 @@ SOURCE=.\src\proof\dch\dchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\dch\dchPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\dch\dchSat.c
 # End Source File
 # Begin Source File
@@ -5807,6 +5851,10 @@ SOURCE=.\src\proof\int\intMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\int\intPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\int\intUtil.c
 # End Source File
 # End Group
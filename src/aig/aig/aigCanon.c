@@ -75,7 +75,7 @@ struct Aig_RMan_t_ {
     int nUniqueVars;
 };
 
-static Aig_RMan_t* s_pRMan = NULL;
+static ABC_THREAD_LOCAL Aig_RMan_t* s_pRMan = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
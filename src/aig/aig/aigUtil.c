@@ -1094,8 +1094,8 @@ void Aig_ManRandomTest1() {
 
 ***********************************************************************/
 unsigned Aig_ManRandom(int fReset) {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static ABC_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static ABC_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if (fReset) {
         m_z = NUMBER1;
         m_w = NUMBER2;
@@ -1671,6 +1671,9 @@ extern Gia_Man_t* Gia_ManDupNoMuxes(Gia_Man_t* p, int fSkipBufs);
 extern void Gia_SatVerifyPattern(Gia_Man_t* p, Gia_Obj_t* pRoot, Vec_Int_t* vCex, Vec_Int_t* vVisit);
 /*=== giaRetime.c ===========================================================*/
 extern Gia_Man_t* Gia_ManRetimeForward(Gia_Man_t* p, int nMaxIters, int fVerbose);
+/*=== giaRetMin.c ===========================================================*/
+extern Gia_Man_t* Gia_ManRetimeMinArea(Gia_Man_t* p, int nMaxIters, int fForwardOnly, int fBackwardOnly, int fVerbose);
+extern Gia_Man_t* Gia_ManRetimeMinDelay(Gia_Man_t* p, int nDelayLim, int fVerbose);
 /*=== giaSat.c ============================================================*/
 extern int Sat_ManTest(Gia_Man_t* pGia, Gia_Obj_t* pObj, int nConfsMax);
 /*=== giaScl.c ============================================================*/
@@ -1864,6 +1867,7 @@ extern int Gia_ManCountPisWithFanout(Gia_Man_t* p);
 extern int Gia_ManCountPosWithNonZeroDrivers(Gia_Man_t* p);
 extern void Gia_ManUpdateCopy(Vec_Int_t* vCopy, Gia_Man_t* p);
 extern Vec_Int_t* Gia_ManComputeDistance(Gia_Man_t* p, int iObj, Vec_Int_t* vObjs, int fVerbose);
+extern Vec_Wec_t* Gia_ManClusterOutputs(Gia_Man_t* p, int nGroupMax, int fVerbose);
 
 /*=== giaCTas.c ===========================================================*/
 typedef struct Tas_Man_t_ Tas_Man_t;
@@ -719,6 +719,45 @@ void Gia_ManExtractTest(Gia_Man_t* pGia) {
     Abc_PrintTime(0, "Creating windows", Abc_Clock() - clk);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes cuts with truth tables for all nodes.]
+
+  Description [Returns the cut sets in the format of Sdb_ForEachCut(),
+  where the last entry of each cut is the literal of its truth table in
+  the returned truth table storage (the complemented literal stands for
+  the complemented truth table). The cuts are minimum-base and the truth
+  tables are normalized to have zero in the first minterm.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t* Gia_ManComputeCutsTruth(Gia_Man_t* pGia, int nCutSize, int nCutNum, Vec_Mem_t** pvTtMem, int fVerbose) {
+    Gia_Sto_t* p = Gia_StoAlloc(pGia, nCutSize, nCutNum, 1, 1, fVerbose);
+    Vec_Wec_t* vCuts = p->vCuts;
+    Gia_Obj_t* pObj;
+    int i, iObj;
+    assert(nCutSize <= 6);
+    Gia_ManForEachObj(p->pGia, pObj, iObj)
+        Gia_StoRefObj(p, iObj);
+    Gia_StoComputeCutsConst0(p, 0);
+    Gia_ManForEachCiId(p->pGia, iObj, i)
+        Gia_StoComputeCutsCi(p, iObj);
+    Gia_ManForEachAnd(p->pGia, pObj, iObj)
+        Gia_StoComputeCutsNode(p, iObj);
+    if (p->fVerbose) {
+        printf("Computed %.0f cuts with up to %d inputs (%.2f per node) and %d truth tables.  ",
+               p->CutCount[3], nCutSize, p->CutCount[3] / Abc_MaxInt(1, Gia_ManAndNum(pGia)), Vec_MemEntryNum(p->vTtMem));
+        Abc_PrintTime(0, "Time", Abc_Clock() - p->clkStart);
+    }
+    *pvTtMem = p->vTtMem;
+    Vec_IntFree(p->vRefs);
+    ABC_FREE(p);
+    return vCuts;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
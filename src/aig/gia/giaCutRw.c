@@ -0,0 +1,695 @@
+/**CFile****************************************************************
+
+  FileName    [giaCutRw.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Rewriting with 5- and 6-input cuts.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaCutRw.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/vec/vecWec.h"
+#include "misc/util/utilTruth.h"
+#include "opt/dau/dau.h"
+
+#ifndef _WIN32
+#    include <unistd.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The nodes are visited in the topological order. For each cut of a node,
+    the cut function is semi-canonicized and its NPN class is looked up in
+    the library of structures. The gain is the number of nodes in the MFFC
+    of the node bounded by the cut minus the number of nodes of the structure
+    not already present in the AIG. The best cut of each node with positive
+    gain is committed, after which the AIG is rebuilt in one pass.
+
+    The library is filled lazily: the structure of a new class is derived
+    from its DSD and, if the conflict limit is given, improved by exact
+    synthesis. Functions of up to three inputs are not given to exact
+    synthesis, because their DSD-based structures are already small. The
+    library can be saved to a file and reloaded by the next run. Each
+    structure is a list of integers: the number of inputs, the conflict
+    limit used for exact synthesis, two fanin literals of each AND node,
+    and the output literal. Variable 0 is the constant, variables 1..nVars
+    are the inputs, followed by the AND nodes.
+*/
+
+#define GIA_CRW_MAGIC 0x57524347 // "GCRW"
+#define GIA_CRW_VERSION 1
+#define GIA_CRW_NODE_MAX 1000 // the max number of AND nodes in a structure
+
+typedef struct Gia_CrwMan_t_ Gia_CrwMan_t;
+struct Gia_CrwMan_t_ {
+    // parameters
+    int nCutSize;  // the max cut size
+    int nCutNum;   // the max number of cuts per node
+    int nBTLimit;  // the conflict limit of exact synthesis
+    int fUseZeros; // accept zero-cost replacements
+    int fVerbose;  // verbose output
+    // the AIG and its cuts
+    Gia_Man_t* pGia;     // the AIG being rewritten
+    Vec_Wec_t* vCuts;    // the cuts of each node
+    Vec_Mem_t* vTtMem;   // the cut functions
+    Vec_Int_t* vTtClass; // the library class of each cut function (-1 if not known)
+    Vec_Int_t* vTtConf;  // the NPN configuration of each cut function
+    Vec_Int_t* vBest;    // the offset of the selected cut of each node (-1 if none)
+    // the library of structures
+    Vec_Mem_t* vLibTts;  // the canonical functions
+    Vec_Wec_t* vLibStrs; // the structures of these functions
+    int fLibChanged;     // the library was extended or improved
+    // temporaries
+    Vec_Int_t* vLits;   // the literals of the structure nodes
+    Vec_Int_t* vLeaves; // the leaves
+    Vec_Int_t* vCover;  // the cover
+    // statistics
+    int nLibLoaded;
+    int nLibAdded;
+    int nLibExact;
+    int nRewritten;
+    int nGainEst;
+    abctime timeCuts;
+    abctime timeLib;
+    abctime timeEval;
+    abctime timeBuild;
+};
+
+#define Sdb_ForEachCut(pList, pCut, i) for (i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += pCut[0] + 2)
+
+// the NPN configuration: the phase in bits 0-6 and the permutation in 3-bit fields starting from bit 8
+static inline int Gia_CrwConfPhase(int Conf) { return Conf & 0x7F; }
+static inline int Gia_CrwConfPerm(int Conf, int i) { return (Conf >> (8 + 3 * i)) & 7; }
+
+static inline int Gia_CrwStrVarNum(Vec_Int_t* vStr) { return Vec_IntEntry(vStr, 0); }
+static inline int Gia_CrwStrLimit(Vec_Int_t* vStr) { return Vec_IntEntry(vStr, 1); }
+static inline int Gia_CrwStrAndNum(Vec_Int_t* vStr) { return (Vec_IntSize(vStr) - 3) / 2; }
+static inline int Gia_CrwStrOut(Vec_Int_t* vStr) { return Vec_IntEntryLast(vStr); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the structure.]
+
+  Description [Returns 0 if the structure is malformed, which cannot be
+  confused with a valid structure because its output is never constant.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word Gia_CrwStrTruth(Vec_Int_t* vStr) {
+    word pSims[1 + 6 + GIA_CRW_NODE_MAX];
+    int i, iLit0, iLit1, nVars = Gia_CrwStrVarNum(vStr), nAnds = Gia_CrwStrAndNum(vStr);
+    if (nVars < 2 || nVars > 6 || Vec_IntSize(vStr) < 3 || (Vec_IntSize(vStr) - 3) % 2 || nAnds > GIA_CRW_NODE_MAX)
+        return 0;
+    pSims[0] = 0;
+    for (i = 0; i < nVars; i++)
+        pSims[1 + i] = s_Truths6[i];
+    for (i = 0; i < nAnds; i++) {
+        iLit0 = Vec_IntEntry(vStr, 2 + 2 * i);
+        iLit1 = Vec_IntEntry(vStr, 3 + 2 * i);
+        if (iLit0 < 0 || iLit1 < 0 || Abc_Lit2Var(iLit0) > nVars + i || Abc_Lit2Var(iLit1) > nVars + i)
+            return 0;
+        pSims[1 + nVars + i] = (Abc_LitIsCompl(iLit0) ? ~pSims[Abc_Lit2Var(iLit0)] : pSims[Abc_Lit2Var(iLit0)]) &
+                               (Abc_LitIsCompl(iLit1) ? ~pSims[Abc_Lit2Var(iLit1)] : pSims[Abc_Lit2Var(iLit1)]);
+    }
+    iLit0 = Gia_CrwStrOut(vStr);
+    if (iLit0 < 0 || Abc_Lit2Var(iLit0) > nVars + nAnds)
+        return 0;
+    return Abc_LitIsCompl(iLit0) ? ~pSims[Abc_Lit2Var(iLit0)] : pSims[Abc_Lit2Var(iLit0)];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the structure from the single-output AIG.]
+
+  Description [The AIG should have nVars primary inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CrwStrFromGia(Gia_Man_t* pSmall, int Limit, Vec_Int_t* vStr) {
+    Gia_Man_t* pClean = Gia_ManCleanup(pSmall);
+    Gia_Obj_t* pObj;
+    int i, nAnds = 0;
+    assert(Gia_ManCoNum(pClean) == 1);
+    Vec_IntClear(vStr);
+    Vec_IntPush(vStr, Gia_ManCiNum(pClean));
+    Vec_IntPush(vStr, Limit);
+    Gia_ManConst0(pClean)->Value = 0;
+    Gia_ManForEachCi(pClean, pObj, i)
+        pObj->Value = Abc_Var2Lit(1 + i, 0);
+    Gia_ManForEachAnd(pClean, pObj, i) {
+        pObj->Value = Abc_Var2Lit(1 + Gia_ManCiNum(pClean) + nAnds++, 0);
+        Vec_IntPush(vStr, Gia_ObjFanin0Copy(pObj));
+        Vec_IntPush(vStr, Gia_ObjFanin1Copy(pObj));
+    }
+    Vec_IntPush(vStr, Gia_ObjFanin0Copy(Gia_ManCo(pClean, 0)));
+    Gia_ManStop(pClean);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the structure of the canonical function.]
+
+  Description [The structure is derived from the DSD of the function. If
+  the conflict limit is given, the function has more than three inputs,
+  and the structure is larger than the lower bound, exact synthesis looks
+  for a smaller one. When vStr already has a structure, it is only
+  improved by exact synthesis.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CrwLibDerive(Gia_CrwMan_t* p, word Truth, int nVars, Vec_Int_t* vStr) {
+    extern Gia_Man_t* Gia_ManFindExactSmaller(word * pTruth, int nVars, int nMaxGates, int nBTLimit);
+    Gia_Man_t* pSmall;
+    int i, iLit;
+    if (Vec_IntSize(vStr) == 0) {
+        pSmall = Gia_ManStart(100);
+        Gia_ManHashAlloc(pSmall);
+        Vec_IntClear(p->vLeaves);
+        for (i = 0; i < nVars; i++)
+            Vec_IntPush(p->vLeaves, Gia_ManAppendCi(pSmall));
+        iLit = Dsm_ManTruthToGia(pSmall, &Truth, p->vLeaves, p->vCover);
+        Gia_ManAppendCo(pSmall, iLit);
+        Gia_CrwStrFromGia(pSmall, 0, vStr);
+        Gia_ManStop(pSmall);
+        assert(Gia_CrwStrTruth(vStr) == Truth);
+    }
+    assert(Gia_CrwStrVarNum(vStr) == nVars);
+    // every node of the structure is needed when there are nVars - 1 of them
+    if (p->nBTLimit > Gia_CrwStrLimit(vStr) && nVars > 3 && Gia_CrwStrAndNum(vStr) > nVars - 1) {
+        word pTruth[4] = {Truth, Truth, Truth, Truth};
+        pSmall = Gia_ManFindExactSmaller(pTruth, nVars, Gia_CrwStrAndNum(vStr), p->nBTLimit);
+        if (pSmall) {
+            Vec_Int_t* vStrNew = Vec_IntAlloc(32);
+            Gia_CrwStrFromGia(pSmall, p->nBTLimit, vStrNew);
+            Gia_ManStop(pSmall);
+            if (Gia_CrwStrTruth(vStrNew) == Truth && Gia_CrwStrAndNum(vStrNew) < Gia_CrwStrAndNum(vStr)) {
+                Vec_IntClear(vStr);
+                Vec_IntAppend(vStr, vStrNew);
+                p->nLibExact++;
+            }
+            Vec_IntFree(vStrNew);
+        }
+        Vec_IntWriteEntry(vStr, 1, p->nBTLimit);
+        p->fLibChanged = 1;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the library class of the canonical function.]
+
+  Description [Adds the class to the library if it is not there.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CrwLibFind(Gia_CrwMan_t* p, word Truth, int nVars) {
+    int iClass = Vec_MemHashInsert(p->vLibTts, &Truth);
+    if (iClass == Vec_WecSize(p->vLibStrs)) {
+        Vec_WecPushLevel(p->vLibStrs);
+        p->nLibAdded++;
+        p->fLibChanged = 1;
+    }
+    Gia_CrwLibDerive(p, Truth, nVars, Vec_WecEntry(p->vLibStrs, iClass));
+    return iClass;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads and writes the library of structures.]
+
+  Description [The file contains the magic number, the version, and the
+  number of classes, followed by the canonical truth table, the size, and
+  the structure of each class, in the native byte order. The structures
+  are checked by simulation when the file is read. The reader returns 0
+  if the file exists but is not a library, in which case it should not be
+  overwritten. The writer first writes the library under a temporary name
+  and then renames it, so that concurrent runs never see a partial file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CrwLibRead(Gia_CrwMan_t* p, char* pFileName) {
+    Vec_Int_t* vStr;
+    FILE* pFile = fopen(pFileName, "rb");
+    int i, nSize, pHead[3];
+    word Truth;
+    if (pFile == NULL)
+        return 1;
+    if (fread(pHead, sizeof(int), 3, pFile) != 3 || pHead[0] != GIA_CRW_MAGIC || pHead[1] != GIA_CRW_VERSION) {
+        printf("The file \"%s\" is not a library of structures and will not be updated.\n", pFileName);
+        fclose(pFile);
+        return 0;
+    }
+    for (i = 0; i < pHead[2]; i++) {
+        if (fread(&Truth, sizeof(word), 1, pFile) != 1 || fread(&nSize, sizeof(int), 1, pFile) != 1 || nSize < 3 || nSize > 3 + 2 * GIA_CRW_NODE_MAX)
+            break;
+        vStr = Vec_IntStart(nSize);
+        if (fread(Vec_IntArray(vStr), sizeof(int), nSize, pFile) != (size_t)nSize || Gia_CrwStrTruth(vStr) != Truth || *Vec_MemHashLookup(p->vLibTts, &Truth) != -1) {
+            Vec_IntFree(vStr);
+            break;
+        }
+        Vec_MemHashInsert(p->vLibTts, &Truth);
+        Vec_IntAppend(Vec_WecPushLevel(p->vLibStrs), vStr);
+        Vec_IntFree(vStr);
+    }
+    if (i < pHead[2]) {
+        printf("The library of structures \"%s\" is corrupted after %d classes.\n", pFileName, i);
+        p->fLibChanged = 1;
+    }
+    p->nLibLoaded = Vec_WecSize(p->vLibStrs);
+    fclose(pFile);
+    return 1;
+}
+int Gia_CrwLibWrite(Gia_CrwMan_t* p, char* pFileName) {
+    Vec_Int_t* vStr;
+    FILE* pFile;
+    char* pFileTemp;
+    int i, nSize, RetValue, pHead[3] = {GIA_CRW_MAGIC, GIA_CRW_VERSION, Vec_WecSize(p->vLibStrs)};
+    size_t nWritten = 0, nExpected = sizeof(int) * 3;
+    pFileTemp = ABC_ALLOC(char, strlen(pFileName) + 20);
+#ifdef _WIN32
+    sprintf(pFileTemp, "%s.tmp", pFileName);
+#else
+    sprintf(pFileTemp, "%s.%d", pFileName, (int)getpid());
+#endif
+    pFile = fopen(pFileTemp, "wb");
+    if (pFile == NULL) {
+        printf("Cannot open file \"%s\" for writing.\n", pFileTemp);
+        ABC_FREE(pFileTemp);
+        return 0;
+    }
+    nWritten += sizeof(int) * fwrite(pHead, sizeof(int), 3, pFile);
+    Vec_WecForEachLevel(p->vLibStrs, vStr, i) {
+        nSize = Vec_IntSize(vStr);
+        nWritten += sizeof(word) * fwrite(Vec_MemReadEntry(p->vLibTts, i), sizeof(word), 1, pFile);
+        nWritten += sizeof(int) * fwrite(&nSize, sizeof(int), 1, pFile);
+        nWritten += sizeof(int) * fwrite(Vec_IntArray(vStr), sizeof(int), nSize, pFile);
+        nExpected += sizeof(word) + sizeof(int) * (1 + nSize);
+    }
+    RetValue = (fclose(pFile) == 0 && nWritten == nExpected && rename(pFileTemp, pFileName) == 0);
+    if (!RetValue) {
+        printf("Cannot write the library of structures into file \"%s\".\n", pFileName);
+        remove(pFileTemp);
+    }
+    ABC_FREE(pFileTemp);
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_CrwMan_t* Gia_CrwManStart(Gia_Man_t* pGia, int nCutSize, int nCutNum, int nBTLimit, int fUseZeros, int fVerbose) {
+    Gia_CrwMan_t* p = ABC_CALLOC(Gia_CrwMan_t, 1);
+    p->nCutSize = nCutSize;
+    p->nCutNum = nCutNum;
+    p->nBTLimit = nBTLimit;
+    p->fUseZeros = fUseZeros;
+    p->fVerbose = fVerbose;
+    p->pGia = Gia_ManRehash(pGia, 0);
+    p->vBest = Vec_IntStartFull(Gia_ManObjNum(p->pGia));
+    p->vLibTts = Vec_MemAllocForTTSimple(6);
+    p->vLibStrs = Vec_WecAlloc(1000);
+    p->vLits = Vec_IntAlloc(100);
+    p->vLeaves = Vec_IntAlloc(6);
+    p->vCover = Vec_IntAlloc(1 << 16);
+    return p;
+}
+void Gia_CrwManStop(Gia_CrwMan_t* p) {
+    Gia_ManStop(p->pGia);
+    if (p->vCuts)
+        Vec_WecFree(p->vCuts);
+    if (p->vTtMem) {
+        Vec_MemHashFree(p->vTtMem);
+        Vec_MemFree(p->vTtMem);
+    }
+    Vec_IntFreeP(&p->vTtClass);
+    Vec_IntFreeP(&p->vTtConf);
+    Vec_IntFree(p->vBest);
+    Vec_MemHashFree(p->vLibTts);
+    Vec_MemFree(p->vLibTts);
+    Vec_WecFree(p->vLibStrs);
+    Vec_IntFree(p->vLits);
+    Vec_IntFree(p->vLeaves);
+    Vec_IntFree(p->vCover);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the library class of the cut function.]
+
+  Description [Computes the NPN configuration of the function, which maps
+  input i of the structure into leaf Perm(i) complemented if bit i of the
+  phase is set, and complements the output if bit nVars is set. The result
+  is computed once for each function.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CrwCutClass(Gia_CrwMan_t* p, int iFunc, int nVars, int* pConf) {
+    int i, Conf, iTruth = Abc_Lit2Var(iFunc);
+    if (Vec_IntEntry(p->vTtClass, iTruth) == -1) {
+        abctime clk = Abc_Clock();
+        word Truth = *Vec_MemReadEntry(p->vTtMem, iTruth);
+        char pPerm[16];
+        Conf = Abc_TtCanonicize(&Truth, nVars, pPerm);
+        Truth = Abc_Tt6Stretch(Truth, nVars);
+        for (i = 0; i < nVars; i++)
+            Conf |= (int)pPerm[i] << (8 + 3 * i);
+        Vec_IntWriteEntry(p->vTtConf, iTruth, Conf);
+        Vec_IntWriteEntry(p->vTtClass, iTruth, Gia_CrwLibFind(p, Truth, nVars));
+        p->timeLib += Abc_Clock() - clk;
+    }
+    *pConf = Vec_IntEntry(p->vTtConf, iTruth);
+    return Vec_IntEntry(p->vTtClass, iTruth);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dereferences and references the MFFC bounded by the cut.]
+
+  Description [The leaves should be marked with the current traversal ID.
+  The nodes rewritten earlier are not expanded, because their fanins are
+  no longer those of the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CrwNodeDeref_rec(Gia_CrwMan_t* p, int iObj) {
+    Gia_Obj_t* pObj = Gia_ManObj(p->pGia, iObj);
+    int k, iFan, Counter = 1;
+    for (k = 0; k < 2; k++) {
+        iFan = k ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+        if (Gia_ObjRefDecId(p->pGia, iFan) > 0 || Gia_ObjIsTravIdCurrentId(p->pGia, iFan) || !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFan)))
+            continue;
+        Counter += Vec_IntEntry(p->vBest, iFan) >= 0 ? 1 : Gia_CrwNodeDeref_rec(p, iFan);
+    }
+    return Counter;
+}
+void Gia_CrwNodeRef_rec(Gia_CrwMan_t* p, int iObj) {
+    Gia_Obj_t* pObj = Gia_ManObj(p->pGia, iObj);
+    int k, iFan;
+    for (k = 0; k < 2; k++) {
+        iFan = k ? Gia_ObjFaninId1(pObj, iObj) : Gia_ObjFaninId0(pObj, iObj);
+        if (Gia_ObjRefIncId(p->pGia, iFan) > 0 || Gia_ObjIsTravIdCurrentId(p->pGia, iFan) || !Gia_ObjIsAnd(Gia_ManObj(p->pGia, iFan)))
+            continue;
+        if (Vec_IntEntry(p->vBest, iFan) == -1)
+            Gia_CrwNodeRef_rec(p, iFan);
+    }
+}
+void Gia_CrwMarkLeaves(Gia_CrwMan_t* p, int* pCut) {
+    int k;
+    Gia_ManIncrementTravId(p->pGia);
+    for (k = 1; k <= pCut[0]; k++)
+        Gia_ObjSetTravIdCurrentId(p->pGia, pCut[k]);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Counts the structure nodes missing in the AIG.]
+
+  Description [Should be called when the MFFC is dereferenced. Fills in
+  p->vLits with the literals of the structure nodes present in the AIG
+  and -1 for the missing ones. A node is present if it precedes the root
+  and is either referenced or a leaf. Returns the number of missing nodes
+  and the output literal in *piLitOut (-1 if missing).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CrwCutCost(Gia_CrwMan_t* p, int iObj, int* pCut, int* piLitOut) {
+    Vec_Int_t* vStr;
+    int i, iLit0, iLit1, iLit, Conf, nAdded = 0;
+    int nLeaves = pCut[0], iFunc = pCut[nLeaves + 1];
+    if (nLeaves < 2) { // constant or buffer
+        *piLitOut = nLeaves ? Abc_Var2Lit(pCut[1], Abc_LitIsCompl(iFunc)) : Abc_LitIsCompl(iFunc);
+        return 0;
+    }
+    vStr = Vec_WecEntry(p->vLibStrs, Gia_CrwCutClass(p, iFunc, nLeaves, &Conf));
+    assert(Gia_CrwStrVarNum(vStr) == nLeaves);
+    Vec_IntClear(p->vLits);
+    Vec_IntPush(p->vLits, 0);
+    for (i = 0; i < nLeaves; i++)
+        Vec_IntPush(p->vLits, Abc_Var2Lit(pCut[1 + Gia_CrwConfPerm(Conf, i)], (Gia_CrwConfPhase(Conf) >> i) & 1));
+    for (i = 0; i < Gia_CrwStrAndNum(vStr); i++) {
+        iLit0 = Vec_IntEntry(vStr, 2 + 2 * i);
+        iLit1 = Vec_IntEntry(vStr, 3 + 2 * i);
+        iLit0 = Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit0)) == -1 ? -1 : Abc_LitNotCond(Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0));
+        iLit1 = Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit1)) == -1 ? -1 : Abc_LitNotCond(Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit1)), Abc_LitIsCompl(iLit1));
+        iLit = -1;
+        if (iLit0 >= 0 && iLit1 >= 0 && Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1)) {
+            iLit = Gia_ManHashLookupInt(p->pGia, iLit0, iLit1);
+            if (iLit == 0 || Abc_Lit2Var(iLit) >= iObj || (Gia_ObjRefNumId(p->pGia, Abc_Lit2Var(iLit)) == 0 && !Gia_ObjIsTravIdCurrentId(p->pGia, Abc_Lit2Var(iLit))))
+                iLit = -1;
+        }
+        nAdded += iLit == -1;
+        Vec_IntPush(p->vLits, iLit);
+    }
+    iLit = Gia_CrwStrOut(vStr);
+    iLit = Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit)) == -1 ? -1 : Abc_LitNotCond(Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit));
+    *piLitOut = iLit == -1 ? -1 : Abc_LitNotCond(iLit, ((Gia_CrwConfPhase(Conf) >> nLeaves) & 1) ^ Abc_LitIsCompl(iFunc));
+    return nAdded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Commits the replacement of the node.]
+
+  Description [Dereferences the MFFC and references the nodes of the AIG
+  used by the missing structure nodes, so that they are not counted as
+  freed by the later replacements.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CrwNodeCommit(Gia_CrwMan_t* p, int iObj, int* pCut, int Offset) {
+    Vec_Int_t* vStr;
+    int i, k, iLit, iLitOut, Conf, nLeaves = pCut[0];
+    Gia_CrwMarkLeaves(p, pCut);
+    Gia_CrwNodeDeref_rec(p, iObj);
+    Gia_CrwCutCost(p, iObj, pCut, &iLitOut);
+    Vec_IntWriteEntry(p->vBest, iObj, Offset);
+    if (iLitOut >= 0) {
+        p->pGia->pRefs[Abc_Lit2Var(iLitOut)] += Gia_ObjRefNumId(p->pGia, iObj);
+        return;
+    }
+    vStr = Vec_WecEntry(p->vLibStrs, Gia_CrwCutClass(p, pCut[nLeaves + 1], nLeaves, &Conf));
+    for (i = 0; i < Gia_CrwStrAndNum(vStr); i++) {
+        if (Vec_IntEntry(p->vLits, 1 + nLeaves + i) >= 0)
+            continue;
+        for (k = 0; k < 2; k++) {
+            iLit = Vec_IntEntry(p->vLits, Abc_Lit2Var(Vec_IntEntry(vStr, 2 + 2 * i + k)));
+            if (iLit > 1)
+                Gia_ObjRefIncId(p->pGia, Abc_Lit2Var(iLit));
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the best replacement of the node.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CrwNodeEval(Gia_CrwMan_t* p, int iObj) {
+    int* pList = Vec_IntArray(Vec_WecEntry(p->vCuts, iObj));
+    int* pCut, i, nFreed, nAdded, iLitOut, GainBest = p->fUseZeros ? -1 : 0, OffsetBest = -1;
+    Sdb_ForEachCut(pList, pCut, i) {
+        if (pCut[0] == 1 && pCut[1] == iObj)
+            continue;
+        Gia_CrwMarkLeaves(p, pCut);
+        nFreed = Gia_CrwNodeDeref_rec(p, iObj);
+        nAdded = Gia_CrwCutCost(p, iObj, pCut, &iLitOut);
+        Gia_CrwNodeRef_rec(p, iObj);
+        if (GainBest < nFreed - nAdded)
+            GainBest = nFreed - nAdded, OffsetBest = pCut - pList;
+    }
+    if (OffsetBest == -1)
+        return;
+    Gia_CrwNodeCommit(p, iObj, pList + OffsetBest, OffsetBest);
+    p->nRewritten++;
+    p->nGainEst += GainBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the structure of the node in the new AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CrwNodeBuild(Gia_CrwMan_t* p, Gia_Man_t* pNew, int* pCut) {
+    Vec_Int_t* vStr;
+    int i, iLit0, iLit1, Conf, nLeaves = pCut[0], iFunc = pCut[nLeaves + 1];
+    if (nLeaves < 2)
+        return nLeaves ? Abc_LitNotCond(Gia_ManObj(p->pGia, pCut[1])->Value, Abc_LitIsCompl(iFunc)) : Abc_LitIsCompl(iFunc);
+    vStr = Vec_WecEntry(p->vLibStrs, Gia_CrwCutClass(p, iFunc, nLeaves, &Conf));
+    Vec_IntClear(p->vLits);
+    Vec_IntPush(p->vLits, 0);
+    for (i = 0; i < nLeaves; i++)
+        Vec_IntPush(p->vLits, Abc_LitNotCond(Gia_ManObj(p->pGia, pCut[1 + Gia_CrwConfPerm(Conf, i)])->Value, (Gia_CrwConfPhase(Conf) >> i) & 1));
+    for (i = 0; i < Gia_CrwStrAndNum(vStr); i++) {
+        iLit0 = Vec_IntEntry(vStr, 2 + 2 * i);
+        iLit1 = Vec_IntEntry(vStr, 3 + 2 * i);
+        iLit0 = Abc_LitNotCond(Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0));
+        iLit1 = Abc_LitNotCond(Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit1)), Abc_LitIsCompl(iLit1));
+        Vec_IntPush(p->vLits, Gia_ManHashAnd(pNew, iLit0, iLit1));
+    }
+    iLit0 = Gia_CrwStrOut(vStr);
+    iLit0 = Abc_LitNotCond(Vec_IntEntry(p->vLits, Abc_Lit2Var(iLit0)), Abc_LitIsCompl(iLit0));
+    return Abc_LitNotCond(iLit0, ((Gia_CrwConfPhase(Conf) >> nLeaves) & 1) ^ Abc_LitIsCompl(iFunc));
+}
+Gia_Man_t* Gia_CrwManBuild(Gia_CrwMan_t* p) {
+    Gia_Man_t *pNew, *pTemp;
+    Gia_Obj_t* pObj;
+    int i, Offset;
+    pNew = Gia_ManStart(Gia_ManObjNum(p->pGia));
+    pNew->pName = Abc_UtilStrsav(p->pGia->pName);
+    pNew->pSpec = Abc_UtilStrsav(p->pGia->pSpec);
+    Gia_ManHashAlloc(pNew);
+    Gia_ManConst0(p->pGia)->Value = 0;
+    Gia_ManForEachCi(p->pGia, pObj, i)
+        pObj->Value = Gia_ManAppendCi(pNew);
+    Gia_ManForEachAnd(p->pGia, pObj, i) {
+        if ((Offset = Vec_IntEntry(p->vBest, i)) >= 0)
+            pObj->Value = Gia_CrwNodeBuild(p, pNew, Vec_IntEntryP(Vec_WecEntry(p->vCuts, i), Offset));
+        else
+            pObj->Value = Gia_ManHashAnd(pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj));
+    }
+    Gia_ManForEachCo(p->pGia, pObj, i)
+        Gia_ManAppendCo(pNew, Gia_ObjFanin0Copy(pObj));
+    Gia_ManHashStop(pNew);
+    Gia_ManSetRegNum(pNew, Gia_ManRegNum(p->pGia));
+    pNew = Gia_ManCleanup(pTemp = pNew);
+    Gia_ManStop(pTemp);
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs rewriting with cuts of up to six inputs.]
+
+  Description [If the file name is given, the library of structures is
+  read from this file before rewriting and written back if it has changed.
+  Returns the original AIG if rewriting did not reduce it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManCutRewrite(Gia_Man_t* pGia, int nCutSize, int nCutNum, int nBTLimit, int fUseZeros, char* pFileName, int fVerbose) {
+    extern Vec_Wec_t* Gia_ManComputeCutsTruth(Gia_Man_t * pGia, int nCutSize, int nCutNum, Vec_Mem_t** pvTtMem, int fVerbose);
+    Gia_CrwMan_t* p;
+    Gia_Man_t* pNew;
+    Gia_Obj_t* pObj;
+    abctime clk, clkTotal = Abc_Clock();
+    int i;
+    assert(pGia->pMuxes == NULL);
+    assert(nCutSize >= 2 && nCutSize <= 6);
+    p = Gia_CrwManStart(pGia, nCutSize, nCutNum, nBTLimit, fUseZeros, fVerbose);
+    if (pFileName && !Gia_CrwLibRead(p, pFileName))
+        pFileName = NULL;
+    // compute the cuts
+    clk = Abc_Clock();
+    p->vCuts = Gia_ManComputeCutsTruth(p->pGia, nCutSize, nCutNum, &p->vTtMem, 0);
+    p->vTtClass = Vec_IntStartFull(Vec_MemEntryNum(p->vTtMem));
+    p->vTtConf = Vec_IntStart(Vec_MemEntryNum(p->vTtMem));
+    p->timeCuts = Abc_Clock() - clk;
+    // select the replacements
+    clk = Abc_Clock();
+    Gia_ManHashStart(p->pGia);
+    Gia_ManCreateRefs(p->pGia);
+    Gia_ManForEachAnd(p->pGia, pObj, i)
+        if (Gia_ObjRefNumId(p->pGia, i) > 0)
+            Gia_CrwNodeEval(p, i);
+    Gia_ManHashStop(p->pGia);
+    p->timeEval = Abc_Clock() - clk - p->timeLib;
+    // rebuild the AIG
+    clk = Abc_Clock();
+    pNew = Gia_CrwManBuild(p);
+    p->timeBuild = Abc_Clock() - clk;
+    if (pFileName && p->fLibChanged)
+        Gia_CrwLibWrite(p, pFileName);
+    if (fVerbose) {
+        printf("Nodes = %d -> %d.  Rewritten = %d.  Estimated gain = %d.  ",
+               Gia_ManAndNum(pGia), Gia_ManAndNum(pNew), p->nRewritten, p->nGainEst);
+        printf("Classes: Loaded = %d.  Added = %d.  Exact = %d.\n", p->nLibLoaded, p->nLibAdded, p->nLibExact);
+        ABC_PRTP("Cuts   ", p->timeCuts, Abc_Clock() - clkTotal);
+        ABC_PRTP("Library", p->timeLib, Abc_Clock() - clkTotal);
+        ABC_PRTP("Eval   ", p->timeEval, Abc_Clock() - clkTotal);
+        ABC_PRTP("Build  ", p->timeBuild, Abc_Clock() - clkTotal);
+        ABC_PRTP("TOTAL  ", Abc_Clock() - clkTotal, Abc_Clock() - clkTotal);
+    }
+    Gia_CrwManStop(p);
+    if (Gia_ManAndNum(pNew) >= Gia_ManAndNum(pGia) && !fUseZeros) {
+        Gia_ManStop(pNew);
+        return Gia_ManDup(pGia);
+    }
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -19,8 +19,25 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "giaAig.h"
 #include "base/main/main.h"
 #include "base/cmd/cmd.h"
+#include "map/if/if.h"
+#include "opt/sfm/sfm.h"
+#include "proof/dch/dch.h"
+#include "opt/dar/dar.h"
+#include "sat/cnf/cnf.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -28,6 +45,37 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_DEEP_THR_MAX 100    // the max number of threads
+#define GIA_DEEP_ITER_MAX 100000 // the max number of iterations
+#define GIA_DEEP_RESEED 20      // the number of iterations without improvement before reseeding
+
+typedef struct Gia_DeepMan_t_ Gia_DeepMan_t;
+struct Gia_DeepMan_t_ {
+    // parameters
+    int nNoImpr;  // the number of iterations without improvement
+    int TimeOut;  // the timeout in seconds
+    int nAnds;    // the quality goal
+    int fUseTwo;  // use two-input LUTs
+    int fVerbose; // verbose output
+    // the best result shared by the threads
+    Gia_Man_t* pBest;          // the best AIG found so far
+    volatile int nBestAnds;    // the number of its AND nodes
+    volatile int nBestVersion; // incremented each time the best AIG changes
+    volatile int nIters;       // the total number of iterations
+    volatile int nItersLast;   // the iteration of the last improvement
+    volatile int Status;       // the reason for stopping (0 = running)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex; // protects the best result
+#endif
+};
+
+typedef struct Gia_DeepThData_t_ {
+    Gia_DeepMan_t* p;
+    int iThread;
+    int Seed;
+    abctime clkTotal;
+} Gia_DeepThData_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -124,14 +172,292 @@ Gia_Man_t* Gia_ManDeepSynOne(int nNoImpr, int TimeOut, int nAnds, int Seed, int
                nAndsMin, nAnds, i, (float)1.0 * (Abc_Clock() - clkStart) / CLOCKS_PER_SEC);
     return pNew;
 }
-Gia_Man_t* Gia_ManDeepSyn(Gia_Man_t* pGia, int nIters, int nNoImpr, int TimeOut, int nAnds, int Seed, int fUseTwo, int fVerbose) {
+/**Function*************************************************************
+
+  Synopsis    [Reentrant version of Abc_Random().]
+
+  Description [Generates the same sequence as Abc_Random() when the
+  state is initialized by Gia_ManDeepSynRandomStart().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Gia_ManDeepSynRandom(unsigned* pState) {
+    pState[0] = 36969 * (pState[0] & 65535) + (pState[0] >> 16);
+    pState[1] = 18000 * (pState[1] & 65535) + (pState[1] >> 16);
+    return (pState[0] << 16) + pState[1];
+}
+static inline void Gia_ManDeepSynRandomStart(unsigned* pState, int Seed) {
+    int s;
+    pState[0] = 3716960521u;
+    pState[1] = 2174103536u;
+    for (s = 0; s < 11 + Seed; s++)
+        Gia_ManDeepSynRandom(pState);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies one randomized synthesis script.]
+
+  Description [Performs the same steps as the script used by
+  Gia_ManDeepSynOne() by calling the GIA procedures directly, without
+  going through the global frame, which makes it safe to use in several
+  threads at the same time. The step "compress2rs" that needs the
+  logic network is replaced by two rounds of "&dc2". The equivalent
+  command line is written into pCommand.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManDeepSynScript(Gia_Man_t* p, unsigned Rand, int KLut, char* pCommand) {
+    extern Gia_Man_t* Gia_ManPerformMfs(Gia_Man_t * p, Sfm_Par_t * pPars);
+    Dch_Pars_t DchPars, *pDchPars = &DchPars;
+    If_Par_t IfPars, *pIfPars = &IfPars;
+    Sfm_Par_t SfmPars, *pSfmPars = &SfmPars;
+    Gia_Man_t *pNew, *pTemp;
+    int fDch = Rand & 1;
+    int fCom = (Rand >> 1) & 1;
+    int fFx = (Rand >> 2) & 1;
+    // &dch
+    Dch_ManSetDefaultParams(pDchPars);
+    pDchPars->fLightSynth = fDch;
+    pNew = Gia_ManPerformDch(p, pDchPars);
+    // &if -a -K <num>
+    Gia_ManSetIfParsDefault(pIfPars);
+    pIfPars->nLutSize = KLut;
+    pIfPars->pLutLib = NULL;
+    pIfPars->fArea = 1;
+    if (Gia_ManHasChoices(pNew))
+        pIfPars->fExpRed = 0;
+    pNew = Gia_ManPerformMapping(pTemp = pNew, pIfPars);
+    Gia_ManStop(pTemp);
+    // &mfs -e -W 20 -L 20
+    Sfm_ParSetDefault(pSfmPars);
+    pSfmPars->nTfoLevMax = 20;
+    pSfmPars->nDepthMax = 100;
+    pSfmPars->nWinSizeMax = 2000;
+    pSfmPars->nGrowthLevel = 20;
+    pSfmPars->fMoreEffort = 1;
+    pNew = Gia_ManPerformMfs(pTemp = pNew, pSfmPars);
+    Gia_ManStop(pTemp);
+    // &fx
+    if (fFx) {
+        pNew = Gia_ManPerformFx(pTemp = pNew, 1000000, 0, 0, 0, 0);
+        Gia_ManStop(pTemp);
+    }
+    // &dc2
+    pNew = Gia_ManCompress2(pTemp = pNew, 1, 0);
+    Gia_ManStop(pTemp);
+    if (fCom) {
+        pNew = Gia_ManCompress2(pTemp = pNew, 1, 0);
+        Gia_ManStop(pTemp);
+    }
+    sprintf(pCommand, "&dch%s; &if -a -K %d; &mfs -e -W 20 -L 20%s%s",
+            fDch ? " -f" : "", KLut, fFx ? "; &fx" : "", fCom ? "; &dc2; &dc2" : "; &dc2");
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs synthesis in one thread.]
+
+  Description [Each thread applies its own sequence of randomized
+  scripts to its current AIG. When the AIG is smaller than the best one,
+  it becomes the shared best result. When the thread does not improve
+  for some time, or when its AIG is much larger than the best one, it
+  restarts from the best result found by all threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_ManDeepSynLock(Gia_DeepMan_t* p) {
+#ifdef ABC_USE_PTHREADS
+    int RetValue = pthread_mutex_lock(&p->Mutex);
+    assert(RetValue == 0);
+    (void)RetValue;
+#endif
+}
+static inline void Gia_ManDeepSynUnlock(Gia_DeepMan_t* p) {
+#ifdef ABC_USE_PTHREADS
+    int RetValue = pthread_mutex_unlock(&p->Mutex);
+    assert(RetValue == 0);
+    (void)RetValue;
+#endif
+}
+void Gia_ManDeepSynWorker(Gia_DeepThData_t* pThData) {
+    Gia_DeepMan_t* p = pThData->p;
+    abctime clkStart = Abc_Clock();
+    abctime nTimeToStop = p->TimeOut ? clkStart + p->TimeOut * CLOCKS_PER_SEC : 0;
+    Gia_Man_t *pCur, *pNew;
+    char Command[1000];
+    unsigned State[2];
+    int i, KLut, nVersion, nCurBest, iCurLast = 0;
+    Gia_ManDeepSynRandomStart(State, pThData->Seed);
+    Gia_ManDeepSynLock(p);
+    pCur = Gia_ManDup(p->pBest);
+    nVersion = p->nBestVersion;
+    Gia_ManDeepSynUnlock(p);
+    nCurBest = Gia_ManAndNum(pCur);
+    for (i = 0; !p->Status; i++) {
+        // diversify the LUT sizes across the threads
+        KLut = p->fUseTwo ? 2 + ((i + pThData->iThread) % 5) : 3 + ((i + pThData->iThread) % 4);
+        pNew = Gia_ManDeepSynScript(pCur, Gia_ManDeepSynRandom(State), KLut, Command);
+        Gia_ManStop(pCur);
+        pCur = pNew;
+        if (nCurBest > Gia_ManAndNum(pCur)) {
+            nCurBest = Gia_ManAndNum(pCur);
+            iCurLast = i;
+        }
+        Gia_ManDeepSynLock(p);
+        p->nIters++;
+        if (p->nBestAnds > Gia_ManAndNum(pCur)) {
+            Gia_ManStop(p->pBest);
+            p->pBest = Gia_ManDup(pCur);
+            p->nBestAnds = Gia_ManAndNum(pCur);
+            p->nBestVersion++;
+            p->nItersLast = p->nIters;
+            nVersion = p->nBestVersion;
+            if (p->fVerbose) {
+                Abc_Print(1, "Thread %2d : ", pThData->iThread);
+                Abc_Print(1, "Iter %6d : ", p->nIters);
+                Abc_Print(1, "Time %8.2f sec : ", (float)1.0 * (Abc_Clock() - clkStart) / CLOCKS_PER_SEC);
+                Abc_Print(1, "And = %6d  ", Gia_ManAndNum(pCur));
+                Abc_Print(1, "Lev = %3d  ", Gia_ManLevelNum(pCur));
+                Abc_Print(1, "<== best : %s\n", Command);
+            }
+        }
+        if (p->Status == 0 && p->nAnds && p->nBestAnds <= p->nAnds)
+            p->Status = 1;
+        if (p->Status == 0 && p->nIters - p->nItersLast > p->nNoImpr)
+            p->Status = 2;
+        if (p->Status == 0 && nTimeToStop && Abc_Clock() > nTimeToStop)
+            p->Status = 3;
+        if (p->Status == 0 && p->nIters >= GIA_DEEP_ITER_MAX)
+            p->Status = 4;
+        // restart from the best result if this thread is behind
+        if (nVersion != p->nBestVersion && (i - iCurLast >= GIA_DEEP_RESEED || Gia_ManAndNum(pCur) > p->nBestAnds + p->nBestAnds / 10)) {
+            Gia_ManStop(pCur);
+            pCur = Gia_ManDup(p->pBest);
+            nVersion = p->nBestVersion;
+            nCurBest = Gia_ManAndNum(pCur);
+            iCurLast = i;
+        }
+        Gia_ManDeepSynUnlock(p);
+    }
+    Gia_ManStop(pCur);
+    pThData->clkTotal = Abc_Clock() - clkStart;
+}
+
+#ifdef ABC_USE_PTHREADS
+void* Gia_ManDeepSynWorkerThread(void* pArg) {
+    Gia_ManDeepSynWorker((Gia_DeepThData_t*)pArg);
+    // free the managers allocated by this thread
+    Cnf_ManFree();
+    Dar_LibStop();
+    pthread_exit(NULL);
+    assert(0);
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs synthesis with several threads.]
+
+  Description [The threads use different random seeds and share the
+  best result. Without pthreads, the threads are run one after another.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManDeepSynPar(Gia_Man_t* pGia, int nProcs, int nNoImpr, int TimeOut, int nAnds, int Seed, int fUseTwo, int fVerbose) {
+    Gia_DeepThData_t ThData[GIA_DEEP_THR_MAX];
+    Gia_DeepMan_t Man, *p = &Man;
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[GIA_DEEP_THR_MAX];
+    int status;
+#endif
+    Gia_Man_t* pBest;
+    abctime clkMax = 0;
+    int i;
+    assert(nProcs > 1 && nProcs <= GIA_DEEP_THR_MAX);
+    memset(p, 0, sizeof(Gia_DeepMan_t));
+    p->nNoImpr = nNoImpr;
+    p->TimeOut = TimeOut;
+    p->nAnds = nAnds;
+    p->fUseTwo = fUseTwo;
+    p->fVerbose = fVerbose;
+    p->pBest = Gia_ManDup(pGia);
+    p->nBestAnds = Gia_ManAndNum(pGia);
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].p = p;
+        ThData[i].iThread = i;
+        ThData[i].Seed = Seed + i;
+        ThData[i].clkTotal = 0;
+    }
+#ifdef ABC_USE_PTHREADS
+    status = pthread_mutex_init(&p->Mutex, NULL);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        status = pthread_create(WorkerThread + i, NULL, Gia_ManDeepSynWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    for (i = 0; i < nProcs; i++)
+        pthread_join(WorkerThread[i], NULL);
+    pthread_mutex_destroy(&p->Mutex);
+#else
+    for (i = 0; i < nProcs; i++) {
+        p->Status = 0;
+        Gia_ManDeepSynWorker(ThData + i);
+    }
+#endif
+    for (i = 0; i < nProcs; i++)
+        clkMax = Abc_MaxInt(clkMax, ThData[i].clkTotal);
+    if (p->Status == 1)
+        Abc_Print(1, "Quality goal (%d nodes <= %d nodes) is achieved after %d iterations and %.2f seconds.\n",
+                  p->nBestAnds, nAnds, p->nIters, (float)1.0 * clkMax / CLOCKS_PER_SEC);
+    else if (p->Status == 2)
+        Abc_Print(1, "Completed %d iterations without improvement in %.2f seconds.\n",
+                  nNoImpr, (float)1.0 * clkMax / CLOCKS_PER_SEC);
+    else if (p->Status == 3)
+        Abc_Print(1, "Runtime limit (%d sec) is reached after %d iterations.\n", TimeOut, p->nIters);
+    else if (p->Status == 4)
+        Abc_Print(1, "Iteration limit (%d iters) is reached after %.2f seconds.\n", GIA_DEEP_ITER_MAX, (float)1.0 * clkMax / CLOCKS_PER_SEC);
+    pBest = p->pBest;
+    return pBest;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManDeepSyn(Gia_Man_t* pGia, int nIters, int nNoImpr, int TimeOut, int nAnds, int Seed, int nProcs, int fUseTwo, int fVerbose) {
     Gia_Man_t* pInit = Gia_ManDup(pGia);
     Gia_Man_t* pBest = Gia_ManDup(pGia);
     Gia_Man_t* pThis;
     int i;
     for (i = 0; i < nIters; i++) {
-        Abc_FrameUpdateGia(Abc_FrameGetGlobalFrame(), Gia_ManDup(pInit));
-        pThis = Gia_ManDeepSynOne(nNoImpr, TimeOut, nAnds, Seed + i, fUseTwo, fVerbose);
+        if (nProcs > 1)
+            pThis = Gia_ManDeepSynPar(pInit, nProcs, nNoImpr, TimeOut, nAnds, Seed + i * nProcs, fUseTwo, fVerbose);
+        else {
+            Abc_FrameUpdateGia(Abc_FrameGetGlobalFrame(), Gia_ManDup(pInit));
+            pThis = Gia_ManDeepSynOne(nNoImpr, TimeOut, nAnds, Seed + i, fUseTwo, fVerbose);
+        }
         if (Gia_ManAndNum(pBest) > Gia_ManAndNum(pThis)) {
             Gia_ManStop(pBest);
             pBest = pThis;
@@ -0,0 +1,1017 @@
+/**CFile****************************************************************
+
+  FileName    [giaRetMin.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Min-area and min-delay retiming with initial state computation.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: giaRetMin.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/cnf/cnf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The AIG is viewed as the retiming graph, whose vertices are the AND nodes
+// and the host (the constant, the PIs, and the registers that are not retimed),
+// and whose edges are the fanins of the AND nodes and the COs, labeled with
+// the number of registers on them. The retimed registers are not represented
+// explicitly; after retiming, each vertex drives a chain of registers shared
+// by its fanouts. The lag of a vertex is the number of registers moved from
+// its fanouts to its fanins. The lag of the host is always zero.
+
+typedef struct Gia_RetMan_t_ Gia_RetMan_t;
+struct Gia_RetMan_t_ {
+    Gia_Man_t* pGia;       // the AIG
+    int nFixed;            // the number of registers that are not retimed
+    Vec_Bit_t* vFixed;     // the ROs of the registers that are not retimed
+    Vec_Int_t* vRoLits;    // for each retimed RO, the source literal it delays
+    Vec_Int_t* vRoWeights; // for each retimed RO, the number of registers after the source
+    Vec_Int_t* vEdges;     // for each fanin of an AND node or a CO, the source literal
+    Vec_Int_t* vWeights;   // for each fanin of an AND node or a CO, the number of registers
+    Vec_Wec_t* vRecs;      // for each source, its values in the previous frames kept in registers
+    Vec_Int_t* vLags;      // the lags of the AND nodes (entry 0 is the lag of the host)
+    Vec_Int_t* vDepths;    // the number of registers driven by each source after retiming
+    Vec_Int_t* vArrs;      // the arrival times of the AND nodes after retiming
+    Vec_Int_t* vOrder;     // the AND nodes in a topological order after retiming
+    Vec_Int_t* vStart;     // the first fanout of each AND node after retiming
+    Vec_Int_t* vFanouts;   // the combinational fanouts of the AND nodes after retiming
+    Vec_Int_t* vDegrees;   // the number of combinational fanins not yet ordered
+    Vec_Wec_t* vMemo;      // for each object, the pairs (frame, literal) in the init-state AIG
+};
+
+// the max-flow problem used to find the registers to move in one step
+typedef struct Gia_RetFlow_t_ Gia_RetFlow_t;
+struct Gia_RetFlow_t_ {
+    int nVerts;       // the number of vertices (0 is the source; 1 is the sink)
+    Vec_Int_t* vArcs; // the arcs (from, to, capacity) before the network is built
+    int* pStart;      // the first arc of each vertex
+    int* pHead;       // the head of each arc
+    int* pRev;        // the reverse arc
+    int* pCap;        // the residual capacity of each arc
+    int* pCur;        // the current arc of each vertex
+    int* pLevel;      // the distance from the source in the residual network
+    int* pQueue;      // the BFS queue
+    int* pPath;       // the arcs of the current augmenting path
+};
+
+#define GIA_RET_INF ABC_INFINITY
+
+#define Gia_RetManForEachEdge(p, e) \
+    for (e = 0; e < Vec_IntSize(p->vEdges); e++) if (Vec_IntEntry(p->vEdges, e) == -1) {} else
+
+static inline int Gia_RetObjIsAnd(Gia_RetMan_t* p, int iObj) { return Gia_ObjIsAnd(Gia_ManObj(p->pGia, iObj)); }
+static inline int Gia_RetLag(Gia_RetMan_t* p, int iObj) { return Vec_IntEntry(p->vLags, Gia_RetObjIsAnd(p, iObj) ? iObj : 0); }
+static inline int Gia_RetEdgeSrc(Gia_RetMan_t* p, int e) { return Abc_Lit2Var(Vec_IntEntry(p->vEdges, e)); }
+static inline int Gia_RetEdgeWeight(Gia_RetMan_t* p, int e) { return Vec_IntEntry(p->vWeights, e) + Gia_RetLag(p, e >> 1) - Gia_RetLag(p, Gia_RetEdgeSrc(p, e)); }
+static inline int Gia_RetIsRetimedRo(Gia_RetMan_t* p, int iObj) { return Gia_ObjIsRo(p->pGia, Gia_ManObj(p->pGia, iObj)) && !Vec_BitEntry(p->vFixed, iObj); }
+static inline int Gia_RetRecord(Gia_RetMan_t* p, int iObj, int Depth) {
+    Vec_Int_t* vRec = Vec_WecEntry(p->vRecs, iObj);
+    return Depth <= Vec_IntSize(vRec) ? Vec_IntEntry(vRec, Depth - 1) : -1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the max-flow problem.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_RetFlow_t* Gia_RetFlowAlloc(int nVerts) {
+    Gia_RetFlow_t* p = ABC_CALLOC(Gia_RetFlow_t, 1);
+    p->nVerts = nVerts;
+    p->vArcs = Vec_IntAlloc(1000);
+    return p;
+}
+static inline void Gia_RetFlowAddArc(Gia_RetFlow_t* p, int iFrom, int iTo, int Cap) {
+    Vec_IntPushThree(p->vArcs, iFrom, iTo, Cap);
+}
+static void Gia_RetFlowFree(Gia_RetFlow_t* p) {
+    Vec_IntFree(p->vArcs);
+    ABC_FREE(p->pStart);
+    ABC_FREE(p->pHead);
+    ABC_FREE(p->pRev);
+    ABC_FREE(p->pCap);
+    ABC_FREE(p->pCur);
+    ABC_FREE(p->pLevel);
+    ABC_FREE(p->pQueue);
+    ABC_FREE(p->pPath);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the residual network from the list of arcs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RetFlowBuild(Gia_RetFlow_t* p) {
+    int i, iFrom, iTo, Cap, e, r, nArcs = Vec_IntSize(p->vArcs) / 3;
+    p->pStart = ABC_CALLOC(int, p->nVerts + 1);
+    p->pHead = ABC_ALLOC(int, 2 * nArcs);
+    p->pRev = ABC_ALLOC(int, 2 * nArcs);
+    p->pCap = ABC_ALLOC(int, 2 * nArcs);
+    p->pCur = ABC_ALLOC(int, p->nVerts);
+    p->pLevel = ABC_ALLOC(int, p->nVerts);
+    p->pQueue = ABC_ALLOC(int, p->nVerts);
+    p->pPath = ABC_ALLOC(int, p->nVerts);
+    for (i = 0; i < nArcs; i++) {
+        p->pStart[Vec_IntEntry(p->vArcs, 3 * i + 0) + 1]++;
+        p->pStart[Vec_IntEntry(p->vArcs, 3 * i + 1) + 1]++;
+    }
+    for (i = 0; i < p->nVerts; i++)
+        p->pStart[i + 1] += p->pStart[i];
+    memcpy(p->pCur, p->pStart, sizeof(int) * p->nVerts);
+    for (i = 0; i < nArcs; i++) {
+        iFrom = Vec_IntEntry(p->vArcs, 3 * i + 0);
+        iTo = Vec_IntEntry(p->vArcs, 3 * i + 1);
+        Cap = Vec_IntEntry(p->vArcs, 3 * i + 2);
+        e = p->pCur[iFrom]++;
+        r = p->pCur[iTo]++;
+        p->pHead[e] = iTo, p->pCap[e] = Cap, p->pRev[e] = r;
+        p->pHead[r] = iFrom, p->pCap[r] = 0, p->pRev[r] = e;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the distances from the source.]
+
+  Description [Returns 1 if the sink is reachable in the residual network.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetFlowBfs(Gia_RetFlow_t* p) {
+    int e, v, iHead = 0, iTail = 0;
+    for (v = 0; v < p->nVerts; v++)
+        p->pLevel[v] = -1;
+    p->pLevel[0] = 0;
+    p->pQueue[iTail++] = 0;
+    while (iHead < iTail) {
+        v = p->pQueue[iHead++];
+        for (e = p->pStart[v]; e < p->pStart[v + 1]; e++)
+            if (p->pCap[e] > 0 && p->pLevel[p->pHead[e]] == -1) {
+                p->pLevel[p->pHead[e]] = p->pLevel[v] + 1;
+                p->pQueue[iTail++] = p->pHead[e];
+            }
+    }
+    return p->pLevel[1] >= 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds one augmenting path along the BFS levels.]
+
+  Description [Returns the amount of flow pushed along the path.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetFlowAugment(Gia_RetFlow_t* p) {
+    int i, e, v = 0, nPath = 0, Flow = GIA_RET_INF;
+    while (v != 1) {
+        for (; p->pCur[v] < p->pStart[v + 1]; p->pCur[v]++) {
+            e = p->pCur[v];
+            if (p->pCap[e] > 0 && p->pLevel[p->pHead[e]] == p->pLevel[v] + 1)
+                break;
+        }
+        if (p->pCur[v] == p->pStart[v + 1]) {
+            // dead end - retreat
+            p->pLevel[v] = -1;
+            if (nPath == 0)
+                return 0;
+            v = p->pHead[p->pRev[p->pPath[--nPath]]];
+            p->pCur[v]++;
+            continue;
+        }
+        p->pPath[nPath++] = p->pCur[v];
+        v = p->pHead[p->pCur[v]];
+    }
+    for (i = 0; i < nPath; i++)
+        Flow = Abc_MinInt(Flow, p->pCap[p->pPath[i]]);
+    for (i = 0; i < nPath; i++) {
+        p->pCap[p->pPath[i]] -= Flow;
+        p->pCap[p->pRev[p->pPath[i]]] += Flow;
+    }
+    return Flow;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the maximum flow using Dinic's algorithm.]
+
+  Description [Returns the value of the flow. Upon return, the vertices
+  on the source side of the minimum cut have non-negative levels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetFlowSolve(Gia_RetFlow_t* p) {
+    int Flow = 0, Delta;
+    Gia_RetFlowBuild(p);
+    while (Gia_RetFlowBfs(p)) {
+        memcpy(p->pCur, p->pStart, sizeof(int) * p->nVerts);
+        while ((Delta = Gia_RetFlowAugment(p)) > 0)
+            Flow += Delta;
+        assert(Flow < GIA_RET_INF);
+    }
+    return Flow;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the registers that form loops without logic.]
+
+  Description [Such registers are not retimed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RetManFixLoops(Gia_RetMan_t* p) {
+    Vec_Int_t* vState = Vec_IntStart(Gia_ManObjNum(p->pGia));
+    Vec_Int_t* vPath = Vec_IntAlloc(100);
+    Gia_Obj_t* pObj;
+    int i, k, iObj;
+    Gia_ManForEachRo(p->pGia, pObj, i) {
+        Vec_IntClear(vPath);
+        iObj = Gia_ObjId(p->pGia, pObj);
+        while (Gia_ObjIsRo(p->pGia, Gia_ManObj(p->pGia, iObj)) && Vec_IntEntry(vState, iObj) == 0) {
+            Vec_IntWriteEntry(vState, iObj, 1);
+            Vec_IntPush(vPath, iObj);
+            iObj = Gia_ObjFaninId0p(p->pGia, Gia_ObjRoToRi(p->pGia, Gia_ManObj(p->pGia, iObj)));
+        }
+        if (Vec_IntEntry(vState, iObj) == 1) {
+            Vec_BitWriteEntry(p->vFixed, iObj, 1);
+            p->nFixed++;
+        }
+        Vec_IntForEachEntry(vPath, iObj, k)
+            Vec_IntWriteEntry(vState, iObj, 2);
+    }
+    Vec_IntFree(vState);
+    Vec_IntFree(vPath);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the source and the number of registers of a fanin.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RetManFanin(Gia_RetMan_t* p, int iFaninLit, int* piLit, int* pWeight) {
+    int iFanin = Abc_Lit2Var(iFaninLit);
+    if (Gia_RetIsRetimedRo(p, iFanin)) {
+        assert(Vec_IntEntry(p->vRoLits, iFanin) >= 0);
+        *piLit = Abc_LitNotCond(Vec_IntEntry(p->vRoLits, iFanin), Abc_LitIsCompl(iFaninLit));
+        *pWeight = Vec_IntEntry(p->vRoWeights, iFanin);
+    } else {
+        *piLit = iFaninLit;
+        *pWeight = 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the value of the source in a previous frame.]
+
+  Description [The register delaying the source by Depth frames holds
+  the value fCompl in the initial state. Returns 0 if another register
+  with the same delay holds the opposite value.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetManRecord(Gia_RetMan_t* p, int iObj, int Depth, int fCompl) {
+    Vec_Int_t* vRec = Vec_WecEntry(p->vRecs, iObj);
+    if (iObj == 0)
+        return !fCompl;
+    while (Vec_IntSize(vRec) < Depth)
+        Vec_IntPush(vRec, -1);
+    if (Vec_IntEntry(vRec, Depth - 1) == -1)
+        Vec_IntWriteEntry(vRec, Depth - 1, fCompl);
+    return Vec_IntEntry(vRec, Depth - 1) == fCompl;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Traces each retimed register back to its source.]
+
+  Description [The registers that record conflicting values of the
+  same source in the same frame are not retimed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RetManResolve(Gia_RetMan_t* p) {
+    Vec_Int_t* vPath = Vec_IntAlloc(100);
+    Gia_Obj_t* pObj;
+    int i, k, iObj, iLit, Weight;
+    Gia_ManForEachRo(p->pGia, pObj, i) {
+        // collect the unresolved registers leading to this one
+        Vec_IntClear(vPath);
+        iObj = Gia_ObjId(p->pGia, pObj);
+        while (Gia_RetIsRetimedRo(p, iObj) && Vec_IntEntry(p->vRoLits, iObj) == -1) {
+            Vec_IntPush(vPath, iObj);
+            iObj = Gia_ObjFaninId0p(p->pGia, Gia_ObjRoToRi(p->pGia, Gia_ManObj(p->pGia, iObj)));
+        }
+        // resolve them starting from the one closest to the source
+        Vec_IntForEachEntryReverse(vPath, iObj, k) {
+            Gia_RetManFanin(p, Gia_ObjFaninLit0p(p->pGia, Gia_ObjRoToRi(p->pGia, Gia_ManObj(p->pGia, iObj))), &iLit, &Weight);
+            if (!Gia_RetManRecord(p, Abc_Lit2Var(iLit), ++Weight, Abc_LitIsCompl(iLit))) {
+                Vec_BitWriteEntry(p->vFixed, iObj, 1);
+                p->nFixed++;
+                continue;
+            }
+            Vec_IntWriteEntry(p->vRoLits, iObj, iLit);
+            Vec_IntWriteEntry(p->vRoWeights, iObj, Weight);
+        }
+    }
+    Vec_IntFree(vPath);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the retiming manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_RetMan_t* Gia_RetManStart(Gia_Man_t* pGia) {
+    Gia_RetMan_t* p;
+    Gia_Obj_t* pObj;
+    int i, iLit, Weight, nObjs = Gia_ManObjNum(pGia);
+    assert(pGia->pMuxes == NULL);
+    p = ABC_CALLOC(Gia_RetMan_t, 1);
+    p->pGia = pGia;
+    p->vFixed = Vec_BitStart(nObjs);
+    p->vRoLits = Vec_IntStartFull(nObjs);
+    p->vRoWeights = Vec_IntStart(nObjs);
+    p->vEdges = Vec_IntStartFull(2 * nObjs);
+    p->vWeights = Vec_IntStart(2 * nObjs);
+    p->vRecs = Vec_WecStart(nObjs);
+    p->vLags = Vec_IntStart(nObjs);
+    p->vDepths = Vec_IntStart(nObjs);
+    p->vArrs = Vec_IntStart(nObjs);
+    p->vOrder = Vec_IntAlloc(Gia_ManAndNum(pGia));
+    p->vStart = Vec_IntAlloc(nObjs + 1);
+    p->vFanouts = Vec_IntAlloc(2 * Gia_ManAndNum(pGia));
+    p->vDegrees = Vec_IntAlloc(nObjs);
+    // find the registers to be retimed
+    Gia_RetManFixLoops(p);
+    Gia_RetManResolve(p);
+    // create the edges
+    Gia_ManForEachAnd(pGia, pObj, i) {
+        Gia_RetManFanin(p, Gia_ObjFaninLit0(pObj, i), &iLit, &Weight);
+        Vec_IntWriteEntry(p->vEdges, 2 * i + 0, iLit);
+        Vec_IntWriteEntry(p->vWeights, 2 * i + 0, Weight);
+        Gia_RetManFanin(p, Gia_ObjFaninLit1(pObj, i), &iLit, &Weight);
+        Vec_IntWriteEntry(p->vEdges, 2 * i + 1, iLit);
+        Vec_IntWriteEntry(p->vWeights, 2 * i + 1, Weight);
+    }
+    Gia_ManForEachCo(pGia, pObj, i) {
+        if (Gia_ObjIsRi(pGia, pObj) && !Vec_BitEntry(p->vFixed, Gia_ObjId(pGia, Gia_ObjRiToRo(pGia, pObj))))
+            continue;
+        Gia_RetManFanin(p, Gia_ObjFaninLit0p(pGia, pObj), &iLit, &Weight);
+        Vec_IntWriteEntry(p->vEdges, 2 * Gia_ObjId(pGia, pObj), iLit);
+        Vec_IntWriteEntry(p->vWeights, 2 * Gia_ObjId(pGia, pObj), Weight);
+    }
+    return p;
+}
+static void Gia_RetManStop(Gia_RetMan_t* p) {
+    Vec_BitFree(p->vFixed);
+    Vec_IntFree(p->vRoLits);
+    Vec_IntFree(p->vRoWeights);
+    Vec_IntFree(p->vEdges);
+    Vec_IntFree(p->vWeights);
+    Vec_WecFree(p->vRecs);
+    Vec_IntFree(p->vLags);
+    Vec_IntFree(p->vDepths);
+    Vec_IntFree(p->vArrs);
+    Vec_IntFree(p->vOrder);
+    Vec_IntFree(p->vStart);
+    Vec_IntFree(p->vFanouts);
+    Vec_IntFree(p->vDegrees);
+    if (p->vMemo)
+        Vec_WecFree(p->vMemo);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the number of registers driven by each source.]
+
+  Description [Sources without fanouts get -1. Returns the total number
+  of registers after retiming.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetManComputeDepths(Gia_RetMan_t* p) {
+    int e, Depth, nRegs = p->nFixed;
+    Vec_IntFill(p->vDepths, Gia_ManObjNum(p->pGia), -1);
+    Gia_RetManForEachEdge(p, e) {
+        assert(Gia_RetEdgeWeight(p, e) >= 0);
+        Vec_IntUpdateEntry(p->vDepths, Gia_RetEdgeSrc(p, e), Gia_RetEdgeWeight(p, e));
+    }
+    Vec_IntForEachEntry(p->vDepths, Depth, e) if (Depth > 0)
+        nRegs += Depth;
+    return nRegs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Orders the AND nodes topologically after retiming.]
+
+  Description [The lags are legal, so the retimed logic has no
+  combinational loops.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_RetManOrder(Gia_RetMan_t* p) {
+    Gia_Man_t* pGia = p->pGia;
+    Gia_Obj_t* pObj;
+    int i, k, e, iObj, iSrc, iFan, nObjs = Gia_ManObjNum(pGia);
+    Vec_IntFill(p->vDegrees, nObjs, 0);
+    Vec_IntFill(p->vStart, nObjs + 1, 0);
+    Gia_ManForEachAnd(pGia, pObj, i) for (k = 0; k < 2; k++) {
+        e = 2 * i + k;
+        iSrc = Gia_RetEdgeSrc(p, e);
+        if (!Gia_RetObjIsAnd(p, iSrc) || Gia_RetEdgeWeight(p, e) > 0)
+            continue;
+        Vec_IntAddToEntry(p->vDegrees, i, 1);
+        Vec_IntAddToEntry(p->vStart, iSrc + 1, 1);
+    }
+    for (i = 0; i < nObjs; i++)
+        Vec_IntAddToEntry(p->vStart, i + 1, Vec_IntEntry(p->vStart, i));
+    Vec_IntFill(p->vFanouts, Vec_IntEntry(p->vStart, nObjs), 0);
+    Gia_ManForEachAnd(pGia, pObj, i) for (k = 0; k < 2; k++) {
+        e = 2 * i + k;
+        iSrc = Gia_RetEdgeSrc(p, e);
+        if (!Gia_RetObjIsAnd(p, iSrc) || Gia_RetEdgeWeight(p, e) > 0)
+            continue;
+        Vec_IntWriteEntry(p->vFanouts, Vec_IntEntry(p->vStart, iSrc), i);
+        Vec_IntAddToEntry(p->vStart, iSrc, 1);
+    }
+    for (i = nObjs; i > 0; i--)
+        Vec_IntWriteEntry(p->vStart, i, Vec_IntEntry(p->vStart, i - 1));
+    Vec_IntWriteEntry(p->vStart, 0, 0);
+    // collect the nodes in the order of their fanins becoming available
+    Vec_IntClear(p->vOrder);
+    Gia_ManForEachAnd(pGia, pObj, i) if (Vec_IntEntry(p->vDegrees, i) == 0)
+        Vec_IntPush(p->vOrder, i);
+    Vec_IntForEachEntry(p->vOrder, iObj, i) for (k = Vec_IntEntry(p->vStart, iObj); k < Vec_IntEntry(p->vStart, iObj + 1); k++) {
+        iFan = Vec_IntEntry(p->vFanouts, k);
+        Vec_IntAddToEntry(p->vDegrees, iFan, -1);
+        if (Vec_IntEntry(p->vDegrees, iFan) == 0)
+            Vec_IntPush(p->vOrder, iFan);
+    }
+    assert(Vec_IntSize(p->vOrder) == Gia_ManAndNum(pGia));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the arrival times after retiming.]
+
+  Description [Assumes unit delay of the AND nodes. Returns the clock
+  period. The largest arrival time at the COs is returned in *pArrHost.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetManArrivals(Gia_RetMan_t* p, int* pArrHost) {
+    Gia_Obj_t* pObj;
+    int i, k, e, iObj, iSrc, Arr, ArrMax = 0;
+    Vec_IntForEachEntry(p->vOrder, iObj, i) {
+        Arr = 0;
+        for (k = 0; k < 2; k++) {
+            e = 2 * iObj + k;
+            iSrc = Gia_RetEdgeSrc(p, e);
+            if (Gia_RetObjIsAnd(p, iSrc) && Gia_RetEdgeWeight(p, e) == 0)
+                Arr = Abc_MaxInt(Arr, Vec_IntEntry(p->vArrs, iSrc));
+        }
+        Vec_IntWriteEntry(p->vArrs, iObj, Arr + 1);
+        ArrMax = Abc_MaxInt(ArrMax, Arr + 1);
+    }
+    *pArrHost = 0;
+    Gia_ManForEachCo(p->pGia, pObj, i) {
+        e = 2 * Gia_ObjId(p->pGia, pObj);
+        if (Vec_IntEntry(p->vEdges, e) == -1)
+            continue;
+        iSrc = Gia_RetEdgeSrc(p, e);
+        if (Gia_RetObjIsAnd(p, iSrc) && Gia_RetEdgeWeight(p, e) == 0)
+            *pArrHost = Abc_MaxInt(*pArrHost, Vec_IntEntry(p->vArrs, iSrc));
+    }
+    return ArrMax;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the lags satisfying the clock period.]
+
+  Description [Implements the FEAS procedure of Leiserson and Saxe, which
+  is the Bellman-Ford algorithm applied to the retiming constraints without
+  deriving them explicitly: each iteration increments the lags of the
+  vertices whose arrival time exceeds the period. The iterations start from
+  the current lags, so that solutions for larger periods are refined
+  incrementally. As in Bellman-Ford, the period is infeasible if it is not
+  met after as many iterations as there are vertices (the AND nodes and the
+  host). Each iteration keeps the lags legal. Returns 1 if the period is
+  met.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetManFeasible(Gia_RetMan_t* p, int Period) {
+    Vec_Bit_t* vInc = Vec_BitStart(Gia_ManObjNum(p->pGia));
+    int i, k, e, iObj, iSrc, ArrHost, fInc, RetValue = 0;
+    int nIters = Gia_ManAndNum(p->pGia) + 1;
+    for (i = 0; i <= nIters; i++) {
+        Gia_RetManOrder(p);
+        if (Gia_RetManArrivals(p, &ArrHost) <= Period) {
+            RetValue = 1;
+            break;
+        }
+        if (i == nIters)
+            break;
+        // the host is incremented together with the nodes it reaches without registers
+        Vec_IntForEachEntry(p->vOrder, iObj, k) {
+            fInc = Vec_IntEntry(p->vArrs, iObj) > Period;
+            for (e = 2 * iObj; !fInc && ArrHost > Period && e < 2 * iObj + 2; e++) {
+                iSrc = Gia_RetEdgeSrc(p, e);
+                if (Gia_RetEdgeWeight(p, e) == 0)
+                    fInc = !Gia_RetObjIsAnd(p, iSrc) || Vec_BitEntry(vInc, iSrc);
+            }
+            Vec_BitWriteEntry(vInc, iObj, fInc);
+        }
+        // incrementing the lag of the host is the same as decrementing the other lags
+        Vec_IntForEachEntry(p->vOrder, iObj, k)
+            Vec_IntAddToEntry(p->vLags, iObj, Vec_BitEntry(vInc, iObj) - (ArrHost > Period));
+    }
+    Vec_BitFree(vInc);
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the source in the given frame.]
+
+  Description [Frame 0 is the initial frame of the original AIG. The values
+  in the negative frames are recorded in the registers, computed by the
+  logic moved backward, or chosen freely.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetManInit_rec(Gia_RetMan_t* p, Gia_Man_t* pInit, int iObj, int iFrame) {
+    Gia_Obj_t* pObj = Gia_ManObj(p->pGia, iObj);
+    Vec_Int_t* vMemo = Vec_WecEntry(p->vMemo, iObj);
+    int k, e, iLit, iLits[2];
+    for (k = 0; k < Vec_IntSize(vMemo); k += 2)
+        if (Vec_IntEntry(vMemo, k) == iFrame)
+            return Vec_IntEntry(vMemo, k + 1);
+    if (Gia_ObjIsConst0(pObj))
+        return 0;
+    if (Gia_ObjIsAnd(pObj) && iFrame >= -Abc_MaxInt(0, Gia_RetLag(p, iObj))) {
+        // the value is computed by the node
+        for (k = 0; k < 2; k++) {
+            e = 2 * iObj + k;
+            iLits[k] = Gia_RetManInit_rec(p, pInit, Gia_RetEdgeSrc(p, e), iFrame - Vec_IntEntry(p->vWeights, e));
+            iLits[k] = Abc_LitNotCond(iLits[k], Abc_LitIsCompl(Vec_IntEntry(p->vEdges, e)));
+        }
+        iLit = Gia_ManHashAnd(pInit, iLits[0], iLits[1]);
+    } else {
+        // the value is recorded in a register or is free
+        assert(iFrame < 0);
+        iLit = Gia_RetRecord(p, iObj, -iFrame);
+        if (iLit == -1)
+            iLit = Gia_ManAppendCi(pInit);
+    }
+    Vec_WecPush(p->vMemo, iObj, iFrame);
+    Vec_WecPush(p->vMemo, iObj, iLit);
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the initial state of the retimed registers.]
+
+  Description [The register delaying vertex v by d frames holds the value
+  of v in frame -d - lag(v) of the original AIG. The vertices retimed
+  backward recompute the values kept in the original registers, which
+  leads to a SAT problem. Returns the initial values of the registers in
+  the chains, or NULL if the initial state cannot be found.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t* Gia_RetManInitState(Gia_RetMan_t* p, int nChains, int fVerbose) {
+    int nConfLimit = 1000000;
+    Gia_Man_t *pInit, *pTemp;
+    Gia_Obj_t* pObj;
+    Vec_Int_t *vCiValues, *vInits = NULL;
+    int i, k, iLit, Value, status, nDepth, nConstrs = 0, iConstr = 0;
+    if (p->vMemo)
+        Vec_WecFree(p->vMemo);
+    p->vMemo = Vec_WecStart(Gia_ManObjNum(p->pGia));
+    pInit = Gia_ManStart(1000);
+    Gia_ManHashAlloc(pInit);
+    // the recomputed values should agree with the values recorded in the registers
+    Gia_ManForEachAnd(p->pGia, pObj, i) {
+        nDepth = Abc_MinInt(Gia_RetLag(p, i), Vec_IntSize(Vec_WecEntry(p->vRecs, i)));
+        for (k = 1; k <= nDepth; k++) if ((Value = Gia_RetRecord(p, i, k)) >= 0) {
+                iLit = Gia_RetManInit_rec(p, pInit, i, -k);
+                iConstr = Gia_ManHashOr(pInit, iConstr, Abc_LitNotCond(iLit, Value));
+                nConstrs++;
+            }
+    }
+    Gia_ManAppendCo(pInit, iConstr);
+    // the values of the registers in the chains
+    Gia_ManForEachObj(p->pGia, pObj, i) for (k = 1; k <= Vec_IntEntry(p->vDepths, i); k++)
+        Gia_ManAppendCo(pInit, Gia_RetManInit_rec(p, pInit, i, -k - Gia_RetLag(p, i)));
+    Gia_ManHashStop(pInit);
+    assert(Gia_ManCoNum(pInit) == nChains + 1);
+    vCiValues = Vec_IntStart(Gia_ManCiNum(pInit));
+    if (iConstr == 1)
+        goto finish;
+    if (iConstr != 0) {
+        Cnf_Dat_t* pCnf;
+        sat_solver* pSat;
+        abctime clk = Abc_Clock();
+        pInit = Gia_ManCleanup(pTemp = pInit);
+        Gia_ManStop(pTemp);
+        pCnf = (Cnf_Dat_t*)Mf_ManGenerateCnf(pInit, 8, 0, 0, 0, 0);
+        pSat = (sat_solver*)Cnf_DataWriteIntoSolver(pCnf, 1, 0);
+        // the first CO should be zero
+        iLit = Abc_Var2Lit(1, 1);
+        status = pSat ? sat_solver_addclause(pSat, &iLit, &iLit + 1) : 0;
+        if (status)
+            status = sat_solver_solve(pSat, NULL, NULL, (ABC_INT64_T)nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0);
+        if (status == l_True)
+            Gia_ManForEachCi(pInit, pObj, i)
+                Vec_IntWriteEntry(vCiValues, i, sat_solver_var_value(pSat, pCnf->nVars - Gia_ManCiNum(pInit) + i));
+        if (fVerbose) {
+            printf("Initial state: Free = %d. Constraints = %d. Nodes = %d. %s  ", Gia_ManCiNum(pInit),
+                   nConstrs, Gia_ManAndNum(pInit), status == l_True ? "Satisfiable." : "Failed.      ");
+            Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+        }
+        if (pSat)
+            sat_solver_delete(pSat);
+        Cnf_DataFree(pCnf);
+        pInit->pData = NULL;
+        if (status != l_True)
+            goto finish;
+    }
+    Gia_ManSetPhasePattern(pInit, vCiValues);
+    vInits = Vec_IntAlloc(nChains);
+    Gia_ManForEachCo(pInit, pObj, i) if (i > 0)
+        Vec_IntPush(vInits, pObj->fPhase);
+finish:
+    Vec_IntFree(vCiValues);
+    Gia_ManStop(pInit);
+    return vInits;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal of the edge in the retimed AIG.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_RetManEdgeLit(Gia_RetMan_t* p, Vec_Int_t* vChains, Vec_Int_t* vRegs, int e) {
+    int iSrc = Gia_RetEdgeSrc(p, e), Weight = Gia_RetEdgeWeight(p, e);
+    int iLit = Weight ? Vec_IntEntry(vRegs, Vec_IntEntry(vChains, iSrc) + Weight - 1) : Gia_ManObj(p->pGia, iSrc)->Value;
+    return Abc_LitNotCond(iLit, Abc_LitIsCompl(Vec_IntEntry(p->vEdges, e)));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the AIG retimed according to the lags.]
+
+  Description [Returns NULL if the initial state cannot be computed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t* Gia_RetManDerive(Gia_RetMan_t* p, int fVerbose) {
+    Gia_Man_t *pGia = p->pGia, *pNew, *pTemp;
+    Vec_Int_t *vChains, *vRegs, *vInits;
+    Gia_Obj_t* pObj;
+    int i, k, iObj, Depth, nChains = 0;
+    Gia_RetManComputeDepths(p);
+    Gia_RetManOrder(p);
+    // assign the registers in the chains
+    vChains = Vec_IntStartFull(Gia_ManObjNum(pGia));
+    Vec_IntForEachEntry(p->vDepths, Depth, i) if (Depth > 0) {
+            Vec_IntWriteEntry(vChains, i, nChains);
+            nChains += Depth;
+        }
+    vInits = Gia_RetManInitState(p, nChains, fVerbose);
+    if (vInits == NULL) {
+        Vec_IntFree(vChains);
+        return NULL;
+    }
+    // create the new manager
+    pNew = Gia_ManStart(Gia_ManObjNum(pGia) + nChains);
+    pNew->pName = Abc_UtilStrsav(pGia->pName);
+    pNew->pSpec = Abc_UtilStrsav(pGia->pSpec);
+    Gia_ManHashAlloc(pNew);
+    Gia_ManFillValue(pGia);
+    Gia_ManConst0(pGia)->Value = 0;
+    Gia_ManForEachPi(pGia, pObj, i)
+        pObj->Value = Gia_ManAppendCi(pNew);
+    Gia_ManForEachRo(pGia, pObj, i) if (Vec_BitEntry(p->vFixed, Gia_ObjId(pGia, pObj)))
+        pObj->Value = Gia_ManAppendCi(pNew);
+    // registers initialized to 1 are complemented
+    vRegs = Vec_IntAlloc(nChains);
+    for (i = 0; i < nChains; i++)
+        Vec_IntPush(vRegs, Abc_LitNotCond(Gia_ManAppendCi(pNew), Vec_IntEntry(vInits, i)));
+    Vec_IntForEachEntry(p->vOrder, iObj, i)
+        Gia_ManObj(pGia, iObj)->Value = Gia_ManHashAnd(pNew, Gia_RetManEdgeLit(p, vChains, vRegs, 2 * iObj), Gia_RetManEdgeLit(p, vChains, vRegs, 2 * iObj + 1));
+    Gia_ManForEachPo(pGia, pObj, i)
+        Gia_ManAppendCo(pNew, Gia_RetManEdgeLit(p, vChains, vRegs, 2 * Gia_ObjId(pGia, pObj)));
+    Gia_ManForEachRi(pGia, pObj, i) if (Vec_BitEntry(p->vFixed, Gia_ObjId(pGia, Gia_ObjRiToRo(pGia, pObj))))
+        Gia_ManAppendCo(pNew, Gia_RetManEdgeLit(p, vChains, vRegs, 2 * Gia_ObjId(pGia, pObj)));
+    Gia_ManForEachObj(pGia, pObj, i) for (k = 0; k < Vec_IntEntry(p->vDepths, i); k++) {
+            iObj = Vec_IntEntry(vChains, i) + k;
+            Gia_ManAppendCo(pNew, Abc_LitNotCond(k ? Vec_IntEntry(vRegs, iObj - 1) : pObj->Value, Vec_IntEntry(vInits, iObj)));
+        }
+    Gia_ManHashStop(pNew);
+    Gia_ManSetRegNum(pNew, p->nFixed + nChains);
+    Vec_IntFree(vChains);
+    Vec_IntFree(vRegs);
+    Vec_IntFree(vInits);
+    pNew = Gia_ManCleanup(pTemp = pNew);
+    Gia_ManStop(pTemp);
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the vertices to be retimed by one frame.]
+
+  Description [Selects the set of vertices, whose lags are decremented
+  (forward retiming) or incremented (backward retiming), to minimize the
+  number of registers with fanout sharing. This is a maximum-weight closure
+  problem solved as the minimum cut. When moving forward, each vertex costs
+  one register, and each source, whose fanouts with the largest number of
+  registers are all selected, saves one register. When moving backward, each
+  vertex saves one register, and each source, whose fanout with the largest
+  number of registers is selected, costs one register. Returns the reduction
+  in the number of registers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_RetManAreaStep(Gia_RetMan_t* p, int fForward) {
+    Gia_Man_t* pGia = p->pGia;
+    Gia_RetFlow_t* pFlow;
+    Vec_Bit_t* vMark;
+    Gia_Obj_t* pObj;
+    int i, e, iSrc, iDst, Weight, Flow, nGain = 0;
+    // vertex 2+2*i is the choice to retime AND node i; vertex 3+2*i is the registers of source i
+    pFlow = Gia_RetFlowAlloc(2 + 2 * Gia_ManObjNum(pGia));
+    vMark = Vec_BitStart(Gia_ManObjNum(pGia));
+    Gia_RetManComputeDepths(p);
+    if (fForward) {
+        // the sources whose registers cannot be moved because they are needed by the COs
+        Gia_ManForEachCo(pGia, pObj, i) {
+            e = 2 * Gia_ObjId(pGia, pObj);
+            if (Vec_IntEntry(p->vEdges, e) != -1 && Gia_RetEdgeWeight(p, e) == Vec_IntEntry(p->vDepths, Gia_RetEdgeSrc(p, e)))
+                Vec_BitWriteEntry(vMark, Gia_RetEdgeSrc(p, e), 1);
+        }
+        Gia_ManForEachAnd(pGia, pObj, i) {
+            Gia_RetFlowAddArc(pFlow, 2 + 2 * i, 1, 1);
+            for (e = 2 * i; e < 2 * i + 2; e++) {
+                iSrc = Gia_RetEdgeSrc(p, e);
+                Weight = Gia_RetEdgeWeight(p, e);
+                if (Weight == 0 && Gia_RetObjIsAnd(p, iSrc))
+                    Gia_RetFlowAddArc(pFlow, 2 + 2 * i, 2 + 2 * iSrc, GIA_RET_INF);
+                else if (Weight == 0)
+                    Gia_RetFlowAddArc(pFlow, 2 + 2 * i, 1, GIA_RET_INF);
+                if (Weight == Vec_IntEntry(p->vDepths, iSrc) && !Vec_BitEntry(vMark, iSrc))
+                    Gia_RetFlowAddArc(pFlow, 3 + 2 * iSrc, 2 + 2 * i, GIA_RET_INF);
+            }
+        }
+        Gia_ManForEachObj(pGia, pObj, i) if (Vec_IntEntry(p->vDepths, i) >= 0 && !Vec_BitEntry(vMark, i)) {
+                Gia_RetFlowAddArc(pFlow, 0, 3 + 2 * i, 1);
+                nGain++;
+            }
+    } else {
+        Gia_ManForEachAnd(pGia, pObj, i) if (Vec_IntEntry(p->vDepths, i) >= 0) {
+                Gia_RetFlowAddArc(pFlow, 0, 2 + 2 * i, 1);
+                nGain++;
+            }
+        Gia_RetManForEachEdge(p, e) {
+            iSrc = Gia_RetEdgeSrc(p, e);
+            iDst = e >> 1;
+            Weight = Gia_RetEdgeWeight(p, e);
+            if (!Gia_RetObjIsAnd(p, iDst)) {
+                if (Weight == 0 && Gia_RetObjIsAnd(p, iSrc))
+                    Gia_RetFlowAddArc(pFlow, 2 + 2 * iSrc, 1, GIA_RET_INF);
+                continue;
+            }
+            if (Weight == 0 && Gia_RetObjIsAnd(p, iSrc))
+                Gia_RetFlowAddArc(pFlow, 2 + 2 * iSrc, 2 + 2 * iDst, GIA_RET_INF);
+            if (Weight == Vec_IntEntry(p->vDepths, iSrc)) {
+                Gia_RetFlowAddArc(pFlow, 2 + 2 * iDst, 3 + 2 * iSrc, GIA_RET_INF);
+                if (!Vec_BitEntry(vMark, iSrc))
+                    Gia_RetFlowAddArc(pFlow, 3 + 2 * iSrc, 1, 1);
+                Vec_BitWriteEntry(vMark, iSrc, 1);
+            }
+        }
+    }
+    Flow = Gia_RetFlowSolve(pFlow);
+    // the vertices on the source side of the cut are retimed
+    if (nGain > Flow) {
+        Gia_ManForEachAnd(pGia, pObj, i) if (pFlow->pLevel[2 + 2 * i] >= 0)
+            Vec_IntAddToEntry(p->vLags, i, fForward ? -1 : 1);
+    }
+    Gia_RetFlowFree(pFlow);
+    Vec_BitFree(vMark);
+    return nGain - Flow;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs min-area retiming.]
+
+  Description [Repeatedly moves the registers forward by one frame, as long
+  as this reduces their number, and then does the same moving them backward.
+  The initial state after backward retiming is computed using SAT; if it
+  does not exist, backward retiming stops.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManRetimeMinArea(Gia_Man_t* pGia, int nMaxIters, int fForwardOnly, int fBackwardOnly, int fVerbose) {
+    Gia_RetMan_t* p;
+    Gia_Man_t *pNew, *pTemp;
+    int i, n, Gain;
+    abctime clk;
+    pNew = Gia_ManDup(pGia);
+    for (n = 0; n < 2; n++) {
+        if ((n == 0 && fBackwardOnly) || (n == 1 && fForwardOnly))
+            continue;
+        for (i = 0; i < nMaxIters; i++) {
+            clk = Abc_Clock();
+            p = Gia_RetManStart(pNew);
+            Gain = Gia_RetManAreaStep(p, n == 0);
+            pTemp = Gain > 0 ? Gia_RetManDerive(p, fVerbose) : NULL;
+            Gia_RetManStop(p);
+            if (pTemp == NULL || Gia_ManRegNum(pTemp) >= Gia_ManRegNum(pNew)) {
+                if (fVerbose && Gain <= 0)
+                    printf("%s retiming stopped because no registers can be saved.\n", n == 0 ? "Forward" : "Backward");
+                else if (fVerbose && pTemp == NULL)
+                    printf("%s retiming stopped because the initial state cannot be computed.\n", n == 0 ? "Forward" : "Backward");
+                else if (fVerbose)
+                    printf("%s retiming stopped because the retimed AIG does not have fewer registers.\n", n == 0 ? "Forward" : "Backward");
+                if (pTemp)
+                    Gia_ManStop(pTemp);
+                break;
+            }
+            if (fVerbose) {
+                printf("%s %2d : And = %6d -> %6d. Reg = %6d -> %6d. ", n == 0 ? "Forward " : "Backward", i + 1,
+                       Gia_ManAndNum(pNew), Gia_ManAndNum(pTemp), Gia_ManRegNum(pNew), Gia_ManRegNum(pTemp));
+                ABC_PRT("Time", Abc_Clock() - clk);
+            }
+            Gia_ManStop(pNew);
+            pNew = pTemp;
+        }
+    }
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs min-delay retiming.]
+
+  Description [Assumes unit delay of the AND nodes. If nDelayLim is given,
+  tries to meet this clock period; otherwise, finds the smallest period by
+  binary search.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManRetimeMinDelay(Gia_Man_t* pGia, int nDelayLim, int fVerbose) {
+    Gia_RetMan_t* p;
+    Gia_Man_t* pNew;
+    Vec_Int_t* vBest;
+    int Lo, Hi, Mid, ArrHost, DelayInit, DelayBest;
+    abctime clk = Abc_Clock();
+    p = Gia_RetManStart(pGia);
+    Gia_RetManOrder(p);
+    DelayInit = DelayBest = Gia_RetManArrivals(p, &ArrHost);
+    vBest = Vec_IntDup(p->vLags);
+    Lo = nDelayLim > 0 ? nDelayLim : 1;
+    Hi = nDelayLim > 0 ? nDelayLim : DelayInit - 1;
+    while (Lo <= Hi) {
+        Mid = (Lo + Hi) / 2;
+        Vec_IntClear(p->vLags);
+        Vec_IntAppend(p->vLags, vBest);
+        if (Gia_RetManFeasible(p, Mid)) {
+            DelayBest = Gia_RetManArrivals(p, &ArrHost);
+            Vec_IntClear(vBest);
+            Vec_IntAppend(vBest, p->vLags);
+            Hi = DelayBest - 1;
+        } else
+            Lo = Mid + 1;
+        if (fVerbose)
+            printf("Period %4d is %s.\n", Mid, Lo > Mid ? "infeasible" : "feasible");
+    }
+    Vec_IntClear(p->vLags);
+    Vec_IntAppend(p->vLags, vBest);
+    Vec_IntFree(vBest);
+    if (DelayBest == DelayInit)
+        pNew = NULL;
+    else if ((pNew = Gia_RetManDerive(p, fVerbose)) == NULL && fVerbose)
+        printf("Retiming failed because the initial state cannot be computed.\n");
+    if (fVerbose) {
+        printf("Delay = %d -> %d. Reg = %d -> %d. ", DelayInit, pNew ? DelayBest : DelayInit,
+               Gia_ManRegNum(pGia), pNew ? Gia_ManRegNum(pNew) : Gia_ManRegNum(pGia));
+        ABC_PRT("Time", Abc_Clock() - clk);
+    }
+    Gia_RetManStop(p);
+    return pNew ? pNew : Gia_ManDup(pGia);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -92,54 +92,19 @@ void Gia_ManSatokoReport(int iOutput, int status, abctime clk) {
 
     Abc_PrintTime(1, "Time", clk);
 }
-satoko_t* Gia_ManSatokoFromDimacs(char* pFileName, satoko_opts_t* opts) {
-    satoko_t* pSat = satoko_create();
-    char* pBuffer = Extra_FileReadContents(pFileName);
-    Vec_Int_t* vLits = Vec_IntAlloc(100);
-    char* pTemp;
-    int fComp, Var, VarMax = 0;
-    for (pTemp = pBuffer; *pTemp; pTemp++) {
-        if (*pTemp == 'c' || *pTemp == 'p') {
-            while (*pTemp != '\n')
-                pTemp++;
-            continue;
-        }
-        while (*pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n')
-            pTemp++;
-        fComp = 0;
-        if (*pTemp == '-')
-            fComp = 1, pTemp++;
-        if (*pTemp == '+')
-            pTemp++;
-        Var = atoi(pTemp);
-        if (Var == 0) {
-            if (Vec_IntSize(vLits) > 0) {
-                satoko_setnvars(pSat, VarMax + 1);
-                if (!satoko_add_clause(pSat, Vec_IntArray(vLits), Vec_IntSize(vLits))) {
-                    satoko_destroy(pSat);
-                    Vec_IntFree(vLits);
-                    ABC_FREE(pBuffer);
-                    return NULL;
-                }
-                Vec_IntClear(vLits);
-            }
-        } else {
-            Var--;
-            VarMax = Abc_MaxInt(VarMax, Var);
-            Vec_IntPush(vLits, Abc_Var2Lit(Var, fComp));
-        }
-        while (*pTemp >= '0' && *pTemp <= '9')
-            pTemp++;
-    }
-    ABC_FREE(pBuffer);
-    Vec_IntFree(vLits);
-    return pSat;
-}
 void Gia_ManSatokoDimacs(char* pFileName, satoko_opts_t* opts) {
     abctime clk = Abc_Clock();
-    int status = SATOKO_UNSAT;
-    satoko_t* pSat = Gia_ManSatokoFromDimacs(pFileName, opts);
-    if (pSat) {
+    int status = SATOKO_UNDEC;
+    satoko_t* pSat = NULL;
+    int RetValue = satoko_parse_dimacs(pFileName, &pSat);
+    if (RetValue == -1) {
+        Abc_Print(-1, "Cannot read CNF from file \"%s\".\n", pFileName);
+        return;
+    }
+    if (RetValue == SATOKO_ERR) // immediate conflict
+        status = SATOKO_UNSAT;
+    else {
+        satoko_configure(pSat, opts);
         status = satoko_solve(pSat);
         satoko_destroy(pSat);
     }
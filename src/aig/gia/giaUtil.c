@@ -46,8 +46,8 @@ ABC_NAMESPACE_IMPL_START
 
 ***********************************************************************/
 unsigned Gia_ManRandom(int fReset) {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static ABC_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static ABC_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if (fReset) {
         m_z = NUMBER1;
         m_w = NUMBER2;
@@ -1740,6 +1740,97 @@ int Gia_ManHasChoices_very_old(Gia_Man_t* p) {
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Clusters primary outputs by the overlap of their cones.]
+
+  Description [Each CI is hashed into one bit of a 256-bit signature,
+  and the signatures are propagated through the logic and the flops for
+  a bounded number of iterations, which approximates the sequential
+  support of each PO. The POs are then greedily grouped: a PO joins the
+  group of the first unclustered PO (the seed) if their signatures share
+  at least half of the bits set in either of them. Returns the groups of
+  PO indices, each group containing at most nGroupMax outputs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t* Gia_ManClusterOutputs(Gia_Man_t* p, int nGroupMax, int fVerbose) {
+    int nWords = 4, nItersMax = 16;
+    Vec_Wec_t* vGroups = Vec_WecAlloc(16);
+    Vec_Int_t* vGroup;
+    Vec_Wrd_t* vSigs = Vec_WrdStart(nWords * Gia_ManObjNum(p));
+    Vec_Wrd_t* vPoSigs = Vec_WrdStart(nWords * Gia_ManPoNum(p));
+    Vec_Bit_t* vUsed = Vec_BitStart(Gia_ManPoNum(p));
+    Gia_Obj_t *pObj, *pObjRo;
+    word *pSig, *pSig0, *pSig1, *pSeed;
+    int i, w, iPo, nBits, nCommon, nUnion, nIters, fChange = 1;
+    abctime clk = Abc_Clock();
+    assert(nGroupMax > 0);
+    // assign one bit to each CI
+    Gia_ManForEachCi(p, pObj, i) {
+        nBits = (int)((((unsigned)Gia_ObjCioId(pObj) + 1) * 2654435761u) % (unsigned)(64 * nWords));
+        Abc_InfoSetBit((unsigned*)Vec_WrdEntryP(vSigs, nWords * Gia_ObjId(p, pObj)), nBits);
+    }
+    // propagate signatures until the sequential supports converge
+    for (nIters = 0; fChange && nIters < nItersMax; nIters++) {
+        fChange = 0;
+        Gia_ManForEachAnd(p, pObj, i) {
+            pSig = Vec_WrdEntryP(vSigs, nWords * i);
+            pSig0 = Vec_WrdEntryP(vSigs, nWords * Gia_ObjFaninId0(pObj, i));
+            pSig1 = Vec_WrdEntryP(vSigs, nWords * Gia_ObjFaninId1(pObj, i));
+            for (w = 0; w < nWords; w++)
+                pSig[w] = pSig0[w] | pSig1[w];
+        }
+        Gia_ManForEachRiRo(p, pObj, pObjRo, i) {
+            pSig = Vec_WrdEntryP(vSigs, nWords * Gia_ObjId(p, pObjRo));
+            pSig0 = Vec_WrdEntryP(vSigs, nWords * Gia_ObjFaninId0p(p, pObj));
+            for (w = 0; w < nWords; w++)
+                if (pSig0[w] & ~pSig[w])
+                    pSig[w] |= pSig0[w], fChange = 1;
+        }
+    }
+    Gia_ManForEachPo(p, pObj, i) {
+        pSig = Vec_WrdEntryP(vPoSigs, nWords * i);
+        pSig0 = Vec_WrdEntryP(vSigs, nWords * Gia_ObjFaninId0p(p, pObj));
+        for (w = 0; w < nWords; w++)
+            pSig[w] = pSig0[w];
+    }
+    // greedily group the outputs around the seeds
+    for (i = 0; i < Gia_ManPoNum(p); i++) {
+        if (Vec_BitEntry(vUsed, i))
+            continue;
+        vGroup = Vec_WecPushLevel(vGroups);
+        Vec_IntPush(vGroup, i);
+        Vec_BitWriteEntry(vUsed, i, 1);
+        pSeed = Vec_WrdEntryP(vPoSigs, nWords * i);
+        for (iPo = i + 1; iPo < Gia_ManPoNum(p) && Vec_IntSize(vGroup) < nGroupMax; iPo++) {
+            if (Vec_BitEntry(vUsed, iPo))
+                continue;
+            pSig = Vec_WrdEntryP(vPoSigs, nWords * iPo);
+            for (nCommon = nUnion = w = 0; w < nWords; w++) {
+                nCommon += Abc_TtCountOnes(pSeed[w] & pSig[w]);
+                nUnion += Abc_TtCountOnes(pSeed[w] | pSig[w]);
+            }
+            if (2 * nCommon < nUnion)
+                continue;
+            Vec_IntPush(vGroup, iPo);
+            Vec_BitWriteEntry(vUsed, iPo, 1);
+        }
+    }
+    if (fVerbose) {
+        printf("Clustered %d outputs into %d groups (max group size = %d) after %d iterations.  ",
+               Gia_ManPoNum(p), Vec_WecSize(vGroups), nGroupMax, nIters);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    }
+    Vec_WrdFree(vSigs);
+    Vec_WrdFree(vPoSigs);
+    Vec_BitFree(vUsed);
+    return vGroups;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Proving multi-output properties.]
@@ -1751,14 +1842,15 @@ int Gia_ManHasChoices_very_old(Gia_Man_t* p) {
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Int_t* Gia_ManGroupProve(Gia_Man_t* pInit, char* pCommLine, int nGroupSize, int fVerbose) {
+Vec_Int_t* Gia_ManGroupProve(Gia_Man_t* pInit, char* pCommLine, int nGroupSize, int fCluster, int fVerbose) {
     Abc_Frame_t* pAbc = Abc_FrameReadGlobalFrame();
     Gia_Man_t* p = Gia_ManDup(pInit);
     Gia_Man_t* pGroup;
-    Vec_Int_t* vOuts;
+    Vec_Wec_t* vGroups;
+    Vec_Int_t* vGroup;
     Vec_Int_t* vOutMap;
     Vec_Ptr_t* vCexes;
-    int i, k, nGroupCur, nGroups;
+    int i, k, iOut;
     abctime clk, timeComm = 0;
     abctime timeStart = Abc_Clock();
     // pre-conditions
@@ -1766,16 +1858,24 @@ Vec_Int_t* Gia_ManGroupProve(Gia_Man_t* pInit, char* pCommLine, int nGroupSize,
     assert(pCommLine != NULL);
     assert(p->nConstrs == 0);
     Abc_Print(1, "RUNNING MultiProve: Group size = %d. Command line = \"%s\".\n", nGroupSize, pCommLine);
+    // create the groups
+    if (fCluster)
+        vGroups = Gia_ManClusterOutputs(p, nGroupSize, fVerbose);
+    else {
+        vGroups = Vec_WecAlloc(Gia_ManPoNum(p) / nGroupSize + 1);
+        for (i = 0; i < Gia_ManPoNum(p); i++)
+            Vec_IntPush(i % nGroupSize ? Vec_WecEntryLast(vGroups) : Vec_WecPushLevel(vGroups), i);
+    }
     // create output map
-    vOuts = Vec_IntStartNatural(Gia_ManPoNum(p));
-    vOutMap = Vec_IntAlloc(Gia_ManPoNum(p));
-    vCexes = Vec_PtrAlloc(Gia_ManPoNum(p));
-    nGroups = Gia_ManPoNum(p) / nGroupSize + (int)((Gia_ManPoNum(p) % nGroupSize) > 0);
-    for (i = 0; i < nGroups; i++) {
+    vOutMap = Vec_IntStartFull(Gia_ManPoNum(p));
+    vCexes = Vec_PtrStart(Gia_ManPoNum(p));
+    Vec_WecForEachLevel(vGroups, vGroup, i) {
         // derive the group
-        nGroupCur = ((i + 1) * nGroupSize < Gia_ManPoNum(p)) ? nGroupSize : Gia_ManPoNum(p) - i * nGroupSize;
-        pGroup = Gia_ManDupCones(p, Vec_IntArray(vOuts) + i * nGroupSize, nGroupCur, 0);
-        Abc_Print(1, "GROUP %4d : %4d <= PoId < %4d : ", i, i * nGroupSize, i * nGroupSize + nGroupCur);
+        pGroup = Gia_ManDupCones(p, Vec_IntArray(vGroup), Vec_IntSize(vGroup), 0);
+        if (fCluster)
+            Abc_Print(1, "GROUP %4d : %4d outputs starting with PoId %4d : ", i, Vec_IntSize(vGroup), Vec_IntEntry(vGroup, 0));
+        else
+            Abc_Print(1, "GROUP %4d : %4d <= PoId < %4d : ", i, Vec_IntEntry(vGroup, 0), Vec_IntEntryLast(vGroup) + 1);
         // set the current GIA
         Abc_FrameUpdateGia(pAbc, pGroup);
         // solve the group
@@ -1784,20 +1884,21 @@ Vec_Int_t* Gia_ManGroupProve(Gia_Man_t* pInit, char* pCommLine, int nGroupSize,
         timeComm += Abc_Clock() - clk;
         // get the solution status
         if (nGroupSize == 1) {
-            Vec_IntPush(vOutMap, Abc_FrameReadProbStatus(pAbc));
-            Vec_PtrPush(vCexes, Abc_FrameReadCex(pAbc));
+            Vec_IntWriteEntry(vOutMap, Vec_IntEntry(vGroup, 0), Abc_FrameReadProbStatus(pAbc));
+            Vec_PtrWriteEntry(vCexes, Vec_IntEntry(vGroup, 0), Abc_FrameReadCex(pAbc));
         } else // if ( nGroupSize > 1 )
         {
             Vec_Int_t* vStatusCur = Abc_FrameReadPoStatuses(pAbc);
             Vec_Ptr_t* vCexesCur = Abc_FrameReadCexVec(pAbc);
             assert(vStatusCur != NULL); // only works for "bmc3" and "pdr"
                                         //            assert( vCexesCur != NULL );
-            for (k = 0; k < nGroupCur; k++) {
-                Vec_IntPush(vOutMap, Vec_IntEntry(vStatusCur, k));
-                Vec_PtrPush(vCexes, vCexesCur ? Vec_PtrEntry(vCexesCur, k) : NULL);
+            Vec_IntForEachEntry(vGroup, iOut, k) {
+                Vec_IntWriteEntry(vOutMap, iOut, Vec_IntEntry(vStatusCur, k));
+                Vec_PtrWriteEntry(vCexes, iOut, vCexesCur ? Vec_PtrEntry(vCexesCur, k) : NULL);
             }
         }
     }
+    Vec_WecFree(vGroups);
     assert(Vec_PtrSize(vCexes) == Gia_ManPoNum(p));
     assert(Vec_IntSize(vOutMap) == Gia_ManPoNum(p));
     // set CEXes
@@ -1815,7 +1916,6 @@ Vec_Int_t* Gia_ManGroupProve(Gia_Man_t* pInit, char* pCommLine, int nGroupSize,
     Abc_PrintTime(1, "Command time", timeComm);
     Abc_PrintTime(1, "Total time  ", Abc_Clock() - timeStart);
     // cleanup
-    Vec_IntFree(vOuts);
     Gia_ManStop(p);
     return vOutMap;
 }
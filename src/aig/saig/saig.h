@@ -37,6 +37,8 @@ ABC_NAMESPACE_HEADER_START
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
 
+typedef struct Saig_SimCkp_t_ Saig_SimCkp_t;
+
 typedef struct Sec_MtrStatus_t_ Sec_MtrStatus_t;
 struct Sec_MtrStatus_t_ {
     int nInputs;  // the total number of inputs
@@ -181,6 +183,20 @@ extern Aig_Man_t* Saig_ManRetimeMinArea(Aig_Man_t* p, int nMaxIters, int fForwar
 extern int Saig_ManRetimeSteps(Aig_Man_t* p, int nSteps, int fForward, int fAddBugs);
 /*=== saigScl.c ==========================================================*/
 extern void Saig_ManReportUselessRegisters(Aig_Man_t* pAig);
+/*=== saigSimCkpt.c ==========================================================*/
+extern Saig_SimCkp_t* Saig_SimCkpStart(Aig_Man_t* pAig, int nWords, int nGap);
+extern void Saig_SimCkpStop(Saig_SimCkp_t* p);
+extern double Saig_SimCkpMemory(Saig_SimCkp_t* p);
+extern int Saig_SimCkpRun(Saig_SimCkp_t* p, int nFrames, int fInit, int fCheckPos);
+extern void Saig_SimCkpFrame(Saig_SimCkp_t* p, int iFrame);
+extern word* Saig_SimCkpObjSim(Saig_SimCkp_t* p, int Id);
+extern word* Saig_SimCkpValid(Saig_SimCkp_t* p);
+extern int Saig_SimCkpFrameNum(Saig_SimCkp_t* p);
+extern int Saig_SimCkpWordNum(Saig_SimCkp_t* p);
+extern unsigned Saig_SimCkpObjHash(Saig_SimCkp_t* p, Aig_Obj_t* pObj);
+extern int Saig_SimCkpObjIsConst(Saig_SimCkp_t* p, Aig_Obj_t* pObj);
+extern int Saig_SimCkpObjsAreEqual(Saig_SimCkp_t* p, Aig_Obj_t* pObj0, Aig_Obj_t* pObj1);
+extern Abc_Cex_t* Saig_SimCkpDeriveCex(Saig_SimCkp_t* p);
 /*=== saigSimMv.c ==========================================================*/
 extern Vec_Ptr_t* Saig_MvManSimulate(Aig_Man_t* pAig, int nFramesSymb, int nFramesSatur, int fVerbose, int fVeryVerbose);
 /*=== saigStrSim.c ==========================================================*/
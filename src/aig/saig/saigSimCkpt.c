@@ -0,0 +1,566 @@
+/**CFile****************************************************************
+
+  FileName    [saigSimCkpt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Sequential AIG package.]
+
+  Synopsis    [Sequential simulator with flop-state checkpointing.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: saigSimCkpt.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "saig.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The frame-unrolled simulators (Ssw_Sml_t, Fra_Sml_t) keep the values
+    of every object in every frame, which takes nObjs * nFrames * nWords
+    words. This simulator keeps the values of only one frame. In addition,
+    it stores the register values at every nGap-th frame (checkpoint) and
+    generates the primary input values using a counter-based random
+    number generator, so the values of any frame can be recomputed on
+    demand by simulating at most nGap frames from the closest checkpoint.
+
+    While the frames are simulated, the normalized values of each object
+    are folded into a 64-bit signature and a flag that records whether
+    the object was ever different from its phase. These are used to
+    refine candidate equivalence classes after arbitrarily long runs:
+    two objects with equal simulation values always have equal signatures,
+    so the refinement never separates objects that the full simulation
+    information would keep together.
+
+    If the AIG has constraints (the last nConstrs POs), a pattern is
+    dropped in the first frame where one of the constraints is 1. The
+    dropped patterns do not contribute to the signatures and cannot
+    produce a failure.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+struct Saig_SimCkp_t_ {
+    // parameters
+    Aig_Man_t* pAig; // the AIG to be simulated
+    int nWords;      // the number of 64-bit words in each frame
+    int nGap;        // the number of frames between checkpoints (0 = automatic)
+    word Seed;       // the seed of the input patterns
+    // AIG representation
+    Vec_Int_t* vNodes; // the nodes as triples (Id, Lit0, Lit1), where Lit is normalized fanin
+    Vec_Int_t* vCos;   // the COs as pairs (Id, Lit)
+    // simulation info
+    word* pSims;        // the values of one frame (normalized by the phase)
+    word* pValid;       // the patterns satisfying the constraints up to this frame
+    word* pCkps;        // the register values and valid patterns at the checkpoints
+    word* pSigs;        // the signatures of the objects accumulated over the frames
+    unsigned* pOnes;    // the objects whose normalized value was 1 at least once
+    int nCkpsAlloc;     // the number of allocated checkpoints
+    int nGapCur;        // the checkpoint gap used by the last run
+    int nFrames;        // the number of frames simulated by the last run
+    int fInit;          // the last run started in the initial state
+    int iFrameCur;      // the frame currently stored in pSims (-1 if none)
+    // failure detected by the last run
+    int iFrameFail; // the frame
+    int iPoFail;    // the output
+    int iPatFail;   // the pattern
+};
+
+static inline word* Saig_SimCkpSim(Saig_SimCkp_t* p, int Id) { return p->pSims + p->nWords * Id; }
+static inline word* Saig_SimCkpCkp(Saig_SimCkp_t* p, int iCkp) { return p->pCkps + p->nWords * (Aig_ManRegNum(p->pAig) + 1) * iCkp; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Mixes the bits of a 64-bit word (splitmix64 finalizer).]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Saig_SimCkpMix(word x) {
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the random word of the given CI in the given frame.]
+
+  Description [Counter-based generator, so that the patterns of any frame
+  can be regenerated without storing them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word Saig_SimCkpRandom(Saig_SimCkp_t* p, int iFrame, int iCi, int iWord) {
+    word x = ((word)iFrame * Aig_ManCiNum(p->pAig) + iCi) * p->nWords + iWord;
+    return Saig_SimCkpMix(p->Seed + (x + 1) * ABC_CONST(0x9E3779B97F4A7C15));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the simulator.]
+
+  Description [The AIG should not be modified while the simulator is used.
+  If nGap is 0, the gap between checkpoints is set to the square root of
+  the number of frames in each run.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Saig_SimCkp_t* Saig_SimCkpStart(Aig_Man_t* pAig, int nWords, int nGap) {
+    Saig_SimCkp_t* p;
+    Aig_Obj_t* pObj;
+    int i;
+    assert(nWords > 0);
+    p = ABC_CALLOC(Saig_SimCkp_t, 1);
+    p->pAig = pAig;
+    p->nWords = nWords;
+    p->nGap = nGap;
+    p->Seed = ABC_CONST(0x2545F4914F6CDD1D);
+    p->iFrameCur = -1;
+    p->iFrameFail = -1;
+    // compile the AIG
+    p->vNodes = Vec_IntAlloc(3 * Aig_ManNodeNum(pAig));
+    Aig_ManForEachNode(pAig, pObj, i) {
+        Vec_IntPush(p->vNodes, pObj->Id);
+        Vec_IntPush(p->vNodes, Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjPhaseReal(Aig_ObjChild0(pObj))));
+        Vec_IntPush(p->vNodes, Abc_Var2Lit(Aig_ObjFaninId1(pObj), Aig_ObjPhaseReal(Aig_ObjChild1(pObj))));
+    }
+    p->vCos = Vec_IntAlloc(2 * Aig_ManCoNum(pAig));
+    Aig_ManForEachCo(pAig, pObj, i) {
+        Vec_IntPush(p->vCos, pObj->Id);
+        Vec_IntPush(p->vCos, Abc_Var2Lit(Aig_ObjFaninId0(pObj), Aig_ObjPhaseReal(Aig_ObjChild0(pObj))));
+    }
+    // allocate simulation info
+    p->pSims = ABC_CALLOC(word, nWords * Aig_ManObjNumMax(pAig));
+    p->pValid = ABC_CALLOC(word, nWords);
+    p->pSigs = ABC_CALLOC(word, Aig_ManObjNumMax(pAig));
+    p->pOnes = ABC_CALLOC(unsigned, Abc_BitWordNum(Aig_ManObjNumMax(pAig)));
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the simulator.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_SimCkpStop(Saig_SimCkp_t* p) {
+    Vec_IntFree(p->vNodes);
+    Vec_IntFree(p->vCos);
+    ABC_FREE(p->pSims);
+    ABC_FREE(p->pValid);
+    ABC_FREE(p->pCkps);
+    ABC_FREE(p->pSigs);
+    ABC_FREE(p->pOnes);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory used by the simulator in bytes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Saig_SimCkpMemory(Saig_SimCkp_t* p) {
+    double Mem = sizeof(Saig_SimCkp_t);
+    Mem += sizeof(int) * (Vec_IntCap(p->vNodes) + Vec_IntCap(p->vCos));
+    Mem += sizeof(word) * p->nWords * (Aig_ManObjNumMax(p->pAig) + 1);
+    Mem += sizeof(word) * p->nWords * (Aig_ManRegNum(p->pAig) + 1) * p->nCkpsAlloc;
+    Mem += sizeof(word) * Aig_ManObjNumMax(p->pAig);
+    Mem += sizeof(unsigned) * Abc_BitWordNum(Aig_ManObjNumMax(p->pAig));
+    return Mem;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one frame.]
+
+  Description [Assumes that the values of the register outputs are
+  assigned. Assigns the primary inputs and computes the nodes and the
+  combinational outputs. The node loop is branch-free over the words,
+  so that the compiler can vectorize it. Drops the patterns violating
+  the constraints in this frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_SimCkpSimulateFrame(Saig_SimCkp_t* p, int iFrame) {
+    Aig_Obj_t* pObj;
+    word *pSim, *pSim0, *pSim1, Mask, Mask0, Mask1;
+    int i, w, Id, Lit0, Lit1, nWords = p->nWords;
+    // constant 1 node is normalized to 0
+    memset(Saig_SimCkpSim(p, 0), 0, sizeof(word) * nWords);
+    // primary inputs
+    Saig_ManForEachPi(p->pAig, pObj, i) {
+        pSim = Saig_SimCkpSim(p, pObj->Id);
+        for (w = 0; w < nWords; w++)
+            pSim[w] = Saig_SimCkpRandom(p, iFrame, i, w);
+    }
+    // internal nodes
+    for (i = 0; i < Vec_IntSize(p->vNodes); i += 3) {
+        Id = Vec_IntEntry(p->vNodes, i);
+        Lit0 = Vec_IntEntry(p->vNodes, i + 1);
+        Lit1 = Vec_IntEntry(p->vNodes, i + 2);
+        pSim = Saig_SimCkpSim(p, Id);
+        pSim0 = Saig_SimCkpSim(p, Abc_Lit2Var(Lit0));
+        pSim1 = Saig_SimCkpSim(p, Abc_Lit2Var(Lit1));
+        Mask = Aig_ManObj(p->pAig, Id)->fPhase ? ~(word)0 : 0;
+        Mask0 = Abc_LitIsCompl(Lit0) ? ~(word)0 : 0;
+        Mask1 = Abc_LitIsCompl(Lit1) ? ~(word)0 : 0;
+        for (w = 0; w < nWords; w++)
+            pSim[w] = ((pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1)) ^ Mask;
+    }
+    // combinational outputs (not normalized)
+    for (i = 0; i < Vec_IntSize(p->vCos); i += 2) {
+        Lit0 = Vec_IntEntry(p->vCos, i + 1);
+        pSim = Saig_SimCkpSim(p, Vec_IntEntry(p->vCos, i));
+        pSim0 = Saig_SimCkpSim(p, Abc_Lit2Var(Lit0));
+        Mask0 = Abc_LitIsCompl(Lit0) ? ~(word)0 : 0;
+        for (w = 0; w < nWords; w++)
+            pSim[w] = pSim0[w] ^ Mask0;
+    }
+    // constraints
+    Saig_ManForEachPo(p->pAig, pObj, i) {
+        if (i < Saig_ManPoNum(p->pAig) - p->pAig->nConstrs)
+            continue;
+        pSim = Saig_SimCkpSim(p, pObj->Id);
+        for (w = 0; w < nWords; w++)
+            p->pValid[w] &= ~pSim[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the register inputs to the register outputs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Saig_SimCkpTransfer(Saig_SimCkp_t* p) {
+    Aig_Obj_t *pObjLi, *pObjLo;
+    int i;
+    Saig_ManForEachLiLo(p->pAig, pObjLi, pObjLo, i)
+        memcpy(Saig_SimCkpSim(p, pObjLo->Id), Saig_SimCkpSim(p, pObjLi->Id), sizeof(word) * p->nWords);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves or restores the register outputs at a checkpoint.]
+
+  Description [The valid patterns are saved after the register values.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Saig_SimCkpSave(Saig_SimCkp_t* p, int iCkp) {
+    Aig_Obj_t* pObj;
+    word* pCkp = Saig_SimCkpCkp(p, iCkp);
+    int i;
+    Saig_ManForEachLo(p->pAig, pObj, i)
+        memcpy(pCkp + p->nWords * i, Saig_SimCkpSim(p, pObj->Id), sizeof(word) * p->nWords);
+    memcpy(pCkp + p->nWords * Aig_ManRegNum(p->pAig), p->pValid, sizeof(word) * p->nWords);
+}
+static inline void Saig_SimCkpLoad(Saig_SimCkp_t* p, int iCkp) {
+    Aig_Obj_t* pObj;
+    word* pCkp = Saig_SimCkpCkp(p, iCkp);
+    int i;
+    Saig_ManForEachLo(p->pAig, pObj, i)
+        memcpy(Saig_SimCkpSim(p, pObj->Id), pCkp + p->nWords * i, sizeof(word) * p->nWords);
+    memcpy(p->pValid, pCkp + p->nWords * Aig_ManRegNum(p->pAig), sizeof(word) * p->nWords);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the register outputs in the first frame.]
+
+  Description [Uses the initial state (all zeros) or random values, which
+  are taken from the generator as if the registers were extra inputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_SimCkpInitialize(Saig_SimCkp_t* p) {
+    Aig_Obj_t* pObj;
+    word* pSim;
+    int i, w;
+    Saig_ManForEachLo(p->pAig, pObj, i) {
+        pSim = Saig_SimCkpSim(p, pObj->Id);
+        for (w = 0; w < p->nWords; w++)
+            pSim[w] = p->fInit ? 0 : Saig_SimCkpRandom(p, 0, Saig_ManPiNum(p->pAig) + i, w);
+    }
+    for (w = 0; w < p->nWords; w++)
+        p->pValid[w] = ~(word)0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Folds the values of the current frame into the signatures.]
+
+  Description [Only the valid patterns are folded in.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Saig_SimCkpAccumulate(Saig_SimCkp_t* p) {
+    Aig_Obj_t* pObj;
+    word *pSim, Sig, Ones, Value;
+    int i, w;
+    Aig_ManForEachObj(p->pAig, pObj, i) {
+        if (!Aig_ObjIsNode(pObj) && !Aig_ObjIsCi(pObj))
+            continue;
+        pSim = Saig_SimCkpSim(p, i);
+        Sig = p->pSigs[i];
+        Ones = 0;
+        for (w = 0; w < p->nWords; w++) {
+            Value = pSim[w] & p->pValid[w];
+            Sig = Saig_SimCkpMix(Sig ^ Value) + ABC_CONST(0x9E3779B97F4A7C15);
+            Ones |= Value;
+        }
+        p->pSigs[i] = Sig;
+        if (Ones)
+            Abc_InfoSetBit(p->pOnes, i);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the primary outputs of the current frame.]
+
+  Description [Returns 1 and records the failure if one of the outputs
+  is 1 under some valid pattern. The constraints are not checked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Saig_SimCkpCheckPos(Saig_SimCkp_t* p, int iFrame) {
+    Aig_Obj_t* pObj;
+    word *pSim, Value;
+    int i, w;
+    Saig_ManForEachPo(p->pAig, pObj, i) {
+        if (i >= Saig_ManPoNum(p->pAig) - p->pAig->nConstrs)
+            break;
+        pSim = Saig_SimCkpSim(p, pObj->Id);
+        for (w = 0; w < p->nWords; w++)
+            if ((Value = pSim[w] & p->pValid[w])) {
+                p->iFrameFail = iFrame;
+                p->iPoFail = i;
+                p->iPatFail = 64 * w + Abc_Tt6FirstBit(Value);
+                return 1;
+            }
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one simulation run.]
+
+  Description [Simulates nFrames frames starting in the initial state
+  (fInit = 1) or in a random state (fInit = 0). Stores the register
+  values at the checkpoints and accumulates the signatures of the nodes
+  and CIs. If fCheckPos is set, stops at the first frame where a primary
+  output is 1 and returns 1; the counter-example can be derived by
+  Saig_SimCkpDeriveCex(). Otherwise returns 0. Each call uses new random
+  patterns while the signatures keep accumulating.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_SimCkpRun(Saig_SimCkp_t* p, int nFrames, int fInit, int fCheckPos) {
+    int f, nCkps;
+    assert(nFrames > 0);
+    // use new patterns in each run
+    if (p->nFrames > 0)
+        p->Seed = Saig_SimCkpRandom(p, p->nFrames, 0, 0);
+    if (p->nGap)
+        p->nGapCur = p->nGap;
+    else
+        for (p->nGapCur = 1; p->nGapCur * p->nGapCur < nFrames; p->nGapCur++)
+            ;
+    nCkps = (nFrames + p->nGapCur - 1) / p->nGapCur;
+    if (p->nCkpsAlloc < nCkps) {
+        p->nCkpsAlloc = nCkps;
+        p->pCkps = ABC_REALLOC(word, p->pCkps, (size_t)p->nWords * (Aig_ManRegNum(p->pAig) + 1) * nCkps);
+    }
+    p->nFrames = nFrames;
+    p->fInit = fInit;
+    p->iFrameFail = -1;
+    Saig_SimCkpInitialize(p);
+    for (f = 0; f < nFrames; f++) {
+        if (f % p->nGapCur == 0)
+            Saig_SimCkpSave(p, f / p->nGapCur);
+        Saig_SimCkpSimulateFrame(p, f);
+        p->iFrameCur = f;
+        Saig_SimCkpAccumulate(p);
+        if (fCheckPos && Saig_SimCkpCheckPos(p, f)) {
+            p->nFrames = f + 1;
+            return 1;
+        }
+        if (f < nFrames - 1)
+            Saig_SimCkpTransfer(p);
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Recomputes the values of the given frame of the last run.]
+
+  Description [Restores the closest checkpoint and simulates forward, or
+  simulates one frame if the next frame is requested. After this call,
+  Saig_SimCkpObjSim() returns the values of the frame and Saig_SimCkpValid()
+  returns the patterns that satisfy the constraints up to this frame.
+  The node values are normalized by their phase; the CI and CO values
+  are not.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Saig_SimCkpFrame(Saig_SimCkp_t* p, int iFrame) {
+    int f, iCkp;
+    assert(iFrame >= 0 && iFrame < p->nFrames);
+    if (iFrame == p->iFrameCur)
+        return;
+    if (iFrame == p->iFrameCur + 1) {
+        Saig_SimCkpTransfer(p);
+        Saig_SimCkpSimulateFrame(p, iFrame);
+        p->iFrameCur = iFrame;
+        return;
+    }
+    iCkp = iFrame / p->nGapCur;
+    Saig_SimCkpLoad(p, iCkp);
+    for (f = iCkp * p->nGapCur; f <= iFrame; f++) {
+        Saig_SimCkpSimulateFrame(p, f);
+        if (f < iFrame)
+            Saig_SimCkpTransfer(p);
+    }
+    p->iFrameCur = iFrame;
+}
+word* Saig_SimCkpObjSim(Saig_SimCkp_t* p, int Id) {
+    assert(p->iFrameCur >= 0);
+    return Saig_SimCkpSim(p, Id);
+}
+word* Saig_SimCkpValid(Saig_SimCkp_t* p) {
+    assert(p->iFrameCur >= 0);
+    return p->pValid;
+}
+int Saig_SimCkpFrameNum(Saig_SimCkp_t* p) {
+    return p->nFrames;
+}
+int Saig_SimCkpWordNum(Saig_SimCkp_t* p) {
+    return p->nWords;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Procedures to refine the equivalence classes.]
+
+  Description [These have the interface of the callbacks used by the
+  class managers. Equal signatures are implied by equal simulation info
+  in all frames of all runs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Saig_SimCkpObjHash(Saig_SimCkp_t* p, Aig_Obj_t* pObj) {
+    word Sig = p->pSigs[pObj->Id];
+    return (unsigned)(Sig ^ (Sig >> 32));
+}
+int Saig_SimCkpObjIsConst(Saig_SimCkp_t* p, Aig_Obj_t* pObj) {
+    return !Abc_InfoHasBit(p->pOnes, pObj->Id);
+}
+int Saig_SimCkpObjsAreEqual(Saig_SimCkp_t* p, Aig_Obj_t* pObj0, Aig_Obj_t* pObj1) {
+    return p->pSigs[pObj0->Id] == p->pSigs[pObj1->Id] && Abc_InfoHasBit(p->pOnes, pObj0->Id) == Abc_InfoHasBit(p->pOnes, pObj1->Id);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example for the failure of the last run.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t* Saig_SimCkpDeriveCex(Saig_SimCkp_t* p) {
+    Abc_Cex_t* pCex;
+    int f, i, iBit, nPis = Saig_ManPiNum(p->pAig);
+    int iWord = p->iPatFail / 64, iShift = p->iPatFail % 64;
+    if (p->iFrameFail == -1)
+        return NULL;
+    pCex = Abc_CexAlloc(Aig_ManRegNum(p->pAig), nPis, p->iFrameFail + 1);
+    pCex->iPo = p->iPoFail;
+    pCex->iFrame = p->iFrameFail;
+    if (!p->fInit)
+        for (i = 0; i < Aig_ManRegNum(p->pAig); i++)
+            if ((Saig_SimCkpRandom(p, 0, nPis + i, iWord) >> iShift) & 1)
+                Abc_InfoSetBit(pCex->pData, i);
+    iBit = Aig_ManRegNum(p->pAig);
+    for (f = 0; f <= p->iFrameFail; f++)
+        for (i = 0; i < nPis; i++, iBit++)
+            if ((Saig_SimCkpRandom(p, f, i, iWord) >> iShift) & 1)
+                Abc_InfoSetBit(pCex->pData, iBit);
+    return pCex;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -1034,7 +1034,7 @@ extern ABC_DLL int Abc_NodeRef_rec(Abc_Obj_t* pNode);
 /*=== abcRefactor.c ==========================================================*/
 extern ABC_DLL int Abc_NtkRefactor(Abc_Ntk_t* pNtk, int nNodeSizeMax, int nConeSizeMax, int fUpdateLevel, int fUseZeros, int fUseDcs, int fVerbose);
 /*=== abcRewrite.c ==========================================================*/
-extern ABC_DLL int Abc_NtkRewrite(Abc_Ntk_t* pNtk, int fUpdateLevel, int fUseZeros, int fVerbose, int fVeryVerbose, int fPlaceEnable);
+extern ABC_DLL int Abc_NtkRewrite(Abc_Ntk_t* pNtk, int fUpdateLevel, int fUseZeros, int fUse5, int fVerbose, int fVeryVerbose, int fPlaceEnable);
 /*=== abcSat.c ==========================================================*/
 extern ABC_DLL int Abc_NtkMiterSat(Abc_Ntk_t* pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit, int fVerbose, ABC_INT64_T* pNumConfs, ABC_INT64_T* pNumInspects);
 extern ABC_DLL void* Abc_NtkMiterSatCreate(Abc_Ntk_t* pNtk, int fAllPrimes);
@@ -60,6 +60,12 @@ struct Abc_Aig_t_ {
     Vec_Ptr_t* vStackReplaceNew; // the nodes to be used for replacement
     Vec_Vec_t* vLevels;          // the nodes to be updated
     Vec_Vec_t* vLevelsR;         // the nodes to be updated
+    Vec_Int_t* vLevelPlaces;     // the place of each scheduled node in vLevels
+    Vec_Int_t* vLevelPlacesR;    // the place of each scheduled node in vLevelsR
+    int LevelMin;                // the smallest non-empty level in vLevels
+    int LevelMax;                // the largest non-empty level in vLevels
+    int LevelMinR;               // the smallest non-empty level in vLevelsR
+    int LevelMaxR;               // the largest non-empty level in vLevelsR
     Vec_Ptr_t* vAddedCells;      // the added nodes
     Vec_Ptr_t* vUpdatedNets;     // the nodes whose fanouts have changed
 
@@ -104,8 +110,10 @@ static void Abc_AigResize(Abc_Aig_t* pMan);
 static void Abc_AigReplace_int(Abc_Aig_t* pMan, Abc_Obj_t* pOld, Abc_Obj_t* pNew, int fUpdateLevel);
 static void Abc_AigUpdateLevel_int(Abc_Aig_t* pMan);
 static void Abc_AigUpdateLevelR_int(Abc_Aig_t* pMan);
-static void Abc_AigRemoveFromLevelStructure(Vec_Vec_t* vStruct, Abc_Obj_t* pNode);
-static void Abc_AigRemoveFromLevelStructureR(Vec_Vec_t* vStruct, Abc_Obj_t* pNode);
+static void Abc_AigAddToLevelStructure(Abc_Aig_t* pMan, Abc_Obj_t* pNode);
+static void Abc_AigAddToLevelStructureR(Abc_Aig_t* pMan, Abc_Obj_t* pNode, int LevelR);
+static void Abc_AigRemoveFromLevelStructure(Abc_Aig_t* pMan, Abc_Obj_t* pNode);
+static void Abc_AigRemoveFromLevelStructureR(Abc_Aig_t* pMan, Abc_Obj_t* pNode);
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -134,6 +142,10 @@ Abc_Aig_t* Abc_AigAlloc(Abc_Ntk_t* pNtkAig) {
     pMan->vNodes = Vec_PtrAlloc(100);
     pMan->vLevels = Vec_VecAlloc(100);
     pMan->vLevelsR = Vec_VecAlloc(100);
+    pMan->vLevelPlaces = Vec_IntAlloc(100);
+    pMan->vLevelPlacesR = Vec_IntAlloc(100);
+    pMan->LevelMin = pMan->LevelMinR = ABC_INFINITY;
+    pMan->LevelMax = pMan->LevelMaxR = -1;
     pMan->vStackReplaceOld = Vec_PtrAlloc(100);
     pMan->vStackReplaceNew = Vec_PtrAlloc(100);
     // create the constant node
@@ -168,6 +180,8 @@ void Abc_AigFree(Abc_Aig_t* pMan) {
         Vec_PtrFree(pMan->vUpdatedNets);
     Vec_VecFree(pMan->vLevels);
     Vec_VecFree(pMan->vLevelsR);
+    Vec_IntFree(pMan->vLevelPlaces);
+    Vec_IntFree(pMan->vLevelPlacesR);
     Vec_PtrFree(pMan->vStackReplaceOld);
     Vec_PtrFree(pMan->vStackReplaceNew);
     Vec_PtrFree(pMan->vNodes);
@@ -848,10 +862,10 @@ void Abc_AigReplace_int(Abc_Aig_t* pMan, Abc_Obj_t* pOld, Abc_Obj_t* pNew, int f
 
         // if the node is in the level structure, remove it
         if (pFanout->fMarkA)
-            Abc_AigRemoveFromLevelStructure(pMan->vLevels, pFanout);
+            Abc_AigRemoveFromLevelStructure(pMan, pFanout);
         // if the node is in the level structure, remove it
         if (pFanout->fMarkB)
-            Abc_AigRemoveFromLevelStructureR(pMan->vLevelsR, pFanout);
+            Abc_AigRemoveFromLevelStructureR(pMan, pFanout);
 
         // remove the old fanout node from the structural hashing table
         Abc_AigAndDelete(pMan, pFanout);
@@ -863,15 +877,10 @@ void Abc_AigReplace_int(Abc_Aig_t* pMan, Abc_Obj_t* pOld, Abc_Obj_t* pNew, int f
 
         if (fUpdateLevel) {
             // schedule the updated fanout for updating direct level
-            assert(pFanout->fMarkA == 0);
-            pFanout->fMarkA = 1;
-            Vec_VecPush(pMan->vLevels, pFanout->Level, pFanout);
+            Abc_AigAddToLevelStructure(pMan, pFanout);
             // schedule the updated fanout for updating reverse level
-            if (pMan->pNtkAig->vLevelsR) {
-                assert(pFanout->fMarkB == 0);
-                pFanout->fMarkB = 1;
-                Vec_VecPush(pMan->vLevelsR, Abc_ObjReverseLevel(pFanout), pFanout);
-            }
+            if (pMan->pNtkAig->vLevelsR)
+                Abc_AigAddToLevelStructureR(pMan, pFanout, Abc_ObjReverseLevel(pFanout));
         }
 
         // the fanout has changed, update EXOR status of its fanouts
@@ -933,9 +942,9 @@ void Abc_AigDeleteNode(Abc_Aig_t* pMan, Abc_Obj_t* pNode) {
     Abc_AigAndDelete(pMan, pNode);
     // if the node is in the level structure, remove it
     if (pNode->fMarkA)
-        Abc_AigRemoveFromLevelStructure(pMan->vLevels, pNode);
+        Abc_AigRemoveFromLevelStructure(pMan, pNode);
     if (pNode->fMarkB)
-        Abc_AigRemoveFromLevelStructureR(pMan->vLevelsR, pNode);
+        Abc_AigRemoveFromLevelStructureR(pMan, pNode);
     // remove the node from the network
     Abc_NtkDeleteObj(pNode);
 
@@ -954,7 +963,9 @@ void Abc_AigDeleteNode(Abc_Aig_t* pMan, Abc_Obj_t* pNode) {
   after the node's level has changed, the fanouts levels can change too, 
   but the new fanout levels are always larger than the node's level.
   As a result, we can accumulate the nodes to be updated in the queue
-  and process them in the increasing order of levels.]
+  and process them in the increasing order of levels. Only the range of
+  levels holding scheduled nodes is visited, so the cost does not depend
+  on the depth of the network.]
                
   SideEffects []
 
@@ -967,7 +978,8 @@ void Abc_AigUpdateLevel_int(Abc_Aig_t* pMan) {
     int LevelNew, i, k, v;
 
     // go through the nodes and update the level of their fanouts
-    Vec_VecForEachLevel(pMan->vLevels, vVec, i) {
+    for (i = pMan->LevelMin; i <= pMan->LevelMax; i++) {
+        vVec = Vec_VecEntry(pMan->vLevels, i);
         if (Vec_PtrSize(vVec) == 0)
             continue;
         Vec_PtrForEachEntry(Abc_Obj_t*, vVec, pNode, k) {
@@ -989,17 +1001,17 @@ void Abc_AigUpdateLevel_int(Abc_Aig_t* pMan) {
                     continue;
                 // if the fanout is present in the data structure, pull it out
                 if (pFanout->fMarkA)
-                    Abc_AigRemoveFromLevelStructure(pMan->vLevels, pFanout);
+                    Abc_AigRemoveFromLevelStructure(pMan, pFanout);
                 // update the fanout level
                 pFanout->Level = LevelNew;
                 // add the fanout to the data structure to update its fanouts
-                assert(pFanout->fMarkA == 0);
-                pFanout->fMarkA = 1;
-                Vec_VecPush(pMan->vLevels, pFanout->Level, pFanout);
+                Abc_AigAddToLevelStructure(pMan, pFanout);
             }
         }
         Vec_PtrClear(vVec);
     }
+    pMan->LevelMin = ABC_INFINITY;
+    pMan->LevelMax = -1;
 }
 
 /**Function*************************************************************
@@ -1019,7 +1031,8 @@ void Abc_AigUpdateLevelR_int(Abc_Aig_t* pMan) {
     int LevelNew, i, k, v, j;
 
     // go through the nodes and update the level of their fanouts
-    Vec_VecForEachLevel(pMan->vLevelsR, vVec, i) {
+    for (i = pMan->LevelMinR; i <= pMan->LevelMaxR; i++) {
+        vVec = Vec_VecEntry(pMan->vLevelsR, i);
         if (Vec_PtrSize(vVec) == 0)
             continue;
         Vec_PtrForEachEntry(Abc_Obj_t*, vVec, pNode, k) {
@@ -1045,17 +1058,59 @@ void Abc_AigUpdateLevelR_int(Abc_Aig_t* pMan) {
                     continue;
                 // if the fanin is present in the data structure, pull it out
                 if (pFanin->fMarkB)
-                    Abc_AigRemoveFromLevelStructureR(pMan->vLevelsR, pFanin);
+                    Abc_AigRemoveFromLevelStructureR(pMan, pFanin);
                 // update the reverse level
                 Abc_ObjSetReverseLevel(pFanin, LevelNew);
                 // add the fanin to the data structure to update its fanins
-                assert(pFanin->fMarkB == 0);
-                pFanin->fMarkB = 1;
-                Vec_VecPush(pMan->vLevelsR, LevelNew, pFanin);
+                Abc_AigAddToLevelStructureR(pMan, pFanin, LevelNew);
             }
         }
         Vec_PtrClear(vVec);
     }
+    pMan->LevelMinR = ABC_INFINITY;
+    pMan->LevelMaxR = -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the node to the level structure.]
+
+  Description [Records the place of the node in its level, so that it can
+  be removed in constant time, and extends the range of non-empty levels.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_AigAddToLevelStructure(Abc_Aig_t* pMan, Abc_Obj_t* pNode) {
+    int Level = pNode->Level;
+    assert(pNode->fMarkA == 0);
+    pNode->fMarkA = 1;
+    Vec_VecPush(pMan->vLevels, Level, pNode);
+    Vec_IntSetEntry(pMan->vLevelPlaces, pNode->Id, Vec_VecLevelSize(pMan->vLevels, Level) - 1);
+    pMan->LevelMin = Abc_MinInt(pMan->LevelMin, Level);
+    pMan->LevelMax = Abc_MaxInt(pMan->LevelMax, Level);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the node to the reverse level structure.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_AigAddToLevelStructureR(Abc_Aig_t* pMan, Abc_Obj_t* pNode, int LevelR) {
+    assert(pNode->fMarkB == 0);
+    pNode->fMarkB = 1;
+    Vec_VecPush(pMan->vLevelsR, LevelR, pNode);
+    Vec_IntSetEntry(pMan->vLevelPlacesR, pNode->Id, Vec_VecLevelSize(pMan->vLevelsR, LevelR) - 1);
+    pMan->LevelMinR = Abc_MinInt(pMan->LevelMinR, LevelR);
+    pMan->LevelMaxR = Abc_MaxInt(pMan->LevelMaxR, LevelR);
 }
 
 /**Function*************************************************************
@@ -1069,25 +1124,20 @@ void Abc_AigUpdateLevelR_int(Abc_Aig_t* pMan) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_AigRemoveFromLevelStructure(Vec_Vec_t* vStruct, Abc_Obj_t* pNode) {
+void Abc_AigRemoveFromLevelStructure(Abc_Aig_t* pMan, Abc_Obj_t* pNode) {
     Vec_Ptr_t* vVecTemp;
-    Abc_Obj_t* pTemp;
-    int m;
+    int Place;
     assert(pNode->fMarkA);
-    vVecTemp = Vec_VecEntry(vStruct, pNode->Level);
-    Vec_PtrForEachEntry(Abc_Obj_t*, vVecTemp, pTemp, m) {
-        if (pTemp != pNode)
-            continue;
-        Vec_PtrWriteEntry(vVecTemp, m, NULL);
-        break;
-    }
-    assert(m < Vec_PtrSize(vVecTemp)); // found
+    vVecTemp = Vec_VecEntry(pMan->vLevels, pNode->Level);
+    Place = Vec_IntEntry(pMan->vLevelPlaces, pNode->Id);
+    assert(Vec_PtrEntry(vVecTemp, Place) == pNode); // found
+    Vec_PtrWriteEntry(vVecTemp, Place, NULL);
     pNode->fMarkA = 0;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Removes the node from the level structure.]
+  Synopsis    [Removes the node from the reverse level structure.]
 
   Description []
                
@@ -1096,19 +1146,14 @@ void Abc_AigRemoveFromLevelStructure(Vec_Vec_t* vStruct, Abc_Obj_t* pNode) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_AigRemoveFromLevelStructureR(Vec_Vec_t* vStruct, Abc_Obj_t* pNode) {
+void Abc_AigRemoveFromLevelStructureR(Abc_Aig_t* pMan, Abc_Obj_t* pNode) {
     Vec_Ptr_t* vVecTemp;
-    Abc_Obj_t* pTemp;
-    int m;
+    int Place;
     assert(pNode->fMarkB);
-    vVecTemp = Vec_VecEntry(vStruct, Abc_ObjReverseLevel(pNode));
-    Vec_PtrForEachEntry(Abc_Obj_t*, vVecTemp, pTemp, m) {
-        if (pTemp != pNode)
-            continue;
-        Vec_PtrWriteEntry(vVecTemp, m, NULL);
-        break;
-    }
-    assert(m < Vec_PtrSize(vVecTemp)); // found
+    vVecTemp = Vec_VecEntry(pMan->vLevelsR, Abc_ObjReverseLevel(pNode));
+    Place = Vec_IntEntry(pMan->vLevelPlacesR, pNode->Id);
+    assert(Vec_PtrEntry(vVecTemp, Place) == pNode); // found
+    Vec_PtrWriteEntry(vVecTemp, Place, NULL);
     pNode->fMarkB = 0;
 }
 
@@ -437,6 +437,7 @@ static int Abc_CommandAbc9Retime(Abc_Frame_t* pAbc, int argc, char** argv);
 static int Abc_CommandAbc9Enable(Abc_Frame_t* pAbc, int argc, char** argv);
 static int Abc_CommandAbc9Dc2(Abc_Frame_t* pAbc, int argc, char** argv);
 static int Abc_CommandAbc9Dsd(Abc_Frame_t* pAbc, int argc, char** argv);
+static int Abc_CommandAbc9CutRw(Abc_Frame_t* pAbc, int argc, char** argv);
 static int Abc_CommandAbc9Bidec(Abc_Frame_t* pAbc, int argc, char** argv);
 static int Abc_CommandAbc9Shrink(Abc_Frame_t* pAbc, int argc, char** argv);
 static int Abc_CommandAbc9Fx(Abc_Frame_t* pAbc, int argc, char** argv);
@@ -1150,6 +1151,7 @@ void Abc_Init(Abc_Frame_t* pAbc) {
     Cmd_CommandAdd(pAbc, "ABC9", "&enable", Abc_CommandAbc9Enable, 0);
     Cmd_CommandAdd(pAbc, "ABC9", "&dc2", Abc_CommandAbc9Dc2, 0);
     Cmd_CommandAdd(pAbc, "ABC9", "&dsd", Abc_CommandAbc9Dsd, 0);
+    Cmd_CommandAdd(pAbc, "ABC9", "&cutrw", Abc_CommandAbc9CutRw, 0);
     Cmd_CommandAdd(pAbc, "ABC9", "&bidec", Abc_CommandAbc9Bidec, 0);
     Cmd_CommandAdd(pAbc, "ABC9", "&shrink", Abc_CommandAbc9Shrink, 0);
     Cmd_CommandAdd(pAbc, "ABC9", "&fx", Abc_CommandAbc9Fx, 0);
@@ -4203,16 +4205,17 @@ usage:
 
 ***********************************************************************/
 static int Abc_CommandFxch(Abc_Frame_t* pAbc, int argc, char** argv) {
-    extern int Abc_NtkFxchPerform(Abc_Ntk_t * pNtk, int nMaxDivExt, int fVerbose, int fVeryVerbose);
+    extern int Abc_NtkFxchPerform(Abc_Ntk_t * pNtk, int nMaxDivExt, int nThreads, int fVerbose, int fVeryVerbose);
     Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
 
     int c,
         nMaxDivExt = 0,
+        nThreads = 1,
         fVerbose = 0,
         fVeryVerbose = 0;
 
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "Nvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "NPvwh")) != EOF) {
         switch (c) {
             case 'N':
                 if (globalUtilOptind >= argc) {
@@ -4226,6 +4229,18 @@ static int Abc_CommandFxch(Abc_Frame_t* pAbc, int argc, char** argv) {
                     goto usage;
                 break;
 
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+
+                if (nThreads < 1)
+                    goto usage;
+                break;
+
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -4260,14 +4275,15 @@ static int Abc_CommandFxch(Abc_Frame_t* pAbc, int argc, char** argv) {
         return 1;
     }
 
-    Abc_NtkFxchPerform(pNtk, nMaxDivExt, fVerbose, fVeryVerbose);
+    Abc_NtkFxchPerform(pNtk, nMaxDivExt, nThreads, fVerbose, fVeryVerbose);
 
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: fxch [-N <num>] [-svwh]\n");
+    Abc_Print(-2, "usage: fxch [-NP <num>] [-svwh]\n");
     Abc_Print(-2, "\t           performs fast extract with cube hashing on the current network\n");
     Abc_Print(-2, "\t-N <num> : max number of divisors to extract during this run [default = unused]\n");
+    Abc_Print(-2, "\t-P <num> : the number of threads enumerating the initial divisors [default = %d]\n", nThreads);
     Abc_Print(-2, "\t-v       : print verbose information [default = %s]\n", fVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-w       : print additional information [default = %s]\n", fVeryVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-h       : print the command usage\n");
@@ -4601,6 +4617,7 @@ int Abc_CommandLutpack(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->nLutsOver = 3;    // (Q) the maximum number of LUTs not in the MFFC
     pPars->nVarsShared = 0;  // (S) the maximum number of shared variables (crossbars)
     pPars->nGrowthLevel = 0; // (L) the maximum number of increased levels
+    pPars->nProcs = 1;       // (J) the number of threads
     pPars->fSatur = 1;
     pPars->fZeroCost = 0;
     pPars->fFirst = 0;
@@ -4608,7 +4625,7 @@ int Abc_CommandLutpack(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->fVerbose = 0;
     pPars->fVeryVerbose = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "NQSLszfovwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "NQSLJszfovwh")) != EOF) {
         switch (c) {
             case 'N':
                 if (globalUtilOptind >= argc) {
@@ -4650,6 +4667,16 @@ int Abc_CommandLutpack(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nGrowthLevel < 0 || pPars->nGrowthLevel > ABC_INFINITY)
                     goto usage;
                 break;
+            case 'J':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-J\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
             case 's':
                 pPars->fSatur ^= 1;
                 break;
@@ -4696,7 +4723,7 @@ int Abc_CommandLutpack(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: lutpack [-NQSL <num>] [-szfovwh]\n");
+    Abc_Print(-2, "usage: lutpack [-NQSLJ <num>] [-szfovwh]\n");
     Abc_Print(-2, "\t           performs \"rewriting\" for LUT network;\n");
     Abc_Print(-2, "\t           determines LUT size as the max fanin count of a node;\n");
     Abc_Print(-2, "\t           if the network is not LUT-mapped, packs it into 6-LUTs\n");
@@ -4705,6 +4732,7 @@ usage:
     Abc_Print(-2, "\t-Q <num> : the max number of LUTs not in MFFC (0 <= num) [default = %d]\n", pPars->nLutsOver);
     Abc_Print(-2, "\t-S <num> : the max number of LUT inputs shared (0 <= num <= 3) [default = %d]\n", pPars->nVarsShared);
     Abc_Print(-2, "\t-L <num> : max level increase after resynthesis (0 <= num) [default = %d]\n", pPars->nGrowthLevel);
+    Abc_Print(-2, "\t-J <num> : the number of threads evaluating the nodes (1 = sequential) [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-s       : toggle iteration till saturation [default = %s]\n", pPars->fSatur ? "yes" : "no");
     Abc_Print(-2, "\t-z       : toggle zero-cost replacements [default = %s]\n", pPars->fZeroCost ? "yes" : "no");
     Abc_Print(-2, "\t-f       : toggle using only first node and first cut [default = %s]\n", pPars->fFirst ? "yes" : "no");
@@ -4928,7 +4956,7 @@ int Abc_CommandMfs(Abc_Frame_t* pAbc, int argc, char** argv) {
     // set defaults
     Abc_NtkMfsParsDefault(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "WFDMLCdraestpgvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "WFDMLCdraestupgvwh")) != EOF) {
         switch (c) {
             case 'W':
                 if (globalUtilOptind >= argc) {
@@ -5008,6 +5036,9 @@ int Abc_CommandMfs(Abc_Frame_t* pAbc, int argc, char** argv) {
             case 't':
                 pPars->fOneHotness ^= 1;
                 break;
+            case 'u':
+                pPars->fUseSim ^= 1;
+                break;
             case 'p':
                 pPars->fPower ^= 1;
                 break;
@@ -5044,7 +5075,7 @@ int Abc_CommandMfs(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: mfs [-WFDMLC <num>] [-draestpgvh]\n");
+    Abc_Print(-2, "usage: mfs [-WFDMLC <num>] [-draestupgvh]\n");
     Abc_Print(-2, "\t           performs don't-care-based optimization of logic networks\n");
     Abc_Print(-2, "\t-W <num> : the number of levels in the TFO cone (0 <= num) [default = %d]\n", pPars->nWinTfoLevs);
     Abc_Print(-2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n", pPars->nFanoutsMax);
@@ -5058,6 +5089,7 @@ usage:
     Abc_Print(-2, "\t-e       : toggle high-effort resubstitution [default = %s]\n", pPars->fMoreEffort ? "yes" : "no");
     Abc_Print(-2, "\t-s       : toggle evaluation of edge swapping [default = %s]\n", pPars->fSwapEdge ? "yes" : "no");
     Abc_Print(-2, "\t-t       : toggle using artificial one-hotness conditions [default = %s]\n", pPars->fOneHotness ? "yes" : "no");
+    Abc_Print(-2, "\t-u       : toggle using simulation to filter resubstitution candidates [default = %s]\n", pPars->fUseSim ? "yes" : "no");
     Abc_Print(-2, "\t-p       : toggle power-aware optimization [default = %s]\n", pPars->fPower ? "yes" : "no");
     Abc_Print(-2, "\t-g       : toggle using new SAT solver [default = %s]\n", pPars->fGiaSat ? "yes" : "no");
     Abc_Print(-2, "\t-v       : toggle printing optimization summary [default = %s]\n", pPars->fVerbose ? "yes" : "no");
@@ -5086,7 +5118,7 @@ int Abc_CommandMfs2(Abc_Frame_t* pAbc, int argc, char** argv) {
     // set defaults
     Sfm_ParSetDefault(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "WFDMLCZNIdaeijlvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "WFDMLCZNIPdaeijlvwh")) != EOF) {
         switch (c) {
             case 'W':
                 if (globalUtilOptind >= argc) {
@@ -5178,6 +5210,16 @@ int Abc_CommandMfs2(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (nFramesAdd < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs < 0)
+                    goto usage;
+                break;
             case 'd':
                 pPars->fRrOnly ^= 1;
                 break;
@@ -5255,7 +5297,7 @@ int Abc_CommandMfs2(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: mfs2 [-WFDMLCZNI <num>] [-daeijlvwh]\n");
+    Abc_Print(-2, "usage: mfs2 [-WFDMLCZNIP <num>] [-daeijlvwh]\n");
     Abc_Print(-2, "\t           performs don't-care-based optimization of logic networks\n");
     Abc_Print(-2, "\t-W <num> : the number of levels in the TFO cone (0 <= num) [default = %d]\n", pPars->nTfoLevMax);
     Abc_Print(-2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n", pPars->nFanoutMax);
@@ -5265,6 +5307,7 @@ usage:
     Abc_Print(-2, "\t-C <num> : the max number of conflicts in one SAT run (0 = no limit) [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-Z <num> : treat the first <num> logic nodes as fixed (0 = none) [default = %d]\n", pPars->nFirstFixed);
     Abc_Print(-2, "\t-N <num> : the max number of nodes to try (0 = all) [default = %d]\n", pPars->nNodesMax);
+    Abc_Print(-2, "\t-P <num> : the number of threads for resubstitution (0 or 1 = none) [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-d       : toggle performing redundancy removal [default = %s]\n", pPars->fRrOnly ? "yes" : "no");
     Abc_Print(-2, "\t-a       : toggle minimizing area or area+edges [default = %s]\n", pPars->fArea ? "area" : "area+edges");
     Abc_Print(-2, "\t-e       : toggle high-effort resubstitution [default = %s]\n", pPars->fMoreEffort ? "yes" : "no");
@@ -6919,6 +6962,7 @@ int Abc_CommandRewrite(Abc_Frame_t* pAbc, int argc, char** argv) {
     int fUpdateLevel;
     int fPrecompute;
     int fUseZeros;
+    int fUse5;
     int fVerbose;
     int fVeryVerbose;
     int fPlaceEnable;
@@ -6929,11 +6973,12 @@ int Abc_CommandRewrite(Abc_Frame_t* pAbc, int argc, char** argv) {
     fUpdateLevel = 1;
     fPrecompute = 0;
     fUseZeros = 0;
+    fUse5 = 0;
     fVerbose = 0;
     fVeryVerbose = 0;
     fPlaceEnable = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "lxzvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "lxzfvwh")) != EOF) {
         switch (c) {
             case 'l':
                 fUpdateLevel ^= 1;
@@ -6944,6 +6989,9 @@ int Abc_CommandRewrite(Abc_Frame_t* pAbc, int argc, char** argv) {
             case 'z':
                 fUseZeros ^= 1;
                 break;
+            case 'f':
+                fUse5 ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -6979,17 +7027,18 @@ int Abc_CommandRewrite(Abc_Frame_t* pAbc, int argc, char** argv) {
     }
 
     // modify the current network
-    if (!Abc_NtkRewrite(pNtk, fUpdateLevel, fUseZeros, fVerbose, fVeryVerbose, fPlaceEnable)) {
+    if (!Abc_NtkRewrite(pNtk, fUpdateLevel, fUseZeros, fUse5, fVerbose, fVeryVerbose, fPlaceEnable)) {
         Abc_Print(-1, "Rewriting has failed.\n");
         return 1;
     }
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: rewrite [-lzvwh]\n");
+    Abc_Print(-2, "usage: rewrite [-lzfvwh]\n");
     Abc_Print(-2, "\t         performs technology-independent rewriting of the AIG\n");
     Abc_Print(-2, "\t-l     : toggle preserving the number of levels [default = %s]\n", fUpdateLevel ? "yes" : "no");
     Abc_Print(-2, "\t-z     : toggle using zero-cost replacements [default = %s]\n", fUseZeros ? "yes" : "no");
+    Abc_Print(-2, "\t-f     : toggle using 5-input cuts that are a gate of a 4-input function [default = %s]\n", fUse5 ? "yes" : "no");
     Abc_Print(-2, "\t-v     : toggle verbose printout [default = %s]\n", fVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-w     : toggle printout subgraph statistics [default = %s]\n", fVeryVerbose ? "yes" : "no");
     //    Abc_Print( -2, "\t-p     : toggle placement-aware rewriting [default = %s]\n", fPlaceEnable? "yes": "no" );
@@ -13915,7 +13964,7 @@ int Abc_CommandDch(Abc_Frame_t* pAbc, int argc, char** argv) {
     // set defaults
     Dch_ManSetDefaultParams(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "WCSsptgcfrvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "WCSPsptgcfrvh")) != EOF) {
         switch (c) {
             case 'W':
                 if (globalUtilOptind >= argc) {
@@ -13947,6 +13996,16 @@ int Abc_CommandDch(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nSatVarMax < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs < 1)
+                    goto usage;
+                break;
             case 's':
                 pPars->fSynthesis ^= 1;
                 break;
@@ -13995,11 +14054,12 @@ int Abc_CommandDch(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: dch [-WCS num] [-sptgcfrvh]\n");
+    Abc_Print(-2, "usage: dch [-WCSP num] [-sptgcfrvh]\n");
     Abc_Print(-2, "\t         computes structural choices using a new approach\n");
     Abc_Print(-2, "\t-W num : the max number of simulation words [default = %d]\n", pPars->nWords);
     Abc_Print(-2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-S num : the max number of SAT variables [default = %d]\n", pPars->nSatVarMax);
+    Abc_Print(-2, "\t-P num : the number of concurrent threads for SAT sweeping [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-s     : toggle synthesizing three snapshots [default = %s]\n", pPars->fSynthesis ? "yes" : "no");
     Abc_Print(-2, "\t-p     : toggle power-aware rewriting [default = %s]\n", pPars->fPower ? "yes" : "no");
     Abc_Print(-2, "\t-t     : toggle simulation of the TFO classes [default = %s]\n", pPars->fSimulateTfo ? "yes" : "no");
@@ -20134,7 +20194,7 @@ int Abc_CommandSeqSweep2(Abc_Frame_t* pAbc, int argc, char** argv) {
     // set defaults
     Ssw_ManSetDefaultParams(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "PQFCLSIVMNcmplkodsefqvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "PQJFCLSGIVMNcmplkodsefqvwh")) != EOF) {
         switch (c) {
             case 'P':
                 if (globalUtilOptind >= argc) {
@@ -20146,6 +20206,16 @@ int Abc_CommandSeqSweep2(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nPartSize < 2)
                     goto usage;
                 break;
+            case 'J':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-J\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
             case 'Q':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-Q\" should be followed by an integer.\n");
@@ -20196,6 +20266,16 @@ int Abc_CommandSeqSweep2(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nFramesAddSim < 0)
                     goto usage;
                 break;
+            case 'G':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-G\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nSimFrames = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nSimFrames < 0)
+                    goto usage;
+                break;
             case 'I':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-I\" should be followed by an integer.\n");
@@ -20344,15 +20424,17 @@ int Abc_CommandSeqSweep2(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: scorr [-PQFCLSIVMN <num>] [-cmplkodsefqvwh]\n");
+    Abc_Print(-2, "usage: scorr [-PQJFCLSGIVMN <num>] [-cmplkodsefqvwh]\n");
     Abc_Print(-2, "\t         performs sequential sweep using K-step induction\n");
     Abc_Print(-2, "\t-P num : max partition size (0 = no partitioning) [default = %d]\n", pPars->nPartSize);
     Abc_Print(-2, "\t-Q num : partition overlap (0 = no overlap) [default = %d]\n", pPars->nOverSize);
+    Abc_Print(-2, "\t-J num : the number of threads solving the partitions (use with -P) [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-F num : number of time frames for induction (1=simple) [default = %d]\n", pPars->nFramesK);
     Abc_Print(-2, "\t-C num : max number of conflicts at a node (0=inifinite) [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-L num : max number of levels to consider (0=all) [default = %d]\n", pPars->nMaxLevs);
     Abc_Print(-2, "\t-N num : number of last POs treated as constraints (0=none) [default = %d]\n", pPars->fConstrs);
     Abc_Print(-2, "\t-S num : additional simulation frames for c-examples (0=none) [default = %d]\n", pPars->nFramesAddSim);
+    Abc_Print(-2, "\t-G num : frames of signature-based random simulation to refine classes (0=none) [default = %d]\n", pPars->nSimFrames);
     Abc_Print(-2, "\t-I num : iteration number to stop and output SR-model (-1=none) [default = %d]\n", pPars->nItersStop);
     Abc_Print(-2, "\t-V num : min var num needed to recycle the SAT solver [default = %d]\n", pPars->nSatVarMax2);
     Abc_Print(-2, "\t-M num : min call num needed to recycle the SAT solver [default = %d]\n", pPars->nRecycleCalls2);
@@ -20646,23 +20728,25 @@ int Abc_CommandLcorr(Abc_Frame_t* pAbc, int argc, char** argv) {
     Abc_Ntk_t *pNtk, *pNtkRes;
     int c;
     int nFramesP;
+    int nSimFrames;
     int nConfMax;
     int nVarsMax;
     int fNewAlgor;
     int fVerbose;
-    extern Abc_Ntk_t* Abc_NtkDarLcorr(Abc_Ntk_t * pNtk, int nFramesP, int nConfMax, int fVerbose);
-    extern Abc_Ntk_t* Abc_NtkDarLcorrNew(Abc_Ntk_t * pNtk, int nVarsMax, int nConfMax, int fVerbose);
+    extern Abc_Ntk_t* Abc_NtkDarLcorr(Abc_Ntk_t * pNtk, int nFramesP, int nSimFrames, int nConfMax, int fVerbose);
+    extern Abc_Ntk_t* Abc_NtkDarLcorrNew(Abc_Ntk_t * pNtk, int nVarsMax, int nSimFrames, int nConfMax, int fVerbose);
 
     pNtk = Abc_FrameReadNtk(pAbc);
 
     // set defaults
     nFramesP = 0;
+    nSimFrames = 0;
     nConfMax = 1000;
     nVarsMax = 1000;
     fNewAlgor = 1;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "PCSnvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "PGCSnvh")) != EOF) {
         switch (c) {
             case 'P':
                 if (globalUtilOptind >= argc) {
@@ -20674,6 +20758,16 @@ int Abc_CommandLcorr(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (nFramesP < 0)
                     goto usage;
                 break;
+            case 'G':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-G\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nSimFrames = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (nSimFrames < 0)
+                    goto usage;
+                break;
             case 'C':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-C\" should be followed by an integer.\n");
@@ -20724,9 +20818,9 @@ int Abc_CommandLcorr(Abc_Frame_t* pAbc, int argc, char** argv) {
 
     // get the new network
     if (fNewAlgor)
-        pNtkRes = Abc_NtkDarLcorrNew(pNtk, nVarsMax, nConfMax, fVerbose);
+        pNtkRes = Abc_NtkDarLcorrNew(pNtk, nVarsMax, nSimFrames, nConfMax, fVerbose);
     else
-        pNtkRes = Abc_NtkDarLcorr(pNtk, nFramesP, nConfMax, fVerbose);
+        pNtkRes = Abc_NtkDarLcorr(pNtk, nFramesP, nSimFrames, nConfMax, fVerbose);
     if (pNtkRes == NULL) {
         Abc_Print(-1, "Sequential sweeping has failed.\n");
         return 1;
@@ -20736,9 +20830,10 @@ int Abc_CommandLcorr(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: lcorr [-PCS num] [-nvh]\n");
+    Abc_Print(-2, "usage: lcorr [-PGCS num] [-nvh]\n");
     Abc_Print(-2, "\t         computes latch correspondence using 1-step induction\n");
     Abc_Print(-2, "\t-P num : number of time frames to use as the prefix [default = %d]\n", nFramesP);
+    Abc_Print(-2, "\t-G num : frames of checkpointed random simulation to refine classes (0=none) [default = %d]\n", nSimFrames);
     Abc_Print(-2, "\t-C num : limit on the number of conflicts [default = %d]\n", nConfMax);
     Abc_Print(-2, "\t-S num : the max number of SAT variables [default = %d]\n", nVarsMax);
     Abc_Print(-2, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgor ? "yes" : "no");
@@ -23797,18 +23892,14 @@ int Abc_CommandXSat(Abc_Frame_t* pAbc, int argc, char** argv) {
     if (argc == globalUtilOptind + 1) {
         char* pFileName = argv[globalUtilOptind];
         xSAT_Solver_t* p;
-        int status;
+        int status, fConsistent;
 
-        FILE* pFile = fopen(pFileName, "rb");
-        if (pFile == NULL) {
-            printf("Cannot open file \"%s\" for writing.\n", pFileName);
+        fConsistent = xSAT_SolverReadDimacs(pFileName, &p);
+        if (p == NULL)
             return 0;
-        }
-        xSAT_SolverParseDimacs(pFile, &p);
 
         clk = Abc_Clock();
-        status = xSAT_SolverSolve(p);
-        fclose(pFile);
+        status = fConsistent ? xSAT_SolverSolve(p) : -1;
 
         xSAT_SolverPrintStats(p);
         if (status == 0)
@@ -23870,11 +23961,17 @@ int Abc_CommandSatoko(Abc_Frame_t* pAbc, int argc, char** argv) {
         int status;
 
         status = satoko_parse_dimacs(pFileName, &p);
-        satoko_configure(p, &opts);
+        if (status == -1) {
+            Abc_Print(-1, "Cannot read CNF from file \"%s\".\n", pFileName);
+            return 1;
+        }
 
         clk = Abc_Clock();
-        if (status == SATOKO_OK)
+        if (status == SATOKO_OK) {
+            satoko_configure(p, &opts);
             status = satoko_solve(p);
+        } else // immediate conflict
+            status = SATOKO_UNSAT;
 
         if (status == SATOKO_UNDEC)
             Abc_Print(1, "UNDECIDED      ");
@@ -23885,7 +23982,8 @@ int Abc_CommandSatoko(Abc_Frame_t* pAbc, int argc, char** argv) {
 
         Abc_PrintTime(1, "Time", Abc_Clock() - clk);
 
-        satoko_destroy(p);
+        if (p)
+            satoko_destroy(p);
         return 0;
     }
 
@@ -23944,7 +24042,7 @@ int Abc_CommandAbc9Satoko(Abc_Frame_t* pAbc, int argc, char** argv) {
     satoko_opts_t opts;
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "Csivh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "CRsivh")) != EOF) {
         switch (c) {
             case 'C':
                 if (globalUtilOptind >= argc) {
@@ -23956,6 +24054,14 @@ int Abc_CommandAbc9Satoko(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (opts.conf_limit < 0)
                     goto usage;
                 break;
+            case 'R':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-R\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                opts.inproc_restarts = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                break;
             case 's':
                 fSplit ^= 1;
                 break;
@@ -23984,9 +24090,11 @@ int Abc_CommandAbc9Satoko(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &satoko [-C num] [-sivh] <file.cnf>\n");
+    Abc_Print(-2, "usage: &satoko [-CR num] [-sivh] <file.cnf>\n");
     Abc_Print(-2, "\t             run Satoko by Bruno Schmitt\n");
     Abc_Print(-2, "\t-C num     : limit on the number of conflicts [default = %d]\n", opts.conf_limit);
+    Abc_Print(-2, "\t-R num     : restarts before inprocessing (vivification, subsumption, elimination) [default = %d]\n", opts.inproc_restarts);
+    Abc_Print(-2, "\t             (the interval grows after each round; 0 disables inprocessing)\n");
     Abc_Print(-2, "\t-s         : split multi-output miter into individual outputs [default = %s]\n", fSplit ? "yes" : "no");
     Abc_Print(-2, "\t-i         : split multi-output miter and solve incrementally [default = %s]\n", fIncrem ? "yes" : "no");
     Abc_Print(-2, "\t-v         : prints verbose information [default = %s]\n", opts.verbose ? "yes" : "no");
@@ -25108,7 +25216,7 @@ int Abc_CommandBmcInter(Abc_Frame_t* pAbc, int argc, char** argv) {
     // set defaults
     Inter_ManSetDefaultParams(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "CFTKLIrtpomcgbqkdivh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "CFTKPMLIrtpomcgbqkdivh")) != EOF) {
         switch (c) {
             case 'C':
                 if (globalUtilOptind >= argc) {
@@ -25150,6 +25258,26 @@ int Abc_CommandBmcInter(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nFramesK < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
+            case 'M':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-M\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProofMemMax = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProofMemMax < 0)
+                    goto usage;
+                break;
             case 'L':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-L\" should be followed by a file name.\n");
@@ -25273,13 +25401,15 @@ int Abc_CommandBmcInter(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: int [-CFTK num] [-LI file] [-irtpomcgbqkdvh]\n");
+    Abc_Print(-2, "usage: int [-CFTKPM num] [-LI file] [-irtpomcgbqkdvh]\n");
     Abc_Print(-2, "\t         uses interpolation to prove the property\n");
     Abc_Print(-2, "\t-C num : the limit on conflicts for one SAT run [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-F num : the limit on number of frames to unroll [default = %d]\n", pPars->nFramesMax);
     Abc_Print(-2, "\t-T num : the limit on runtime per output in seconds [default = %d]\n", pPars->nSecLimit);
     Abc_Print(-2, "\t-K num : the number of steps in inductive checking [default = %d]\n", pPars->nFramesK);
     Abc_Print(-2, "\t         (K = 1 works in all cases; K > 1 works without -t and -b)\n");
+    Abc_Print(-2, "\t-P num : the number of threads starting at different unrolling depths [default = %d]\n", pPars->nProcs);
+    Abc_Print(-2, "\t-M num : the limit on proof-logging memory in MB (0 = no limit) [default = %d]\n", pPars->nProofMemMax);
     Abc_Print(-2, "\t-L file: the log file name [default = %s]\n", pLogFileName ? pLogFileName : "no logging");
     Abc_Print(-2, "\t-I file: the file name for dumping interpolant [default = \"%s\"]\n", pPars->pFileName ? pPars->pFileName : "invar.aig");
     Abc_Print(-2, "\t-i     : toggle dumping interpolant/invariant into a file [default = %s]\n", pPars->fDropInvar ? "yes" : "no");
@@ -25702,10 +25832,13 @@ int Abc_CommandInduction(Abc_Frame_t* pAbc, int argc, char** argv) {
     int fUnique;
     int fUniqueAll;
     int fGetCex;
+    int fParallel;
+    int fStrengthen;
     int fVerbose;
     int fVeryVerbose;
     int c;
     extern int Abc_NtkDarInduction(Abc_Ntk_t * pNtk, int nTimeOut, int nFramesMax, int nConfMax, int fUnique, int fUniqueAll, int fGetCex, int fVerbose, int fVeryVerbose);
+    extern int Abc_NtkDarInductionPar(Abc_Ntk_t * pNtk, int nTimeOut, int nFramesMax, int nConfMax, int fStrengthen, int fVerbose);
     // set defaults
     nTimeOut = 0;
     nFramesMax = 0;
@@ -25713,10 +25846,12 @@ int Abc_CommandInduction(Abc_Frame_t* pAbc, int argc, char** argv) {
     fUnique = 0;
     fUniqueAll = 0;
     fGetCex = 0;
+    fParallel = 0;
+    fStrengthen = 1;
     fVerbose = 0;
     fVeryVerbose = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "FCTuaxvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "FCTuaxpsvwh")) != EOF) {
         switch (c) {
             case 'F':
                 if (globalUtilOptind >= argc) {
@@ -25757,6 +25892,12 @@ int Abc_CommandInduction(Abc_Frame_t* pAbc, int argc, char** argv) {
             case 'x':
                 fGetCex ^= 1;
                 break;
+            case 'p':
+                fParallel ^= 1;
+                break;
+            case 's':
+                fStrengthen ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -25790,6 +25931,12 @@ int Abc_CommandInduction(Abc_Frame_t* pAbc, int argc, char** argv) {
         return 0;
     }
 
+    if (fParallel) {
+        pAbc->Status = Abc_NtkDarInductionPar(pNtk, nTimeOut, nFramesMax, nConfMax, fStrengthen, fVerbose);
+        Abc_FrameReplaceCex(pAbc, &pNtk->pSeqModel);
+        return 0;
+    }
+
     // modify the current network
     pAbc->Status = Abc_NtkDarInduction(pNtk, nTimeOut, nFramesMax, nConfMax, fUnique, fUniqueAll, fGetCex, fVerbose, fVeryVerbose);
     if (fGetCex) {
@@ -25798,7 +25945,7 @@ int Abc_CommandInduction(Abc_Frame_t* pAbc, int argc, char** argv) {
     }
     return 0;
 usage:
-    Abc_Print(-2, "usage: ind [-FCT num] [-uaxvwh]\n");
+    Abc_Print(-2, "usage: ind [-FCT num] [-uaxpsvwh]\n");
     Abc_Print(-2, "\t         runs the inductive case of the K-step induction\n");
     Abc_Print(-2, "\t-F num : the max number of timeframes [default = %d]\n", nFramesMax);
     Abc_Print(-2, "\t-C num : the max number of conflicts by SAT solver [default = %d]\n", nConfMax);
@@ -25806,6 +25953,8 @@ usage:
     Abc_Print(-2, "\t-u     : toggle adding uniqueness constraints on demand [default = %s]\n", fUnique ? "yes" : "no");
     Abc_Print(-2, "\t-a     : toggle adding uniqueness constraints always [default = %s]\n", fUniqueAll ? "yes" : "no");
     Abc_Print(-2, "\t-x     : toggle returning CEX to induction for the top frame [default = %s]\n", fGetCex ? "yes" : "no");
+    Abc_Print(-2, "\t-p     : toggle running the base and step cases concurrently (full proof) [default = %s]\n", fParallel ? "yes" : "no");
+    Abc_Print(-2, "\t-s     : toggle strengthening with invariants found by \"scorr\" (with \"-p\") [default = %s]\n", fStrengthen ? "yes" : "no");
     Abc_Print(-2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-w     : toggle printing additional verbose information [default = %s]\n", fVeryVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-h     : print the command usage\n");
@@ -31870,11 +32019,25 @@ usage:
 int Abc_CommandAbc9Retime(Abc_Frame_t* pAbc, int argc, char** argv) {
     Gia_Man_t* pTemp;
     int c;
+    int Mode = 0;
     int nMaxIters = 100;
+    int nDelayLim = 0;
+    int fForwardOnly = 0;
+    int fBackwardOnly = 0;
     int fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "Nvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "MNDfbvh")) != EOF) {
         switch (c) {
+            case 'M':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-M\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                Mode = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (Mode < 0 || Mode > 2)
+                    goto usage;
+                break;
             case 'N':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-N\" should be followed by an integer.\n");
@@ -31885,6 +32048,22 @@ int Abc_CommandAbc9Retime(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (nMaxIters < 0)
                     goto usage;
                 break;
+            case 'D':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-D\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nDelayLim = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (nDelayLim < 0)
+                    goto usage;
+                break;
+            case 'f':
+                fForwardOnly ^= 1;
+                break;
+            case 'b':
+                fBackwardOnly ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -31902,14 +32081,31 @@ int Abc_CommandAbc9Retime(Abc_Frame_t* pAbc, int argc, char** argv) {
         Abc_Print(-1, "The network is combinational.\n");
         return 0;
     }
-    pTemp = Gia_ManRetimeForward(pAbc->pGia, nMaxIters, fVerbose);
+    if (Mode > 0 && pAbc->pGia->pMuxes) {
+        Abc_Print(-1, "Abc_CommandAbc9Retime(): This mode does not work for AIGs with XORs and MUXes.\n");
+        return 1;
+    }
+    if (Mode == 1)
+        pTemp = Gia_ManRetimeMinArea(pAbc->pGia, nMaxIters, fForwardOnly, fBackwardOnly, fVerbose);
+    else if (Mode == 2)
+        pTemp = Gia_ManRetimeMinDelay(pAbc->pGia, nDelayLim, fVerbose);
+    else
+        pTemp = Gia_ManRetimeForward(pAbc->pGia, nMaxIters, fVerbose);
     Abc_FrameUpdateGia(pAbc, pTemp);
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &retime [-N <num>] [-vh]\n");
-    Abc_Print(-2, "\t         performs most-forward retiming\n");
-    Abc_Print(-2, "\t-N num : the number of incremental iterations [default = %d]\n", nMaxIters);
+    Abc_Print(-2, "usage: &retime [-MND <num>] [-fbvh]\n");
+    Abc_Print(-2, "\t         performs retiming using one of the algorithms:\n");
+    Abc_Print(-2, "\t                0 : most-forward retiming\n");
+    Abc_Print(-2, "\t                1 : min-area retiming with initial state computation\n");
+    Abc_Print(-2, "\t                2 : min-delay retiming with initial state computation\n");
+    Abc_Print(-2, "\t-M num : the retiming algorithm to use [default = %d]\n", Mode);
+    Abc_Print(-2, "\t-N num : the number of incremental iterations of algorithms 0 and 1 [default = %d]\n", nMaxIters);
+    Abc_Print(-2, "\t-D num : the clock period to achieve by min-delay retiming [default = %d]\n", nDelayLim);
+    Abc_Print(-2, "\t         (if 0, the smallest period is found by binary search)\n");
+    Abc_Print(-2, "\t-f     : toggle forward-only min-area retiming [default = %s]\n", fForwardOnly ? "yes" : "no");
+    Abc_Print(-2, "\t-b     : toggle backward-only min-area retiming [default = %s]\n", fBackwardOnly ? "yes" : "no");
     Abc_Print(-2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-h     : print the command usage\n");
     return 1;
@@ -32061,6 +32257,100 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9CutRw(Abc_Frame_t* pAbc, int argc, char** argv) {
+    extern Gia_Man_t* Gia_ManCutRewrite(Gia_Man_t * pGia, int nCutSize, int nCutNum, int nBTLimit, int fUseZeros, char* pFileName, int fVerbose);
+    Gia_Man_t* pTemp;
+    char* pFileName = NULL;
+    int c, nCutSize = 6, nCutNum = 12, nBTLimit = 100, fUseZeros = 0, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ((c = Extra_UtilGetopt(argc, argv, "KNCFzvh")) != EOF) {
+        switch (c) {
+            case 'K':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-K\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nCutSize = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (nCutSize < 2 || nCutSize > 6)
+                    goto usage;
+                break;
+            case 'N':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-N\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nCutNum = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (nCutNum < 2 || nCutNum > 50)
+                    goto usage;
+                break;
+            case 'C':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-C\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nBTLimit = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (nBTLimit < 0)
+                    goto usage;
+                break;
+            case 'F':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-F\" should be followed by a file name.\n");
+                    goto usage;
+                }
+                pFileName = argv[globalUtilOptind];
+                globalUtilOptind++;
+                break;
+            case 'z':
+                fUseZeros ^= 1;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if (pAbc->pGia == NULL) {
+        Abc_Print(-1, "Abc_CommandAbc9CutRw(): There is no AIG.\n");
+        return 1;
+    }
+    if (pAbc->pGia->pMuxes) {
+        Abc_Print(-1, "Abc_CommandAbc9CutRw(): The AIG has XORs or MUXes (run \"&st\").\n");
+        return 1;
+    }
+    pTemp = Gia_ManCutRewrite(pAbc->pGia, nCutSize, nCutNum, nBTLimit, fUseZeros, pFileName, fVerbose);
+    Abc_FrameUpdateGia(pAbc, pTemp);
+    return 0;
+
+usage:
+    Abc_Print(-2, "usage: &cutrw [-KNC num] [-F file] [-zvh]\n");
+    Abc_Print(-2, "\t         performs AIG rewriting with cuts of up to six inputs\n");
+    Abc_Print(-2, "\t-K num : the max cut size (2 <= num <= 6) [default = %d]\n", nCutSize);
+    Abc_Print(-2, "\t-N num : the max number of cuts at a node (2 <= num <= 50) [default = %d]\n", nCutNum);
+    Abc_Print(-2, "\t-C num : the conflict limit of exact synthesis (0 = no exact synthesis) [default = %d]\n", nBTLimit);
+    Abc_Print(-2, "\t-F file: the library of structures to read and update [default = %s]\n", pFileName ? pFileName : "none");
+    Abc_Print(-2, "\t-z     : toggle using zero-cost replacements [default = %s]\n", fUseZeros ? "yes" : "no");
+    Abc_Print(-2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose ? "yes" : "no");
+    Abc_Print(-2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -33434,7 +33724,7 @@ int Abc_CommandAbc9Scorr(Abc_Frame_t* pAbc, int argc, char** argv) {
     int c;
     Cec_ManCorSetDefaultParams(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "FCPpkrecqwvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "FCPJpkrecqwvh")) != EOF) {
         switch (c) {
             case 'F':
                 if (globalUtilOptind >= argc) {
@@ -33466,6 +33756,16 @@ int Abc_CommandAbc9Scorr(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nPrefix < 0)
                     goto usage;
                 break;
+            case 'J':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-J\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
             case 'p':
                 fPartition ^= 1;
                 break;
@@ -33519,11 +33819,12 @@ int Abc_CommandAbc9Scorr(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &scorr [-FCP num] [-pkrecqwvh]\n");
+    Abc_Print(-2, "usage: &scorr [-FCPJ num] [-pkrecqwvh]\n");
     Abc_Print(-2, "\t         performs signal correpondence computation\n");
     Abc_Print(-2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-F num : the number of timeframes in inductive case [default = %d]\n", pPars->nFrames);
     Abc_Print(-2, "\t-P num : the number of timeframes in the prefix [default = %d]\n", pPars->nPrefix);
+    Abc_Print(-2, "\t-J num : the number of concurrent threads for the inductive case [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-p     : toggle using partitioning for the input AIG [default = %s]\n", fPartition ? "yes" : "no");
     Abc_Print(-2, "\t-k     : toggle using constant correspondence [default = %s]\n", pPars->fConstCorr ? "yes" : "no");
     Abc_Print(-2, "\t-r     : toggle using implication rings during refinement [default = %s]\n", pPars->fUseRings ? "yes" : "no");
@@ -38403,7 +38704,7 @@ int Abc_CommandAbc9Dch(Abc_Frame_t* pAbc, int argc, char** argv) {
     // set defaults
     Dch_ManSetDefaultParams(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "WCSsptfremgcxvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "WCSPsptfremgcxvh")) != EOF) {
         switch (c) {
             case 'W':
                 if (globalUtilOptind >= argc) {
@@ -38435,6 +38736,16 @@ int Abc_CommandAbc9Dch(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nSatVarMax < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs < 1)
+                    goto usage;
+                break;
             case 's':
                 pPars->fSynthesis ^= 1;
                 break;
@@ -38499,11 +38810,12 @@ int Abc_CommandAbc9Dch(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &dch [-WCS num] [-sptfremgcxvh]\n");
+    Abc_Print(-2, "usage: &dch [-WCSP num] [-sptfremgcxvh]\n");
     Abc_Print(-2, "\t         computes structural choices using a new approach\n");
     Abc_Print(-2, "\t-W num : the max number of simulation words [default = %d]\n", pPars->nWords);
     Abc_Print(-2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-S num : the max number of SAT variables [default = %d]\n", pPars->nSatVarMax);
+    Abc_Print(-2, "\t-P num : the number of concurrent threads for SAT sweeping [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-s     : toggle synthesizing three snapshots [default = %s]\n", pPars->fSynthesis ? "yes" : "no");
     Abc_Print(-2, "\t-p     : toggle power-aware rewriting [default = %s]\n", pPars->fPower ? "yes" : "no");
     Abc_Print(-2, "\t-t     : toggle simulation of the TFO classes [default = %s]\n", pPars->fSimulateTfo ? "yes" : "no");
@@ -39235,7 +39547,7 @@ int Abc_CommandAbc9ReachY(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->nBddMax = 100;
     pPars->nClusterMax = 500;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "BCFTLbcryzvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "BCFTPLbcryzvwh")) != EOF) {
         switch (c) {
             case 'B':
                 if (globalUtilOptind >= argc) {
@@ -39277,6 +39589,16 @@ int Abc_CommandAbc9ReachY(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->TimeLimit < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
             case 'L':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-L\" should be followed by a file name.\n");
@@ -39337,12 +39659,13 @@ int Abc_CommandAbc9ReachY(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &reachy [-BCFT num] [-L file] [-bcryzvh]\n");
+    Abc_Print(-2, "usage: &reachy [-BCFTP num] [-L file] [-bcryzvh]\n");
     Abc_Print(-2, "\t         model checking via BDD-based reachability (non-linear-QS-based)\n");
     Abc_Print(-2, "\t-B num : the max BDD size to introduce cut points [default = %d]\n", pPars->nBddMax);
     Abc_Print(-2, "\t-C num : the max BDD size to reparameterize/cluster [default = %d]\n", pPars->nClusterMax);
     Abc_Print(-2, "\t-F num : max number of reachability iterations [default = %d]\n", pPars->nIterMax);
     Abc_Print(-2, "\t-T num : approximate time limit in seconds (0=infinite) [default = %d]\n", pPars->TimeLimit);
+    Abc_Print(-2, "\t-P num : the number of threads computing image of frontier cubes [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-L file: the log file name [default = %s]\n", pLogFileName ? pLogFileName : "no logging");
     Abc_Print(-2, "\t-b     : enable using backward enumeration [default = %s]\n", pPars->fBackward ? "yes" : "no");
     Abc_Print(-2, "\t-c     : enable reparametrization clustering [default = %s]\n", pPars->fCluster ? "yes" : "no");
@@ -40237,12 +40560,12 @@ usage:
 
 ***********************************************************************/
 int Abc_CommandAbc9GroupProve(Abc_Frame_t* pAbc, int argc, char** argv) {
-    extern Vec_Int_t* Gia_ManGroupProve(Gia_Man_t * p, char* pCommLine, int nGroupSize, int fVerbose);
+    extern Vec_Int_t* Gia_ManGroupProve(Gia_Man_t * p, char* pCommLine, int nGroupSize, int fCluster, int fVerbose);
     Vec_Int_t* vStatus;
     char* pCommLine = NULL;
-    int c, nGroupSize = 1, fVerbose = 0;
+    int c, nGroupSize = 1, fCluster = 0, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "GSvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "GScvh")) != EOF) {
         switch (c) {
             case 'G':
                 if (globalUtilOptind >= argc) {
@@ -40261,6 +40584,10 @@ int Abc_CommandAbc9GroupProve(Abc_Frame_t* pAbc, int argc, char** argv) {
                 }
                 pCommLine = argv[globalUtilOptind];
                 globalUtilOptind++;
+                break;
+            case 'c':
+                fCluster ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -40278,16 +40605,17 @@ int Abc_CommandAbc9GroupProve(Abc_Frame_t* pAbc, int argc, char** argv) {
         Abc_Print(-1, "Abc_CommandAbc9GroupProve(): Command line is not given.\n");
         return 1;
     }
-    vStatus = Gia_ManGroupProve(pAbc->pGia, pCommLine, nGroupSize, fVerbose);
+    vStatus = Gia_ManGroupProve(pAbc->pGia, pCommLine, nGroupSize, fCluster, fVerbose);
     Vec_IntFree(vStatus);
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &gprove [-GS num] [-vh]\n");
+    Abc_Print(-2, "usage: &gprove [-GS num] [-cvh]\n");
     Abc_Print(-2, "\t         proves multi-output testcase by splitting outputs into groups\n");
     Abc_Print(-2, "\t         (currently, group size more than one works only for \"bmc3\" and \"pdr\")\n");
     Abc_Print(-2, "\t-G num : the size of one group [default = %d]\n", nGroupSize);
     Abc_Print(-2, "\t-S str : the command line to be executed for each group [default = %s]\n", pCommLine ? pCommLine : "none");
+    Abc_Print(-2, "\t-c     : toggle grouping outputs by cone overlap instead of by index [default = %s]\n", fCluster ? "yes" : "no");
     Abc_Print(-2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-h     : print the command usage\n");
     return 1;
@@ -40315,8 +40643,11 @@ int Abc_CommandAbc9MultiProve(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->TimeOutInc = 100;
     pPars->TimeOutGap = 0;
     pPars->TimePerOut = 0;
+    pPars->nProcs = 1;
+    pPars->nGroupMax = 16;
+    pPars->nMemLimit = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "TLMGHsdvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "TLMGHPCZFsdvwh")) != EOF) {
         switch (c) {
             case 'T':
                 if (globalUtilOptind >= argc) {
@@ -40368,6 +40699,44 @@ int Abc_CommandAbc9MultiProve(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->TimePerOut <= 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
+            case 'C':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-C\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nGroupMax = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nGroupMax <= 0)
+                    goto usage;
+                break;
+            case 'Z':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-Z\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nMemLimit = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nMemLimit < 0)
+                    goto usage;
+                break;
+            case 'F':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-F\" should be followed by a file name.\n");
+                    goto usage;
+                }
+                pPars->pStatusFile = argv[globalUtilOptind];
+                globalUtilOptind++;
+                break;
             case 's':
                 pPars->fUseSyn ^= 1;
                 break;
@@ -40394,20 +40763,31 @@ int Abc_CommandAbc9MultiProve(Abc_Frame_t* pAbc, int argc, char** argv) {
         Abc_Print(-1, "Abc_CommandAbc9MultiProve(): The problem is combinational.\n");
         return 1;
     }
+    if (pPars->nProcs > 1 && pPars->fUseSyn) {
+        Abc_Print(-1, "Abc_CommandAbc9MultiProve(): Synthesis (switch \"-s\") is not supported by concurrent threads (switch \"-P\").\n");
+        return 1;
+    }
     pAbc->Status = Gia_ManMultiProve(pAbc->pGia, pPars);
-    vStatuses = Abc_FrameDeriveStatusArray(pAbc->pGia->vSeqModelVec);
+    if (pPars->vOutMap)
+        vStatuses = pPars->vOutMap, pPars->vOutMap = NULL;
+    else
+        vStatuses = Abc_FrameDeriveStatusArray(pAbc->pGia->vSeqModelVec);
     Abc_FrameReplacePoStatuses(pAbc, &vStatuses);
     Abc_FrameReplaceCexVec(pAbc, &pAbc->pGia->vSeqModelVec);
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &mprove [-TLMGH num] [-sdvwh]\n");
+    Abc_Print(-2, "usage: &mprove [-TLMGHPCZ num] [-F file] [-sdvwh]\n");
     Abc_Print(-2, "\t         proves multi-output testcase by applying several engines\n");
     Abc_Print(-2, "\t-T num : approximate global runtime limit in seconds [default = %d]\n", pPars->TimeOutGlo);
     Abc_Print(-2, "\t-L num : approximate local runtime limit in seconds [default = %d]\n", pPars->TimeOutLoc);
     Abc_Print(-2, "\t-M num : percentage of local runtime limit increase [default = %d]\n", pPars->TimeOutInc);
     Abc_Print(-2, "\t-G num : approximate gap runtime limit in seconds [default = %d]\n", pPars->TimeOutGap);
     Abc_Print(-2, "\t-H num : timeout per output in miliseconds [default = %d]\n", pPars->TimePerOut);
+    Abc_Print(-2, "\t-P num : the number of concurrent threads (1 = sequential) [default = %d]\n", pPars->nProcs);
+    Abc_Print(-2, "\t-C num : the max number of outputs in one cluster [default = %d]\n", pPars->nGroupMax);
+    Abc_Print(-2, "\t-Z num : the memory limit for the concurrent clusters in MB (0 = no limit) [default = %d]\n", pPars->nMemLimit);
+    Abc_Print(-2, "\t-F file: the file to write the live status (with -P) [default = %s]\n", pPars->pStatusFile ? pPars->pStatusFile : "none");
     Abc_Print(-2, "\t-s     : toggle using combinational synthesis [default = %s]\n", pPars->fUseSyn ? "yes" : "no");
     Abc_Print(-2, "\t-d     : toggle dumping invariant into a file [default = %s]\n", pPars->fDumpFinal ? "yes" : "no");
     Abc_Print(-2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose ? "yes" : "no");
@@ -40673,6 +41053,8 @@ int Abc_CommandAbc9SBmc(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->nTimeOut = 0;                              // timeout in seconds
     pPars->nLutSize = 0;                              // max LUT size for CNF computation
     pPars->nProcs = 1;                                // the number of parallel solvers
+    pPars->nShareSize = 8;                            // the max size of shared learnt clauses
+    pPars->nShareLbd = 3;                             // the max LBD of shared learnt clauses
     pPars->fLoadCnf = 0;                              // dynamic CNF loading
     pPars->fDumpFrames = 0;                           // dump unrolled timeframes
     pPars->fUseSynth = 0;                             // use synthesis
@@ -40688,7 +41070,7 @@ int Abc_CommandAbc9SBmc(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->pFuncOnFrameDone = pAbc->pFuncOnFrameDone; // frame done callback
 
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "PCFATgevwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "PCFATSLgevwh")) != EOF) {
         switch (c) {
             case 'P':
                 if (globalUtilOptind >= argc) {
@@ -40740,6 +41122,26 @@ int Abc_CommandAbc9SBmc(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nTimeOut < 0)
                     goto usage;
                 break;
+            case 'S':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-S\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nShareSize = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nShareSize < 0)
+                    goto usage;
+                break;
+            case 'L':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-L\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nShareLbd = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nShareLbd < 0)
+                    goto usage;
+                break;
             case 'g':
                 pPars->fUseGlucose ^= 1;
                 break;
@@ -40762,6 +41164,10 @@ int Abc_CommandAbc9SBmc(Abc_Frame_t* pAbc, int argc, char** argv) {
         Abc_Print(-1, "Abc_CommandAbc9Bmcs(): There is no AIG.\n");
         return 0;
     }
+    if (pPars->nShareSize > 100) {
+        Abc_Print(-1, "Abc_CommandAbc9Bmcs(): The size of shared clauses cannot exceed 100 literals.\n");
+        return 0;
+    }
     if (pPars->nProcs > 4) {
         Abc_Print(-1, "Abc_CommandAbc9Bmcs(): Currently this command can run at most 4 concurrent solvers.\n");
         return 0;
@@ -40772,13 +41178,15 @@ int Abc_CommandAbc9SBmc(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &bmcs [-PCFAT num] [-gevwh]\n");
+    Abc_Print(-2, "usage: &bmcs [-PCFATSL num] [-gevwh]\n");
     Abc_Print(-2, "\t         performs bounded model checking\n");
     Abc_Print(-2, "\t-P num : the number of parallel solvers [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-C num : the SAT solver conflict limit [default = %d]\n", pPars->nConfLimit);
     Abc_Print(-2, "\t-F num : the maximum number of timeframes [default = %d]\n", pPars->nFramesMax);
     Abc_Print(-2, "\t-A num : the number of additional frames to unroll [default = %d]\n", pPars->nFramesAdd);
     Abc_Print(-2, "\t-T num : approximate timeout in seconds [default = %d]\n", pPars->nTimeOut);
+    Abc_Print(-2, "\t-S num : the max size of learnt clauses shared by parallel solvers (0 = no sharing) [default = %d]\n", pPars->nShareSize);
+    Abc_Print(-2, "\t-L num : the max LBD of learnt clauses shared by parallel solvers [default = %d]\n", pPars->nShareLbd);
     Abc_Print(-2, "\t-g     : toggle using Glucose 3.0 by Gilles Audemard and Laurent Simon [default = %s]\n", pPars->fUseGlucose ? "Glucose" : "Satoko");
     Abc_Print(-2, "\t-e     : toggle using variable eliminatation [default = %s]\n", pPars->fUseEliminate ? "yes" : "no");
     Abc_Print(-2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose ? "yes" : "no");
@@ -43067,7 +43475,7 @@ int Abc_CommandAbc9Mfs(Abc_Frame_t* pAbc, int argc, char** argv) {
     pPars->nDepthMax = 100;
     pPars->nWinSizeMax = 2000;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "WFDMLCNdaeblvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "WFDMLCNPdaeblvwh")) != EOF) {
         switch (c) {
             case 'W':
                 if (globalUtilOptind >= argc) {
@@ -43139,6 +43547,16 @@ int Abc_CommandAbc9Mfs(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nNodesMax < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs < 0)
+                    goto usage;
+                break;
             case 'd':
                 pPars->fRrOnly ^= 1;
                 break;
@@ -43194,7 +43612,7 @@ int Abc_CommandAbc9Mfs(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &mfs [-WFDMLCN <num>] [-daeblvwh]\n");
+    Abc_Print(-2, "usage: &mfs [-WFDMLCNP <num>] [-daeblvwh]\n");
     Abc_Print(-2, "\t           performs don't-care-based optimization of logic networks\n");
     Abc_Print(-2, "\t-W <num> : the number of levels in the TFO cone (0 <= num) [default = %d]\n", pPars->nTfoLevMax);
     Abc_Print(-2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n", pPars->nFanoutMax);
@@ -43203,6 +43621,7 @@ usage:
     Abc_Print(-2, "\t-L <num> : the max increase in node level after resynthesis (0 <= num) [default = %d]\n", pPars->nGrowthLevel);
     Abc_Print(-2, "\t-C <num> : the max number of conflicts in one SAT run (0 = no limit) [default = %d]\n", pPars->nBTLimit);
     Abc_Print(-2, "\t-N <num> : the max number of nodes to try (0 = all) [default = %d]\n", pPars->nNodesMax);
+    Abc_Print(-2, "\t-P <num> : the number of threads for resubstitution (0 or 1 = none) [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-d       : toggle performing redundancy removal [default = %s]\n", pPars->fRrOnly ? "yes" : "no");
     Abc_Print(-2, "\t-a       : toggle minimizing area or area+edges [default = %s]\n", pPars->fArea ? "area" : "area+edges");
     Abc_Print(-2, "\t-e       : toggle high-effort resubstitution [default = %s]\n", pPars->fMoreEffort ? "yes" : "no");
@@ -43232,7 +43651,7 @@ int Abc_CommandAbc9Mfsd(Abc_Frame_t* pAbc, int argc, char** argv) {
     Sbd_Par_t Pars, *pPars = &Pars;
     Sbd_ParSetDefault(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "KSNPWFMCmcdpvwh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "KSNPWFMCJmcdpvwh")) != EOF) {
         switch (c) {
             case 'K':
                 if (globalUtilOptind >= argc) {
@@ -43314,6 +43733,16 @@ int Abc_CommandAbc9Mfsd(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nBTLimit < 0)
                     goto usage;
                 break;
+            case 'J':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-J\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
             case 'm':
                 pPars->fMapping ^= 1;
                 break;
@@ -43353,7 +43782,7 @@ int Abc_CommandAbc9Mfsd(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &mfsd [-KSNPWFMC <num>] [-mcdpvwh]\n");
+    Abc_Print(-2, "usage: &mfsd [-KSNPWFMCJ <num>] [-mcdpvwh]\n");
     Abc_Print(-2, "\t           performs SAT-based delay-oriented AIG optimization\n");
     Abc_Print(-2, "\t-K <num> : the LUT size for delay minimization (2 <= num <= 6) [default = %d]\n", pPars->nLutSize);
     Abc_Print(-2, "\t-S <num> : the LUT structure size (1 <= num <= 2) [default = %d]\n", pPars->nLutNum);
@@ -43363,6 +43792,7 @@ usage:
     Abc_Print(-2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n", pPars->nTfoFanMax);
     Abc_Print(-2, "\t-M <num> : the max node count of windows to consider (0 = no limit) [default = %d]\n", pPars->nWinSizeMax);
     Abc_Print(-2, "\t-C <num> : the max number of conflicts in one SAT run (0 = no limit) [default = %d]\n", pPars->nBTLimit);
+    Abc_Print(-2, "\t-J <num> : the number of threads solving the windows (1 = sequential) [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-m       : toggle generating delay-oriented mapping [default = %s]\n", pPars->fMapping ? "yes" : "no");
     Abc_Print(-2, "\t-c       : toggle using several cuts at each node [default = %s]\n", pPars->fMoreCuts ? "yes" : "no");
     Abc_Print(-2, "\t-d       : toggle additional search for good divisors [default = %s]\n", pPars->fFindDivs ? "yes" : "no");
@@ -43385,11 +43815,11 @@ usage:
 
 ***********************************************************************/
 int Abc_CommandAbc9DeepSyn(Abc_Frame_t* pAbc, int argc, char** argv) {
-    extern Gia_Man_t* Gia_ManDeepSyn(Gia_Man_t * pGia, int nIters, int nNoImpr, int TimeOut, int nAnds, int Seed, int fUseTwo, int fVerbose);
+    extern Gia_Man_t* Gia_ManDeepSyn(Gia_Man_t * pGia, int nIters, int nNoImpr, int TimeOut, int nAnds, int Seed, int nProcs, int fUseTwo, int fVerbose);
     Gia_Man_t* pTemp;
-    int c, nIters = 1, nNoImpr = ABC_INFINITY, TimeOut = 0, nAnds = 0, Seed = 0, fUseTwo = 0, fVerbose = 0;
+    int c, nIters = 1, nNoImpr = ABC_INFINITY, TimeOut = 0, nAnds = 0, Seed = 0, nProcs = 1, fUseTwo = 0, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "IJTAStvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "IJTASPtvh")) != EOF) {
         switch (c) {
             case 'I':
                 if (globalUtilOptind >= argc) {
@@ -43441,6 +43871,16 @@ int Abc_CommandAbc9DeepSyn(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (Seed < 0)
                     goto usage;
                 break;
+            case 'P':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-P\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (nProcs < 1 || nProcs > 100)
+                    goto usage;
+                break;
             case 't':
                 fUseTwo ^= 1;
                 break;
@@ -43457,18 +43897,19 @@ int Abc_CommandAbc9DeepSyn(Abc_Frame_t* pAbc, int argc, char** argv) {
         Abc_Print(-1, "Abc_CommandAbc9DeepSyn(): There is no AIG.\n");
         return 0;
     }
-    pTemp = Gia_ManDeepSyn(pAbc->pGia, nIters, nNoImpr, TimeOut, nAnds, Seed, fUseTwo, fVerbose);
+    pTemp = Gia_ManDeepSyn(pAbc->pGia, nIters, nNoImpr, TimeOut, nAnds, Seed, nProcs, fUseTwo, fVerbose);
     Abc_FrameUpdateGia(pAbc, pTemp);
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &deepsyn [-IJTAS <num>] [-tvh]\n");
+    Abc_Print(-2, "usage: &deepsyn [-IJTASP <num>] [-tvh]\n");
     Abc_Print(-2, "\t           performs synthesis\n");
     Abc_Print(-2, "\t-I <num> : the number of iterations [default = %d]\n", nIters);
     Abc_Print(-2, "\t-J <num> : the number of steps without improvements [default = %d]\n", nNoImpr);
     Abc_Print(-2, "\t-T <num> : the timeout in seconds (0 = no timeout) [default = %d]\n", TimeOut);
     Abc_Print(-2, "\t-A <num> : the number of nodes to stop (0 = no limit) [default = %d]\n", nAnds);
     Abc_Print(-2, "\t-S <num> : user-specified random seed (0 <= num <= 100) [default = %d]\n", Seed);
+    Abc_Print(-2, "\t-P <num> : the number of concurrent threads (1 <= num <= 100) [default = %d]\n", nProcs);
     Abc_Print(-2, "\t-t       : toggle using two-input LUTs [default = %s]\n", fUseTwo ? "yes" : "no");
     Abc_Print(-2, "\t-v       : toggle printing optimization summary [default = %s]\n", fVerbose ? "yes" : "no");
     Abc_Print(-2, "\t-h       : print the command usage\n");
@@ -44087,7 +44528,7 @@ int Abc_CommandAbc9Gla(Abc_Frame_t* pAbc, int argc, char** argv) {
     char* pLogFileName = NULL;
     Abs_ParSetDefaults(pPars);
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "FSCMDETRQPBALtfardmnscbpquwvh")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "FSCMDETRQPBJALtfardmnscbpquwvh")) != EOF) {
         switch (c) {
             case 'F':
                 if (globalUtilOptind >= argc) {
@@ -44199,6 +44640,16 @@ int Abc_CommandAbc9Gla(Abc_Frame_t* pAbc, int argc, char** argv) {
                 if (pPars->nFramesNoChangeLim < 0)
                     goto usage;
                 break;
+            case 'J':
+                if (globalUtilOptind >= argc) {
+                    Abc_Print(-1, "Command line switch \"-J\" should be followed by an integer.\n");
+                    goto usage;
+                }
+                pPars->nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if (pPars->nProcs <= 0)
+                    goto usage;
+                break;
             case 'A':
                 if (globalUtilOptind >= argc) {
                     Abc_Print(-1, "Command line switch \"-A\" should be followed by a file name.\n");
@@ -44322,7 +44773,7 @@ int Abc_CommandAbc9Gla(Abc_Frame_t* pAbc, int argc, char** argv) {
     return 0;
 
 usage:
-    Abc_Print(-2, "usage: &gla [-FSCMDETRQPB num] [-AL file] [-fardmnscbpquwvh]\n");
+    Abc_Print(-2, "usage: &gla [-FSCMDETRQPBJ num] [-AL file] [-fardmnscbpquwvh]\n");
     Abc_Print(-2, "\t          fixed-time-frame gate-level proof- and cex-based abstraction\n");
     Abc_Print(-2, "\t-F num  : the max number of timeframes to unroll [default = %d]\n", pPars->nFramesMax);
     Abc_Print(-2, "\t-S num  : the starting time frame (0=unused) [default = %d]\n", pPars->nFramesStart);
@@ -44335,6 +44786,7 @@ usage:
     Abc_Print(-2, "\t-Q num  : stop when abstraction size exceeds num %% during refinement (0<=num<=100) [default = %d]\n", pPars->nRatioMin2);
     Abc_Print(-2, "\t-P num  : maximum percentage of added objects before a restart (0<=num<=100) [default = %d]\n", pPars->nRatioMax);
     Abc_Print(-2, "\t-B num  : the number of stable frames to call prover or dump abstraction [default = %d]\n", pPars->nFramesNoChangeLim);
+    Abc_Print(-2, "\t-J num  : the number of threads computing candidate refinements [default = %d]\n", pPars->nProcs);
     Abc_Print(-2, "\t-A file : file name for dumping abstrated model (&gla -d) or abstraction map (&gla -m)\n");
     Abc_Print(-2, "\t-L file : the log file name [default = %s]\n", pLogFileName ? pLogFileName : "no logging");
     Abc_Print(-2, "\t-f      : toggle propagating fanout implications [default = %s]\n", pPars->fPropFanout ? "yes" : "no");
@@ -2065,13 +2065,13 @@ Abc_Ntk_t* Abc_NtkDarSeqSweep2(Abc_Ntk_t* pNtk, Ssw_Pars_t* pPars) {
   SeeAlso     []
  
 ***********************************************************************/
-Abc_Ntk_t* Abc_NtkDarLcorr(Abc_Ntk_t* pNtk, int nFramesP, int nConfMax, int fVerbose) {
+Abc_Ntk_t* Abc_NtkDarLcorr(Abc_Ntk_t* pNtk, int nFramesP, int nSimFrames, int nConfMax, int fVerbose) {
     Aig_Man_t *pMan, *pTemp;
     Abc_Ntk_t* pNtkAig = NULL;
     pMan = Abc_NtkToDar(pNtk, 0, 1);
     if (pMan == NULL)
         return NULL;
-    pMan = Fra_FraigLatchCorrespondence(pTemp = pMan, nFramesP, nConfMax, 0, fVerbose, NULL, 0.0);
+    pMan = Fra_FraigLatchCorrespondence(pTemp = pMan, nFramesP, nSimFrames, nConfMax, 0, fVerbose, NULL, 0.0);
     Aig_ManStop(pTemp);
     if (pMan) {
         if (Aig_ManRegNum(pMan) < Abc_NtkLatchNum(pNtk))
@@ -2099,7 +2099,7 @@ Abc_Ntk_t* Abc_NtkDarLcorr(Abc_Ntk_t* pNtk, int nFramesP, int nConfMax, int fVer
   SeeAlso     []
  
 ***********************************************************************/
-Abc_Ntk_t* Abc_NtkDarLcorrNew(Abc_Ntk_t* pNtk, int nVarsMax, int nConfMax, int fVerbose) {
+Abc_Ntk_t* Abc_NtkDarLcorrNew(Abc_Ntk_t* pNtk, int nVarsMax, int nSimFrames, int nConfMax, int fVerbose) {
     Ssw_Pars_t Pars, *pPars = &Pars;
     Aig_Man_t *pMan, *pTemp;
     Abc_Ntk_t* pNtkAig = NULL;
@@ -2108,6 +2108,7 @@ Abc_Ntk_t* Abc_NtkDarLcorrNew(Abc_Ntk_t* pNtk, int nVarsMax, int nConfMax, int f
         return NULL;
     Ssw_ManSetDefaultParams(pPars);
     pPars->fLatchCorrOpt = 1;
+    pPars->nSimFrames = nSimFrames;
     pPars->nBTLimit = nConfMax;
     pPars->nSatVarMax = nVarsMax;
     pPars->fVerbose = fVerbose;
@@ -3490,6 +3491,46 @@ int Abc_NtkDarInduction(Abc_Ntk_t* pNtk, int nTimeOut, int nFramesMax, int nConf
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs k-induction with concurrent base and step cases.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDarInductionPar(Abc_Ntk_t* pNtk, int nTimeOut, int nFramesMax, int nConfMax, int fStrengthen, int fVerbose) {
+    Aig_Man_t* pMan;
+    Gia_Man_t* pGia;
+    abctime clkTotal = Abc_Clock();
+    int RetValue;
+    pMan = Abc_NtkToDar(pNtk, 0, 1);
+    if (pMan == NULL)
+        return -1;
+    pGia = Gia_ManFromAigSimple(pMan);
+    Aig_ManStop(pMan);
+    RetValue = Bmc_KindPerform(pGia, nFramesMax, nConfMax, nTimeOut, fStrengthen, fVerbose);
+    if (RetValue == 1) {
+        Abc_Print(1, "Networks are equivalent.  ");
+        ABC_PRT("Time", Abc_Clock() - clkTotal);
+    } else if (RetValue == 0) {
+        Abc_Print(1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pGia->pCexSeq->iPo, pNtk->pName, pGia->pCexSeq->iFrame);
+        ABC_PRT("Time", Abc_Clock() - clkTotal);
+    } else {
+        Abc_Print(1, "Networks are UNDECIDED.  ");
+        ABC_PRT("Time", Abc_Clock() - clkTotal);
+    }
+    ABC_FREE(pNtk->pModel);
+    ABC_FREE(pNtk->pSeqModel);
+    pNtk->pSeqModel = pGia->pCexSeq;
+    pGia->pCexSeq = NULL;
+    Gia_ManStop(pGia);
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Interplates two networks.]
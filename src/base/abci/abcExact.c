@@ -1943,7 +1943,7 @@ static int Ses_CheckGatesConsistency(Ses_Man_t* pSes, int nGates) {
         return 0;
     }
 
-    if (pSes->fDecStructure && nGates >= (1 << (pSes->nMaxDepth - 1)) + 1) {
+    if (pSes->fDecStructure && pSes->nMaxDepth != -1 && nGates >= (1 << (pSes->nMaxDepth - 1)) + 1) {
         if (pSes->fReasonVerbose)
             printf("give up due to impossible depth in AND-dec structure (depth = %d, gates = %d)", pSes->nMaxDepth, nGates);
         return 0;
@@ -2036,7 +2036,7 @@ static int Ses_ManFindNetworkExact(Ses_Man_t* pSes, int nGates) {
 // is there a network for a given number of gates
 /* return: (3: impossible, 2: continue, 1: found, 0: gave up) */
 static int Ses_ManFindNetworkExactCEGAR(Ses_Man_t* pSes, int nGates, char** pSol) {
-    int fRes, iMint, fSat, i;
+    int fRes, iMint, fSat, i, nIters = 0;
     word pTruth[4];
 
     /* debug */
@@ -2064,6 +2064,12 @@ static int Ses_ManFindNetworkExactCEGAR(Ses_Man_t* pSes, int nGates, char** pSol
         }
         ABC_FREE(*pSol);
 
+        /* each refinement constrains a new row, so more refinements than rows mean no progress */
+        if (++nIters > pSes->nRows) {
+            pSes->fHitResLimit = 1;
+            return 0;
+        }
+
         if (pSes->fKeepRowAssigns)
             Abc_TtSetBit(pSes->pTtValues, iMint - 1);
         if (!Ses_ManCreateTruthTableClause(pSes, iMint - 1)) /* UNSAT, continue */
@@ -2263,6 +2269,46 @@ Gia_Man_t* Gia_ManFindExact(word* pTruth, int nVars, int nFunc, int nMaxDepth, i
     return pGia;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds an AIG with fewer than nMaxGates gates.]
+
+  Description [Tries the gate counts in the increasing order. Returns NULL
+               if there is no such AIG or if the conflict limit is reached.
+               The truth table should have four words. The conflict limit
+               should be positive, because it is the only bound on the
+               runtime of each SAT call.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t* Gia_ManFindExactSmaller(word* pTruth, int nVars, int nMaxGates, int nBTLimit) {
+    Ses_Man_t* pSes;
+    char* pSol = NULL;
+    Gia_Man_t* pGia = NULL;
+    int nGates, fRes;
+
+    assert(nVars >= 2 && nVars <= 8);
+    assert(nBTLimit > 0);
+
+    pSes = Ses_ManAlloc(pTruth, nVars, 1, -1, NULL, 1, nBTLimit, 0);
+    memset(pSes->pTtValues, 0, 4 * sizeof(word));
+    nGates = Abc_MaxInt(0, Vec_IntSize(pSes->vStairDecVars) - 1);
+    while (++nGates < nMaxGates) {
+        fRes = Ses_ManFindNetworkExactCEGAR(pSes, nGates, &pSol);
+        if (fRes == 0 || fRes == 1 || fRes == 3)
+            break;
+    }
+    if (pSol) {
+        pGia = Ses_ManExtractGia(pSol);
+        ABC_FREE(pSol);
+    }
+    Ses_ManClean(pSes);
+    return pGia;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Some test cases.]
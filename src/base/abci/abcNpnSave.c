@@ -62,7 +62,7 @@ static word Truth[8] = {
     ABC_CONST(0x0000000000000000),
     ABC_CONST(0xFFFFFFFFFFFFFFFF)};
 
-static Npn_Man_t* pNpnMan = NULL;
+static ABC_THREAD_LOCAL Npn_Man_t* pNpnMan = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
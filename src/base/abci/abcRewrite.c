@@ -34,7 +34,7 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Cut_Man_t* Abc_NtkStartCutManForRewrite(Abc_Ntk_t* pNtk);
+static Cut_Man_t* Abc_NtkStartCutManForRewrite(Abc_Ntk_t* pNtk, int nVarsMax);
 static void Abc_NodePrintCuts(Abc_Obj_t* pNode);
 static void Abc_ManShowCutCone(Abc_Obj_t* pNode, Vec_Ptr_t* vLeaves);
 
@@ -57,7 +57,7 @@ extern void Abc_PlaceUpdate(Vec_Ptr_t* vAddedCells, Vec_Ptr_t* vUpdatedNets);
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkRewrite(Abc_Ntk_t* pNtk, int fUpdateLevel, int fUseZeros, int fVerbose, int fVeryVerbose, int fPlaceEnable) {
+int Abc_NtkRewrite(Abc_Ntk_t* pNtk, int fUpdateLevel, int fUseZeros, int fUse5, int fVerbose, int fVeryVerbose, int fPlaceEnable) {
     extern void Dec_GraphUpdateNetwork(Abc_Obj_t * pRoot, Dec_Graph_t * pGraph, int fUpdateLevel, int nGain);
     ProgressBar* pProgress;
     Cut_Man_t* pManCut;
@@ -90,12 +90,13 @@ int Abc_NtkRewrite(Abc_Ntk_t* pNtk, int fUpdateLevel, int fUseZeros, int fVerbos
     pManRwr = Rwr_ManStart(0);
     if (pManRwr == NULL)
         return 0;
+    pManRwr->fUse5 = fUse5;
     // compute the reverse levels if level update is requested
     if (fUpdateLevel)
         Abc_NtkStartReverseLevels(pNtk, 0);
     // start the cut manager
     clk = Abc_Clock();
-    pManCut = Abc_NtkStartCutManForRewrite(pNtk);
+    pManCut = Abc_NtkStartCutManForRewrite(pNtk, fUse5 ? 5 : 4);
     Rwr_ManAddTimeCuts(pManRwr, Abc_Clock() - clk);
     pNtk->pManCut = pManCut;
 
@@ -195,20 +196,20 @@ int Abc_NtkRewrite(Abc_Ntk_t* pNtk, int fUpdateLevel, int fUseZeros, int fVerbos
   SeeAlso     []
 
 ***********************************************************************/
-Cut_Man_t* Abc_NtkStartCutManForRewrite(Abc_Ntk_t* pNtk) {
+Cut_Man_t* Abc_NtkStartCutManForRewrite(Abc_Ntk_t* pNtk, int nVarsMax) {
     static Cut_Params_t Params, *pParams = &Params;
     Cut_Man_t* pManCut;
     Abc_Obj_t* pObj;
     int i;
     // start the cut manager
     memset(pParams, 0, sizeof(Cut_Params_t));
-    pParams->nVarsMax = 4;   // the max cut size ("k" of the k-feasible cuts)
-    pParams->nKeepMax = 250; // the max number of cuts kept at a node
-    pParams->fTruth = 1;     // compute truth tables
-    pParams->fFilter = 1;    // filter dominated cuts
-    pParams->fSeq = 0;       // compute sequential cuts
-    pParams->fDrop = 0;      // drop cuts on the fly
-    pParams->fVerbose = 0;   // the verbosiness flag
+    pParams->nVarsMax = nVarsMax; // the max cut size ("k" of the k-feasible cuts)
+    pParams->nKeepMax = 250;      // the max number of cuts kept at a node
+    pParams->fTruth = 1;          // compute truth tables
+    pParams->fFilter = 1;         // filter dominated cuts
+    pParams->fSeq = 0;            // compute sequential cuts
+    pParams->fDrop = 0;           // drop cuts on the fly
+    pParams->fVerbose = 0;        // the verbosiness flag
     pParams->nIdsMax = Abc_NtkObjNumMax(pNtk);
     pManCut = Cut_ManStart(pParams);
     if (pParams->fDrop)
@@ -1178,7 +1178,9 @@ void Abc_NtkStopReverseLevels(Abc_Ntk_t* pNtk) {
 
   Synopsis    [Incrementally updates level of the nodes.]
 
-  Description []
+  Description [The level structure is empty between the calls. Only the
+  levels holding the scheduled nodes are visited and cleaned, so the cost
+  of an update does not depend on the depth of the network.]
                
   SideEffects []
 
@@ -1187,7 +1189,7 @@ void Abc_NtkStopReverseLevels(Abc_Ntk_t* pNtk) {
 ***********************************************************************/
 void Abc_NtkUpdateLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
     Abc_Obj_t *pFanout, *pTemp;
-    int LevelOld, Lev, k, m;
+    int LevelOld, LevelMax, Lev, k, m;
     //    int Counter = 0, CounterMax = 0;
     // check if level has changed
     LevelOld = Abc_ObjLevel(pObjNew);
@@ -1196,11 +1198,11 @@ void Abc_NtkUpdateLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
     // start the data structure for level update
     // we cannot fail to visit a node when using this structure because the
     // nodes are stored by their _old_ levels, which are assumed to be correct
-    Vec_VecClear(vLevels);
     Vec_VecPush(vLevels, LevelOld, pObjNew);
+    LevelMax = LevelOld;
     pObjNew->fMarkA = 1;
     // recursively update level
-    Vec_VecForEachEntryStart(Abc_Obj_t*, vLevels, pTemp, Lev, k, LevelOld) {
+    Vec_VecForEachEntryStartStop(Abc_Obj_t*, vLevels, pTemp, Lev, k, LevelOld, LevelMax + 1) {
         //        Counter--;
         pTemp->fMarkA = 0;
         assert(Abc_ObjLevel(pTemp) == Lev);
@@ -1213,6 +1215,7 @@ void Abc_NtkUpdateLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
             if (!Abc_ObjIsCo(pFanout) && !pFanout->fMarkA) {
                 assert(Abc_ObjLevel(pFanout) >= Lev);
                 Vec_VecPush(vLevels, Abc_ObjLevel(pFanout), pFanout);
+                LevelMax = Abc_MaxInt(LevelMax, Abc_ObjLevel(pFanout));
                 //                Counter++;
                 //                CounterMax = Abc_MaxFloat( CounterMax, Counter );
                 pFanout->fMarkA = 1;
@@ -1220,6 +1223,9 @@ void Abc_NtkUpdateLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
         }
     }
     //    printf( "%d ", CounterMax );
+    // clean the visited levels
+    for (Lev = LevelOld; Lev <= LevelMax; Lev++)
+        Vec_PtrClear(Vec_VecEntry(vLevels, Lev));
 }
 
 /**Function*************************************************************
@@ -1235,7 +1241,7 @@ void Abc_NtkUpdateLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
 ***********************************************************************/
 void Abc_NtkUpdateReverseLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
     Abc_Obj_t *pFanin, *pTemp;
-    int LevelOld, LevFanin, Lev, k, m;
+    int LevelOld, LevelMax, LevFanin, Lev, k, m;
     // check if level has changed
     LevelOld = Abc_ObjReverseLevel(pObjNew);
     if (LevelOld == Abc_ObjReverseLevelNew(pObjNew))
@@ -1243,14 +1249,13 @@ void Abc_NtkUpdateReverseLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
     // start the data structure for level update
     // we cannot fail to visit a node when using this structure because the
     // nodes are stored by their _old_ levels, which are assumed to be correct
-    Vec_VecClear(vLevels);
     Vec_VecPush(vLevels, LevelOld, pObjNew);
+    LevelMax = LevelOld;
     pObjNew->fMarkA = 1;
     // recursively update level
-    Vec_VecForEachEntryStart(Abc_Obj_t*, vLevels, pTemp, Lev, k, LevelOld) {
+    Vec_VecForEachEntryStartStop(Abc_Obj_t*, vLevels, pTemp, Lev, k, LevelOld, LevelMax + 1) {
         pTemp->fMarkA = 0;
-        LevelOld = Abc_ObjReverseLevel(pTemp);
-        assert(LevelOld == Lev);
+        assert(Abc_ObjReverseLevel(pTemp) == Lev);
         Abc_ObjSetReverseLevel(pTemp, Abc_ObjReverseLevelNew(pTemp));
         // if the level did not change, no need to check the fanout levels
         if (Abc_ObjReverseLevel(pTemp) == Lev)
@@ -1261,10 +1266,14 @@ void Abc_NtkUpdateReverseLevel(Abc_Obj_t* pObjNew, Vec_Vec_t* vLevels) {
                 LevFanin = Abc_ObjReverseLevel(pFanin);
                 assert(LevFanin >= Lev);
                 Vec_VecPush(vLevels, LevFanin, pFanin);
+                LevelMax = Abc_MaxInt(LevelMax, LevFanin);
                 pFanin->fMarkA = 1;
             }
         }
     }
+    // clean the visited levels
+    for (Lev = LevelOld; Lev <= LevelMax; Lev++)
+        Vec_PtrClear(Vec_VecEntry(vLevels, Lev));
 }
 
 /**Function*************************************************************
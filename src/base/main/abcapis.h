@@ -106,6 +106,13 @@ extern ABC_DLL void* Abc_FrameReadCex(Abc_Frame_t* pAbc);
 // procedure to return sequential equivalences
 extern ABC_DLL int* Abc_FrameReadMiniAigEquivClasses(Abc_Frame_t* pAbc);
 
+// procedures to run incremental BMC on the current AIG (outputs and constraints are selected by PO index)
+extern ABC_DLL void* Abc_FrameBmcStart(Abc_Frame_t* pAbc);
+extern ABC_DLL void Abc_FrameBmcStop(void* pSes);
+extern ABC_DLL void Abc_FrameBmcSetOutput(void* pSes, int iPo, int fActive);
+extern ABC_DLL void Abc_FrameBmcSetConstraint(void* pSes, int iPo, int fActive);
+extern ABC_DLL int Abc_FrameBmcSolve(Abc_Frame_t* pAbc, void* pSes, int nFrames, int nConfLimit);
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
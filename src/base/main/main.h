@@ -74,6 +74,8 @@ extern ABC_DLL Abc_Ntk_t* Abc_FrameReadNtk(Abc_Frame_t* p);
 extern ABC_DLL Gia_Man_t* Abc_FrameReadGia(Abc_Frame_t* p);
 extern ABC_DLL FILE* Abc_FrameReadOut(Abc_Frame_t* p);
 extern ABC_DLL FILE* Abc_FrameReadErr(Abc_Frame_t* p);
+extern ABC_DLL void Abc_FrameSetOut(Abc_Frame_t* p, FILE* pFile);
+extern ABC_DLL void Abc_FrameSetErr(Abc_Frame_t* p, FILE* pFile);
 extern ABC_DLL int Abc_FrameReadMode(Abc_Frame_t* p);
 extern ABC_DLL int Abc_FrameSetMode(Abc_Frame_t* p, int fNameMode);
 extern ABC_DLL void Abc_FrameRestart(Abc_Frame_t* p);
@@ -105,6 +107,7 @@ extern ABC_DLL void* Abc_FrameReadManDd();
 extern ABC_DLL void* Abc_FrameReadManDec();
 extern ABC_DLL void* Abc_FrameReadManDsd();
 extern ABC_DLL void* Abc_FrameReadManDsd2();
+extern ABC_DLL int Abc_FrameReadNpnImage(unsigned short** puCanons, char** puPhases, char** puPerms, unsigned char** puMap);
 extern ABC_DLL Vec_Ptr_t* Abc_FrameReadSignalNames();
 extern ABC_DLL char* Abc_FrameReadSpecName();
 
@@ -21,6 +21,7 @@
 #include "base/abc/abc.h"
 #include "mainInt.h"
 #include "bool/dec/dec.h"
+#include "opt/rwr/rwr.h"
 #include "map/if/if.h"
 #include "aig/miniaig/ndr.h"
 
@@ -28,13 +29,32 @@
 #    include "bdd/extrab/extraBdd.h"
 #endif
 
+#ifdef ABC_USE_PTHREADS
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#    endif
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Abc_Frame_t* s_GlobalFrame = NULL;
+// the current frame of the calling thread; each thread that calls
+// Abc_Start() works with its own frame, so that several ABC sessions
+// can run concurrently in one process
+static ABC_THREAD_LOCAL Abc_Frame_t* s_GlobalFrame = NULL;
+
+#ifdef ABC_USE_PTHREADS
+// the frame started by a thread is also recorded under this key, so that
+// it is stopped when the thread exits without calling Abc_Stop()
+static pthread_key_t s_FrameKey;
+static pthread_once_t s_FrameKeyOnce = PTHREAD_ONCE_INIT;
+static void Abc_FrameKeyStart(void);
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -72,7 +92,8 @@ void* Abc_FrameReadManDec() {
 }
 void* Abc_FrameReadManDsd() { return s_GlobalFrame->pManDsd; }
 void* Abc_FrameReadManDsd2() { return s_GlobalFrame->pManDsd2; }
-char* Abc_FrameReadFlag(char* pFlag) { return Cmd_FlagReadByName(s_GlobalFrame, pFlag); }
+int Abc_FrameReadNpnImage(unsigned short** puCanons, char** puPhases, char** puPerms, unsigned char** puMap) { return Rwr_ImgReadNpn(puCanons, puPhases, puPerms, puMap); }
+char* Abc_FrameReadFlag(char* pFlag) { return s_GlobalFrame ? Cmd_FlagReadByName(s_GlobalFrame, pFlag) : NULL; }
 Vec_Ptr_t* Abc_FrameReadSignalNames() { return s_GlobalFrame->vSignalNames; }
 char* Abc_FrameReadSpecName() { return s_GlobalFrame->pSpecName; }
 
@@ -114,15 +135,24 @@ void Abc_FrameSetLibGen2(void* pLib) { s_GlobalFrame->pLibGen2 = pLib; }
 void Abc_FrameSetLibMiMo(void* pLib) { s_GlobalFrame->pLibMiMo = pLib; }
 void Abc_FrameSetLibSuper(void* pLib) { s_GlobalFrame->pLibSuper = pLib; }
 void Abc_FrameSetFlag(char* pFlag, char* pValue) { Cmd_FlagUpdateValue(s_GlobalFrame, pFlag, pValue); }
+// the engines may call these from worker threads, which have no frame
 void Abc_FrameSetCex(Abc_Cex_t* pCex) {
+    if (s_GlobalFrame == NULL) {
+        ABC_FREE(pCex);
+        return;
+    }
     ABC_FREE(s_GlobalFrame->pCex);
     s_GlobalFrame->pCex = pCex;
 }
 void Abc_FrameSetNFrames(int nFrames) {
+    if (s_GlobalFrame == NULL)
+        return;
     ABC_FREE(s_GlobalFrame->pCex);
     s_GlobalFrame->nFrames = nFrames;
 }
 void Abc_FrameSetStatus(int Status) {
+    if (s_GlobalFrame == NULL)
+        return;
     ABC_FREE(s_GlobalFrame->pCex);
     s_GlobalFrame->Status = Status;
 }
@@ -135,6 +165,10 @@ void Abc_FrameSetManDsd2(void* pMan) {
     s_GlobalFrame->pManDsd2 = pMan;
 }
 void Abc_FrameSetInv(Vec_Int_t* vInv) {
+    if (s_GlobalFrame == NULL) {
+        Vec_IntFreeP(&vInv);
+        return;
+    }
     Vec_IntFreeP(&s_GlobalFrame->pAbcWlcInv);
     s_GlobalFrame->pAbcWlcInv = vInv;
 }
@@ -155,6 +189,9 @@ void Abc_FrameSetSpecName(char* pFileName) {
     s_GlobalFrame->pSpecName = pFileName;
 }
 
+void Abc_FrameSetOut(Abc_Frame_t* p, FILE* pFile) { p->Out = pFile; }
+void Abc_FrameSetErr(Abc_Frame_t* p, FILE* pFile) { p->Err = pFile; }
+
 int Abc_FrameIsBatchMode() { return s_GlobalFrame ? s_GlobalFrame->fBatchMode : 0; }
 void Abc_FrameSetBatchMode(int Mode) {
     if (s_GlobalFrame) s_GlobalFrame->fBatchMode = Mode;
@@ -300,10 +337,10 @@ void Abc_FrameDeallocate(Abc_Frame_t* p) {
     ABC_FREE(p->pCex2);
     ABC_FREE(p->pCex);
     Vec_IntFreeP(&p->pAbcWlcInv);
-    Abc_NamDeref(s_GlobalFrame->pJsonStrs);
-    Vec_WecFreeP(&s_GlobalFrame->vJsonObjs);
-    Ndr_Delete(s_GlobalFrame->pNdr);
-    ABC_FREE(s_GlobalFrame->pNdrArray);
+    Abc_NamDeref(p->pJsonStrs);
+    Vec_WecFreeP(&p->vJsonObjs);
+    Ndr_Delete(p->pNdr);
+    ABC_FREE(p->pNdrArray);
 
     Gia_ManStopP(&p->pGiaMiniAig);
     Gia_ManStopP(&p->pGiaMiniLut);
@@ -312,8 +349,14 @@ void Abc_FrameDeallocate(Abc_Frame_t* p) {
     ABC_FREE(p->pArray);
     ABC_FREE(p->pBoxes);
 
+    if (s_GlobalFrame == p) {
+        s_GlobalFrame = NULL;
+#ifdef ABC_USE_PTHREADS
+        pthread_once(&s_FrameKeyOnce, Abc_FrameKeyStart);
+        pthread_setspecific(s_FrameKey, NULL);
+#endif
+    }
     ABC_FREE(p);
-    s_GlobalFrame = NULL;
 }
 
 /**Function*************************************************************
@@ -659,6 +702,46 @@ void Abc_FrameSetGlobalFrame(Abc_Frame_t* p) {
     s_GlobalFrame = p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Stops the frame of the exiting thread.]
+
+  Description [Called by pthreads for the threads that exit without
+  calling Abc_Stop().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void Abc_FrameThreadExit(void* pArg) {
+    Abc_Frame_t* p = (Abc_Frame_t*)pArg;
+    s_GlobalFrame = p;
+    Abc_FrameEnd(p);
+    Abc_FrameDeallocate(p);
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the key recording the frame of each thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void Abc_FrameKeyStart(void) {
+    int status = pthread_key_create(&s_FrameKey, Abc_FrameThreadExit);
+    assert(status == 0);
+    (void)status;
+}
+#endif
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -676,6 +759,11 @@ Abc_Frame_t* Abc_FrameGetGlobalFrame() {
         s_GlobalFrame = Abc_FrameAllocate();
         // perform initializations
         Abc_FrameInit(s_GlobalFrame);
+#ifdef ABC_USE_PTHREADS
+        // stop the framework when this thread exits
+        pthread_once(&s_FrameKeyOnce, Abc_FrameKeyStart);
+        pthread_setspecific(s_FrameKey, s_GlobalFrame);
+#endif
     }
     return s_GlobalFrame;
 }
@@ -41,7 +41,14 @@ ABC_NAMESPACE_IMPL_START
   For example, some error messages while parsing files will not be 
   produced, and intermediate networks will not be checked for consistancy. 
   One possibility is to load the resource file after Abc_Start() as follows:
-  Abc_UtilsSource(  Abc_FrameGetGlobalFrame() );]
+  Abc_UtilsSource(  Abc_FrameGetGlobalFrame() );
+  When compiled with ABC_USE_PTHREADS, the frame is thread-local, so
+  each thread may call Abc_Start()/Abc_Stop() to run its own session.
+  The frame started by a thread, either here or on demand by a command
+  or an engine reading the frame, is stopped when the thread exits, if
+  Abc_Stop() has not been called. Abc_Print() and printf() write to the
+  standard output of the process in all threads, so the output of
+  concurrent sessions is interleaved.]
                
   SideEffects []
 
@@ -20,6 +20,8 @@
 
 #include "wlc.h"
 #include "sat/bmc/bmc.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -137,6 +139,9 @@ void* Wla_Bmc3Thread(void* pArg) {
     Aig_ManStop(pData->pAig);
     ABC_FREE(pData);
 
+    // free the managers allocated by this thread
+    Cnf_ManFree();
+    Dar_LibStop();
     // quit this thread
     pthread_exit(NULL);
     assert(0);
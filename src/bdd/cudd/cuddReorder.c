@@ -100,7 +100,7 @@ ABC_NAMESPACE_IMPL_START
 static char rcsid[] DD_UNUSED = "$Id: cuddReorder.c,v 1.69 2009/02/21 18:24:10 fabio Exp $";
 #endif
 
-static int* entry;
+static ABC_THREAD_LOCAL int* entry;
 
 int ddTotalNumberSwapping;
 #ifdef DD_STATS
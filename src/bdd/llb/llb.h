@@ -60,6 +60,7 @@ struct Gia_ParLlb_t_ {
     int fSkipOutCheck; // does not check the property output
     int TimeLimit;     // time limit for one reachability run
     int TimeLimitGlo;  // time limit for all reachability runs
+    int nProcs;        // the number of threads computing image of frontier cubes
     // internal parameters
     abctime TimeTarget; // the time to stop
     int iFrame;         // explored up to this frame
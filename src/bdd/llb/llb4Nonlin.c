@@ -46,6 +46,7 @@ struct Llb_Mnx_t_ {
     // structural info
     Vec_Int_t* vOrder;  // for each object ID, its BDD variable number or -1
     Vec_Int_t* vVars2Q; // 1 if variable is quantifiable; 0 othervise
+    Llb_Par_t* pPar;    // threads computing image of frontier cubes
 
     abctime timeImage;
     abctime timeRemap;
@@ -727,30 +728,43 @@ int Llb_Nonlin4Reachability(Llb_Mnx_t* p) {
         }
 
         // compute the next states
-        clkTemp = Abc_Clock();
-        p->bNext = Llb_Nonlin4Image(p->dd, p->vRoots, p->bCurrent, p->vVars2Q);
-        if (p->bNext == NULL) {
-            if (!p->pPars->fSilent)
-                printf("Reached timeout (%d seconds) during image computation in quantification.\n", p->pPars->TimeLimit);
-            p->pPars->iFrame = nIters - 1;
-            return -1;
-        }
-        Cudd_Ref(p->bNext);
-        p->timeImage += Abc_Clock() - clkTemp;
+        if (p->pPar) {
+            clkTemp = Abc_Clock();
+            p->bNext = Llb_Nonlin4ParImage(p->pPar, p->bCurrent, p->pPars->TimeTarget);
+            if (p->bNext == NULL) {
+                if (!p->pPars->fSilent)
+                    printf("Reached timeout (%d seconds) during partitioned image computation.\n", p->pPars->TimeLimit);
+                p->pPars->iFrame = nIters - 1;
+                return -1;
+            }
+            p->timeImage += Abc_Clock() - clkTemp;
+            bAux = p->bNext;
+        } else {
+            clkTemp = Abc_Clock();
+            p->bNext = Llb_Nonlin4Image(p->dd, p->vRoots, p->bCurrent, p->vVars2Q);
+            if (p->bNext == NULL) {
+                if (!p->pPars->fSilent)
+                    printf("Reached timeout (%d seconds) during image computation in quantification.\n", p->pPars->TimeLimit);
+                p->pPars->iFrame = nIters - 1;
+                return -1;
+            }
+            Cudd_Ref(p->bNext);
+            p->timeImage += Abc_Clock() - clkTemp;
 
-        // remap into current states
-        clkTemp = Abc_Clock();
-        p->bNext = Cudd_bddVarMap(p->dd, bAux = p->bNext);
-        if (p->bNext == NULL) {
-            if (!p->pPars->fSilent)
-                printf("Reached timeout (%d seconds) during remapping next states.\n", p->pPars->TimeLimit);
+            // remap into current states
+            clkTemp = Abc_Clock();
+            p->bNext = Cudd_bddVarMap(p->dd, bAux = p->bNext);
+            if (p->bNext == NULL) {
+                if (!p->pPars->fSilent)
+                    printf("Reached timeout (%d seconds) during remapping next states.\n", p->pPars->TimeLimit);
+                Cudd_RecursiveDeref(p->dd, bAux);
+                p->pPars->iFrame = nIters - 1;
+                return -1;
+            }
+            Cudd_Ref(p->bNext);
             Cudd_RecursiveDeref(p->dd, bAux);
-            p->pPars->iFrame = nIters - 1;
-            return -1;
+            p->timeRemap += Abc_Clock() - clkTemp;
         }
-        Cudd_Ref(p->bNext);
-        Cudd_RecursiveDeref(p->dd, bAux);
-        p->timeRemap += Abc_Clock() - clkTemp;
 
         // collect statistics
         if (p->pPars->fVerbose) {
@@ -917,6 +931,8 @@ Llb_Mnx_t* Llb_MnxStart(Aig_Man_t* pAig, Gia_ParLlb_t* pPars) {
 
     if (pPars->fReorder)
         Llb_Nonlin4Reorder(p->dd, 0, 1);
+    if (pPars->nProcs > 1 && p->vRoots)
+        p->pPar = Llb_Nonlin4ParStart(p->dd, pAig, p->vOrder, p->vRoots, p->vVars2Q, pPars->nProcs, pPars->fVerbose);
     return p;
 }
 
@@ -934,6 +950,7 @@ Llb_Mnx_t* Llb_MnxStart(Aig_Man_t* pAig, Gia_ParLlb_t* pPars) {
 void Llb_MnxStop(Llb_Mnx_t* p) {
     DdNode* bTemp;
     int i;
+    Llb_Nonlin4ParStop(p->pPar);
     if (p->pPars->fVerbose) {
         p->timeReo = Cudd_ReadReorderingTime(p->dd);
         p->timeOther = p->timeTotal - p->timeImage - p->timeRemap;
@@ -0,0 +1,420 @@
+/**CFile****************************************************************
+
+  FileName    [llb4Par.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [BDD based reachability.]
+
+  Synopsis    [Image computation for frontier cubes in separate BDD managers.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: llb4Par.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "llbInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX      100
+#define LLB_PAR_SIZE_MIN 100 // smaller frontiers are not split
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Llb_Par_t* Llb_Nonlin4ParStart(DdManager* dd, Aig_Man_t* pAig, Vec_Int_t* vOrder, Vec_Ptr_t* vRoots, Vec_Int_t* vVars2Q, int nProcs, int fVerbose) { return NULL; }
+void Llb_Nonlin4ParStop(Llb_Par_t* p) {}
+DdNode* Llb_Nonlin4ParImage(Llb_Par_t* p, DdNode* bCurrent, abctime TimeTarget) { return NULL; }
+
+#else // pthreads are used
+
+// information given to the thread
+typedef struct Llb_ParThData_t_ {
+    DdManager* dd;      // the private BDD manager
+    Vec_Ptr_t* vRoots;  // the partitions in the private manager
+    Vec_Int_t* vVars2Q; // 1 if variable is quantifiable; 0 othervise
+    Vec_Ptr_t* vCubes;  // the frontier cubes assigned to this thread
+    DdNode* bImage;     // the image of the cubes in terms of current-state variables
+    abctime nTimeLeft;  // the runtime remaining before timeout (0 = no timeout)
+    int fStop;          // the thread should exit
+    int fWorking;       // the thread is computing image
+} Llb_ParThData_t;
+
+struct Llb_Par_t_ {
+    DdManager* dd;                       // the main BDD manager
+    Vec_Ptr_t* vRoots;                   // the partitions in the main manager
+    Vec_Int_t* vVars2Q;                  // 1 if variable is quantifiable; 0 othervise
+    int nProcs;                          // the number of threads
+    int nSplitVars;                      // the number of variables to split the frontier
+    int fVerbose;                        // print statistics
+    Llb_ParThData_t ThData[PAR_THR_MAX]; // the thread data
+    pthread_t WorkerThread[PAR_THR_MAX]; // the threads
+    // statistics
+    int nImagesPar;                      // images computed by splitting the frontier
+    int nImagesSeq;                      // images computed in the main manager
+    int nCubes;                          // the number of non-empty frontier cubes
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of the cubes in the private manager.]
+
+  Description [Returns the image in terms of current-state variables
+  or NULL if the timeout was reached.]
+
+  SideEffects [Dereferences the cubes.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static DdNode* Llb_Nonlin4ParImageCubes(Llb_ParThData_t* pThData) {
+    DdManager* dd = pThData->dd;
+    DdNode *bCube, *bImage, *bTemp, *bRes;
+    int i;
+    bRes = Cudd_ReadLogicZero(dd);
+    Cudd_Ref(bRes);
+    Vec_PtrForEachEntry(DdNode*, pThData->vCubes, bCube, i) {
+        if (bRes == NULL) {
+            Cudd_RecursiveDeref(dd, bCube);
+            continue;
+        }
+        bImage = Llb_Nonlin4Image(dd, pThData->vRoots, bCube, pThData->vVars2Q);
+        Cudd_RecursiveDeref(dd, bCube);
+        if (bImage == NULL) {
+            Cudd_RecursiveDeref(dd, bRes);
+            bRes = NULL;
+            continue;
+        }
+        Cudd_Ref(bImage);
+        // remap into current states
+        bImage = Cudd_bddVarMap(dd, bTemp = bImage);
+        if (bImage == NULL) {
+            Cudd_RecursiveDeref(dd, bTemp);
+            Cudd_RecursiveDeref(dd, bRes);
+            bRes = NULL;
+            continue;
+        }
+        Cudd_Ref(bImage);
+        Cudd_RecursiveDeref(dd, bTemp);
+        // add to the result
+        bRes = Cudd_bddOr(dd, bTemp = bRes, bImage);
+        if (bRes != NULL)
+            Cudd_Ref(bRes);
+        Cudd_RecursiveDeref(dd, bTemp);
+        Cudd_RecursiveDeref(dd, bImage);
+    }
+    Vec_PtrClear(pThData->vCubes);
+    return bRes;
+}
+
+void* Llb_Nonlin4ParWorkerThread(void* pArg) {
+    Llb_ParThData_t* pThData = (Llb_ParThData_t*)pArg;
+    volatile int* pPlace = &pThData->fWorking;
+    while (1) {
+        while (*pPlace == 0)
+            ;
+        assert(pThData->fWorking);
+        if (pThData->fStop) {
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        // the clock is measured per thread, so the stop time is set here
+        pThData->dd->TimeStop = pThData->nTimeLeft ? Abc_Clock() + pThData->nTimeLeft : 0;
+        pThData->bImage = Llb_Nonlin4ParImageCubes(pThData);
+        pThData->dd->TimeStop = 0;
+        pThData->fWorking = 0;
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the threads with their private BDD managers.]
+
+  Description [Each thread receives a copy of the partitions of the
+  transition relation and the variable map of the main manager. The
+  variable order of the private managers follows the main manager at
+  the time of the call, which keeps the first transfers cheap.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Llb_Par_t* Llb_Nonlin4ParStart(DdManager* dd, Aig_Man_t* pAig, Vec_Int_t* vOrder, Vec_Ptr_t* vRoots, Vec_Int_t* vVars2Q, int nProcs, int fVerbose) {
+    Llb_Par_t* p;
+    DdNode* bRoot;
+    int* pPerm;
+    int i, k, status;
+    assert(nProcs > 1);
+    p = ABC_CALLOC(Llb_Par_t, 1);
+    p->dd = dd;
+    p->vRoots = vRoots;
+    p->vVars2Q = vVars2Q;
+    p->nProcs = Abc_MinInt(nProcs, PAR_THR_MAX);
+    p->nSplitVars = Abc_Base2Log(p->nProcs);
+    p->fVerbose = fVerbose;
+    pPerm = ABC_ALLOC(int, Cudd_ReadSize(dd));
+    for (i = 0; i < Cudd_ReadSize(dd); i++)
+        pPerm[i] = Cudd_ReadInvPerm(dd, i);
+    for (i = 0; i < p->nProcs; i++) {
+        Llb_ParThData_t* pThData = p->ThData + i;
+        pThData->dd = Cudd_Init(Cudd_ReadSize(dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0);
+        Cudd_ShuffleHeap(pThData->dd, pPerm);
+        Cudd_AutodynEnable(pThData->dd, CUDD_REORDER_SYMM_SIFT);
+        Cudd_SetMaxGrowth(pThData->dd, 1.05);
+        Llb_Nonlin4SetupVarMap(pThData->dd, pAig, vOrder);
+        pThData->vRoots = Vec_PtrAlloc(Vec_PtrSize(vRoots));
+        Vec_PtrForEachEntry(DdNode*, vRoots, bRoot, k) {
+            bRoot = Cudd_bddTransfer(dd, pThData->dd, bRoot);
+            Cudd_Ref(bRoot);
+            Vec_PtrPush(pThData->vRoots, bRoot);
+        }
+        pThData->vVars2Q = Vec_IntDup(vVars2Q);
+        pThData->vCubes = Vec_PtrAlloc(1 << p->nSplitVars);
+        status = pthread_create(p->WorkerThread + i, NULL, Llb_Nonlin4ParWorkerThread, (void*)pThData);
+        assert(status == 0);
+    }
+    ABC_FREE(pPerm);
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the threads and their BDD managers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParStop(Llb_Par_t* p) {
+    DdNode* bRoot;
+    int i, k;
+    if (p == NULL)
+        return;
+    for (i = 0; i < p->nProcs; i++) {
+        assert(!p->ThData[i].fWorking);
+        p->ThData[i].fStop = 1;
+        p->ThData[i].fWorking = 1;
+    }
+    for (i = 0; i < p->nProcs; i++)
+        pthread_join(p->WorkerThread[i], NULL);
+    if (p->fVerbose)
+        printf("Image computation: %d times in %d threads (%.1f cubes on average) and %d times sequentially.\n",
+               p->nImagesPar, p->nProcs, p->nImagesPar ? 1.0 * p->nCubes / p->nImagesPar : 0.0, p->nImagesSeq);
+    for (i = 0; i < p->nProcs; i++) {
+        Llb_ParThData_t* pThData = p->ThData + i;
+        Vec_PtrForEachEntry(DdNode*, pThData->vRoots, bRoot, k)
+            Cudd_RecursiveDeref(pThData->dd, bRoot);
+        Vec_PtrFree(pThData->vRoots);
+        Vec_PtrFree(pThData->vCubes);
+        Vec_IntFree(pThData->vVars2Q);
+        Extra_StopManager(pThData->dd);
+    }
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image in the main manager.]
+
+  Description [Returns the referenced image in terms of current-state
+  variables or NULL if the timeout was reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static DdNode* Llb_Nonlin4ParImageSeq(Llb_Par_t* p, DdNode* bCurrent) {
+    DdNode *bNext, *bTemp;
+    p->nImagesSeq++;
+    bNext = Llb_Nonlin4Image(p->dd, p->vRoots, bCurrent, p->vVars2Q);
+    if (bNext == NULL)
+        return NULL;
+    Cudd_Ref(bNext);
+    bNext = Cudd_bddVarMap(p->dd, bTemp = bNext);
+    if (bNext != NULL)
+        Cudd_Ref(bNext);
+    Cudd_RecursiveDeref(p->dd, bTemp);
+    return bNext;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the frontier into disjoint cubes.]
+
+  Description [Cofactors the frontier with respect to all assignments of
+  its topmost support variables. Returns the referenced non-empty parts
+  or NULL if the timeout was reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t* Llb_Nonlin4ParSplit(Llb_Par_t* p, DdNode* bCurrent, int nVars) {
+    DdManager* dd = p->dd;
+    Vec_Ptr_t* vParts;
+    DdNode *bSupp, *bVar, *bCube, *bPart, *pVars[16];
+    int i, k;
+    assert(nVars > 0 && nVars < 16);
+    bSupp = Cudd_Support(dd, bCurrent);
+    if (bSupp == NULL)
+        return NULL;
+    Cudd_Ref(bSupp);
+    for (k = 0, bVar = bSupp; k < nVars; k++, bVar = Cudd_T(bVar))
+        pVars[k] = Cudd_bddIthVar(dd, Cudd_NodeReadIndex(bVar));
+    vParts = Vec_PtrAlloc(1 << nVars);
+    for (i = 0; i < (1 << nVars); i++) {
+        bCube = Cudd_ReadOne(dd);
+        Cudd_Ref(bCube);
+        for (k = 0; k < nVars; k++) {
+            bCube = Cudd_bddAnd(dd, bVar = bCube, Cudd_NotCond(pVars[k], !((i >> k) & 1)));
+            Cudd_Ref(bCube);
+            Cudd_RecursiveDeref(dd, bVar);
+        }
+        bPart = Cudd_bddAnd(dd, bCurrent, bCube);
+        if (bPart == NULL) {
+            Cudd_RecursiveDeref(dd, bCube);
+            Vec_PtrForEachEntry(DdNode*, vParts, bPart, k)
+                Cudd_RecursiveDeref(dd, bPart);
+            Vec_PtrFree(vParts);
+            Cudd_RecursiveDeref(dd, bSupp);
+            return NULL;
+        }
+        Cudd_Ref(bPart);
+        Cudd_RecursiveDeref(dd, bCube);
+        if (bPart == Cudd_ReadLogicZero(dd))
+            Cudd_RecursiveDeref(dd, bPart);
+        else
+            Vec_PtrPush(vParts, bPart);
+    }
+    Cudd_RecursiveDeref(dd, bSupp);
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of the frontier using the threads.]
+
+  Description [The frontier is split into disjoint cubes, which are
+  distributed among the threads. Each thread computes the image of its
+  cubes in its own manager. The images are transferred back and merged.
+  Small frontiers are processed in the main manager. Returns the
+  referenced image in terms of current-state variables or NULL if the
+  timeout was reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode* Llb_Nonlin4ParImage(Llb_Par_t* p, DdNode* bCurrent, abctime TimeTarget) {
+    DdManager* dd = p->dd;
+    Vec_Ptr_t* vParts;
+    DdNode *bPart, *bNext, *bTemp;
+    abctime nTimeLeft = 0;
+    int i, nVars, fBusy[PAR_THR_MAX], fFailed = 0;
+    // small frontiers are not worth splitting
+    nVars = Abc_MinInt(p->nSplitVars, Cudd_SupportSize(dd, bCurrent));
+    if (nVars == 0 || Cudd_DagSize(bCurrent) < LLB_PAR_SIZE_MIN)
+        return Llb_Nonlin4ParImageSeq(p, bCurrent);
+    vParts = Llb_Nonlin4ParSplit(p, bCurrent, nVars);
+    if (vParts == NULL)
+        return NULL;
+    p->nImagesPar++;
+    p->nCubes += Vec_PtrSize(vParts);
+    // distribute the cubes among the threads
+    Vec_PtrForEachEntry(DdNode*, vParts, bPart, i) {
+        Llb_ParThData_t* pThData = p->ThData + i % p->nProcs;
+        bTemp = Cudd_bddTransfer(dd, pThData->dd, bPart);
+        Cudd_Ref(bTemp);
+        Vec_PtrPush(pThData->vCubes, bTemp);
+        Cudd_RecursiveDeref(dd, bPart);
+    }
+    Vec_PtrFree(vParts);
+    // compute the images
+    if (TimeTarget)
+        nTimeLeft = Abc_MaxInt(1, TimeTarget - Abc_Clock());
+    for (i = 0; i < p->nProcs; i++) {
+        assert(!p->ThData[i].fWorking);
+        p->ThData[i].bImage = NULL;
+        p->ThData[i].nTimeLeft = nTimeLeft;
+        p->ThData[i].fWorking = (Vec_PtrSize(p->ThData[i].vCubes) > 0);
+        fBusy[i] = p->ThData[i].fWorking;
+    }
+    for (i = 0; i < p->nProcs; i++) {
+        volatile int* pPlace = &p->ThData[i].fWorking;
+        while (*pPlace)
+            ;
+    }
+    // merge the images
+    bNext = Cudd_ReadLogicZero(dd);
+    Cudd_Ref(bNext);
+    for (i = 0; i < p->nProcs; i++) {
+        Llb_ParThData_t* pThData = p->ThData + i;
+        if (pThData->bImage == NULL) {
+            fFailed |= fBusy[i];
+            continue;
+        }
+        bTemp = fFailed ? NULL : Cudd_bddTransfer(pThData->dd, dd, pThData->bImage);
+        Cudd_RecursiveDeref(pThData->dd, pThData->bImage);
+        pThData->bImage = NULL;
+        if (bTemp == NULL) {
+            fFailed = 1;
+            continue;
+        }
+        Cudd_Ref(bTemp);
+        bNext = Cudd_bddOr(dd, bPart = bNext, bTemp);
+        if (bNext != NULL)
+            Cudd_Ref(bNext);
+        Cudd_RecursiveDeref(dd, bPart);
+        Cudd_RecursiveDeref(dd, bTemp);
+        if (bNext == NULL)
+            fFailed = 1;
+    }
+    if (fFailed) {
+        if (bNext)
+            Cudd_RecursiveDeref(dd, bNext);
+        return NULL;
+    }
+    return bNext;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
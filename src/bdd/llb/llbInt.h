@@ -46,6 +46,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Llb_Man_t_ Llb_Man_t;
 typedef struct Llb_Mtr_t_ Llb_Mtr_t;
 typedef struct Llb_Grp_t_ Llb_Grp_t;
+typedef struct Llb_Par_t_ Llb_Par_t;
 
 struct Llb_Man_t_ {
     Gia_ParLlb_t* pPars; // parameters
@@ -188,6 +189,11 @@ extern Vec_Ptr_t* Llb_Nonlin4Group(DdManager* dd, Vec_Ptr_t* vParts, Vec_Int_t*
 //extern Vec_Int_t *     Llb_AigMap( Aig_Man_t * pAig, int nLutSize, int nLutMin );
 /*=== llb4Nonlin.c ======================================================*/
 //extern int             Llb_Nonlin4CoreReach( Aig_Man_t * pAig, Gia_ParLlb_t * pPars );
+extern void Llb_Nonlin4SetupVarMap(DdManager* dd, Aig_Man_t* pAig, Vec_Int_t* vOrder);
+/*=== llb4Par.c =========================================================*/
+extern Llb_Par_t* Llb_Nonlin4ParStart(DdManager* dd, Aig_Man_t* pAig, Vec_Int_t* vOrder, Vec_Ptr_t* vRoots, Vec_Int_t* vVars2Q, int nProcs, int fVerbose);
+extern void Llb_Nonlin4ParStop(Llb_Par_t* p);
+extern DdNode* Llb_Nonlin4ParImage(Llb_Par_t* p, DdNode* bCurrent, abctime TimeTarget);
 /*=== llb4Sweep.c ======================================================*/
 extern void Llb4_Nonlin4Sweep(Aig_Man_t* pAig, int nSweepMax, int nClusterMax, DdManager** pdd, Vec_Int_t** pvOrder, Vec_Ptr_t** pvGroups, int fVerbose);
 
@@ -81,6 +81,7 @@ struct Dec_Man_t_ {
     char* pPhases;            // canonical phases
     char* pPerms;             // canonical permutations
     unsigned char* pMap;      // mapping of functions into class numbers
+    int fNpnShared;           // the above tables belong to the shared image
 };
 
 ////////////////////////////////////////////////////////////////////////
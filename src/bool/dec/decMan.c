@@ -18,6 +18,7 @@
 
 #include "base/abc/abc.h"
 #include "misc/mvc/mvc.h"
+#include "base/main/main.h"
 #include "dec.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -49,7 +50,9 @@ Dec_Man_t* Dec_ManStart() {
     p->vCubes = Vec_IntAlloc(8);
     p->vLits = Vec_IntAlloc(8);
     // canonical forms, phases, perms
-    Extra_Truth4VarNPN(&p->puCanons, &p->pPhases, &p->pPerms, &p->pMap);
+    p->fNpnShared = Abc_FrameReadNpnImage(&p->puCanons, &p->pPhases, &p->pPerms, &p->pMap);
+    if (!p->fNpnShared)
+        Extra_Truth4VarNPN(&p->puCanons, &p->pPhases, &p->pPerms, &p->pMap);
     //ABC_PRT( "NPN classes precomputation time", Abc_Clock() - clk );
     return p;
 }
@@ -69,10 +72,12 @@ void Dec_ManStop(Dec_Man_t* p) {
     Mvc_ManagerFree((Mvc_Manager_t*)p->pMvcMem);
     Vec_IntFree(p->vCubes);
     Vec_IntFree(p->vLits);
-    ABC_FREE(p->puCanons);
-    ABC_FREE(p->pPhases);
-    ABC_FREE(p->pPerms);
-    ABC_FREE(p->pMap);
+    if (!p->fNpnShared) {
+        ABC_FREE(p->puCanons);
+        ABC_FREE(p->pPhases);
+        ABC_FREE(p->pPerms);
+        ABC_FREE(p->pMap);
+    }
     ABC_FREE(p);
 }
 
@@ -59,7 +59,11 @@ static void Extra_ProgressBarClean(ProgressBar* p);
 ***********************************************************************/
 ProgressBar* Extra_ProgressBarStart(FILE* pFile, int nItemsTotal) {
     ProgressBar* p;
-    if (!Abc_FrameShowProgress(Abc_FrameGetGlobalFrame())) return NULL;
+    Abc_Frame_t* pFrame;
+    pFrame = Abc_FrameReadGlobalFrame();
+    if (pFrame == NULL)
+        return NULL;
+    if (!Abc_FrameShowProgress(pFrame)) return NULL;
     p = ABC_ALLOC(ProgressBar, 1);
     memset(p, 0, sizeof(ProgressBar));
     p->pFile = pFile;
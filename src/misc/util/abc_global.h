@@ -65,6 +65,15 @@
 #        endif
 #    endif
 
+// per-thread storage for the static managers used by concurrent engines
+#    if !defined(ABC_USE_PTHREADS)
+#        define ABC_THREAD_LOCAL
+#    elif defined(_MSC_VER)
+#        define ABC_THREAD_LOCAL __declspec(thread)
+#    else
+#        define ABC_THREAD_LOCAL __thread
+#    endif
+
 /*
 #ifdef __cplusplus
 #error "C++ code"
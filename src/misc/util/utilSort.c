@@ -738,8 +738,8 @@ void Abc_QuickSortTest() {
 #define NUMBER2 2174103536u
 
 unsigned Abc_Random(int fReset) {
-    static unsigned int m_z = NUMBER1;
-    static unsigned int m_w = NUMBER2;
+    static ABC_THREAD_LOCAL unsigned int m_z = NUMBER1;
+    static ABC_THREAD_LOCAL unsigned int m_w = NUMBER2;
     if (fReset) {
         m_z = NUMBER1;
         m_w = NUMBER2;
@@ -105,7 +105,9 @@ struct Dar_Lib_t_ // library
     unsigned char* pMap;
 };
 
-static Dar_Lib_t* s_DarLib = NULL;
+// each thread uses its own library, which is allocated on the first call to Dar_LibPrepare();
+// every worker thread that runs engines able to rewrite AIGs calls Dar_LibStop() before exiting
+static ABC_THREAD_LOCAL Dar_Lib_t* s_DarLib = NULL;
 
 static inline Dar_LibObj_t* Dar_LibObj(Dar_Lib_t* p, int Id) { return p->pObjs + Id; }
 static inline int Dar_LibObjTruth(Dar_LibObj_t* pObj) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -189,6 +191,8 @@ void Dar_LibFree(Dar_Lib_t* p) {
 
 ***********************************************************************/
 int Dar_LibReturnClass(unsigned uTruth) {
+    if (s_DarLib == NULL) // this thread has not used the library yet
+        Dar_LibStart();
     return s_DarLib->pMap[uTruth & 0xffff];
 }
 
@@ -206,6 +210,8 @@ int Dar_LibReturnClass(unsigned uTruth) {
 void Dar_LibReturnCanonicals(unsigned* pCanons) {
     int Visits[222] = {0};
     int i, k;
+    if (s_DarLib == NULL) // this thread has not used the library yet
+        Dar_LibStart();
     // find canonical truth tables
     for (i = k = 0; i < (1 << 16); i++)
         if (!Visits[s_DarLib->pMap[i]]) {
@@ -448,8 +454,11 @@ void Dar_LibSetup0_rec(Dar_Lib_t* p, Dar_LibObj_t* pObj, int Class, int fCollect
 
 ***********************************************************************/
 void Dar_LibPrepare(int nSubgraphs) {
-    Dar_Lib_t* p = s_DarLib;
+    Dar_Lib_t* p;
     int i, k, nNodes0Total;
+    if (s_DarLib == NULL) // this thread has not used the library yet
+        Dar_LibStart();
+    p = s_DarLib;
     if (p->nSubgraphs == nSubgraphs)
         return;
 
@@ -579,7 +588,8 @@ void Dar_LibStart() {
 
 ***********************************************************************/
 void Dar_LibStop() {
-    assert(s_DarLib != NULL);
+    if (s_DarLib == NULL)
+        return;
     Dar_LibFree(s_DarLib);
     s_DarLib = NULL;
 }
@@ -9,7 +9,7 @@
   Synopsis    [Max-flow computation.]
 
   Author      [Aaron Hurst]
-  
+
   Affiliation [UC Berkeley]
 
   Date        [Ver. 1.0. Started - January 1, 2008.]
@@ -26,10 +26,37 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void dfsfast_e_retreat(Abc_Obj_t* pObj);
-static void dfsfast_r_retreat(Abc_Obj_t* pObj);
-
-#define FDIST(xn, xe, yn, ye) (FDATA(xn)->xe##_dist == (FDATA(yn)->ye##_dist + 1))
+// The flow network has two vertices for each object: the entry vertex
+// (2*Id) and the exit vertex (2*Id+1), connected by a unit-capacity edge
+// going from the exit vertex to the entry vertex.  All other edges have
+// infinite capacity.  The latches are the sources; the sinks depend on
+// the direction of retiming and the constraints.
+
+typedef struct Flow_Net_t_ Flow_Net_t;
+struct Flow_Net_t_ {
+    int nVerts;      // the number of vertices
+    int nEdges;      // the number of edges (each edge has its reverse)
+    int iSource;     // the source vertex
+    int iSink;       // the sink vertex
+    int* pStart;     // the first out-edge of each vertex
+    int* pHead;      // the head vertex of each edge
+    int* pRev;       // the reverse of each edge
+    int* pCap;       // the residual capacity of each edge
+    int* pUnit;      // the unit edge of each object (or -1)
+    int* pCur;       // the current edge of each vertex
+    int* pLabel;     // the distance label of each vertex
+    iword* pExcess;  // the excess of each vertex
+    int* pQueue;     // the queue of active vertices
+    int* pBfs;       // the queue of breadth-first search
+    int nPushes;     // the number of pushes
+    int nRelabels;   // the number of relabels
+    int nGlobals;    // the number of global relabels
+};
+
+#define FLOW_INF ABC_INFINITY
+
+static inline int Flow_VertE(Abc_Obj_t* pObj) { return 2 * Abc_ObjId(pObj); }
+static inline int Flow_VertR(Abc_Obj_t* pObj) { return 2 * Abc_ObjId(pObj) + 1; }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -37,604 +64,379 @@ static void dfsfast_r_retreat(Abc_Obj_t* pObj);
 
 /**Function*************************************************************
 
-  Synopsis    [Fast DFS.]
+  Synopsis    [Adds one edge and its reverse to the network.]
+
+  Description [When the edge arrays are not allocated yet, only counts
+               the out-degree of the vertices.]
 
-  Description [Uses sink-distance-histogram heuristic.  May not find all
-               flow paths: this occurs in a small number of cases where
-               the flow predecessor points to a non-adjacent node and
-               the distance ordering is perturbed.]
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-
-void dfsfast_preorder(Abc_Ntk_t* pNtk) {
-    Abc_Obj_t *pObj, *pNext;
-    Vec_Ptr_t *vTimeIn, *qn = Vec_PtrAlloc(Abc_NtkObjNum(pNtk));
-    Vec_Int_t* qe = Vec_IntAlloc(Abc_NtkObjNum(pNtk));
-    int i, j, d = 0, end;
-    int qpos = 0;
-
-    // create reverse timing edges for backward traversal
-#if !defined(IGNORE_TIMING)
-    if (pManMR->maxDelay) {
-        Abc_NtkForEachObj(pNtk, pObj, i) {
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, j) {
-                vTimeIn = FDATA(pNext)->vNodes;
-                if (!vTimeIn) {
-                    vTimeIn = FDATA(pNext)->vNodes = Vec_PtrAlloc(2);
-                }
-                Vec_PtrPush(vTimeIn, pObj);
-            }
-        }
+static inline int Flow_NetAddEdge(Flow_Net_t* p, int iFrom, int iTo, int Cap) {
+    int e, r;
+    if (p->pHead == NULL) {
+        p->pStart[iFrom + 1]++;
+        p->pStart[iTo + 1]++;
+        return -1;
     }
-#endif
-
-    // clear histogram
-    assert(pManMR->vSinkDistHist);
-    memset(Vec_IntArray(pManMR->vSinkDistHist), 0, sizeof(int) * Vec_IntSize(pManMR->vSinkDistHist));
-
-    // seed queue : latches, PIOs, and blocks
-    Abc_NtkForEachObj(pNtk, pObj, i) if (Abc_ObjIsPo(pObj) || Abc_ObjIsLatch(pObj) || (pManMR->fIsForward && FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask)) {
-        Vec_PtrPush(qn, pObj);
-        Vec_IntPush(qe, 'r');
-        FDATA(pObj)->r_dist = 1;
-    }
-    else if (Abc_ObjIsPi(pObj) || (!pManMR->fIsForward && FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask)) {
-        Vec_PtrPush(qn, pObj);
-        Vec_IntPush(qe, 'e');
-        FDATA(pObj)->e_dist = 1;
-    }
-
-    // until queue is empty...
-    while (qpos < Vec_PtrSize(qn)) {
-        pObj = (Abc_Obj_t*)Vec_PtrEntry(qn, qpos);
-        assert(pObj);
-        end = Vec_IntEntry(qe, qpos);
-        qpos++;
-
-        if (end == 'r') {
-            d = FDATA(pObj)->r_dist;
-
-            // 1. structural edges
-            if (pManMR->fIsForward) {
-                Abc_ObjForEachFanin(pObj, pNext, i) if (!FDATA(pNext)->e_dist) {
-                    FDATA(pNext)->e_dist = d + 1;
-                    Vec_PtrPush(qn, pNext);
-                    Vec_IntPush(qe, 'e');
-                }
-            } else
-                Abc_ObjForEachFanout(pObj, pNext, i) if (!FDATA(pNext)->e_dist) {
-                    FDATA(pNext)->e_dist = d + 1;
-                    Vec_PtrPush(qn, pNext);
-                    Vec_IntPush(qe, 'e');
-                }
-
-            if (d == 1) continue;
-
-            // 2. reverse edges (forward retiming only)
-            if (pManMR->fIsForward) {
-                Abc_ObjForEachFanout(pObj, pNext, i) if (!FDATA(pNext)->r_dist && !Abc_ObjIsLatch(pNext)) {
-                    FDATA(pNext)->r_dist = d + 1;
-                    Vec_PtrPush(qn, pNext);
-                    Vec_IntPush(qe, 'r');
-                }
+    e = p->pCur[iFrom]++;
+    r = p->pCur[iTo]++;
+    p->pHead[e] = iTo;
+    p->pHead[r] = iFrom;
+    p->pRev[e] = r;
+    p->pRev[r] = e;
+    p->pCap[e] = Cap;
+    p->pCap[r] = 0;
+    return e;
+}
 
-                // 3. timimg edges (forward retiming only)
-#if !defined(IGNORE_TIMING)
-                if (pManMR->maxDelay && FDATA(pObj)->vNodes)
-                    Vec_PtrForEachEntry(Abc_Obj_t*, FDATA(pObj)->vNodes, pNext, i) {
-                        if (!FDATA(pNext)->r_dist) {
-                            FDATA(pNext)->r_dist = d + 1;
-                            Vec_PtrPush(qn, pNext);
-                            Vec_IntPush(qe, 'r');
-                        }
-                    }
-#endif
-            }
+/**Function*************************************************************
 
-        } else { // if 'e'
-            if (Abc_ObjIsLatch(pObj)) continue;
+  Synopsis    [Adds the edges of the network.]
 
-            d = FDATA(pObj)->e_dist;
+  Description [Follows the rules of the original augmenting-path search:
+               structural edges, reverse edges and timing edges have
+               infinite capacity; each non-latch object can carry one
+               unit of flow from its exit vertex to its entry vertex.]
 
-            // 1. through node
-            if (!FDATA(pObj)->r_dist) {
-                FDATA(pObj)->r_dist = d + 1;
-                Vec_PtrPush(qn, pObj);
-                Vec_IntPush(qe, 'r');
-            }
+  SideEffects []
 
-            // 2. reverse edges (backward retiming only)
-            if (!pManMR->fIsForward) {
-                Abc_ObjForEachFanin(pObj, pNext, i) if (!FDATA(pNext)->e_dist && !Abc_ObjIsLatch(pNext)) {
-                    FDATA(pNext)->e_dist = d + 1;
-                    Vec_PtrPush(qn, pNext);
-                    Vec_IntPush(qe, 'e');
-                }
+  SeeAlso     []
 
-                // 3. timimg edges (backward retiming only)
+***********************************************************************/
+static void Flow_NetAddEdges(MinRegMan_t* pManMR, Flow_Net_t* p, Abc_Ntk_t* pNtk) {
+    Abc_Obj_t *pObj, *pNext;
+    int i, k, fSinkE, fSinkR;
+    int fForward = pManMR->fIsForward;
+    Abc_NtkForEachObj(pNtk, pObj, i) {
+        fSinkE = (FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask) || Abc_ObjIsPi(pObj);
+        fSinkR = Abc_ObjIsLatch(pObj) || (fForward && (Abc_ObjIsPo(pObj) || (FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask)));
+        // the latches are the sources
+        if (Abc_ObjIsLatch(pObj))
+            Flow_NetAddEdge(p, p->iSource, Flow_VertE(pObj), FLOW_INF);
+        // the entry vertex
+        if (fSinkE)
+            Flow_NetAddEdge(p, Flow_VertE(pObj), p->iSink, FLOW_INF);
+        else {
+            // 1. structural edges
+            if (fForward)
+                Abc_ObjForEachFanout(pObj, pNext, k)
+                    Flow_NetAddEdge(p, Flow_VertE(pObj), Flow_VertR(pNext), FLOW_INF);
+            else
+                Abc_ObjForEachFanin(pObj, pNext, k)
+                    Flow_NetAddEdge(p, Flow_VertE(pObj), Flow_VertR(pNext), FLOW_INF);
+            // 2. reverse and timing edges (backward retiming only)
+            if (!fForward && !Abc_ObjIsLatch(pObj)) {
+                Abc_ObjForEachFanout(pObj, pNext, k)
+                    Flow_NetAddEdge(p, Flow_VertE(pObj), Flow_VertE(pNext), FLOW_INF);
 #if !defined(IGNORE_TIMING)
-                if (pManMR->maxDelay && FDATA(pObj)->vNodes)
-                    Vec_PtrForEachEntry(Abc_Obj_t*, FDATA(pObj)->vNodes, pNext, i) {
-                        if (!FDATA(pNext)->e_dist) {
-                            FDATA(pNext)->e_dist = d + 1;
-                            Vec_PtrPush(qn, pNext);
-                            Vec_IntPush(qe, 'e');
-                        }
-                    }
+                if (pManMR->maxDelay)
+                    Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, k)
+                        Flow_NetAddEdge(p, Flow_VertE(pObj), Flow_VertE(pNext), FLOW_INF);
 #endif
             }
         }
-    }
-
-    // free time edges
+        // the exit vertex
+        p->pUnit[Abc_ObjId(pObj)] = -1;
+        if (fSinkR)
+            Flow_NetAddEdge(p, Flow_VertR(pObj), p->iSink, FLOW_INF);
+        else {
+            // 1. through the node
+            p->pUnit[Abc_ObjId(pObj)] = Flow_NetAddEdge(p, Flow_VertR(pObj), Flow_VertE(pObj), 1);
+            // 2. reverse and timing edges (forward retiming only)
+            if (fForward) {
+                Abc_ObjForEachFanin(pObj, pNext, k) if (!Abc_ObjIsLatch(pNext))
+                    Flow_NetAddEdge(p, Flow_VertR(pObj), Flow_VertR(pNext), FLOW_INF);
 #if !defined(IGNORE_TIMING)
-    if (pManMR->maxDelay) {
-        Abc_NtkForEachObj(pNtk, pObj, i) {
-            vTimeIn = FDATA(pObj)->vNodes;
-            if (vTimeIn) {
-                Vec_PtrFree(vTimeIn);
-                FDATA(pObj)->vNodes = 0;
+                if (pManMR->maxDelay)
+                    Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, k)
+                        Flow_NetAddEdge(p, Flow_VertR(pObj), Flow_VertR(pNext), FLOW_INF);
+#endif
             }
         }
     }
-#endif
-
-    Abc_NtkForEachObj(pNtk, pObj, i) {
-        Vec_IntAddToEntry(pManMR->vSinkDistHist, FDATA(pObj)->r_dist, 1);
-        Vec_IntAddToEntry(pManMR->vSinkDistHist, FDATA(pObj)->e_dist, 1);
-
-#ifdef DEBUG_PREORDER
-        printf("node %d\t: r=%d\te=%d\n", Abc_ObjId(pObj), FDATA(pObj)->r_dist, FDATA(pObj)->e_dist);
-#endif
-    }
-
-    // printf("\t\tpre-ordered (max depth=%d)\n", d+1);
-
-    // deallocate
-    Vec_PtrFree(qn);
-    Vec_IntFree(qe);
 }
 
-int dfsfast_e(Abc_Obj_t* pObj, Abc_Obj_t* pPred) {
-    int i;
-    Abc_Obj_t* pNext;
-
-    if (pManMR->fSinkDistTerminate) return 0;
-
-    // have we reached the sink?
-    if (FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask || Abc_ObjIsPi(pObj)) {
-        assert(pPred);
-        assert(!pManMR->fIsForward);
-        return 1;
-    }
-
-    FSET(pObj, VISITED_E);
-
-#ifdef DEBUG_VISITED
-    printf("(%de=%d) ", Abc_ObjId(pObj), FDATA(pObj)->e_dist);
-#endif
+/**Function*************************************************************
 
-    // 1. structural edges
-    if (pManMR->fIsForward)
-        Abc_ObjForEachFanout(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_R) && FDIST(pObj, e, pNext, r) && dfsfast_r(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("o");
-#endif
-                goto found;
-            }
-        }
-    else
-        Abc_ObjForEachFanin(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_R) && FDIST(pObj, e, pNext, r) && dfsfast_r(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("o");
-#endif
-                goto found;
-            }
-        }
+  Synopsis    [Tightens the capacity of the edges leaving the source.]
 
-    if (Abc_ObjIsLatch(pObj))
-        goto not_found;
+  Description [The flow leaving a latch cannot exceed the total capacity
+               leaving its successors, which is usually one unit.  Using
+               this bound instead of infinity keeps the initial preflow
+               from flooding the network with excess that has to be
+               returned to the source.  The maximum flow does not change;
+               the latches are treated as source-reachable regardless.]
 
-    // 2. reverse edges (backward retiming only)
-    if (!pManMR->fIsForward) {
-        Abc_ObjForEachFanout(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_E) && FDIST(pObj, e, pNext, e) && dfsfast_e(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("i");
-#endif
-                goto found;
-            }
-        }
+  SideEffects []
 
-        // 3. timing edges (backward retiming only)
-#if !defined(IGNORE_TIMING)
-        if (pManMR->maxDelay)
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, i) {
-                if (!FTEST(pNext, VISITED_E) && FDIST(pObj, e, pNext, e) && dfsfast_e(pNext, pPred)) {
-#    ifdef DEBUG_PRINT_FLOWS
-                    printf("o");
-#    endif
-                    goto found;
-                }
-            }
-#endif
-    }
+  SeeAlso     []
 
-    // unwind
-    if (FTEST(pObj, FLOW) && !FTEST(pObj, VISITED_R) && FDIST(pObj, e, pObj, r) && dfsfast_r(pObj, FGETPRED(pObj))) {
-        FUNSET(pObj, FLOW);
-        FSETPRED(pObj, NULL);
-#ifdef DEBUG_PRINT_FLOWS
-        printf("u");
-#endif
-        goto found;
+***********************************************************************/
+static void Flow_NetBoundSources(Flow_Net_t* p) {
+    iword* pOut = p->pExcess;
+    iword Bound;
+    int e, f, u;
+    // compute the capacity leaving each vertex
+    for (u = 0; u < p->nVerts; u++)
+        for (e = p->pStart[u]; e < p->pStart[u + 1]; e++)
+            pOut[u] += p->pCap[e];
+    pOut[p->iSink] = FLOW_INF;
+    // bound the capacity of the source edges
+    for (e = p->pStart[p->iSource]; e < p->pStart[p->iSource + 1]; e++) {
+        u = p->pHead[e];
+        Bound = 0;
+        for (f = p->pStart[u]; f < p->pStart[u + 1]; f++)
+            Bound += Abc_MinInt(p->pCap[f], (int)Abc_MinWord(pOut[p->pHead[f]], FLOW_INF));
+        p->pCap[e] = (int)Abc_MinWord(Bound, FLOW_INF);
     }
-
-not_found:
-    FUNSET(pObj, VISITED_E);
-    dfsfast_e_retreat(pObj);
-    return 0;
-
-found:
-#ifdef DEBUG_PRINT_FLOWS
-    printf("%d ", Abc_ObjId(pObj));
-#endif
-    FUNSET(pObj, VISITED_E);
-    return 1;
+    memset(pOut, 0, sizeof(iword) * p->nVerts);
 }
 
-int dfsfast_r(Abc_Obj_t* pObj, Abc_Obj_t* pPred) {
-    int i;
-    Abc_Obj_t *pNext, *pOldPred;
+/**Function*************************************************************
 
-    if (pManMR->fSinkDistTerminate) return 0;
+  Synopsis    [Builds the flow network.]
 
-#ifdef DEBUG_VISITED
-    printf("(%dr=%d) ", Abc_ObjId(pObj), FDATA(pObj)->r_dist);
-#endif
+  Description []
 
-    // have we reached the sink?
-    if (Abc_ObjIsLatch(pObj) || (pManMR->fIsForward && Abc_ObjIsPo(pObj)) || (pManMR->fIsForward && FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask)) {
-        assert(pPred);
-        return 1;
-    }
+  SideEffects []
 
-    FSET(pObj, VISITED_R);
+  SeeAlso     []
 
-    if (FTEST(pObj, FLOW)) {
-        pOldPred = FGETPRED(pObj);
-        if (pOldPred && !FTEST(pOldPred, VISITED_E) && FDIST(pObj, r, pOldPred, e) && dfsfast_e(pOldPred, pOldPred)) {
-            FSETPRED(pObj, pPred);
+***********************************************************************/
+static Flow_Net_t* Flow_NetStart(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
+    Flow_Net_t* p = ABC_CALLOC(Flow_Net_t, 1);
+    int i, nObjs = Abc_NtkObjNumMax(pNtk);
+    assert(nObjs <= pManMR->nNodes);
+    p->nVerts = 2 * nObjs + 2;
+    p->iSource = 2 * nObjs;
+    p->iSink = 2 * nObjs + 1;
+    p->pStart = ABC_CALLOC(int, p->nVerts + 1);
+    p->pUnit = ABC_ALLOC(int, nObjs);
+    // count the edges
+    Flow_NetAddEdges(pManMR, p, pNtk);
+    for (i = 0; i < p->nVerts; i++)
+        p->pStart[i + 1] += p->pStart[i];
+    p->nEdges = p->pStart[p->nVerts];
+    // add the edges
+    p->pHead = ABC_ALLOC(int, p->nEdges + 1);
+    p->pRev = ABC_ALLOC(int, p->nEdges + 1);
+    p->pCap = ABC_ALLOC(int, p->nEdges + 1);
+    p->pCur = ABC_ALLOC(int, p->nVerts);
+    memcpy(p->pCur, p->pStart, sizeof(int) * p->nVerts);
+    Flow_NetAddEdges(pManMR, p, pNtk);
+    for (i = 0; i < p->nVerts; i++)
+        assert(p->pCur[i] == p->pStart[i + 1]);
+    p->pLabel = ABC_CALLOC(int, p->nVerts);
+    p->pExcess = ABC_CALLOC(iword, p->nVerts);
+    p->pQueue = ABC_ALLOC(int, p->nVerts);
+    p->pBfs = ABC_ALLOC(int, p->nVerts);
+    Flow_NetBoundSources(p);
+    return p;
+}
+static void Flow_NetStop(Flow_Net_t* p) {
+    ABC_FREE(p->pStart);
+    ABC_FREE(p->pHead);
+    ABC_FREE(p->pRev);
+    ABC_FREE(p->pCap);
+    ABC_FREE(p->pUnit);
+    ABC_FREE(p->pCur);
+    ABC_FREE(p->pLabel);
+    ABC_FREE(p->pExcess);
+    ABC_FREE(p->pQueue);
+    ABC_FREE(p->pBfs);
+    ABC_FREE(p);
+}
 
-#ifdef DEBUG_PRINT_FLOWS
-            printf("fr");
-#endif
-            goto found;
-        }
+/**Function*************************************************************
 
-    } else {
-        if (!FTEST(pObj, VISITED_E) && FDIST(pObj, r, pObj, e) && dfsfast_e(pObj, pObj)) {
-            FSET(pObj, FLOW);
-            FSETPRED(pObj, pPred);
+  Synopsis    [Computes exact distance labels.]
 
-#ifdef DEBUG_PRINT_FLOWS
-            printf("f");
-#endif
-            goto found;
-        }
-    }
+  Description [Performs backward breadth-first search in the residual
+               network from the sink, then from the source.  The labels
+               of the vertices reached from the source are offset by the
+               number of vertices.  Other vertices cannot have excess.]
 
-    // 2. reverse edges (forward retiming only)
-    if (pManMR->fIsForward) {
-        Abc_ObjForEachFanin(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_R) && FDIST(pObj, r, pNext, r) && !Abc_ObjIsLatch(pNext) && dfsfast_r(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("i");
-#endif
-                goto found;
-            }
-        }
+  SideEffects []
 
-        // 3. timing edges (forward retiming only)
-#if !defined(IGNORE_TIMING)
-        if (pManMR->maxDelay)
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, i) {
-                if (!FTEST(pNext, VISITED_R) && FDIST(pObj, r, pNext, r) && dfsfast_r(pNext, pPred)) {
-#    ifdef DEBUG_PRINT_FLOWS
-                    printf("o");
-#    endif
-                    goto found;
+  SeeAlso     []
+
+***********************************************************************/
+static void Flow_NetGlobalRelabel(Flow_Net_t* p) {
+    int i, e, v, u, iHead, iTail, Start, nUnreached = 2 * p->nVerts;
+    p->nGlobals++;
+    for (i = 0; i < p->nVerts; i++)
+        p->pLabel[i] = nUnreached;
+    p->pLabel[p->iSource] = p->nVerts;
+    p->pLabel[p->iSink] = 0;
+    for (Start = 0; Start < 2; Start++) {
+        iHead = iTail = 0;
+        p->pBfs[iTail++] = Start ? p->iSource : p->iSink;
+        while (iHead < iTail) {
+            v = p->pBfs[iHead++];
+            for (e = p->pStart[v]; e < p->pStart[v + 1]; e++) {
+                u = p->pHead[e];
+                if (p->pLabel[u] == nUnreached && p->pCap[p->pRev[e]] > 0) {
+                    p->pLabel[u] = p->pLabel[v] + 1;
+                    p->pBfs[iTail++] = u;
                 }
             }
-#endif
+        }
     }
-
-    FUNSET(pObj, VISITED_R);
-    dfsfast_r_retreat(pObj);
-    return 0;
-
-found:
-#ifdef DEBUG_PRINT_FLOWS
-    printf("%d ", Abc_ObjId(pObj));
-#endif
-    FUNSET(pObj, VISITED_R);
-    return 1;
+    memcpy(p->pCur, p->pStart, sizeof(int) * p->nVerts);
 }
 
-void dfsfast_e_retreat(Abc_Obj_t* pObj) {
-    Abc_Obj_t* pNext;
-    int i, *h;
-    int old_dist = FDATA(pObj)->e_dist;
-    int adj_dist, min_dist = MAX_DIST;
-
-    // 1. structural edges
-    if (pManMR->fIsForward)
-        Abc_ObjForEachFanout(pObj, pNext, i) {
-            adj_dist = FDATA(pNext)->r_dist;
-            if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-        }
-    else
-        Abc_ObjForEachFanin(pObj, pNext, i) {
-            adj_dist = FDATA(pNext)->r_dist;
-            if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-        }
+/**Function*************************************************************
 
-    if (Abc_ObjIsLatch(pObj)) goto update;
+  Synopsis    [Computes maximum flow using push-relabel.]
 
-    // 2. through
-    if (FTEST(pObj, FLOW)) {
-        adj_dist = FDATA(pObj)->r_dist;
-        if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-    }
+  Description [Uses FIFO selection of active vertices and periodic
+               global relabeling.  Returns the value of the flow.]
 
-    // 3. reverse edges (backward retiming only)
-    if (!pManMR->fIsForward) {
-        Abc_ObjForEachFanout(pObj, pNext, i) {
-            adj_dist = FDATA(pNext)->e_dist;
-            if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-        }
+  SideEffects []
 
-        // 4. timing edges (backward retiming only)
-#if !defined(IGNORE_TIMING)
-        if (pManMR->maxDelay)
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, i) {
-                adj_dist = FDATA(pNext)->e_dist;
-                if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-            }
-#endif
-    }
+  SeeAlso     []
 
-update:
-    ++min_dist;
-    if (min_dist >= MAX_DIST) min_dist = 0;
-    // printf("[%de=%d->%d] ", Abc_ObjId(pObj), old_dist, min_dist+1);
-    FDATA(pObj)->e_dist = min_dist;
-
-    assert(min_dist < Vec_IntSize(pManMR->vSinkDistHist));
-    h = Vec_IntArray(pManMR->vSinkDistHist);
-    h[old_dist]--;
-    h[min_dist]++;
-    if (!h[old_dist]) {
-        pManMR->fSinkDistTerminate = 1;
+***********************************************************************/
+static int Flow_NetMaxFlow(Flow_Net_t* p) {
+    int e, v, u, d, Label, iHead = 0, nActive = 0;
+    iword Work = 0, WorkMax = 6 * (iword)p->nVerts + p->nEdges / 2;
+    // saturate the edges leaving the source
+    for (e = p->pStart[p->iSource]; e < p->pStart[p->iSource + 1]; e++) {
+        u = p->pHead[e];
+        d = p->pCap[e];
+        p->pCap[e] -= d;
+        p->pCap[p->pRev[e]] += d;
+        p->pExcess[p->iSource] -= d;
+        if (p->pExcess[u] == 0 && u != p->iSink)
+            p->pQueue[(iHead + nActive++) % p->nVerts] = u;
+        p->pExcess[u] += d;
     }
-}
-
-void dfsfast_r_retreat(Abc_Obj_t* pObj) {
-    Abc_Obj_t* pNext;
-    int i, *h;
-    int old_dist = FDATA(pObj)->r_dist;
-    int adj_dist, min_dist = MAX_DIST;
-
-    // 1. through or pred
-    if (FTEST(pObj, FLOW)) {
-        if (FGETPRED(pObj)) {
-            adj_dist = FDATA(FGETPRED(pObj))->e_dist;
-            if (adj_dist) min_dist = MIN(min_dist, adj_dist);
+    Flow_NetGlobalRelabel(p);
+    // discharge the active vertices
+    while (nActive > 0) {
+        v = p->pQueue[iHead];
+        iHead = (iHead + 1) % p->nVerts;
+        nActive--;
+        while (p->pExcess[v] > 0) {
+            if (p->pCur[v] == p->pStart[v + 1]) {
+                // relabel the vertex
+                Label = 2 * p->nVerts;
+                for (e = p->pStart[v]; e < p->pStart[v + 1]; e++)
+                    if (p->pCap[e] > 0 && Label > p->pLabel[p->pHead[e]] + 1)
+                        Label = p->pLabel[p->pHead[e]] + 1;
+                assert(Label < 2 * p->nVerts);
+                p->pLabel[v] = Label;
+                p->pCur[v] = p->pStart[v];
+                Work += p->pStart[v + 1] - p->pStart[v] + 12;
+                p->nRelabels++;
+                continue;
+            }
+            e = p->pCur[v];
+            u = p->pHead[e];
+            if (p->pCap[e] == 0 || p->pLabel[v] != p->pLabel[u] + 1) {
+                p->pCur[v]++;
+                continue;
+            }
+            // push the flow
+            d = p->pExcess[v] < p->pCap[e] ? (int)p->pExcess[v] : p->pCap[e];
+            p->pCap[e] -= d;
+            p->pCap[p->pRev[e]] += d;
+            p->pExcess[v] -= d;
+            if (p->pExcess[u] == 0 && u != p->iSink && u != p->iSource)
+                p->pQueue[(iHead + nActive++) % p->nVerts] = u;
+            p->pExcess[u] += d;
+            p->nPushes++;
         }
-    } else {
-        adj_dist = FDATA(pObj)->e_dist;
-        if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-    }
-
-    // 2. reverse edges (forward retiming only)
-    if (pManMR->fIsForward) {
-        Abc_ObjForEachFanin(pObj, pNext, i) if (!Abc_ObjIsLatch(pNext)) {
-            adj_dist = FDATA(pNext)->r_dist;
-            if (adj_dist) min_dist = MIN(min_dist, adj_dist);
+        if (Work > WorkMax) {
+            Flow_NetGlobalRelabel(p);
+            Work = 0;
         }
-
-        // 3. timing edges (forward retiming only)
-#if !defined(IGNORE_TIMING)
-        if (pManMR->maxDelay)
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, i) {
-                adj_dist = FDATA(pNext)->r_dist;
-                if (adj_dist) min_dist = MIN(min_dist, adj_dist);
-            }
-#endif
-    }
-
-    ++min_dist;
-    if (min_dist >= MAX_DIST) min_dist = 0;
-    //printf("[%dr=%d->%d] ", Abc_ObjId(pObj), old_dist, min_dist+1);
-    FDATA(pObj)->r_dist = min_dist;
-
-    assert(min_dist < Vec_IntSize(pManMR->vSinkDistHist));
-    h = Vec_IntArray(pManMR->vSinkDistHist);
-    h[old_dist]--;
-    h[min_dist]++;
-    if (!h[old_dist]) {
-        pManMR->fSinkDistTerminate = 1;
     }
+    assert(p->pExcess[p->iSink] < FLOW_INF);
+    return (int)p->pExcess[p->iSink];
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Plain DFS.]
+  Synopsis    [Marks the vertices reachable from the source.]
+
+  Description [Sets VISITED_E (VISITED_R) on the objects whose entry
+               (exit) vertex is reachable from the source in the residual
+               network and FLOW on the objects carrying a unit of flow.]
 
-  Description [Does not use sink-distance-histogram heuristic.]
-               
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-
-int dfsplain_e(Abc_Obj_t* pObj, Abc_Obj_t* pPred) {
-    int i;
-    Abc_Obj_t* pNext;
-
-    if (FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask || Abc_ObjIsPi(pObj)) {
-        assert(pPred);
-        assert(!pManMR->fIsForward);
-        return 1;
+static void Flow_NetMarkCut(MinRegMan_t* pManMR, Flow_Net_t* p, Abc_Ntk_t* pNtk) {
+    Abc_Obj_t* pObj;
+    char* pReached = ABC_CALLOC(char, p->nVerts);
+    int i, e, v, u, iHead = 0, iTail = 0;
+    pReached[p->iSource] = 1;
+    p->pBfs[iTail++] = p->iSource;
+    // the source edges are infinite in the original network
+    for (e = p->pStart[p->iSource]; e < p->pStart[p->iSource + 1]; e++) {
+        pReached[p->pHead[e]] = 1;
+        p->pBfs[iTail++] = p->pHead[e];
     }
-
-    FSET(pObj, VISITED_E);
-
-    // printf(" %de\n", Abc_ObjId(pObj));
-
-    // 1. structural edges
-    if (pManMR->fIsForward)
-        Abc_ObjForEachFanout(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_R) && dfsplain_r(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("o");
-#endif
-                goto found;
-            }
-        }
-    else
-        Abc_ObjForEachFanin(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_R) && dfsplain_r(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("o");
-#endif
-                goto found;
+    while (iHead < iTail) {
+        v = p->pBfs[iHead++];
+        for (e = p->pStart[v]; e < p->pStart[v + 1]; e++) {
+            u = p->pHead[e];
+            if (!pReached[u] && p->pCap[e] > 0) {
+                pReached[u] = 1;
+                p->pBfs[iTail++] = u;
             }
         }
-
-    if (Abc_ObjIsLatch(pObj))
-        return 0;
-
-    // 2. reverse edges (backward retiming only)
-    if (!pManMR->fIsForward) {
-        Abc_ObjForEachFanout(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_E) && dfsplain_e(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("i");
-#endif
-                goto found;
-            }
-        }
-
-        // 3. timing edges (backward retiming only)
-#if !defined(IGNORE_TIMING)
-        if (pManMR->maxDelay)
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, i) {
-                if (!FTEST(pNext, VISITED_E) && dfsplain_e(pNext, pPred)) {
-#    ifdef DEBUG_PRINT_FLOWS
-                    printf("o");
-#    endif
-                    goto found;
-                }
-            }
-#endif
     }
-
-    // unwind
-    if (FTEST(pObj, FLOW) && !FTEST(pObj, VISITED_R) && dfsplain_r(pObj, FGETPRED(pObj))) {
-        FUNSET(pObj, FLOW);
-        FSETPRED(pObj, NULL);
-#ifdef DEBUG_PRINT_FLOWS
-        printf("u");
-#endif
-        goto found;
+    assert(!pReached[p->iSink]);
+    Abc_NtkForEachObj(pNtk, pObj, i) {
+        FUNSET(pObj, VISITED | FLOW);
+        if (pReached[Flow_VertE(pObj)])
+            FSET(pObj, VISITED_E);
+        if (pReached[Flow_VertR(pObj)])
+            FSET(pObj, VISITED_R);
+        if (p->pUnit[i] >= 0 && p->pCap[p->pUnit[i]] == 0)
+            FSET(pObj, FLOW);
     }
-
-    return 0;
-
-found:
-#ifdef DEBUG_PRINT_FLOWS
-    printf("%d ", Abc_ObjId(pObj));
-#endif
-
-    return 1;
+    ABC_FREE(pReached);
 }
 
-int dfsplain_r(Abc_Obj_t* pObj, Abc_Obj_t* pPred) {
-    int i;
-    Abc_Obj_t *pNext, *pOldPred;
-
-    // have we reached the sink?
-    if (Abc_ObjIsLatch(pObj) || (pManMR->fIsForward && Abc_ObjIsPo(pObj)) || (pManMR->fIsForward && FTEST(pObj, BLOCK_OR_CONS) & pManMR->constraintMask)) {
-        assert(pPred);
-        return 1;
-    }
+/**Function*************************************************************
 
-    FSET(pObj, VISITED_R);
+  Synopsis    [Computes maximum flow.]
 
-    // printf(" %dr\n", Abc_ObjId(pObj));
+  Description [Builds the flow network of the current retiming problem
+               and solves it with push-relabel.  Iterative, so the depth
+               of the network is not limited by the stack.]
 
-    if (FTEST(pObj, FLOW)) {
-        pOldPred = FGETPRED(pObj);
-        if (pOldPred && !FTEST(pOldPred, VISITED_E) && dfsplain_e(pOldPred, pOldPred)) {
-            FSETPRED(pObj, pPred);
+  SideEffects [Leaves VISITED flags on source-reachable nodes.]
 
-#ifdef DEBUG_PRINT_FLOWS
-            printf("fr");
-#endif
-            goto found;
-        }
+  SeeAlso     []
 
-    } else {
-        if (!FTEST(pObj, VISITED_E) && dfsplain_e(pObj, pObj)) {
-            FSET(pObj, FLOW);
-            FSETPRED(pObj, pPred);
+***********************************************************************/
+int Abc_FlowRetime_PushFlows(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk, int fVerbose) {
+    Flow_Net_t* p;
+    int flow;
+    abctime clk = Abc_Clock();
 
-#ifdef DEBUG_PRINT_FLOWS
-            printf("f");
-#endif
-            goto found;
-        }
-    }
+    pManMR->constraintMask |= BLOCK;
 
-    // 2. follow reverse edges
-    if (pManMR->fIsForward) { // forward retiming only
-        Abc_ObjForEachFanin(pObj, pNext, i) {
-            if (!FTEST(pNext, VISITED_R) && !Abc_ObjIsLatch(pNext) && dfsplain_r(pNext, pPred)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("i");
-#endif
-                goto found;
-            }
-        }
+    p = Flow_NetStart(pManMR, pNtk);
+    flow = Flow_NetMaxFlow(p);
+    Flow_NetMarkCut(pManMR, p, pNtk);
 
-        // 3. timing edges (forward only)
-#if !defined(IGNORE_TIMING)
-        if (pManMR->maxDelay)
-            Vec_PtrForEachEntry(Abc_Obj_t*, FTIMEEDGES(pObj), pNext, i) {
-                if (!FTEST(pNext, VISITED_R) && dfsplain_r(pNext, pPred)) {
-#    ifdef DEBUG_PRINT_FLOWS
-                    printf("o");
-#    endif
-                    goto found;
-                }
-            }
-#endif
+    if (fVerbose && pManMR->fVerbose) {
+        printf("\t\tmax-flow = %d (verts = %d, edges = %d, pushes = %d, relabels = %d, global = %d) ",
+               flow, p->nVerts, p->nEdges / 2, p->nPushes, p->nRelabels, p->nGlobals);
+        ABC_PRT("time", Abc_Clock() - clk);
     }
-
-    return 0;
-
-found:
-#ifdef DEBUG_PRINT_FLOWS
-    printf("%d ", Abc_ObjId(pObj));
-#endif
-    return 1;
+    Flow_NetStop(p);
+    return flow;
 }
+
 ABC_NAMESPACE_IMPL_END
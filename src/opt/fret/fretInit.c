@@ -36,17 +36,17 @@ ABC_NAMESPACE_IMPL_START
 ///                     FUNCTION PROTOTYPES                          ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Abc_FlowRetime_UpdateForwardInit_rec(Abc_Obj_t* pObj);
-static void Abc_FlowRetime_VerifyBackwardInit(Abc_Ntk_t* pNtk);
-static void Abc_FlowRetime_VerifyBackwardInit_rec(Abc_Obj_t* pObj);
-static Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(Abc_Obj_t* pOrigObj);
+static void Abc_FlowRetime_UpdateForwardInit_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+static void Abc_FlowRetime_VerifyBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+static void Abc_FlowRetime_VerifyBackwardInit_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+static Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(MinRegMan_t* pManMR, Abc_Obj_t* pOrigObj);
 
-static void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj);
-static void Abc_FlowRetime_SimulateSop(Abc_Obj_t* pObj, char* pSop);
+static void Abc_FlowRetime_SimulateNode(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+static void Abc_FlowRetime_SimulateSop(MinRegMan_t* pManMR, Abc_Obj_t* pObj, char* pSop);
 
-static void Abc_FlowRetime_SetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t* pOrig);
-static void Abc_FlowRetime_GetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t** pOrig, int* lag);
-static void Abc_FlowRetime_ClearInitToOrig(Abc_Obj_t* pInit);
+static void Abc_FlowRetime_SetInitToOrig(MinRegMan_t* pManMR, Abc_Obj_t* pInit, Abc_Obj_t* pOrig);
+static void Abc_FlowRetime_GetInitToOrig(MinRegMan_t* pManMR, Abc_Obj_t* pInit, Abc_Obj_t** pOrig, int* lag);
+static void Abc_FlowRetime_ClearInitToOrig(MinRegMan_t* pManMR, Abc_Obj_t* pInit);
 
 extern void* Abc_FrameReadLibGen();
 
@@ -68,13 +68,13 @@ extern void Abc_NtkMarkCone_rec(Abc_Obj_t* pObj, int fForward);
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_InitState(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_InitState(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     if (!pManMR->fComputeInitState) return;
 
     if (pManMR->fIsForward)
-        Abc_FlowRetime_UpdateForwardInit(pNtk);
+        Abc_FlowRetime_UpdateForwardInit(pManMR, pNtk);
     else {
-        Abc_FlowRetime_UpdateBackwardInit(pNtk);
+        Abc_FlowRetime_UpdateBackwardInit(pManMR, pNtk);
     }
 }
 
@@ -156,7 +156,7 @@ void Abc_FlowRetime_PrintInitStateInfo(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_UpdateForwardInit(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_UpdateForwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Obj_t *pObj, *pFanin;
     int i;
 
@@ -166,7 +166,7 @@ void Abc_FlowRetime_UpdateForwardInit(Abc_Ntk_t* pNtk) {
 
     Abc_NtkForEachLatch(pNtk, pObj, i) {
         pFanin = Abc_ObjFanin0(pObj);
-        Abc_FlowRetime_UpdateForwardInit_rec(pFanin);
+        Abc_FlowRetime_UpdateForwardInit_rec(pManMR, pFanin);
 
         if (FTEST(pFanin, INIT_0))
             Abc_LatchSetInit0(pObj);
@@ -177,7 +177,7 @@ void Abc_FlowRetime_UpdateForwardInit(Abc_Ntk_t* pNtk) {
     }
 }
 
-void Abc_FlowRetime_UpdateForwardInit_rec(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_UpdateForwardInit_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Abc_Obj_t* pNext;
     int i;
 
@@ -190,10 +190,10 @@ void Abc_FlowRetime_UpdateForwardInit_rec(Abc_Obj_t* pObj) {
     Abc_NodeSetTravIdCurrent(pObj);
 
     Abc_ObjForEachFanin(pObj, pNext, i) {
-        Abc_FlowRetime_UpdateForwardInit_rec(pNext);
+        Abc_FlowRetime_UpdateForwardInit_rec(pManMR, pNext);
     }
 
-    Abc_FlowRetime_SimulateNode(pObj);
+    Abc_FlowRetime_SimulateNode(pManMR, pObj);
 }
 
 /**Function*************************************************************
@@ -259,7 +259,7 @@ static void Abc_FlowRetime_EvalHop_rec(Hop_Man_t* pHop, Hop_Obj_t* pObj, int* f,
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Abc_FlowRetime_SetInitValue(Abc_Obj_t* pObj,
+static inline void Abc_FlowRetime_SetInitValue(MinRegMan_t* pManMR, Abc_Obj_t* pObj,
                                                int val,
                                                int dc) {
     // store init value
@@ -284,7 +284,7 @@ static inline void Abc_FlowRetime_SetInitValue(Abc_Obj_t* pObj,
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_SimulateNode(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Abc_Ntk_t* pNtk = Abc_ObjNtk(pObj);
     Abc_Obj_t* pFanin;
     int i, rAnd, rVar, dcAnd, dcVar;
@@ -299,15 +299,15 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
 
     // (i) constant nodes
     if (Abc_NtkIsStrash(pNtk) && Abc_AigNodeIsConst(pObj)) {
-        Abc_FlowRetime_SetInitValue(pObj, 1, 0);
+        Abc_FlowRetime_SetInitValue(pManMR, pObj, 1, 0);
         return;
     }
     if (!Abc_NtkIsStrash(pNtk) && Abc_ObjIsNode(pObj)) {
         if (Abc_NodeIsConst0(pObj)) {
-            Abc_FlowRetime_SetInitValue(pObj, 0, 0);
+            Abc_FlowRetime_SetInitValue(pManMR, pObj, 0, 0);
             return;
         } else if (Abc_NodeIsConst1(pObj)) {
-            Abc_FlowRetime_SetInitValue(pObj, 1, 0);
+            Abc_FlowRetime_SetInitValue(pManMR, pObj, 1, 0);
             return;
         }
     }
@@ -316,7 +316,7 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
     if (!Abc_ObjIsNode(pObj)) {
         pFanin = Abc_ObjFanin0(pObj);
 
-        Abc_FlowRetime_SetInitValue(pObj,
+        Abc_FlowRetime_SetInitValue(pManMR, pObj,
                                     (FTEST(pFanin, INIT_1) ? 1 : 0) ^ pObj->fCompl0,
                                     !FTEST(pFanin, INIT_CARE));
         return;
@@ -326,7 +326,7 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
 
     // ------ SOP network
     if (Abc_NtkHasSop(pNtk)) {
-        Abc_FlowRetime_SimulateSop(pObj, (char*)Abc_ObjData(pObj));
+        Abc_FlowRetime_SimulateSop(pManMR, pObj, (char*)Abc_ObjData(pObj));
         return;
     }
 #ifdef ABC_USE_CUDD
@@ -352,7 +352,7 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
         rVar = (pBdd == Cudd_ReadOne(dd));
         dcVar = !Cudd_IsConstant(pBdd);
 
-        Abc_FlowRetime_SetInitValue(pObj, rVar, dcVar);
+        Abc_FlowRetime_SetInitValue(pManMR, pObj, rVar, dcVar);
         return;
     }
 #endif // #ifdef ABC_USE_CUDD
@@ -372,7 +372,7 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
 
         Abc_FlowRetime_EvalHop_rec(pHop, (Hop_Obj_t*)pObj->pData, &rVar, &dcVar);
 
-        Abc_FlowRetime_SetInitValue(pObj, rVar, dcVar);
+        Abc_FlowRetime_SetInitValue(pManMR, pObj, rVar, dcVar);
 
         // clear flags
         Abc_ObjForEachFanin(pObj, pFanin, i) {
@@ -402,13 +402,13 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
 
         if (!rAnd) dcAnd = 0; /* controlling value */
 
-        Abc_FlowRetime_SetInitValue(pObj, rAnd, dcAnd);
+        Abc_FlowRetime_SetInitValue(pManMR, pObj, rAnd, dcAnd);
         return;
     }
 
     // ------ MAPPED network
     else if (Abc_NtkHasMapping(pNtk)) {
-        Abc_FlowRetime_SimulateSop(pObj, (char*)Mio_GateReadSop((Mio_Gate_t*)pObj->pData));
+        Abc_FlowRetime_SimulateSop(pManMR, pObj, (char*)Mio_GateReadSop((Mio_Gate_t*)pObj->pData));
         return;
     }
 
@@ -426,7 +426,7 @@ void Abc_FlowRetime_SimulateNode(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_SimulateSop(Abc_Obj_t* pObj, char* pSop) {
+void Abc_FlowRetime_SimulateSop(MinRegMan_t* pManMR, Abc_Obj_t* pObj, char* pSop) {
     Abc_Obj_t* pFanin;
     char* pCube;
     int i, j, rAnd, rOr, rVar, dcAnd, dcOr, v;
@@ -464,7 +464,43 @@ void Abc_FlowRetime_SimulateSop(Abc_Obj_t* pObj, char* pSop) {
     if (!Abc_SopGetPhase(pSop))
         rOr ^= 1;
 
-    Abc_FlowRetime_SetInitValue(pObj, rOr, dcOr);
+    Abc_FlowRetime_SetInitValue(pManMR, pObj, rOr, dcOr);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a balanced tree of two-input AND gates.]
+
+  Description [The nodes of the init state network are converted into
+               BDDs before SAT solving, which is impractical for a single
+               node with one fanin per latch.]
+
+  SideEffects [Overwrites the array.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Obj_t* Abc_FlowRetime_CreateAndTree(Abc_Ntk_t* pNtk, Vec_Ptr_t* vObjs) {
+    Vec_Ptr_t* vPair;
+    int i, k;
+    if (Vec_PtrSize(vObjs) == 1)
+        return Abc_NtkCreateNodeAnd(pNtk, vObjs);
+    vPair = Vec_PtrAlloc(2);
+    while (Vec_PtrSize(vObjs) > 1) {
+        for (i = k = 0; i < Vec_PtrSize(vObjs); i += 2) {
+            if (i + 1 == Vec_PtrSize(vObjs)) {
+                Vec_PtrWriteEntry(vObjs, k++, Vec_PtrEntry(vObjs, i));
+                break;
+            }
+            Vec_PtrClear(vPair);
+            Vec_PtrPush(vPair, Vec_PtrEntry(vObjs, i));
+            Vec_PtrPush(vPair, Vec_PtrEntry(vObjs, i + 1));
+            Vec_PtrWriteEntry(vObjs, k++, Abc_NtkCreateNodeAnd(pNtk, vPair));
+        }
+        Vec_PtrShrink(vObjs, k);
+    }
+    Vec_PtrFree(vPair);
+    return (Abc_Obj_t*)Vec_PtrEntry(vObjs, 0);
 }
 
 /**Function*************************************************************
@@ -478,7 +514,7 @@ void Abc_FlowRetime_SimulateSop(Abc_Obj_t* pObj, char* pSop) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_SetupBackwardInit(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_SetupBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Obj_t *pLatch, *pObj, *pPi;
     int i;
     Vec_Ptr_t* vObj = Vec_PtrAlloc(100);
@@ -520,8 +556,8 @@ void Abc_FlowRetime_SetupBackwardInit(Abc_Ntk_t* pNtk) {
 
     // mitre output
 
-    // create n-input AND gate
-    pObj = Abc_NtkCreateNodeAnd(pManMR->pInitNtk, vObj);
+    // create n-input AND gate (as a balanced tree to keep the fanin small)
+    pObj = Abc_FlowRetime_CreateAndTree(pManMR->pInitNtk, vObj);
 
     Abc_ObjAddFanin(Abc_NtkCreatePo(pManMR->pInitNtk), pObj);
 
@@ -539,7 +575,7 @@ void Abc_FlowRetime_SetupBackwardInit(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_FlowRetime_SolveBackwardInit(Abc_Ntk_t* pNtk) {
+int Abc_FlowRetime_SolveBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     int i;
     Abc_Obj_t *pObj, *pInitObj;
     Vec_Ptr_t* vDelete = Vec_PtrAlloc(0);
@@ -650,7 +686,7 @@ int Abc_FlowRetime_SolveBackwardInit(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_UpdateBackwardInit(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_UpdateBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Obj_t *pOrigObj, *pInitObj;
     Vec_Ptr_t* vBo = Vec_PtrAlloc(100);
     Vec_Ptr_t* vPi = Vec_PtrAlloc(100);
@@ -668,7 +704,7 @@ void Abc_FlowRetime_UpdateBackwardInit(Abc_Ntk_t* pNtk) {
 
         // create a buffer instead
         pBuf = Abc_NtkCreateNodeBuf(pInitNtk, NULL);
-        Abc_FlowRetime_ClearInitToOrig(pBuf);
+        Abc_FlowRetime_ClearInitToOrig(pManMR, pBuf);
 
         Abc_ObjBetterTransferFanout(pInitObj, pBuf, 0);
         FDATA(pOrigObj)->pInitObj = pBuf;
@@ -698,7 +734,7 @@ void Abc_FlowRetime_UpdateBackwardInit(Abc_Ntk_t* pNtk) {
 
     // recursively build init network
     Vec_PtrForEachEntry(Abc_Obj_t*, vBo, pOrigObj, i)
-        Abc_FlowRetime_UpdateBackwardInit_rec(pOrigObj);
+        Abc_FlowRetime_UpdateBackwardInit_rec(pManMR, pOrigObj);
 
     // clear flags
     Abc_NtkForEachObj(pNtk, pOrigObj, i)
@@ -721,7 +757,7 @@ void Abc_FlowRetime_UpdateBackwardInit(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Obj_t* Abc_FlowRetime_CopyNodeToInitNtk(Abc_Obj_t* pOrigObj) {
+Abc_Obj_t* Abc_FlowRetime_CopyNodeToInitNtk(MinRegMan_t* pManMR, Abc_Obj_t* pOrigObj) {
     Abc_Ntk_t* pNtk = pManMR->pNtk;
     Abc_Ntk_t* pInitNtk = pManMR->pInitNtk;
     Abc_Obj_t* pInitObj;
@@ -735,7 +771,7 @@ Abc_Obj_t* Abc_FlowRetime_CopyNodeToInitNtk(Abc_Obj_t* pOrigObj) {
     // (0) convert BI/BO nodes to buffers
     if (Abc_ObjIsBi(pOrigObj) || Abc_ObjIsBo(pOrigObj)) {
         pInitObj = Abc_NtkCreateNodeBuf(pInitNtk, NULL);
-        Abc_FlowRetime_ClearInitToOrig(pInitObj);
+        Abc_FlowRetime_ClearInitToOrig(pManMR, pInitObj);
         return pInitObj;
     }
 
@@ -747,7 +783,7 @@ Abc_Obj_t* Abc_FlowRetime_CopyNodeToInitNtk(Abc_Obj_t* pOrigObj) {
         if (!Abc_ObjIsNode(pOrigObj)) {
             assert(Abc_ObjFaninNum(pOrigObj) == 1);
             pInitObj = Abc_NtkCreateNodeBuf(pInitNtk, NULL);
-            Abc_FlowRetime_ClearInitToOrig(pInitObj);
+            Abc_FlowRetime_ClearInitToOrig(pManMR, pInitObj);
             return pInitObj;
         }
 
@@ -769,7 +805,7 @@ Abc_Obj_t* Abc_FlowRetime_CopyNodeToInitNtk(Abc_Obj_t* pOrigObj) {
             assert(Abc_ObjFaninNum(pOrigObj) == 1);
 
             pInitObj = Abc_NtkCreateNodeBuf(pInitNtk, NULL);
-            Abc_FlowRetime_ClearInitToOrig(pInitObj);
+            Abc_FlowRetime_ClearInitToOrig(pManMR, pInitObj);
             return pInitObj;
         }
 
@@ -814,7 +850,7 @@ Abc_Obj_t* Abc_FlowRetime_CopyNodeToInitNtk(Abc_Obj_t* pOrigObj) {
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(Abc_Obj_t* pOrigObj) {
+Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(MinRegMan_t* pManMR, Abc_Obj_t* pOrigObj) {
     Abc_Obj_t *pOrigFanin, *pInitFanin, *pInitObj;
     int i;
 
@@ -830,9 +866,9 @@ Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(Abc_Obj_t* pOrigObj) {
 
     // does an init node already exist?
     if (!pOrigObj->fMarkA) {
-        pInitObj = Abc_FlowRetime_CopyNodeToInitNtk(pOrigObj);
+        pInitObj = Abc_FlowRetime_CopyNodeToInitNtk(pManMR, pOrigObj);
 
-        Abc_FlowRetime_SetInitToOrig(pInitObj, pOrigObj);
+        Abc_FlowRetime_SetInitToOrig(pManMR, pInitObj, pOrigObj);
         FDATA(pOrigObj)->pInitObj = pInitObj;
 
         pOrigObj->fMarkA = 1;
@@ -848,7 +884,7 @@ Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(Abc_Obj_t* pOrigObj) {
             // should not reach BOs (i.e. the start of the next frame)
             // the new latch bounday should lie before it
             assert(!Abc_ObjIsBo(pOrigFanin));
-            pInitFanin = Abc_FlowRetime_UpdateBackwardInit_rec(pOrigFanin);
+            pInitFanin = Abc_FlowRetime_UpdateBackwardInit_rec(pManMR, pOrigFanin);
             Abc_ObjAddFanin(pInitObj, pInitFanin);
         }
 
@@ -874,7 +910,7 @@ Abc_Obj_t* Abc_FlowRetime_UpdateBackwardInit_rec(Abc_Obj_t* pOrigObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_VerifyBackwardInit(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_VerifyBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Obj_t *pObj, *pFanin;
     int i;
 
@@ -884,7 +920,7 @@ void Abc_FlowRetime_VerifyBackwardInit(Abc_Ntk_t* pNtk) {
 
     Abc_NtkForEachObj(pNtk, pObj, i) if (Abc_ObjIsBo(pObj)) {
         pFanin = Abc_ObjFanin0(pObj);
-        Abc_FlowRetime_VerifyBackwardInit_rec(pFanin);
+        Abc_FlowRetime_VerifyBackwardInit_rec(pManMR, pFanin);
 
         if (FTEST(pObj, INIT_CARE)) {
             if (FTEST(pObj, INIT_CARE) != FTEST(pFanin, INIT_CARE)) {
@@ -896,7 +932,7 @@ void Abc_FlowRetime_VerifyBackwardInit(Abc_Ntk_t* pNtk) {
     }
 }
 
-void Abc_FlowRetime_VerifyBackwardInit_rec(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_VerifyBackwardInit_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Abc_Obj_t* pNext;
     int i;
 
@@ -917,10 +953,10 @@ void Abc_FlowRetime_VerifyBackwardInit_rec(Abc_Obj_t* pObj) {
     }
 
     Abc_ObjForEachFanin(pObj, pNext, i) {
-        Abc_FlowRetime_VerifyBackwardInit_rec(pNext);
+        Abc_FlowRetime_VerifyBackwardInit_rec(pManMR, pNext);
     }
 
-    Abc_FlowRetime_SimulateNode(pObj);
+    Abc_FlowRetime_SimulateNode(pManMR, pObj);
 }
 
 /**Function*************************************************************
@@ -934,7 +970,7 @@ void Abc_FlowRetime_VerifyBackwardInit_rec(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_FlowRetime_PartialSat(Vec_Ptr_t* vNodes, int cut) {
+int Abc_FlowRetime_PartialSat(MinRegMan_t* pManMR, Vec_Ptr_t* vNodes, int cut) {
     Abc_Ntk_t *pPartNtk, *pInitNtk = pManMR->pInitNtk;
     Abc_Obj_t *pObj, *pNext, *pPartObj, *pPartNext, *pPo;
     int i, j, result;
@@ -1000,7 +1036,7 @@ int Abc_FlowRetime_PartialSat(Vec_Ptr_t* vNodes, int cut) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_ConstrainInit() {
+void Abc_FlowRetime_ConstrainInit(MinRegMan_t* pManMR) {
     Vec_Ptr_t* vNodes;
     int low, high, mid;
     int i, n, lag;
@@ -1021,7 +1057,7 @@ void Abc_FlowRetime_ConstrainInit() {
     Vec_PtrReorder(vNodes, n);
 
 #if defined(DEBUG_CHECK)
-    assert(!Abc_FlowRetime_PartialSat(vNodes, 0));
+    assert(!Abc_FlowRetime_PartialSat(pManMR, vNodes, 0));
 #endif
 
     // grow initialization constraint
@@ -1033,7 +1069,7 @@ void Abc_FlowRetime_ConstrainInit() {
         while (low != high - 1) {
             mid = (low + high) >> 1;
 
-            if (!Abc_FlowRetime_PartialSat(vNodes, mid)) {
+            if (!Abc_FlowRetime_PartialSat(pManMR, vNodes, mid)) {
                 low = mid;
                 vprintf("-");
             } else {
@@ -1044,8 +1080,8 @@ void Abc_FlowRetime_ConstrainInit() {
         }
 
 #if defined(DEBUG_CHECK)
-        assert(Abc_FlowRetime_PartialSat(vNodes, high));
-        assert(!Abc_FlowRetime_PartialSat(vNodes, low));
+        assert(Abc_FlowRetime_PartialSat(pManMR, vNodes, high));
+        assert(!Abc_FlowRetime_PartialSat(pManMR, vNodes, low));
 #endif
 
         // mark its TFO
@@ -1062,7 +1098,7 @@ void Abc_FlowRetime_ConstrainInit() {
 #endif
 
         // add node to constraint
-        Abc_FlowRetime_GetInitToOrig(pObj, &pOrigObj, &lag);
+        Abc_FlowRetime_GetInitToOrig(pManMR, pObj, &pOrigObj, &lag);
         assert(pOrigObj);
         vprintf(" <=> %d/%d\n", Abc_ObjId(pOrigObj), lag);
 
@@ -1076,7 +1112,7 @@ void Abc_FlowRetime_ConstrainInit() {
         Vec_IntPush(&pConstraint->vNodes, Abc_ObjId(pOrigObj));
         Vec_IntPush(&pConstraint->vLags, lag);
 
-    } while (Abc_FlowRetime_PartialSat(vNodes, Vec_PtrSize(vNodes)));
+    } while (Abc_FlowRetime_PartialSat(pManMR, vNodes, Vec_PtrSize(vNodes)));
 
     pConstraint->pBiasNode = NULL;
 
@@ -1103,7 +1139,7 @@ void Abc_FlowRetime_ConstrainInit() {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_RemoveInitBias() {
+void Abc_FlowRetime_RemoveInitBias(MinRegMan_t* pManMR) {
     // Abc_Ntk_t *pNtk = pManMR->pNtk;
     Abc_Obj_t* pBiasNode;
     InitConstraint_t* pConstraint;
@@ -1135,7 +1171,7 @@ void Abc_FlowRetime_RemoveInitBias() {
   SeeAlso     []
 
 ***********************************************************************/
-static void Abc_FlowRetime_ConnectBiasNode(Abc_Obj_t* pBiasNode, Abc_Obj_t* pObj, int biasLag) {
+static void Abc_FlowRetime_ConnectBiasNode(MinRegMan_t* pManMR, Abc_Obj_t* pBiasNode, Abc_Obj_t* pObj, int biasLag) {
     Abc_Obj_t *pCur, *pNext;
     int i;
     int lag;
@@ -1155,7 +1191,7 @@ static void Abc_FlowRetime_ConnectBiasNode(Abc_Obj_t* pBiasNode, Abc_Obj_t* pObj
         if (Abc_NodeIsTravIdCurrent(pCur)) continue;
         Abc_NodeSetTravIdCurrent(pCur);
 
-        if (!Abc_ObjIsLatch(pCur) && !Abc_ObjIsBo(pCur) && Abc_FlowRetime_GetLag(pObj) + lag == biasLag) {
+        if (!Abc_ObjIsLatch(pCur) && !Abc_ObjIsBo(pCur) && Abc_FlowRetime_GetLag(pManMR, pObj) + lag == biasLag) {
             // printf("biasing : ");
             // Abc_ObjPrint(stdout,  pCur );
 #if 1
@@ -1188,7 +1224,7 @@ static void Abc_FlowRetime_ConnectBiasNode(Abc_Obj_t* pBiasNode, Abc_Obj_t* pObj
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_AddInitBias() {
+void Abc_FlowRetime_AddInitBias(MinRegMan_t* pManMR) {
     Abc_Ntk_t* pNtk = pManMR->pNtk;
     Abc_Obj_t *pBiasNode, *pObj;
     InitConstraint_t* pConstraint;
@@ -1208,7 +1244,7 @@ void Abc_FlowRetime_AddInitBias() {
 
         Vec_IntForEachEntry(&pConstraint->vNodes, id, j) {
             pObj = Abc_NtkObj(pNtk, id);
-            Abc_FlowRetime_ConnectBiasNode(pBiasNode, pObj, Vec_IntEntry(&pConstraint->vLags, j));
+            Abc_FlowRetime_ConnectBiasNode(pManMR, pBiasNode, pObj, Vec_IntEntry(&pConstraint->vLags, j));
         }
 
         // pConstraint->pBiasNode = pBiasNode;
@@ -1226,7 +1262,7 @@ void Abc_FlowRetime_AddInitBias() {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_ClearInitToOrig(Abc_Obj_t* pInit) {
+void Abc_FlowRetime_ClearInitToOrig(MinRegMan_t* pManMR, Abc_Obj_t* pInit) {
     int id = Abc_ObjId(pInit);
 
     // grow data structure if necessary
@@ -1252,7 +1288,7 @@ void Abc_FlowRetime_ClearInitToOrig(Abc_Obj_t* pInit) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_SetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t* pOrig) {
+void Abc_FlowRetime_SetInitToOrig(MinRegMan_t* pManMR, Abc_Obj_t* pInit, Abc_Obj_t* pOrig) {
     int lag;
     int id = Abc_ObjId(pInit);
 
@@ -1267,7 +1303,7 @@ void Abc_FlowRetime_SetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t* pOrig) {
 
     // ignore BI, BO, and latch nodes
     if (Abc_ObjIsBo(pOrig) || Abc_ObjIsBi(pOrig) || Abc_ObjIsLatch(pOrig)) {
-        Abc_FlowRetime_ClearInitToOrig(pInit);
+        Abc_FlowRetime_ClearInitToOrig(pManMR, pInit);
         return;
     }
 
@@ -1275,7 +1311,7 @@ void Abc_FlowRetime_SetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t* pOrig) {
     lag = Abc_FlowRetime_ObjFirstNonLatchBox(pOrig, &pOrig);
 
     pManMR->pInitToOrig[id].id = Abc_ObjId(pOrig);
-    pManMR->pInitToOrig[id].lag = Abc_FlowRetime_GetLag(pOrig) + lag;
+    pManMR->pInitToOrig[id].lag = Abc_FlowRetime_GetLag(pManMR, pOrig) + lag;
 }
 
 /**Function*************************************************************
@@ -1289,7 +1325,7 @@ void Abc_FlowRetime_SetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t* pOrig) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_GetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t** pOrig, int* lag) {
+void Abc_FlowRetime_GetInitToOrig(MinRegMan_t* pManMR, Abc_Obj_t* pInit, Abc_Obj_t** pOrig, int* lag) {
     int id = Abc_ObjId(pInit);
     int origId;
 
@@ -1299,7 +1335,7 @@ void Abc_FlowRetime_GetInitToOrig(Abc_Obj_t* pInit, Abc_Obj_t** pOrig, int* lag)
 
     if (origId < 0) {
         assert(Abc_ObjFaninNum(pInit));
-        Abc_FlowRetime_GetInitToOrig(Abc_ObjFanin0(pInit), pOrig, lag);
+        Abc_FlowRetime_GetInitToOrig(pManMR, Abc_ObjFanin0(pInit), pOrig, lag);
         return;
     }
 
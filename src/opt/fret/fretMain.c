@@ -28,28 +28,25 @@ ABC_NAMESPACE_IMPL_START
 
 static void Abc_FlowRetime_AddDummyFanin(Abc_Obj_t* pObj);
 
-static Abc_Ntk_t* Abc_FlowRetime_MainLoop();
+static Abc_Ntk_t* Abc_FlowRetime_MainLoop(MinRegMan_t* pManMR);
 
-static void Abc_FlowRetime_MarkBlocks(Abc_Ntk_t* pNtk);
+static void Abc_FlowRetime_MarkBlocks(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 static void Abc_FlowRetime_MarkReachable_rec(Abc_Obj_t* pObj, char end);
-static int Abc_FlowRetime_ImplementCut(Abc_Ntk_t* pNtk);
-static void Abc_FlowRetime_RemoveLatchBubbles(Abc_Obj_t* pLatch);
+static int Abc_FlowRetime_ImplementCut(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+static void Abc_FlowRetime_RemoveLatchBubbles(MinRegMan_t* pManMR, Abc_Obj_t* pLatch);
 
-static Abc_Ntk_t* Abc_FlowRetime_NtkDup(Abc_Ntk_t* pNtk);
+static Abc_Ntk_t* Abc_FlowRetime_NtkDup(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+static void Abc_FlowRetime_DeleteObjs(Abc_Ntk_t* pNtk, Vec_Ptr_t* vObjs);
 
-static void Abc_FlowRetime_VerifyPathLatencies(Abc_Ntk_t* pNtk);
-static int Abc_FlowRetime_VerifyPathLatencies_rec(Abc_Obj_t* pObj, int markD);
+static void Abc_FlowRetime_VerifyPathLatencies(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+static int Abc_FlowRetime_VerifyPathLatencies_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj, int markD);
 
-static void Abc_FlowRetime_UpdateLags_forw_rec(Abc_Obj_t* pObj);
-static void Abc_FlowRetime_UpdateLags_back_rec(Abc_Obj_t* pObj);
+static void Abc_FlowRetime_UpdateLags_forw_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+static void Abc_FlowRetime_UpdateLags_back_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
 
 extern void Abc_NtkMarkCone_rec(Abc_Obj_t* pObj, int fForward);
 
-void print_node3(Abc_Obj_t* pObj);
-
-MinRegMan_t* pManMR;
-
-int fPathError = 0;
+void print_node3(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -71,9 +68,10 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
     int i;
     Abc_Obj_t *pObj, *pNext;
     InitConstraint_t* pData;
+    MinRegMan_t* pManMR;
 
     // create manager
-    pManMR = ABC_ALLOC(MinRegMan_t, 1);
+    pManMR = ABC_CALLOC(MinRegMan_t, 1);
 
     pManMR->pNtk = pNtk;
     pManMR->fVerbose = fVerbose;
@@ -96,6 +94,9 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
 
     if (!Abc_NtkHasOnlyLatchBoxes(pNtk)) {
         printf("\tERROR: Can not retime with black/white boxes\n");
+        Vec_PtrFree(pManMR->vNodes);
+        Vec_PtrFree(pManMR->vInitConstraints);
+        ABC_FREE(pManMR);
         return pNtk;
     }
 
@@ -103,6 +104,9 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
         vprintf("\tmax delay constraint = %d\n", maxDelay);
         if (maxDelay < (i = Abc_NtkLevel(pNtk))) {
             printf("ERROR: max delay constraint (%d) must be > current max delay (%d)\n", maxDelay, i);
+            Vec_PtrFree(pManMR->vNodes);
+            Vec_PtrFree(pManMR->vInitConstraints);
+            ABC_FREE(pManMR);
             return pNtk;
         }
     }
@@ -137,7 +141,7 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
     if (pManMR->fVerbose) Abc_FlowRetime_PrintInitStateInfo(pNtk);
     vprintf("\tpushing bubbles out of latch boxes\n");
     Abc_NtkForEachLatch(pNtk, pObj, i)
-        Abc_FlowRetime_RemoveLatchBubbles(pObj);
+        Abc_FlowRetime_RemoveLatchBubbles(pManMR, pObj);
     if (pManMR->fVerbose) Abc_FlowRetime_PrintInitStateInfo(pNtk);
 
     // check for box inputs/outputs
@@ -161,22 +165,19 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
     pManMR->nLatches = Abc_NtkLatchNum(pNtk);
     pManMR->nNodes = Abc_NtkObjNumMax(pNtk) + 1;
 
-    // build histogram
-    pManMR->vSinkDistHist = Vec_IntStart(pManMR->nNodes * 2 + 10);
-
     // initialize timing
     if (maxDelay)
-        Abc_FlowRetime_InitTiming(pNtk);
+        Abc_FlowRetime_InitTiming(pManMR, pNtk);
 
     // create lag and Flow_Data structure
     pManMR->vLags = Vec_IntStart(pManMR->nNodes);
     memset(pManMR->vLags->pArray, 0, sizeof(int) * pManMR->nNodes);
 
     pManMR->pDataArray = ABC_ALLOC(Flow_Data_t, pManMR->nNodes);
-    Abc_FlowRetime_ClearFlows(1);
+    Abc_FlowRetime_ClearFlows(pManMR, 1);
 
     // main loop!
-    pNtk = Abc_FlowRetime_MainLoop();
+    pNtk = Abc_FlowRetime_MainLoop(pManMR);
 
     // cleanup node fields
     Abc_NtkForEachObj(pNtk, pObj, i) {
@@ -190,8 +191,7 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
     if (pManMR->pInitToOrig) ABC_FREE(pManMR->pInitToOrig);
     if (pManMR->vNodes) Vec_PtrFree(pManMR->vNodes);
     if (pManMR->vLags) Vec_IntFree(pManMR->vLags);
-    if (pManMR->vSinkDistHist) Vec_IntFree(pManMR->vSinkDistHist);
-    if (pManMR->maxDelay) Abc_FlowRetime_FreeTiming(pNtk);
+    if (pManMR->maxDelay) Abc_FlowRetime_FreeTiming(pManMR, pNtk);
     while (Vec_PtrSize(pManMR->vInitConstraints)) {
         pData = (InitConstraint_t*)Vec_PtrPop(pManMR->vInitConstraints);
         //assert( pData->pBiasNode );
@@ -232,7 +232,7 @@ Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int
 
 ***********************************************************************/
 Abc_Ntk_t*
-Abc_FlowRetime_MainLoop() {
+Abc_FlowRetime_MainLoop(MinRegMan_t* pManMR) {
     Abc_Ntk_t *pNtk = pManMR->pNtk, *pNtkCopy = pNtk;
     Abc_Obj_t* pObj;
     int i;
@@ -249,26 +249,26 @@ Abc_FlowRetime_MainLoop() {
             vprintf("\tforward iteration %d\n", pManMR->iteration);
             last = Abc_NtkLatchNum(pNtk);
 
-            Abc_FlowRetime_MarkBlocks(pNtk);
+            Abc_FlowRetime_MarkBlocks(pManMR, pNtk);
 
             if (pManMR->maxDelay) {
                 // timing-constrained loop
-                Abc_FlowRetime_ConstrainConserv(pNtk);
-                while (Abc_FlowRetime_RefineConstraints()) {
+                Abc_FlowRetime_ConstrainConserv(pManMR, pNtk);
+                while (Abc_FlowRetime_RefineConstraints(pManMR)) {
                     pManMR->subIteration++;
-                    Abc_FlowRetime_ClearFlows(0);
+                    Abc_FlowRetime_ClearFlows(pManMR, 0);
                 }
             } else {
-                flow = Abc_FlowRetime_PushFlows(pNtk, 1);
+                flow = Abc_FlowRetime_PushFlows(pManMR, pNtk, 1);
             }
 
-            cut = Abc_FlowRetime_ImplementCut(pNtk);
+            cut = Abc_FlowRetime_ImplementCut(pManMR, pNtk);
 
 #if defined(DEBUG_PRINT_LEVELS)
             vprintf("\t\tlevels = %d\n", Abc_NtkLevel(pNtk));
 #endif
 
-            Abc_FlowRetime_ClearFlows(1);
+            Abc_FlowRetime_ClearFlows(pManMR, 1);
 
             pManMR->iteration++;
         } while (cut != last);
@@ -294,12 +294,12 @@ Abc_FlowRetime_MainLoop() {
             if (pManMR->fGuaranteeInitState) {
                 if (pNtk != pNtkCopy)
                     Abc_NtkDelete(pNtk);
-                pNtk = pManMR->pNtk = Abc_FlowRetime_NtkDup(pNtkCopy);
+                pNtk = pManMR->pNtk = Abc_FlowRetime_NtkDup(pManMR, pNtkCopy);
                 vprintf("\trestoring network. regs = %d\n", Abc_NtkLatchNum(pNtk));
             }
 
             if (pManMR->fComputeInitState) {
-                Abc_FlowRetime_SetupBackwardInit(pNtk);
+                Abc_FlowRetime_SetupBackwardInit(pManMR, pNtk);
             }
 
             do {
@@ -309,28 +309,28 @@ Abc_FlowRetime_MainLoop() {
                 vprintf("\tbackward iteration %d\n", pManMR->iteration);
                 last = Abc_NtkLatchNum(pNtk);
 
-                Abc_FlowRetime_AddInitBias();
-                Abc_FlowRetime_MarkBlocks(pNtk);
+                Abc_FlowRetime_AddInitBias(pManMR);
+                Abc_FlowRetime_MarkBlocks(pManMR, pNtk);
 
                 if (pManMR->maxDelay) {
                     // timing-constrained loop
-                    Abc_FlowRetime_ConstrainConserv(pNtk);
-                    while (Abc_FlowRetime_RefineConstraints()) {
+                    Abc_FlowRetime_ConstrainConserv(pManMR, pNtk);
+                    while (Abc_FlowRetime_RefineConstraints(pManMR)) {
                         pManMR->subIteration++;
-                        Abc_FlowRetime_ClearFlows(0);
+                        Abc_FlowRetime_ClearFlows(pManMR, 0);
                     }
                 } else {
-                    flow = Abc_FlowRetime_PushFlows(pNtk, 1);
+                    flow = Abc_FlowRetime_PushFlows(pManMR, pNtk, 1);
                 }
 
-                Abc_FlowRetime_RemoveInitBias();
-                cut = Abc_FlowRetime_ImplementCut(pNtk);
+                Abc_FlowRetime_RemoveInitBias(pManMR);
+                cut = Abc_FlowRetime_ImplementCut(pManMR, pNtk);
 
 #if defined(DEBUG_PRINT_LEVELS)
                 vprintf("\t\tlevels = %d\n", Abc_NtkLevelReverse(pNtk));
 #endif
 
-                Abc_FlowRetime_ClearFlows(1);
+                Abc_FlowRetime_ClearFlows(pManMR, 1);
 
                 pManMR->iteration++;
             } while (cut != last);
@@ -338,7 +338,7 @@ Abc_FlowRetime_MainLoop() {
             // compute initial states
             if (!pManMR->fComputeInitState) break;
 
-            if (Abc_FlowRetime_SolveBackwardInit(pNtk)) {
+            if (Abc_FlowRetime_SolveBackwardInit(pManMR, pNtk)) {
                 if (pManMR->fVerbose) Abc_FlowRetime_PrintInitStateInfo(pNtk);
                 break;
             } else {
@@ -347,7 +347,7 @@ Abc_FlowRetime_MainLoop() {
                     Abc_NtkForEachLatch(pNtk, pObj, i) Abc_LatchSetInitDc(pObj);
                     break;
                 }
-                Abc_FlowRetime_ConstrainInit();
+                Abc_FlowRetime_ConstrainInit(pManMR);
             }
 
             Abc_NtkDelete(pManMR->pInitNtk);
@@ -373,7 +373,7 @@ Abc_FlowRetime_MainLoop() {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_RemoveLatchBubbles(Abc_Obj_t* pLatch) {
+void Abc_FlowRetime_RemoveLatchBubbles(MinRegMan_t* pManMR, Abc_Obj_t* pLatch) {
     int bubble = 0;
     Abc_Ntk_t* pNtk = pManMR->pNtk;
     Abc_Obj_t *pBi, *pBo, *pInv;
@@ -417,7 +417,7 @@ void Abc_FlowRetime_RemoveLatchBubbles(Abc_Obj_t* pLatch) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_MarkBlocks(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_MarkBlocks(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     int i;
     Abc_Obj_t* pObj;
 
@@ -465,68 +465,6 @@ void Abc_FlowRetime_MarkBlocks(Abc_Ntk_t* pNtk) {
     }
 }
 
-/**Function*************************************************************
-
-  Synopsis    [Computes maximum flow.]
-
-  Description []
-               
-  SideEffects [Leaves VISITED flags on source-reachable nodes.]
-
-  SeeAlso     []
-
-***********************************************************************/
-int Abc_FlowRetime_PushFlows(Abc_Ntk_t* pNtk, int fVerbose) {
-    int i, j, flow = 0, last, srcDist = 0;
-    Abc_Obj_t *pObj, *pObj2;
-    //  int clk = clock();
-
-    pManMR->constraintMask |= BLOCK;
-
-    pManMR->fSinkDistTerminate = 0;
-    dfsfast_preorder(pNtk);
-
-    // (i) fast max-flow computation
-    while (!pManMR->fSinkDistTerminate && srcDist < MAX_DIST) {
-        srcDist = MAX_DIST;
-        Abc_NtkForEachLatch(pNtk, pObj, i) if (FDATA(pObj)->e_dist)
-            srcDist
-            = MIN(srcDist, (int)FDATA(pObj)->e_dist);
-
-        Abc_NtkForEachLatch(pNtk, pObj, i) {
-            if (srcDist == (int)FDATA(pObj)->e_dist && dfsfast_e(pObj, NULL)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("\n\n");
-#endif
-                flow++;
-            }
-        }
-    }
-
-    if (fVerbose) vprintf("\t\tmax-flow1 = %d \t", flow);
-
-    // (ii) complete max-flow computation
-    // also, marks source-reachable nodes
-    do {
-        last = flow;
-        Abc_NtkForEachLatch(pNtk, pObj, i) {
-            if (dfsplain_e(pObj, NULL)) {
-#ifdef DEBUG_PRINT_FLOWS
-                printf("\n\n");
-#endif
-                flow++;
-                Abc_NtkForEachObj(pNtk, pObj2, j)
-                    FUNSET(pObj2, VISITED);
-            }
-        }
-    } while (flow > last);
-
-    if (fVerbose) vprintf("max-flow2 = %d\n", flow);
-
-    //  PRT( "time", clock() - clk );
-    return flow;
-}
-
 /**Function*************************************************************
 
   Synopsis    [Restores latch boxes.]
@@ -613,14 +551,8 @@ void Abc_FlowRetime_FixLatchBoxes(Abc_Ntk_t* pNtk, Vec_Ptr_t* vBoxIns) {
     }
 
     // delete remaining BIs and BOs
-    while (Vec_PtrSize(vFreeBi)) {
-        pObj = (Abc_Obj_t*)Vec_PtrPop(vFreeBi);
-        Abc_NtkDeleteObj(pObj);
-    }
-    while (Vec_PtrSize(vFreeBo)) {
-        pObj = (Abc_Obj_t*)Vec_PtrPop(vFreeBo);
-        Abc_NtkDeleteObj(pObj);
-    }
+    Abc_FlowRetime_DeleteObjs(pNtk, vFreeBi);
+    Abc_FlowRetime_DeleteObjs(pNtk, vFreeBo);
 
 #if defined(DEBUG_CHECK)
     Abc_NtkForEachObj(pNtk, pObj, i) {
@@ -655,24 +587,24 @@ void Abc_FlowRetime_FixLatchBoxes(Abc_Ntk_t* pNtk, Vec_Ptr_t* vBoxIns) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_VerifyPathLatencies(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_VerifyPathLatencies(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     int i;
     Abc_Obj_t* pObj;
-    fPathError = 0;
+    pManMR->fPathError = 0;
 
     vprintf("\t\tVerifying latency along all paths...");
 
     Abc_NtkForEachObj(pNtk, pObj, i) {
         if (Abc_ObjIsBo(pObj)) {
-            Abc_FlowRetime_VerifyPathLatencies_rec(pObj, 0);
+            Abc_FlowRetime_VerifyPathLatencies_rec(pManMR, pObj, 0);
         } else if (!pManMR->fIsForward && Abc_ObjIsPi(pObj)) {
-            Abc_FlowRetime_VerifyPathLatencies_rec(pObj, 0);
+            Abc_FlowRetime_VerifyPathLatencies_rec(pManMR, pObj, 0);
         }
 
-        if (fPathError) {
+        if (pManMR->fPathError) {
             if (Abc_ObjFaninNum(pObj) > 0) {
                 printf("fanin ");
-                print_node(Abc_ObjFanin0(pObj));
+                print_node(pManMR, Abc_ObjFanin0(pObj));
             }
             printf("\n");
             exit(0);
@@ -688,7 +620,7 @@ void Abc_FlowRetime_VerifyPathLatencies(Abc_Ntk_t* pNtk) {
     }
 }
 
-int Abc_FlowRetime_VerifyPathLatencies_rec(Abc_Obj_t* pObj, int markD) {
+int Abc_FlowRetime_VerifyPathLatencies_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj, int markD) {
     int i, j;
     Abc_Obj_t* pNext;
     int fCare = 0;
@@ -708,27 +640,27 @@ int Abc_FlowRetime_VerifyPathLatencies_rec(Abc_Obj_t* pObj, int markD) {
             if (Abc_ObjIsBo(pNext) || (pManMR->fIsForward && Abc_ObjIsPo(pNext))) {
                 if (!markD && !Abc_ObjIsLatch(pObj)) {
                     printf("\nERROR: no-latch path (end)\n");
-                    print_node(pNext);
+                    print_node(pManMR, pNext);
                     printf("\n");
-                    fPathError = 1;
+                    pManMR->fPathError = 1;
                 }
             } else if (!pManMR->fIsForward && Abc_ObjIsPo(pNext)) {
                 if (markD || Abc_ObjIsLatch(pObj)) {
                     printf("\nERROR: extra-latch path to outputs\n");
-                    print_node(pNext);
+                    print_node(pManMR, pNext);
                     printf("\n");
-                    fPathError = 1;
+                    pManMR->fPathError = 1;
                 }
             } else {
-                j = Abc_FlowRetime_VerifyPathLatencies_rec(pNext, markD || Abc_ObjIsLatch(pObj));
+                j = Abc_FlowRetime_VerifyPathLatencies_rec(pManMR, pNext, markD || Abc_ObjIsLatch(pObj));
                 if (j >= 0) {
                     markC |= j;
                     fCare = 1;
                 }
             }
 
-            if (fPathError) {
-                print_node(pObj);
+            if (pManMR->fPathError) {
+                print_node(pManMR, pObj);
                 printf("\n");
                 return 0;
             }
@@ -739,15 +671,15 @@ int Abc_FlowRetime_VerifyPathLatencies_rec(Abc_Obj_t* pObj, int markD) {
 
     if (markC && markD) {
         printf("\nERROR: mult-latch path\n");
-        print_node(pObj);
+        print_node(pManMR, pObj);
         printf("\n");
-        fPathError = 1;
+        pManMR->fPathError = 1;
     }
     if (!markC && !markD) {
         printf("\nERROR: no-latch path (inter)\n");
-        print_node(pObj);
+        print_node(pManMR, pObj);
         printf("\n");
-        fPathError = 1;
+        pManMR->fPathError = 1;
     }
 
     return (pObj->fMarkC = markC);
@@ -765,7 +697,7 @@ int Abc_FlowRetime_VerifyPathLatencies_rec(Abc_Obj_t* pObj, int markD) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_CopyInitState(Abc_Obj_t* pSrc, Abc_Obj_t* pDest) {
+void Abc_FlowRetime_CopyInitState(MinRegMan_t* pManMR, Abc_Obj_t* pSrc, Abc_Obj_t* pDest) {
     Abc_Obj_t* pObj;
 
     if (!pManMR->fComputeInitState) return;
@@ -799,7 +731,7 @@ void Abc_FlowRetime_CopyInitState(Abc_Obj_t* pSrc, Abc_Obj_t* pDest) {
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_FlowRetime_ImplementCut(Abc_Ntk_t* pNtk) {
+int Abc_FlowRetime_ImplementCut(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     int i, j, cut = 0, unmoved = 0;
     Abc_Obj_t *pObj, *pReg, *pNext, *pBo = NULL, *pBi = NULL;
     Vec_Ptr_t* vFreeRegs = Vec_PtrAlloc(Abc_NtkLatchNum(pNtk));
@@ -814,7 +746,7 @@ int Abc_FlowRetime_ImplementCut(Abc_Ntk_t* pNtk) {
         Vec_PtrPush(vBoxIns, pBi);
 
         // copy initial state values to BO
-        Abc_FlowRetime_CopyInitState(pObj, pBo);
+        Abc_FlowRetime_CopyInitState(pManMR, pObj, pBo);
 
         // re-use latch elsewhere
         Vec_PtrPush(vFreeRegs, pObj);
@@ -846,12 +778,12 @@ int Abc_FlowRetime_ImplementCut(Abc_Ntk_t* pNtk) {
 
             // only insert latch between fanouts that lie across min-cut
             // some fanout paths may be cut at deeper points
-            Abc_ObjForEachFanout(pObj, pNext, j) if (Abc_FlowRetime_IsAcrossCut(pObj, pNext))
+            Abc_ObjForEachFanout(pObj, pNext, j) if (Abc_FlowRetime_IsAcrossCut(pManMR, pObj, pNext))
                 Vec_PtrPush(vMove, pNext);
 
             // check that move-set is non-zero
             if (Vec_PtrSize(vMove) == 0)
-                print_node(pObj);
+                print_node(pManMR, pObj);
             assert(Vec_PtrSize(vMove) > 0);
 
             // insert one of re-useable registers
@@ -869,18 +801,15 @@ int Abc_FlowRetime_ImplementCut(Abc_Ntk_t* pNtk) {
     }
 
 #if defined(DEBUG_CHECK)
-    Abc_FlowRetime_VerifyPathLatencies(pNtk);
+    Abc_FlowRetime_VerifyPathLatencies(pManMR, pNtk);
 #endif
 
     // delete remaining latches
-    while (Vec_PtrSize(vFreeRegs)) {
-        pReg = (Abc_Obj_t*)Vec_PtrPop(vFreeRegs);
-        Abc_NtkDeleteObj(pReg);
-    }
+    Abc_FlowRetime_DeleteObjs(pNtk, vFreeRegs);
 
     // update initial states
-    Abc_FlowRetime_UpdateLags();
-    Abc_FlowRetime_InitState(pNtk);
+    Abc_FlowRetime_UpdateLags(pManMR);
+    Abc_FlowRetime_InitState(pManMR, pNtk);
 
     // restore latch boxes
     Abc_FlowRetime_FixLatchBoxes(pNtk, vBoxIns);
@@ -893,6 +822,53 @@ int Abc_FlowRetime_ImplementCut(Abc_Ntk_t* pNtk) {
     return cut;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Deletes a set of objects.]
+
+  Description [Removes the objects from the lists of boxes, CIs, and COs
+               in one pass, rather than one object at a time, which takes
+               quadratic time when many latches are retimed.]
+
+  SideEffects [Empties the array.]
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Ptr_t* Abc_FlowRetime_CompactObjs(Vec_Ptr_t* vList) {
+    Abc_Obj_t* pObj;
+    int i, k = 0;
+    if (vList == NULL)
+        return NULL;
+    Vec_PtrForEachEntry(Abc_Obj_t*, vList, pObj, i) if (!Abc_NodeIsTravIdCurrent(pObj))
+        Vec_PtrWriteEntry(vList, k++, pObj);
+    Vec_PtrShrink(vList, k);
+    return vList;
+}
+void Abc_FlowRetime_DeleteObjs(Abc_Ntk_t* pNtk, Vec_Ptr_t* vObjs) {
+    Vec_Ptr_t *vBoxes, *vCis, *vCos;
+    Abc_Obj_t* pObj;
+    int i;
+    // compact the lists
+    Abc_NtkIncrementTravId(pNtk);
+    Vec_PtrForEachEntry(Abc_Obj_t*, vObjs, pObj, i) {
+        assert(Abc_ObjIsLatch(pObj) || Abc_ObjIsBi(pObj) || Abc_ObjIsBo(pObj));
+        Abc_NodeSetTravIdCurrent(pObj);
+    }
+    vBoxes = Abc_FlowRetime_CompactObjs(pNtk->vBoxes);
+    vCis = Abc_FlowRetime_CompactObjs(pNtk->vCis);
+    vCos = Abc_FlowRetime_CompactObjs(pNtk->vCos);
+    // delete the objects while the lists are detached
+    pNtk->vBoxes = pNtk->vCis = pNtk->vCos = NULL;
+    while (Vec_PtrSize(vObjs)) {
+        pObj = (Abc_Obj_t*)Vec_PtrPop(vObjs);
+        Abc_NtkDeleteObj(pObj);
+    }
+    pNtk->vBoxes = vBoxes;
+    pNtk->vCis = vCis;
+    pNtk->vCos = vCos;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Adds dummy fanin.]
@@ -924,7 +900,7 @@ void Abc_FlowRetime_AddDummyFanin(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void print_node(Abc_Obj_t* pObj) {
+void print_node(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     int i;
     Abc_Obj_t* pNext;
     char m[6];
@@ -969,7 +945,7 @@ void print_node2(Abc_Obj_t* pObj) {
     printf("} ");
 }
 
-void print_node3(Abc_Obj_t* pObj) {
+void print_node3(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     int i;
     Abc_Obj_t* pNext;
     char m[6];
@@ -985,12 +961,12 @@ void print_node3(Abc_Obj_t* pObj) {
     printf("\nnode %d type=%d mark=%d %s\n", Abc_ObjId(pObj), Abc_ObjType(pObj), FDATA(pObj)->mark, m);
     printf("fanouts\n");
     Abc_ObjForEachFanout(pObj, pNext, i) {
-        print_node(pNext);
+        print_node(pManMR, pNext);
         printf("\n");
     }
     printf("fanins\n");
     Abc_ObjForEachFanin(pObj, pNext, i) {
-        print_node(pNext);
+        print_node(pManMR, pNext);
         printf("\n");
     }
 }
@@ -1027,7 +1003,7 @@ void Abc_ObjBetterTransferFanout(Abc_Obj_t* pFrom, Abc_Obj_t* pTo, int complemen
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_FlowRetime_IsAcrossCut(Abc_Obj_t* pObj, Abc_Obj_t* pNext) {
+int Abc_FlowRetime_IsAcrossCut(MinRegMan_t* pManMR, Abc_Obj_t* pObj, Abc_Obj_t* pNext) {
     if (FTEST(pObj, VISITED_R) && !FTEST(pObj, VISITED_E)) {
         if (pManMR->fIsForward) {
             if (!FTEST(pNext, VISITED_R) || (FTEST(pNext, BLOCK_OR_CONS) & pManMR->constraintMask) || FTEST(pNext, CROSS_BOUNDARY) || Abc_ObjIsLatch(pNext))
@@ -1054,7 +1030,7 @@ int Abc_FlowRetime_IsAcrossCut(Abc_Obj_t* pObj, Abc_Obj_t* pNext) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_ClearFlows(int fClearAll) {
+void Abc_FlowRetime_ClearFlows(MinRegMan_t* pManMR, int fClearAll) {
     int i;
 
     if (fClearAll)
@@ -1063,8 +1039,6 @@ void Abc_FlowRetime_ClearFlows(int fClearAll) {
         // clear only data related to flow problem
         for (i = 0; i < pManMR->nNodes; i++) {
             pManMR->pDataArray[i].mark &= ~(VISITED | FLOW);
-            pManMR->pDataArray[i].e_dist = 0;
-            pManMR->pDataArray[i].r_dist = 0;
             pManMR->pDataArray[i].pred = NULL;
         }
     }
@@ -1081,7 +1055,7 @@ void Abc_FlowRetime_ClearFlows(int fClearAll) {
   SeeAlso     []
 
 ***********************************************************************/
-static Abc_Ntk_t* Abc_FlowRetime_NtkDup(Abc_Ntk_t* pNtk) {
+static Abc_Ntk_t* Abc_FlowRetime_NtkDup(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Ntk_t* pNtkCopy;
     Abc_Obj_t *pObj, *pObjCopy, *pNext, *pNextCopy;
     int i, j;
@@ -1187,7 +1161,7 @@ Abc_Ntk_t* Abc_FlowRetime_NtkSilentRestrash(Abc_Ntk_t* pNtk, int fCleanup) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_UpdateLags_forw_rec(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_UpdateLags_forw_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Abc_Obj_t* pNext;
     int i;
 
@@ -1200,11 +1174,11 @@ void Abc_FlowRetime_UpdateLags_forw_rec(Abc_Obj_t* pObj) {
     Abc_NodeSetTravIdCurrent(pObj);
 
     if (Abc_ObjIsNode(pObj)) {
-        Abc_FlowRetime_SetLag(pObj, -1 + Abc_FlowRetime_GetLag(pObj));
+        Abc_FlowRetime_SetLag(pManMR, pObj, -1 + Abc_FlowRetime_GetLag(pManMR, pObj));
     }
 
     Abc_ObjForEachFanin(pObj, pNext, i) {
-        Abc_FlowRetime_UpdateLags_forw_rec(pNext);
+        Abc_FlowRetime_UpdateLags_forw_rec(pManMR, pNext);
     }
 }
 
@@ -1219,7 +1193,7 @@ void Abc_FlowRetime_UpdateLags_forw_rec(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_UpdateLags_back_rec(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_UpdateLags_back_rec(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Abc_Obj_t* pNext;
     int i;
 
@@ -1232,11 +1206,11 @@ void Abc_FlowRetime_UpdateLags_back_rec(Abc_Obj_t* pObj) {
     Abc_NodeSetTravIdCurrent(pObj);
 
     if (Abc_ObjIsNode(pObj)) {
-        Abc_FlowRetime_SetLag(pObj, 1 + Abc_FlowRetime_GetLag(pObj));
+        Abc_FlowRetime_SetLag(pManMR, pObj, 1 + Abc_FlowRetime_GetLag(pManMR, pObj));
     }
 
     Abc_ObjForEachFanout(pObj, pNext, i) {
-        Abc_FlowRetime_UpdateLags_back_rec(pNext);
+        Abc_FlowRetime_UpdateLags_back_rec(pManMR, pNext);
     }
 }
 
@@ -1251,7 +1225,7 @@ void Abc_FlowRetime_UpdateLags_back_rec(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_UpdateLags() {
+void Abc_FlowRetime_UpdateLags(MinRegMan_t* pManMR) {
     Abc_Obj_t *pObj, *pNext;
     int i, j;
 
@@ -1259,11 +1233,11 @@ void Abc_FlowRetime_UpdateLags() {
 
     Abc_NtkForEachLatch(pManMR->pNtk, pObj, i) if (pManMR->fIsForward) {
         Abc_ObjForEachFanin(pObj, pNext, j)
-            Abc_FlowRetime_UpdateLags_forw_rec(pNext);
+            Abc_FlowRetime_UpdateLags_forw_rec(pManMR, pNext);
     }
     else {
         Abc_ObjForEachFanout(pObj, pNext, j)
-            Abc_FlowRetime_UpdateLags_back_rec(pNext);
+            Abc_FlowRetime_UpdateLags_back_rec(pManMR, pNext);
     }
 }
 
@@ -1278,7 +1252,7 @@ void Abc_FlowRetime_UpdateLags() {
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_FlowRetime_GetLag(Abc_Obj_t* pObj) {
+int Abc_FlowRetime_GetLag(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     assert(!Abc_ObjIsLatch(pObj));
     assert((int)Abc_ObjId(pObj) < Vec_IntSize(pManMR->vLags));
 
@@ -1296,7 +1270,7 @@ int Abc_FlowRetime_GetLag(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_SetLag(Abc_Obj_t* pObj, int lag) {
+void Abc_FlowRetime_SetLag(MinRegMan_t* pManMR, Abc_Obj_t* pObj, int lag) {
     assert(Abc_ObjIsNode(pObj));
     assert((int)Abc_ObjId(pObj) < Vec_IntSize(pManMR->vLags));
 
@@ -29,18 +29,18 @@ ABC_NAMESPACE_IMPL_START
 static void Abc_FlowRetime_Dfs_forw(Abc_Obj_t* pObj, Vec_Ptr_t* vNodes);
 static void Abc_FlowRetime_Dfs_back(Abc_Obj_t* pObj, Vec_Ptr_t* vNodes);
 
-static void Abc_FlowRetime_ConstrainExact_forw(Abc_Obj_t* pObj);
-static void Abc_FlowRetime_ConstrainExact_back(Abc_Obj_t* pObj);
-static void Abc_FlowRetime_ConstrainConserv_forw(Abc_Ntk_t* pNtk);
-static void Abc_FlowRetime_ConstrainConserv_back(Abc_Ntk_t* pNtk);
+static void Abc_FlowRetime_ConstrainExact_forw(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+static void Abc_FlowRetime_ConstrainExact_back(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+static void Abc_FlowRetime_ConstrainConserv_forw(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+static void Abc_FlowRetime_ConstrainConserv_back(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 
-void trace2(Abc_Obj_t* pObj) {
+void trace2(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Abc_Obj_t* pNext;
     int i;
 
-    print_node(pObj);
+    print_node(pManMR, pObj);
     Abc_ObjForEachFanin(pObj, pNext, i) if (pNext->Level >= pObj->Level - 1) {
-        trace2(pNext);
+        trace2(pManMR, pNext);
         break;
     }
 }
@@ -60,7 +60,7 @@ void trace2(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_InitTiming(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_InitTiming(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     pManMR->nConservConstraints = pManMR->nExactConstraints = 0;
 
     pManMR->vExactNodes = Vec_PtrAlloc(1000);
@@ -81,7 +81,7 @@ void Abc_FlowRetime_InitTiming(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_ConstrainConserv(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_ConstrainConserv(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Obj_t* pObj;
     int i;
     void* pArray;
@@ -99,9 +99,9 @@ void Abc_FlowRetime_ConstrainConserv(Abc_Ntk_t* pNtk) {
 
 #if !defined(IGNORE_TIMING)
     if (pManMR->fIsForward) {
-        Abc_FlowRetime_ConstrainConserv_forw(pNtk);
+        Abc_FlowRetime_ConstrainConserv_forw(pManMR, pNtk);
     } else {
-        Abc_FlowRetime_ConstrainConserv_back(pNtk);
+        Abc_FlowRetime_ConstrainConserv_back(pManMR, pNtk);
     }
 #endif
 
@@ -109,7 +109,7 @@ void Abc_FlowRetime_ConstrainConserv(Abc_Ntk_t* pNtk) {
         assert(!Vec_PtrSize(FTIMEEDGES(pObj)));
 }
 
-void Abc_FlowRetime_ConstrainConserv_forw(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_ConstrainConserv_forw(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Vec_Ptr_t* vNodes = pManMR->vNodes;
     Abc_Obj_t *pObj, *pNext, *pBi, *pBo;
     int i, j;
@@ -239,7 +239,7 @@ void Abc_FlowRetime_ConstrainConserv_forw(Abc_Ntk_t* pNtk) {
     Vec_PtrClear(vNodes);
 }
 
-void Abc_FlowRetime_ConstrainConserv_back(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_ConstrainConserv_back(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Vec_Ptr_t* vNodes = pManMR->vNodes;
     Abc_Obj_t *pObj, *pNext, *pBi, *pBo;
     int i, j, l;
@@ -383,7 +383,7 @@ void Abc_FlowRetime_ConstrainConserv_back(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_ConstrainExact(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_ConstrainExact(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     if (FTEST(pObj, CONSERVATIVE)) {
         pManMR->nConservConstraints--;
         FUNSET(pObj, CONSERVATIVE);
@@ -391,9 +391,9 @@ void Abc_FlowRetime_ConstrainExact(Abc_Obj_t* pObj) {
 
 #if !defined(IGNORE_TIMING)
     if (pManMR->fIsForward) {
-        Abc_FlowRetime_ConstrainExact_forw(pObj);
+        Abc_FlowRetime_ConstrainExact_forw(pManMR, pObj);
     } else {
-        Abc_FlowRetime_ConstrainExact_back(pObj);
+        Abc_FlowRetime_ConstrainExact_back(pManMR, pObj);
     }
 #endif
 }
@@ -427,7 +427,7 @@ void Abc_FlowRetime_ConstrainExact_forw_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vNodes,
     Vec_PtrPush(vNodes, Abc_ObjNotCond(pObj, latch));
 }
 
-void Abc_FlowRetime_ConstrainExact_forw(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_ConstrainExact_forw(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Vec_Ptr_t* vNodes = pManMR->vNodes;
     Abc_Obj_t *pNext, *pCur, *pReg;
     // Abc_Ntk_t *pNtk = pManMR->pNtk;
@@ -502,7 +502,7 @@ void Abc_FlowRetime_ConstrainExact_back_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vNodes,
     Vec_PtrPush(vNodes, Abc_ObjNotCond(pObj, latch));
 }
 
-void Abc_FlowRetime_ConstrainExact_back(Abc_Obj_t* pObj) {
+void Abc_FlowRetime_ConstrainExact_back(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     Vec_Ptr_t* vNodes = pManMR->vNodes;
     Abc_Obj_t *pNext, *pCur, *pReg;
     // Abc_Ntk_t *pNtk = pManMR->pNtk;
@@ -559,7 +559,7 @@ void Abc_FlowRetime_ConstrainExact_back(Abc_Obj_t* pObj) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_ConstrainExactAll(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_ConstrainExactAll(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     int i;
     Abc_Obj_t* pObj;
     void* pArray;
@@ -573,7 +573,7 @@ void Abc_FlowRetime_ConstrainExactAll(Abc_Ntk_t* pNtk) {
 
     // generate all constraints
     Abc_NtkForEachObj(pNtk, pObj, i) if (!Abc_ObjIsLatch(pObj) && FTEST(pObj, CONSERVATIVE) && !FTEST(pObj, BLOCK)) if (!Vec_PtrSize(FTIMEEDGES(pObj)))
-        Abc_FlowRetime_ConstrainExact(pObj);
+        Abc_FlowRetime_ConstrainExact(pManMR, pObj);
 }
 
 /**Function*************************************************************
@@ -587,7 +587,7 @@ void Abc_FlowRetime_ConstrainExactAll(Abc_Ntk_t* pNtk) {
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_FlowRetime_FreeTiming(Abc_Ntk_t* pNtk) {
+void Abc_FlowRetime_FreeTiming(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk) {
     Abc_Obj_t* pObj;
     void* pArray;
 
@@ -658,7 +658,7 @@ void Abc_FlowRetime_Dfs_back(Abc_Obj_t* pObj, Vec_Ptr_t* vNodes) {
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_FlowRetime_RefineConstraints() {
+int Abc_FlowRetime_RefineConstraints(MinRegMan_t* pManMR) {
     Abc_Ntk_t* pNtk = pManMR->pNtk;
     int i, flow, count = 0;
     Abc_Obj_t* pObj;
@@ -671,7 +671,7 @@ int Abc_FlowRetime_RefineConstraints() {
     pManMR->constraintMask = BLOCK | CONSERVATIVE;
     vprintf("\t\trefinement: over ");
     fflush(stdout);
-    flow = Abc_FlowRetime_PushFlows(pNtk, 0);
+    flow = Abc_FlowRetime_PushFlows(pManMR, pNtk, 0);
     vprintf("= %d ", flow);
 
     // remember nodes
@@ -692,10 +692,10 @@ int Abc_FlowRetime_RefineConstraints() {
 
     // 2. underconstrained
     pManMR->constraintMask = BLOCK;
-    Abc_FlowRetime_ClearFlows(0);
+    Abc_FlowRetime_ClearFlows(pManMR, 0);
     vprintf("under = ");
     fflush(stdout);
-    flow = Abc_FlowRetime_PushFlows(pNtk, 0);
+    flow = Abc_FlowRetime_PushFlows(pManMR, pNtk, 0);
     vprintf("%d refined nodes = ", flow);
     fflush(stdout);
 
@@ -704,7 +704,7 @@ int Abc_FlowRetime_RefineConstraints() {
         Abc_NtkForEachObj(pNtk, pObj, i) {
             if (pObj->fMarkC && FTEST(pObj, VISITED_R) && FTEST(pObj, CONSERVATIVE) && count < maxTighten) {
                 count++;
-                Abc_FlowRetime_ConstrainExact(pObj);
+                Abc_FlowRetime_ConstrainExact(pManMR, pObj);
             }
             pObj->fMarkC = 0;
         }
@@ -712,7 +712,7 @@ int Abc_FlowRetime_RefineConstraints() {
         Abc_NtkForEachObj(pNtk, pObj, i) {
             if (pObj->fMarkC && FTEST(pObj, VISITED_E) && FTEST(pObj, CONSERVATIVE) && count < maxTighten) {
                 count++;
-                Abc_FlowRetime_ConstrainExact(pObj);
+                Abc_FlowRetime_ConstrainExact(pManMR, pObj);
             }
             pObj->fMarkC = 0;
         }
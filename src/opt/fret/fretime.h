@@ -37,8 +37,6 @@ ABC_NAMESPACE_HEADER_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#    define MAX_DIST 30000
-
 // flags in Flow_Data structure...
 #    define VISITED_E 0x001
 #    define VISITED_R 0x002
@@ -66,12 +64,10 @@ typedef struct Flow_Data_t_ {
         Abc_Obj_t* pCopy;
         Vec_Ptr_t* vNodes;
     };
-
-    unsigned int e_dist : 16;
-    unsigned int r_dist : 16;
 } Flow_Data_t;
 
 // useful macros for manipulating Flow_Data structure...
+// (they refer to the manager pManMR of the calling function)
 #    define FDATA(x) (pManMR->pDataArray + Abc_ObjId(x))
 #    define FSET(x, y) FDATA(x)->mark |= y
 #    define FUNSET(x, y) FDATA(x)->mark &= ~y
@@ -106,7 +102,6 @@ typedef struct MinRegMan_t_ {
 
     // problem state
     int fIsForward;
-    int fSinkDistTerminate;
     int nExactConstraints, nConservConstraints;
     int fSolutionIsDc;
     int constraintMask;
@@ -114,7 +109,6 @@ typedef struct MinRegMan_t_ {
     Vec_Int_t* vLags;
 
     // problem data
-    Vec_Int_t* vSinkDistHist;
     Flow_Data_t* pDataArray;
     Vec_Ptr_t* vTimeEdges;
     Vec_Ptr_t* vExactNodes;
@@ -125,18 +119,18 @@ typedef struct MinRegMan_t_ {
     NodeLag_t* pInitToOrig;
     int sizeInitToOrig;
 
-} MinRegMan_t;
+    int fPathError; // set when the path latencies do not match
 
-extern MinRegMan_t* pManMR;
+} MinRegMan_t;
 
 #    define vprintf \
         if (pManMR->fVerbose) printf
 
-static inline void FSETPRED(Abc_Obj_t* pObj, Abc_Obj_t* pPred) {
+static inline void FSETPRED(MinRegMan_t* pManMR, Abc_Obj_t* pObj, Abc_Obj_t* pPred) {
     assert(!Abc_ObjIsLatch(pObj)); // must preserve field to maintain init state linkage
     FDATA(pObj)->pred = pPred;
 }
-static inline Abc_Obj_t* FGETPRED(Abc_Obj_t* pObj) {
+static inline Abc_Obj_t* FGETPRED(MinRegMan_t* pManMR, Abc_Obj_t* pObj) {
     return FDATA(pObj)->pred;
 }
 
@@ -144,18 +138,17 @@ static inline Abc_Obj_t* FGETPRED(Abc_Obj_t* pObj) {
 
 Abc_Ntk_t* Abc_FlowRetime_MinReg(Abc_Ntk_t* pNtk, int fVerbose, int fComputeInitState, int fGuaranteeInitState, int fBlockConst, int fForward, int fBackward, int nMaxIters, int maxDelay, int fFastButConservative);
 
-void print_node(Abc_Obj_t* pObj);
+void print_node(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
 
 void Abc_ObjBetterTransferFanout(Abc_Obj_t* pFrom, Abc_Obj_t* pTo, int complement);
 
-int Abc_FlowRetime_PushFlows(Abc_Ntk_t* pNtk, int fVerbose);
-int Abc_FlowRetime_IsAcrossCut(Abc_Obj_t* pCur, Abc_Obj_t* pNext);
-void Abc_FlowRetime_ClearFlows(int fClearAll);
+int Abc_FlowRetime_IsAcrossCut(MinRegMan_t* pManMR, Abc_Obj_t* pCur, Abc_Obj_t* pNext);
+void Abc_FlowRetime_ClearFlows(MinRegMan_t* pManMR, int fClearAll);
 
-int Abc_FlowRetime_GetLag(Abc_Obj_t* pObj);
-void Abc_FlowRetime_SetLag(Abc_Obj_t* pObj, int lag);
+int Abc_FlowRetime_GetLag(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+void Abc_FlowRetime_SetLag(MinRegMan_t* pManMR, Abc_Obj_t* pObj, int lag);
 
-void Abc_FlowRetime_UpdateLags();
+void Abc_FlowRetime_UpdateLags(MinRegMan_t* pManMR);
 
 void Abc_ObjPrintNeighborhood(Abc_Obj_t* pObj, int depth);
 
@@ -163,39 +156,34 @@ Abc_Ntk_t* Abc_FlowRetime_NtkSilentRestrash(Abc_Ntk_t* pNtk, int fCleanup);
 
 /*=== fretFlow.c ==========================================================*/
 
-int dfsplain_e(Abc_Obj_t* pObj, Abc_Obj_t* pPred);
-int dfsplain_r(Abc_Obj_t* pObj, Abc_Obj_t* pPred);
-
-void dfsfast_preorder(Abc_Ntk_t* pNtk);
-int dfsfast_e(Abc_Obj_t* pObj, Abc_Obj_t* pPred);
-int dfsfast_r(Abc_Obj_t* pObj, Abc_Obj_t* pPred);
+int Abc_FlowRetime_PushFlows(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk, int fVerbose);
 
 /*=== fretInit.c ==========================================================*/
 
 void Abc_FlowRetime_PrintInitStateInfo(Abc_Ntk_t* pNtk);
 
-void Abc_FlowRetime_InitState(Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_InitState(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 
-void Abc_FlowRetime_UpdateForwardInit(Abc_Ntk_t* pNtk);
-void Abc_FlowRetime_UpdateBackwardInit(Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_UpdateForwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_UpdateBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 
-void Abc_FlowRetime_SetupBackwardInit(Abc_Ntk_t* pNtk);
-int Abc_FlowRetime_SolveBackwardInit(Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_SetupBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+int Abc_FlowRetime_SolveBackwardInit(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 
-void Abc_FlowRetime_ConstrainInit();
-void Abc_FlowRetime_AddInitBias();
-void Abc_FlowRetime_RemoveInitBias();
+void Abc_FlowRetime_ConstrainInit(MinRegMan_t* pManMR);
+void Abc_FlowRetime_AddInitBias(MinRegMan_t* pManMR);
+void Abc_FlowRetime_RemoveInitBias(MinRegMan_t* pManMR);
 
 /*=== fretTime.c ==========================================================*/
 
-void Abc_FlowRetime_InitTiming(Abc_Ntk_t* pNtk);
-void Abc_FlowRetime_FreeTiming(Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_InitTiming(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_FreeTiming(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 
-int Abc_FlowRetime_RefineConstraints();
+int Abc_FlowRetime_RefineConstraints(MinRegMan_t* pManMR);
 
-void Abc_FlowRetime_ConstrainConserv(Abc_Ntk_t* pNtk);
-void Abc_FlowRetime_ConstrainExact(Abc_Obj_t* pObj);
-void Abc_FlowRetime_ConstrainExactAll(Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_ConstrainConserv(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
+void Abc_FlowRetime_ConstrainExact(MinRegMan_t* pManMR, Abc_Obj_t* pObj);
+void Abc_FlowRetime_ConstrainExactAll(MinRegMan_t* pManMR, Abc_Ntk_t* pNtk);
 
 ABC_NAMESPACE_HEADER_END
 
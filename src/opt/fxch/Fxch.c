@@ -140,7 +140,9 @@ void Fxch_CubesUnGruping(Fxch_Man_t* pFxchMan) {
   Synopsis    [ Performs fast extract with cube hashing on a set
                 of covers. ]
 
-  Description []
+  Description [ When nThreads > 1, the initial divisors are enumerated
+                by several threads. The result does not depend on the
+                number of threads. ]
 
   SideEffects []
 
@@ -150,6 +152,7 @@ void Fxch_CubesUnGruping(Fxch_Man_t* pFxchMan) {
 int Fxch_FastExtract(Vec_Wec_t* vCubes,
                      int ObjIdMax,
                      int nMaxDivExt,
+                     int nThreads,
                      int fVerbose,
                      int fVeryVerbose) {
     abctime TempTime;
@@ -162,7 +165,7 @@ int Fxch_FastExtract(Vec_Wec_t* vCubes,
     Fxch_ManGenerateLitHashKeys(pFxchMan);
     Fxch_ManComputeLevel(pFxchMan);
     Fxch_ManSCHashTablesInit(pFxchMan);
-    Fxch_ManDivCreate(pFxchMan);
+    Fxch_ManDivCreate(pFxchMan, nThreads);
     pFxchMan->timeInit = Abc_Clock() - TempTime;
 
     if (fVeryVerbose)
@@ -215,6 +218,7 @@ int Fxch_FastExtract(Vec_Wec_t* vCubes,
 ***********************************************************************/
 int Abc_NtkFxchPerform(Abc_Ntk_t* pNtk,
                        int nMaxDivExt,
+                       int nThreads,
                        int fVerbose,
                        int fVeryVerbose) {
     Vec_Wec_t* vCubes;
@@ -227,7 +231,7 @@ int Abc_NtkFxchPerform(Abc_Ntk_t* pNtk,
     }
 
     vCubes = Abc_NtkFxRetrieve(pNtk);
-    if (Fxch_FastExtract(vCubes, Abc_NtkObjNumMax(pNtk), nMaxDivExt, fVerbose, fVeryVerbose) > 0) {
+    if (Fxch_FastExtract(vCubes, Abc_NtkObjNumMax(pNtk), nMaxDivExt, nThreads, fVerbose, fVeryVerbose) > 0) {
         Abc_NtkFxInsert(pNtk, vCubes);
         Vec_WecFree(vCubes);
 
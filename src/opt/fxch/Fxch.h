@@ -149,8 +149,8 @@ static inline int Fxch_CountOnes(unsigned num) {
 }
 
 /*===== Fxch.c =======================================================*/
-int Abc_NtkFxchPerform(Abc_Ntk_t* pNtk, int nMaxDivExt, int fVerbose, int fVeryVerbose);
-int Fxch_FastExtract(Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int fVerbose, int fVeryVerbose);
+int Abc_NtkFxchPerform(Abc_Ntk_t* pNtk, int nMaxDivExt, int nThreads, int fVerbose, int fVeryVerbose);
+int Fxch_FastExtract(Vec_Wec_t* vCubes, int ObjIdMax, int nMaxDivExt, int nThreads, int fVerbose, int fVeryVerbose);
 
 /*===== FxchDiv.c ====================================================================================================*/
 int Fxch_DivCreate(Fxch_Man_t* pFxchMan, Fxch_SubCube_t* pSubCube0, Fxch_SubCube_t* pSubCube1);
@@ -168,7 +168,7 @@ void Fxch_ManMapLiteralsIntoCubes(Fxch_Man_t* pFxchMan, int nVars);
 void Fxch_ManGenerateLitHashKeys(Fxch_Man_t* pFxchMan);
 void Fxch_ManSCHashTablesInit(Fxch_Man_t* pFxchMan);
 void Fxch_ManSCHashTablesFree(Fxch_Man_t* pFxchMan);
-void Fxch_ManDivCreate(Fxch_Man_t* pFxchMan);
+void Fxch_ManDivCreate(Fxch_Man_t* pFxchMan, int nThreads);
 int Fxch_ManComputeLevelDiv(Fxch_Man_t* pFxchMan, Vec_Int_t* vCubeFree);
 int Fxch_ManComputeLevelCube(Fxch_Man_t* pFxchMan, Vec_Int_t* vCube);
 void Fxch_ManComputeLevel(Fxch_Man_t* pFxchMan);
@@ -208,6 +208,14 @@ int Fxch_SCHashTableRemove(Fxch_SCHashTable_t* pSCHashTable,
                            uint32_t iLit1,
                            char fUpdate);
 
+Vec_Wrd_t* Fxch_SCHashTableCollectPairs(Fxch_SCHashTable_t* pSCHashTable,
+                                        Vec_Wec_t* vCubes,
+                                        int nThreads);
+
+int Fxch_SCHashTableAddPair(Fxch_SCHashTable_t* pSCHashTable,
+                            word* pPair,
+                            char fUpdate);
+
 unsigned int Fxch_SCHashTableMemory(Fxch_SCHashTable_t*);
 void Fxch_SCHashTablePrint(Fxch_SCHashTable_t*);
 
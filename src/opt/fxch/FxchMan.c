@@ -262,17 +262,30 @@ void Fxch_ManSCHashTablesFree(Fxch_Man_t* pFxchMan) {
     Fxch_SCHashTableDelete(pFxchMan->pSCHashTable);
 }
 
-void Fxch_ManDivCreate(Fxch_Man_t* pFxchMan) {
+void Fxch_ManDivCreate(Fxch_Man_t* pFxchMan,
+                       int nThreads) {
     Vec_Int_t* vCube;
+    Vec_Wrd_t* vPairs = NULL;
     float Weight;
     int fAdd = 1,
         fUpdate = 0,
-        iCube;
+        iCube,
+        iPair = 0;
+
+    /* Sub-cube pairs are found by several threads and added here in the serial order */
+    if (nThreads > 1)
+        vPairs = Fxch_SCHashTableCollectPairs(pFxchMan->pSCHashTable, pFxchMan->vCubes, nThreads);
 
     Vec_WecForEachLevel(pFxchMan->vCubes, vCube, iCube) {
         Fxch_ManDivSingleCube(pFxchMan, iCube, fAdd, fUpdate);
-        Fxch_ManDivDoubleCube(pFxchMan, iCube, fAdd, fUpdate);
+        if (vPairs == NULL) {
+            Fxch_ManDivDoubleCube(pFxchMan, iCube, fAdd, fUpdate);
+            continue;
+        }
+        for (; iPair < Vec_WrdSize(vPairs) && (int)(Vec_WrdEntry(vPairs, iPair) >> 32) == iCube; iPair += 3)
+            pFxchMan->nPairsD += Fxch_SCHashTableAddPair(pFxchMan->pSCHashTable, Vec_WrdEntryP(vPairs, iPair + 1), (char)fUpdate);
     }
+    Vec_WrdFreeP(&vPairs);
 
     pFxchMan->vDivPrio = Vec_QueAlloc(Vec_FltSize(pFxchMan->vDivWeights));
     Vec_QueSetPriority(pFxchMan->vDivPrio, Vec_FltArrayP(pFxchMan->vDivWeights));
@@ -17,8 +17,41 @@
 ***********************************************************************/
 #include "Fxch.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
+#define FXCH_PAR_THR_MAX 64
+
+/* Per-thread data of the parallel divisor enumeration
+ *
+ *   Each thread owns the bins whose index is equal to its number modulo
+ *   the number of threads. It fills its bins with the sub-cubes hashed
+ *   into them and then collects the matching sub-cube pairs found there.
+ */
+typedef struct Fxch_SCHashThData_t_ Fxch_SCHashThData_t;
+struct Fxch_SCHashThData_t_ {
+    Fxch_SCHashTable_t* pSCHashTable;
+    Vec_Wec_t* vCubes;
+    int iThread,
+        nThreads,
+        nEntries;
+
+    /* Private temporary data */
+    Vec_Int_t vSubCube0;
+    Vec_Int_t vSubCube1;
+    Vec_Wrd_t* vPairs;
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -119,7 +152,9 @@ static inline Fxch_SCHashTable_Entry_t* Fxch_SCHashTableBin(Fxch_SCHashTable_t*
 static inline int Fxch_SCHashTableEntryCompare(Fxch_SCHashTable_t* pSCHashTable,
                                                Vec_Wec_t* vCubes,
                                                Fxch_SubCube_t* pSCData0,
-                                               Fxch_SubCube_t* pSCData1) {
+                                               Fxch_SubCube_t* pSCData1,
+                                               Vec_Int_t* vSubCube0,
+                                               Vec_Int_t* vSubCube1) {
     Vec_Int_t *vCube0 = Vec_WecEntry(vCubes, pSCData0->iCube),
               *vCube1 = Vec_WecEntry(vCubes, pSCData1->iCube);
 
@@ -136,49 +171,39 @@ static inline int Fxch_SCHashTableEntryCompare(Fxch_SCHashTable_t* pSCHashTable,
     if (Result == 0)
         return 0;
 
-    Vec_IntClear(&pSCHashTable->vSubCube0);
-    Vec_IntClear(&pSCHashTable->vSubCube1);
+    Vec_IntClear(vSubCube0);
+    Vec_IntClear(vSubCube1);
 
     if (pSCData0->iLit1 > 0 && pSCData1->iLit1 > 0 && (Vec_IntEntry(vCube0, pSCData0->iLit0) == Vec_IntEntry(vCube1, pSCData1->iLit0) || Vec_IntEntry(vCube0, pSCData0->iLit0) == Vec_IntEntry(vCube1, pSCData1->iLit1) || Vec_IntEntry(vCube0, pSCData0->iLit1) == Vec_IntEntry(vCube1, pSCData1->iLit0) || Vec_IntEntry(vCube0, pSCData0->iLit1) == Vec_IntEntry(vCube1, pSCData1->iLit1)))
         return 0;
 
     if (pSCData0->iLit0 > 0)
-        Vec_IntAppendSkip(&pSCHashTable->vSubCube0, vCube0, pSCData0->iLit0);
+        Vec_IntAppendSkip(vSubCube0, vCube0, pSCData0->iLit0);
     else
-        Vec_IntAppend(&pSCHashTable->vSubCube0, vCube0);
+        Vec_IntAppend(vSubCube0, vCube0);
 
     if (pSCData1->iLit0 > 0)
-        Vec_IntAppendSkip(&pSCHashTable->vSubCube1, vCube1, pSCData1->iLit0);
+        Vec_IntAppendSkip(vSubCube1, vCube1, pSCData1->iLit0);
     else
-        Vec_IntAppend(&pSCHashTable->vSubCube1, vCube1);
+        Vec_IntAppend(vSubCube1, vCube1);
 
     if (pSCData0->iLit1 > 0)
-        Vec_IntDrop(&pSCHashTable->vSubCube0,
+        Vec_IntDrop(vSubCube0,
                     pSCData0->iLit0 < pSCData0->iLit1 ? pSCData0->iLit1 - 1 : pSCData0->iLit1);
 
     if (pSCData1->iLit1 > 0)
-        Vec_IntDrop(&pSCHashTable->vSubCube1,
+        Vec_IntDrop(vSubCube1,
                     pSCData1->iLit0 < pSCData1->iLit1 ? pSCData1->iLit1 - 1 : pSCData1->iLit1);
 
-    return Vec_IntEqual(&pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1);
+    return Vec_IntEqual(vSubCube0, vSubCube1);
 }
 
-int Fxch_SCHashTableInsert(Fxch_SCHashTable_t* pSCHashTable,
-                           Vec_Wec_t* vCubes,
-                           uint32_t SubCubeID,
-                           uint32_t iCube,
-                           uint32_t iLit0,
-                           uint32_t iLit1,
-                           char fUpdate) {
+static inline void Fxch_SCHashTableEntryPush(Fxch_SCHashTable_Entry_t* pBin,
+                                             uint32_t SubCubeID,
+                                             uint32_t iCube,
+                                             uint32_t iLit0,
+                                             uint32_t iLit1) {
     int iNewEntry;
-    int Pairs = 0;
-    uint32_t BinID;
-    Fxch_SCHashTable_Entry_t* pBin;
-    Fxch_SubCube_t* pNewEntry;
-    int iEntry;
-
-    MurmurHash3_x86_32((void*)&SubCubeID, sizeof(int), 0x9747b28c, &BinID);
-    pBin = Fxch_SCHashTableBin(pSCHashTable, BinID);
 
     if (pBin->vSCData == NULL) {
         pBin->vSCData = ABC_CALLOC(Fxch_SubCube_t, 16);
@@ -195,56 +220,86 @@ int Fxch_SCHashTableInsert(Fxch_SCHashTable_t* pSCHashTable,
     pBin->vSCData[iNewEntry].iCube = iCube;
     pBin->vSCData[iNewEntry].iLit0 = iLit0;
     pBin->vSCData[iNewEntry].iLit1 = iLit1;
-    pSCHashTable->nEntries++;
+}
+
+/* Adds the divisor (or the single-cube containment) given by the pair of
+ * matching sub-cubes, where pNewEntry is the one hashed later. Returns 1
+ * if a divisor was added. */
+static inline int Fxch_SCHashTablePairAdd(Fxch_SCHashTable_t* pSCHashTable,
+                                          Fxch_SubCube_t* pEntry,
+                                          Fxch_SubCube_t* pNewEntry,
+                                          char fUpdate) {
+    int* pOutputID0 = Vec_IntEntryP(pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID);
+    int* pOutputID1 = Vec_IntEntryP(pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID);
+    int Result = 0;
+    int Base;
+    int iNewDiv = -1, i, z;
+
+    if ((pEntry->iLit0 == 0) || (pNewEntry->iLit0 == 0)) {
+        Vec_Int_t *vCube0 = Fxch_ManGetCube(pSCHashTable->pFxchMan, pEntry->iCube),
+                  *vCube1 = Fxch_ManGetCube(pSCHashTable->pFxchMan, pNewEntry->iCube);
+
+        if (Vec_IntSize(vCube0) > Vec_IntSize(vCube1)) {
+            Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pEntry->iCube);
+            Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube);
+        } else {
+            Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube);
+            Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pEntry->iCube);
+        }
 
-    if (pBin->Size == 1)
         return 0;
+    }
 
-    pNewEntry = &(pBin->vSCData[iNewEntry]);
-    for (iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++) {
-        Fxch_SubCube_t* pEntry = &(pBin->vSCData[iEntry]);
-        int* pOutputID0 = Vec_IntEntryP(pSCHashTable->pFxchMan->vOutputID, pEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID);
-        int* pOutputID1 = Vec_IntEntryP(pSCHashTable->pFxchMan->vOutputID, pNewEntry->iCube * pSCHashTable->pFxchMan->nSizeOutputID);
-        int Result = 0;
-        int Base;
-        int iNewDiv = -1, i, z;
+    Base = Fxch_DivCreate(pSCHashTable->pFxchMan, pEntry, pNewEntry);
 
-        if ((pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0))
-            continue;
+    if (Base < 0)
+        return 0;
 
-        if (!Fxch_SCHashTableEntryCompare(pSCHashTable, vCubes, pEntry, pNewEntry))
-            continue;
+    for (i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++)
+        Result += Fxch_CountOnes(pOutputID0[i] & pOutputID1[i]);
 
-        if ((pEntry->iLit0 == 0) || (pNewEntry->iLit0 == 0)) {
-            Vec_Int_t *vCube0 = Fxch_ManGetCube(pSCHashTable->pFxchMan, pEntry->iCube),
-                      *vCube1 = Fxch_ManGetCube(pSCHashTable->pFxchMan, pNewEntry->iCube);
+    for (z = 0; z < Result; z++)
+        iNewDiv = Fxch_DivAdd(pSCHashTable->pFxchMan, fUpdate, 0, Base);
 
-            if (Vec_IntSize(vCube0) > Vec_IntSize(vCube1)) {
-                Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pEntry->iCube);
-                Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube);
-            } else {
-                Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pNewEntry->iCube);
-                Vec_IntPush(pSCHashTable->pFxchMan->vSCC, pEntry->iCube);
-            }
+    Vec_WecPush(pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube);
+    Vec_WecPush(pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube);
 
-            continue;
-        }
+    return 1;
+}
 
-        Base = Fxch_DivCreate(pSCHashTable->pFxchMan, pEntry, pNewEntry);
+int Fxch_SCHashTableInsert(Fxch_SCHashTable_t* pSCHashTable,
+                           Vec_Wec_t* vCubes,
+                           uint32_t SubCubeID,
+                           uint32_t iCube,
+                           uint32_t iLit0,
+                           uint32_t iLit1,
+                           char fUpdate) {
+    int Pairs = 0;
+    uint32_t BinID;
+    Fxch_SCHashTable_Entry_t* pBin;
+    Fxch_SubCube_t* pNewEntry;
+    int iEntry;
 
-        if (Base < 0)
-            continue;
+    MurmurHash3_x86_32((void*)&SubCubeID, sizeof(int), 0x9747b28c, &BinID);
+    pBin = Fxch_SCHashTableBin(pSCHashTable, BinID);
+
+    Fxch_SCHashTableEntryPush(pBin, SubCubeID, iCube, iLit0, iLit1);
+    pSCHashTable->nEntries++;
 
-        for (i = 0; i < pSCHashTable->pFxchMan->nSizeOutputID; i++)
-            Result += Fxch_CountOnes(pOutputID0[i] & pOutputID1[i]);
+    if (pBin->Size == 1)
+        return 0;
 
-        for (z = 0; z < Result; z++)
-            iNewDiv = Fxch_DivAdd(pSCHashTable->pFxchMan, fUpdate, 0, Base);
+    pNewEntry = &(pBin->vSCData[pBin->Size - 1]);
+    for (iEntry = 0; iEntry < (int)pBin->Size - 1; iEntry++) {
+        Fxch_SubCube_t* pEntry = &(pBin->vSCData[iEntry]);
 
-        Vec_WecPush(pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pEntry->iCube);
-        Vec_WecPush(pSCHashTable->pFxchMan->vDivCubePairs, iNewDiv, pNewEntry->iCube);
+        if ((pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0))
+            continue;
 
-        Pairs++;
+        if (!Fxch_SCHashTableEntryCompare(pSCHashTable, vCubes, pEntry, pNewEntry, &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1))
+            continue;
+
+        Pairs += Fxch_SCHashTablePairAdd(pSCHashTable, pEntry, pNewEntry, fUpdate);
     }
 
     return Pairs;
@@ -298,7 +353,7 @@ int Fxch_SCHashTableRemove(Fxch_SCHashTable_t* pSCHashTable,
             if ((pEntry->iLit1 != 0 && pNextEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNextEntry->iLit1 != 0))
                 continue;
 
-            if (!Fxch_SCHashTableEntryCompare(pSCHashTable, vCubes, pEntry, pNextEntry)
+            if (!Fxch_SCHashTableEntryCompare(pSCHashTable, vCubes, pEntry, pNextEntry, &pSCHashTable->vSubCube0, &pSCHashTable->vSubCube1)
                 || pEntry->iLit0 == 0
                 || pNextEntry->iLit0 == 0)
                 continue;
@@ -331,6 +386,212 @@ int Fxch_SCHashTableRemove(Fxch_SCHashTable_t* pSCHashTable,
     return Pairs;
 }
 
+/* Parallel divisor enumeration
+ *
+ *   The sub-cubes of all cubes are hashed by several threads, each filling
+ *   only the bins it owns, in the same order as the serial insertion. Then
+ *   every thread compares the sub-cubes inside its bins and records the
+ *   matching pairs. A pair is recorded as three words:
+ *        - the cube of the later sub-cube and the rank of this sub-cube
+ *          among the sub-cubes of its cube
+ *        - the position of the earlier sub-cube in the bin and the
+ *          position of the later sub-cube in the bin
+ *        - the bin index
+ *   Sorting the pairs restores the order in which the serial insertion
+ *   finds them, so the divisors are created exactly as without threads.
+ */
+#ifdef ABC_USE_PTHREADS
+static inline int Fxch_SCHashTableSubCubeRank(int nLits,
+                                              int iLit0,
+                                              int iLit1) {
+    int Rank;
+
+    if (iLit0 == 0)
+        return 0;
+
+    Rank = iLit0 + (iLit0 - 1) * nLits - (iLit0 - 1) * iLit0 / 2;
+    return iLit1 ? Rank + iLit1 - iLit0 : Rank;
+}
+
+static inline void Fxch_SCHashTableFillOne(Fxch_SCHashThData_t* pThData,
+                                           uint32_t SubCubeID,
+                                           uint32_t iCube,
+                                           uint32_t iLit0,
+                                           uint32_t iLit1) {
+    Fxch_SCHashTable_t* pSCHashTable = pThData->pSCHashTable;
+    uint32_t BinID;
+
+    MurmurHash3_x86_32((void*)&SubCubeID, sizeof(int), 0x9747b28c, &BinID);
+    if ((int)((BinID & pSCHashTable->SizeMask) % pThData->nThreads) != pThData->iThread)
+        return;
+
+    Fxch_SCHashTableEntryPush(Fxch_SCHashTableBin(pSCHashTable, BinID), SubCubeID, iCube, iLit0, iLit1);
+    pThData->nEntries++;
+}
+
+static void Fxch_SCHashTableFill(Fxch_SCHashThData_t* pThData) {
+    Vec_Int_t* vLitHashKeys = pThData->pSCHashTable->pFxchMan->vLitHashKeys;
+    Vec_Int_t* vCube;
+    int iCube;
+
+    Vec_WecForEachLevel(pThData->vCubes, vCube, iCube) {
+        int SubCubeID = 0,
+            iLit0, Lit0,
+            iLit1, Lit1;
+
+        Vec_IntForEachEntryStart(vCube, Lit0, iLit0, 1)
+            SubCubeID
+            += Vec_IntEntry(vLitHashKeys, Lit0);
+
+        Fxch_SCHashTableFillOne(pThData, SubCubeID, iCube, 0, 0);
+
+        Vec_IntForEachEntryStart(vCube, Lit0, iLit0, 1) {
+            SubCubeID -= Vec_IntEntry(vLitHashKeys, Lit0);
+            Fxch_SCHashTableFillOne(pThData, SubCubeID, iCube, iLit0, 0);
+
+            if (Vec_IntSize(vCube) >= 3)
+                Vec_IntForEachEntryStart(vCube, Lit1, iLit1, iLit0 + 1) {
+                    SubCubeID -= Vec_IntEntry(vLitHashKeys, Lit1);
+                    Fxch_SCHashTableFillOne(pThData, SubCubeID, iCube, iLit0, iLit1);
+                    SubCubeID += Vec_IntEntry(vLitHashKeys, Lit1);
+                }
+
+            SubCubeID += Vec_IntEntry(vLitHashKeys, Lit0);
+        }
+    }
+}
+
+static void Fxch_SCHashTableCollect(Fxch_SCHashThData_t* pThData) {
+    Fxch_SCHashTable_t* pSCHashTable = pThData->pSCHashTable;
+    unsigned int iBin;
+
+    for (iBin = pThData->iThread; iBin <= pSCHashTable->SizeMask; iBin += pThData->nThreads) {
+        Fxch_SCHashTable_Entry_t* pBin = pSCHashTable->pBins + iBin;
+        int iEntry, iNewEntry;
+
+        for (iNewEntry = 1; iNewEntry < (int)pBin->Size; iNewEntry++) {
+            Fxch_SubCube_t* pNewEntry = &(pBin->vSCData[iNewEntry]);
+            int nLits = Vec_IntSize(Vec_WecEntry(pThData->vCubes, pNewEntry->iCube)) - 1;
+            word Key = ((word)pNewEntry->iCube << 32) | (word)Fxch_SCHashTableSubCubeRank(nLits, pNewEntry->iLit0, pNewEntry->iLit1);
+
+            for (iEntry = 0; iEntry < iNewEntry; iEntry++) {
+                Fxch_SubCube_t* pEntry = &(pBin->vSCData[iEntry]);
+
+                if ((pEntry->iLit1 != 0 && pNewEntry->iLit1 == 0) || (pEntry->iLit1 == 0 && pNewEntry->iLit1 != 0))
+                    continue;
+
+                if (!Fxch_SCHashTableEntryCompare(pSCHashTable, pThData->vCubes, pEntry, pNewEntry, &pThData->vSubCube0, &pThData->vSubCube1))
+                    continue;
+
+                Vec_WrdPush(pThData->vPairs, Key);
+                Vec_WrdPush(pThData->vPairs, ((word)iEntry << 32) | (word)iNewEntry);
+                Vec_WrdPush(pThData->vPairs, (word)iBin);
+            }
+        }
+    }
+}
+
+static int Fxch_SCHashTablePairCompare(const void* pArg0,
+                                       const void* pArg1) {
+    const word* pPair0 = (const word*)pArg0;
+    const word* pPair1 = (const word*)pArg1;
+
+    if (pPair0[0] != pPair1[0])
+        return pPair0[0] < pPair1[0] ? -1 : 1;
+    if (pPair0[1] != pPair1[1])
+        return pPair0[1] < pPair1[1] ? -1 : 1;
+    if (pPair0[2] != pPair1[2])
+        return pPair0[2] < pPair1[2] ? -1 : 1;
+    return 0;
+}
+
+static void* Fxch_SCHashTableThread(void* pArg) {
+    Fxch_SCHashThData_t* pThData = (Fxch_SCHashThData_t*)pArg;
+    Fxch_SCHashTableFill(pThData);
+    Fxch_SCHashTableCollect(pThData);
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [ Hashes all sub-cubes and finds their matching pairs
+                using several threads. ]
+
+  Description [ The table should be empty. Returns the sorted pairs,
+                to be passed to Fxch_SCHashTableAddPair() in order, or
+                NULL if threads are not available. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t* Fxch_SCHashTableCollectPairs(Fxch_SCHashTable_t* pSCHashTable,
+                                        Vec_Wec_t* vCubes,
+                                        int nThreads) {
+#ifdef ABC_USE_PTHREADS
+    Fxch_SCHashThData_t ThData[FXCH_PAR_THR_MAX];
+    pthread_t WorkerThread[FXCH_PAR_THR_MAX];
+    Vec_Wrd_t* vPairs;
+    int i, nPairs = 0, status;
+
+    assert(pSCHashTable->nEntries == 0);
+    nThreads = Abc_MinInt(nThreads, FXCH_PAR_THR_MAX);
+    memset(ThData, 0, sizeof(ThData));
+    for (i = 0; i < nThreads; i++) {
+        ThData[i].pSCHashTable = pSCHashTable;
+        ThData[i].vCubes = vCubes;
+        ThData[i].iThread = i;
+        ThData[i].nThreads = nThreads;
+        ThData[i].vPairs = Vec_WrdAlloc(1024);
+        status = pthread_create(WorkerThread + i, NULL, Fxch_SCHashTableThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    for (i = 0; i < nThreads; i++) {
+        pthread_join(WorkerThread[i], NULL);
+        pSCHashTable->nEntries += ThData[i].nEntries;
+        nPairs += Vec_WrdSize(ThData[i].vPairs);
+    }
+
+    vPairs = Vec_WrdAlloc(nPairs);
+    for (i = 0; i < nThreads; i++) {
+        Vec_WrdAppend(vPairs, ThData[i].vPairs);
+        Vec_WrdFree(ThData[i].vPairs);
+        Vec_IntErase(&ThData[i].vSubCube0);
+        Vec_IntErase(&ThData[i].vSubCube1);
+    }
+    qsort(Vec_WrdArray(vPairs), (size_t)(Vec_WrdSize(vPairs) / 3), 3 * sizeof(word), Fxch_SCHashTablePairCompare);
+    return vPairs;
+#else
+    return NULL;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [ Adds the divisor given by a pair returned by
+                Fxch_SCHashTableCollectPairs(). ]
+
+  Description [ The pair points to the last two words of the record:
+                the positions of the sub-cubes and the bin index.
+                Returns 1 if a divisor was added. ]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fxch_SCHashTableAddPair(Fxch_SCHashTable_t* pSCHashTable,
+                            word* pPair,
+                            char fUpdate) {
+    Fxch_SCHashTable_Entry_t* pBin = pSCHashTable->pBins + pPair[1];
+    unsigned int iEntry = (unsigned int)(pPair[0] >> 32),
+                 iNewEntry = (unsigned int)(pPair[0] & 0xFFFFFFFF);
+
+    return Fxch_SCHashTablePairAdd(pSCHashTable, pBin->vSCData + iEntry, pBin->vSCData + iNewEntry, fUpdate);
+}
+
 unsigned int Fxch_SCHashTableMemory(Fxch_SCHashTable_t* pHashTable) {
     unsigned int Memory = sizeof(Fxch_SCHashTable_t);
 
@@ -42,6 +42,7 @@ struct Lpk_Par_t_ {
     int nLutsOver;    // (Q) the maximum number of LUTs not in the MFFC
     int nVarsShared;  // (S) the maximum number of shared variables (crossbars)
     int nGrowthLevel; // (L) the maximum increase in the node level after resynthesis
+    int nProcs;       // (J) the number of threads
     int fSatur;       // iterate till saturation
     int fZeroCost;    // accept zero-cost replacements
     int fFirst;       // use root node and first cut only
@@ -230,18 +230,20 @@ void Lpk_DecomposeClean(Vec_Ptr_t* vLeaves, int nLeavesOld) {
 
 /**Function*************************************************************
 
-  Synopsis    [Decomposes the function using recursive MUX decomposition.]
+  Synopsis    [Decomposes the function without creating the nodes.]
 
-  Description []
+  Description [Returns the function whose decomposition is stored in the
+  array of leaves after the original leaves, or NULL if there is no
+  decomposition satisfying the constraints on area and delay. Does not
+  change the network, so it can be called by several threads at a time.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Obj_t* Lpk_Decompose(Lpk_Man_t* p, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, unsigned* pTruth, unsigned* puSupps, int nLutK, int AreaLim, int DelayLim) {
+Lpk_Fun_t* Lpk_DecomposeFun(Lpk_Man_t* p, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, unsigned* pTruth, unsigned* puSupps, int nLutK, int AreaLim, int DelayLim) {
     Lpk_Fun_t* pFun;
-    Abc_Obj_t* pObjNew = NULL;
     int nLeaves = Vec_PtrSize(vLeaves);
     pFun = Lpk_FunCreate(pNtk, vLeaves, pTruth, nLutK, AreaLim, DelayLim);
     if (puSupps[0] || puSupps[1]) {
@@ -258,12 +260,44 @@ Abc_Obj_t* Lpk_Decompose(Lpk_Man_t* p, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, unsi
         pFun->fSupports = 1;
     }
     Lpk_FunSuppMinimize(pFun);
-    if (pFun->nVars <= pFun->nLutK)
-        pObjNew = Lpk_ImplementFun(p, pNtk, vLeaves, pFun);
-    else if (Lpk_Decompose_rec(p, pFun))
-        pObjNew = Lpk_Implement(p, pNtk, vLeaves, nLeaves);
+    if (pFun->nVars <= pFun->nLutK || Lpk_Decompose_rec(p, pFun))
+        return pFun;
     Lpk_DecomposeClean(vLeaves, nLeaves);
-    return pObjNew;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the nodes of the decomposition in the network.]
+
+  Description [Takes the function returned by Lpk_DecomposeFun() and
+  frees it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Obj_t* Lpk_DecomposeImplement(Lpk_Man_t* p, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, int nLeaves, Lpk_Fun_t* pFun) {
+    assert(Vec_PtrEntry(vLeaves, nLeaves) == pFun);
+    return Lpk_Implement(p, pNtk, vLeaves, nLeaves);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decomposes the function using recursive MUX decomposition.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Obj_t* Lpk_Decompose(Lpk_Man_t* p, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, unsigned* pTruth, unsigned* puSupps, int nLutK, int AreaLim, int DelayLim) {
+    int nLeaves = Vec_PtrSize(vLeaves);
+    Lpk_Fun_t* pFun = Lpk_DecomposeFun(p, pNtk, vLeaves, pTruth, puSupps, nLutK, AreaLim, DelayLim);
+    return pFun ? Lpk_DecomposeImplement(p, pNtk, vLeaves, nLeaves, pFun) : NULL;
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -410,10 +410,8 @@ int Lpk_DsdAnalizeOne(Lpk_Fun_t* p, unsigned* ppTruths[5][16], Kit_DsdNtk_t* pNt
 
 ***********************************************************************/
 Lpk_Res_t* Lpk_DsdAnalize(Lpk_Man_t* pMan, Lpk_Fun_t* p, int nShared) {
-    static Lpk_Res_t Res0, *pRes0 = &Res0;
-    static Lpk_Res_t Res1, *pRes1 = &Res1;
-    static Lpk_Res_t Res2, *pRes2 = &Res2;
-    static Lpk_Res_t Res3, *pRes3 = &Res3;
+    static ABC_THREAD_LOCAL Lpk_Res_t Res0, Res1, Res2, Res3;
+    Lpk_Res_t *pRes0 = &Res0, *pRes1 = &Res1, *pRes2 = &Res2, *pRes3 = &Res3;
     int fUseBackLooking = 1;
     Lpk_Res_t* pRes = NULL;
     Vec_Int_t* vBSets;
@@ -22,12 +22,26 @@
 #include "bool/kit/cloud.h"
 #include "base/main/main.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define LPK_PAR_THR_MAX 100
+#define LPK_PAR_BATCH 256 // the max number of nodes evaluated in one round
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -308,7 +322,7 @@ int Lpk_ResynthesizeNode(Lpk_Man_t* p) {
     Kit_DsdNtk_t* pDsdNtk;
     Lpk_Cut_t* pCut;
     unsigned* pTruth;
-    int i, k, nSuppSize, nCutNodes, RetValue;
+    int i, nSuppSize, nCutNodes, RetValue;
     abctime clk;
 
     // compute the cuts
@@ -333,15 +347,7 @@ int Lpk_ResynthesizeNode(Lpk_Man_t* p) {
             break;
 
         // skip bad cuts
-        //        printf( "Mffc size = %d.  ", Abc_NodeMffcLabel(p->pObj) );
-        for (k = 0; k < (int)pCut->nLeaves; k++)
-            Abc_NtkObj(p->pNtk, pCut->pLeaves[k])->vFanouts.nSize++;
-        nCutNodes = Abc_NodeMffcLabel(p->pObj, NULL);
-        //        printf( "Mffc with cut = %d.  ", nCutNodes );
-        for (k = 0; k < (int)pCut->nLeaves; k++)
-            Abc_NtkObj(p->pNtk, pCut->pLeaves[k])->vFanouts.nSize--;
-        //        printf( "Mffc cut = %d.  ", (int)pCut->nNodes - (int)pCut->nNodesDup );
-        //        printf( "\n" );
+        nCutNodes = Lpk_NodeMffcLabelCut(p, pCut);
         if (nCutNodes != (int)pCut->nNodes - (int)pCut->nNodesDup)
             continue;
 
@@ -413,27 +419,20 @@ void Lpk_ComputeSupports(Lpk_Man_t* p, Lpk_Cut_t* pCut, unsigned* pTruth) {
 
 /**Function*************************************************************
 
-  Synopsis    [Performs resynthesis for one node.]
+  Synopsis    [Computes the cuts of the node.]
 
-  Description []
+  Description [Starts the job of the node. Returns 0 if the node has no
+  cuts to try.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Lpk_ResynthesizeNodeNew(Lpk_Man_t* p) {
-    //    static int Count = 0;
-    int NodeCounts[16] = {0, 0, 0, 0, 1, 3, 6, 14, 26, 57, 106, 230, 425, 1000000, 1000000, 1000000};
-    Abc_Obj_t *pObjNew, *pLeaf;
-    Lpk_Cut_t* pCut;
-    unsigned* pTruth;
-    int nNodesBef, nNodesAft, nCutNodes;
-    int i, k;
+int Lpk_ResynthesizeNodeCuts(Lpk_Man_t* p, Lpk_Job_t* pJob) {
     abctime clk;
-    int Required = Abc_ObjRequiredLevel(p->pObj);
-    //    CloudNode * pFun2;//, * pFun1;
-
+    pJob->Status = LPK_JOB_NONE;
+    pJob->Required = Abc_ObjRequiredLevel(p->pObj);
     // compute the cuts
     clk = Abc_Clock();
     if (!Lpk_NodeCuts(p)) {
@@ -444,11 +443,41 @@ int Lpk_ResynthesizeNodeNew(Lpk_Man_t* p) {
 
     if (p->pPars->fVeryVerbose)
         printf("Node %5d : Mffc size = %5d. Cuts = %5d.  Level = %2d. Req = %2d.\n",
-               p->pObj->Id, p->nMffc, p->nEvals, p->pObj->Level, Required);
-    // try the good cuts
+               p->pObj->Id, p->nMffc, p->nEvals, p->pObj->Level, pJob->Required);
     p->nCutsTotal += p->nCuts;
     p->nCutsUseful += p->nEvals;
-    for (i = 0; i < p->nEvals; i++) {
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks for the decomposition of the node.]
+
+  Description [Tries the good cuts starting from the given one. Returns
+  the number of the first cut, which is decomposed or should be given to
+  the LUT minimizer, or the number of cuts if there is no such cut. The
+  cut and its decomposition are stored in the job. Does not change the
+  network.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_ResynthesizeNodeEval(Lpk_Man_t* p, Lpk_Job_t* pJob, int iStart) {
+    //    static int Count = 0;
+    int NodeCounts[16] = {0, 0, 0, 0, 1, 3, 6, 14, 26, 57, 106, 230, 425, 1000000, 1000000, 1000000};
+    Abc_Obj_t* pLeaf;
+    Lpk_Cut_t* pCut;
+    unsigned* pTruth;
+    int nCutNodes;
+    int i, k;
+    abctime clk;
+    //    CloudNode * pFun2;//, * pFun1;
+
+    // try the good cuts
+    pJob->Status = LPK_JOB_NONE;
+    for (i = iStart; i < p->nEvals; i++) {
         // get the cut
         pCut = p->pCuts + p->pEvals[i];
         if (p->pPars->fFirst && i == 1)
@@ -457,22 +486,14 @@ int Lpk_ResynthesizeNodeNew(Lpk_Man_t* p) {
         //            continue;
 
         // skip bad cuts
-        //        printf( "Mffc size = %d.  ", Abc_NodeMffcLabel(p->pObj) );
-        for (k = 0; k < (int)pCut->nLeaves; k++)
-            Abc_NtkObj(p->pNtk, pCut->pLeaves[k])->vFanouts.nSize++;
-        nCutNodes = Abc_NodeMffcLabel(p->pObj, NULL);
-        //        printf( "Mffc with cut = %d.  ", nCutNodes );
-        for (k = 0; k < (int)pCut->nLeaves; k++)
-            Abc_NtkObj(p->pNtk, pCut->pLeaves[k])->vFanouts.nSize--;
-        //        printf( "Mffc cut = %d.  ", (int)pCut->nNodes - (int)pCut->nNodesDup );
-        //        printf( "\n" );
+        nCutNodes = Lpk_NodeMffcLabelCut(p, pCut);
         if (nCutNodes != (int)pCut->nNodes - (int)pCut->nNodesDup)
             continue;
 
         // collect nodes into the array
-        Vec_PtrClear(p->vLeaves);
+        Vec_PtrClear(pJob->vLeaves);
         for (k = 0; k < (int)pCut->nLeaves; k++)
-            Vec_PtrPush(p->vLeaves, Abc_NtkObj(p->pNtk, pCut->pLeaves[k]));
+            Vec_PtrPush(pJob->vLeaves, Abc_NtkObj(p->pNtk, pCut->pLeaves[k]));
 
         // compute the truth table
         clk = Abc_Clock();
@@ -481,27 +502,13 @@ int Lpk_ResynthesizeNodeNew(Lpk_Man_t* p) {
         clk = Abc_Clock();
         Lpk_ComputeSupports(p, pCut, pTruth);
         p->timeSupps += Abc_Clock() - clk;
-        //clk = Abc_Clock();
-        //        pFun1 = Lpk_CutTruthBdd( p, pCut );
-        //p->timeTruth2 += Abc_Clock() - clk;
-        /*
-clk = Abc_Clock();
-        Cloud_Restart( p->pDsdMan->dd );
-        pFun2 = Kit_TruthToCloud( p->pDsdMan->dd, pTruth, pCut->nLeaves );
-        RetValue = Kit_CreateCloud( p->pDsdMan->dd, pFun2, p->vBddNodes );
-p->timeTruth3 += Abc_Clock() - clk;
-*/
-        //        if ( pFun1 != pFun2 )
-        //            printf( "Truth tables do not agree!\n" );
-        //        else
-        //            printf( "Fine!\n" );
 
         if (p->pPars->fVeryVerbose) {
             //            char * pFileName;
             int nSuppSize = Extra_TruthSupportSize(pTruth, pCut->nLeaves);
             printf("  C%02d: L= %2d/%2d  V= %2d/%d  N= %d  W= %4.2f  ",
                    i, pCut->nLeaves, nSuppSize, pCut->nNodes, pCut->nNodesDup, pCut->nLuts, pCut->Weight);
-            Vec_PtrForEachEntry(Abc_Obj_t*, p->vLeaves, pLeaf, k)
+            Vec_PtrForEachEntry(Abc_Obj_t*, pJob->vLeaves, pLeaf, k)
                 printf("%c=%d ", 'a' + k, Abc_ObjLevel(pLeaf));
             printf("\n");
             Kit_DsdPrintFromTruth(pTruth, pCut->nLeaves);
@@ -510,43 +517,430 @@ p->timeTruth3 += Abc_Clock() - clk;
             //            printf( "Saved truth table in file \"%s\".\n", pFileName );
         }
 
-        // update the network
-        nNodesBef = Abc_NtkNodeNum(p->pNtk);
+        // decompose the function
         clk = Abc_Clock();
-        pObjNew = Lpk_Decompose(p, p->pNtk, p->vLeaves, pTruth, p->puSupps, p->pPars->nLutSize,
-                                (int)pCut->nNodes - (int)pCut->nNodesDup - 1 + (int)(p->pPars->fZeroCost > 0), Required);
-        if (pObjNew == NULL && p->pPars->nLutSize == 4 && (int)pCut->nNodes > NodeCounts[Vec_PtrSize(p->vLeaves)] + !p->pPars->fZeroCost)
-            pObjNew = Abc_NtkLutMinDecompose(p->pNtk, p->vLeaves, (word*)pTruth, p->pPars->nLutSize, Required);
+        pJob->pFun = Lpk_DecomposeFun(p, p->pNtk, pJob->vLeaves, pTruth, p->puSupps, p->pPars->nLutSize,
+                                      (int)pCut->nNodes - (int)pCut->nNodesDup - 1 + (int)(p->pPars->fZeroCost > 0), pJob->Required);
         p->timeEval += Abc_Clock() - clk;
-        nNodesAft = Abc_NtkNodeNum(p->pNtk);
-
-        // perform replacement
-        if (pObjNew) {
-            int nGain = (int)pCut->nNodes - (int)pCut->nNodesDup - (nNodesAft - nNodesBef);
-            //assert( nGain >= 1 - p->pPars->fZeroCost );
-            assert(Abc_ObjLevel(pObjNew) <= Required);
-            /*
-            if ( nGain <= 0 )
-            {
-                int x = 0;
-            }
-            if ( Abc_ObjLevel(pObjNew) > Required )
-            {
-                int x = 0;
-            }
-*/
-            p->nGainTotal += nGain;
-            p->nChanges++;
-            if (p->pPars->fVeryVerbose)
-                printf("Performed resynthesis: Gain = %2d. Level = %2d. Req = %2d.\n", nGain, Abc_ObjLevel(pObjNew), Required);
-            Abc_NtkUpdate(p->pObj, pObjNew, p->vLevels);
-            //printf( "%3d : %d-%d=%d(%d) \n", p->nChanges, nNodesBef, Abc_NtkNodeNum(p->pNtk), nNodesBef-Abc_NtkNodeNum(p->pNtk), nGain );
+        if (pJob->pFun)
+            pJob->Status = LPK_JOB_DEC;
+        else if (p->pPars->nLutSize == 4 && (int)pCut->nNodes > NodeCounts[pCut->nLeaves] + !p->pPars->fZeroCost)
+            pJob->Status = LPK_JOB_LUTMIN;
+        else
+            continue;
+        // save the cut and the levels of its leaves
+        pJob->iCut = i;
+        pJob->Cut = *pCut;
+        Vec_PtrForEachEntryStop(Abc_Obj_t*, pJob->vLeaves, pLeaf, k, (int)pCut->nLeaves)
+            pJob->pLevels[k] = Abc_ObjLevel(pLeaf);
+        return i;
+    }
+    return p->nEvals;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the node by the decomposition found.]
+
+  Description [Returns 0 if the LUT minimizer did not find the
+  decomposition.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_ResynthesizeNodeImplement(Lpk_Man_t* p, Lpk_Job_t* pJob) {
+    Lpk_Cut_t* pCut = &pJob->Cut;
+    Abc_Obj_t* pObjNew;
+    unsigned* pTruth;
+    int nNodesBef, nNodesAft;
+    abctime clk;
+
+    // update the network
+    nNodesBef = Abc_NtkNodeNum(p->pNtk);
+    clk = Abc_Clock();
+    if (pJob->Status == LPK_JOB_DEC)
+        pObjNew = Lpk_DecomposeImplement(p, p->pNtk, pJob->vLeaves, (int)pCut->nLeaves, pJob->pFun);
+    else {
+        assert(pJob->Status == LPK_JOB_LUTMIN);
+        pTruth = Lpk_CutTruth(p, pCut, 0);
+        pObjNew = Abc_NtkLutMinDecompose(p->pNtk, pJob->vLeaves, (word*)pTruth, p->pPars->nLutSize, pJob->Required);
+    }
+    p->timeEval += Abc_Clock() - clk;
+    nNodesAft = Abc_NtkNodeNum(p->pNtk);
+    pJob->Status = LPK_JOB_NONE;
+    if (pObjNew == NULL)
+        return 0;
+
+    // perform replacement
+    {
+        int nGain = (int)pCut->nNodes - (int)pCut->nNodesDup - (nNodesAft - nNodesBef);
+        //assert( nGain >= 1 - p->pPars->fZeroCost );
+        assert(Abc_ObjLevel(pObjNew) <= pJob->Required);
+        p->nGainTotal += nGain;
+        p->nChanges++;
+        if (p->pPars->fVeryVerbose)
+            printf("Performed resynthesis: Gain = %2d. Level = %2d. Req = %2d.\n", nGain, Abc_ObjLevel(pObjNew), pJob->Required);
+        Abc_NtkUpdate(p->pObj, pObjNew, p->vLevels);
+        //printf( "%3d : %d-%d=%d(%d) \n", p->nChanges, nNodesBef, Abc_NtkNodeNum(p->pNtk), nNodesBef-Abc_NtkNodeNum(p->pNtk), nGain );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resynthesis for one node.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_ResynthesizeNodeNew(Lpk_Man_t* p) {
+    Lpk_Job_t Job, *pJob = &Job;
+    int i;
+    pJob->Id = p->pObj->Id;
+    pJob->vLeaves = p->vLeaves;
+    if (!Lpk_ResynthesizeNodeCuts(p, pJob))
+        return 0;
+    for (i = 0; (i = Lpk_ResynthesizeNodeEval(p, pJob, i)) < p->nEvals; i++)
+        if (Lpk_ResynthesizeNodeImplement(p, pJob))
+            break;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resynthesis for the nodes of one iteration.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Lpk_ResynthesizeNodes(Lpk_Man_t* p, int nNodes, ProgressBar* pProgress) {
+    Abc_Obj_t* pObj;
+    int i;
+    Abc_NtkForEachNode(p->pNtk, pObj, i) {
+        // skip all except the final node
+        if (p->pPars->fFirst) {
+            if (!Abc_ObjIsCo(Abc_ObjFanout0(pObj)))
+                continue;
+        }
+        if (i >= nNodes)
             break;
+        if (pProgress)
+            Extra_ProgressBarUpdate(pProgress, i, NULL);
+        // skip the nodes that did not change
+        if (p->pPars->fSatur && !Lpk_NodeHasChanged(p, pObj->Id))
+            continue;
+        // resynthesize
+        p->pObj = pObj;
+        if (p->pPars->fOldAlgo)
+            Lpk_ResynthesizeNode(p);
+        else
+            Lpk_ResynthesizeNodeNew(p);
+    }
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Lpk_ResynthesizePar(Lpk_Man_t* p, int nNodes, ProgressBar* pProgress) {
+    Lpk_ResynthesizeNodes(p, nNodes, pProgress);
+}
+
+#else // pthreads are used
+
+// information given to the thread
+typedef struct Lpk_ParThData_t_ Lpk_ParThData_t;
+struct Lpk_ParThData_t_ {
+    Lpk_Man_t* p;       // the private manager
+    Lpk_Par_t Pars;     // the private copy of the parameters
+    Lpk_Job_t* pJobs;   // the jobs of the current round (NULL to quit)
+    int nJobs;          // the number of jobs in the current round
+    int iFirst;         // the first job of this thread
+    int nStep;          // the distance between the jobs of this thread
+    int fWorking;       // set while the jobs are being solved (protected by the mutex)
+    void* pMutex;       // the mutex shared with the main thread
+    void* pCondWork;    // signaled by the main thread when the jobs are given
+    void* pCondDone;    // signaled by the thread when the jobs are solved
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the manager of one thread.]
+
+  Description [The thread manager works on the network of the main
+  manager and shares with it the record of the visited nodes. When the
+  thread manager is stopped, its statistics are added to the main one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Lpk_Man_t* Lpk_ManStartThread(Lpk_Man_t* pMan, Lpk_Par_t* pPars) {
+    Lpk_Man_t* p = Lpk_ManStart(pPars);
+    p->pNtk = pMan->pNtk;
+    p->vVisited = pMan->vVisited;
+    return p;
+}
+void Lpk_ManStopThread(Lpk_Man_t* pMan, Lpk_Man_t* p) {
+    int i;
+    pMan->nNodesOver += p->nNodesOver;
+    pMan->nCutsTotal += p->nCutsTotal;
+    pMan->nCutsUseful += p->nCutsUseful;
+    pMan->nMuxes += p->nMuxes;
+    pMan->nDsds += p->nDsds;
+    for (i = 0; i < 17; i++)
+        pMan->nBlocks[i] += p->nBlocks[i];
+    pMan->timeCuts = Abc_MaxWord(pMan->timeCuts, p->timeCuts);
+    pMan->timeTruth = Abc_MaxWord(pMan->timeTruth, p->timeTruth);
+    pMan->timeSupps = Abc_MaxWord(pMan->timeSupps, p->timeSupps);
+    pMan->timeEval = Abc_MaxWord(pMan->timeEval, p->timeEval);
+    pMan->timeEvalMuxAn = Abc_MaxWord(pMan->timeEvalMuxAn, p->timeEvalMuxAn);
+    pMan->timeEvalMuxSp = Abc_MaxWord(pMan->timeEvalMuxSp, p->timeEvalMuxSp);
+    pMan->timeEvalDsdAn = Abc_MaxWord(pMan->timeEvalDsdAn, p->timeEvalDsdAn);
+    pMan->timeEvalDsdSp = Abc_MaxWord(pMan->timeEvalDsdSp, p->timeEvalDsdSp);
+    p->vVisited = NULL;
+    Lpk_ManStop(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that the decomposition found by a thread is still valid.]
+
+  Description [The decomposition is valid if the network did not change
+  around the node after the round started: the required level of the node,
+  the levels of the cut leaves, and the nodes inside the cut are the same,
+  and the nodes of the cut are still in the MFFC of the node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_ResynthesizeParCheck(Lpk_Man_t* p, Lpk_Job_t* pJob) {
+    Lpk_Cut_t* pCut = &pJob->Cut;
+    Abc_Obj_t* pObj;
+    int i;
+    if (Abc_ObjRequiredLevel(p->pObj) != pJob->Required)
+        return 0;
+    for (i = 0; i < (int)pCut->nLeaves; i++) {
+        pObj = Abc_NtkObj(p->pNtk, pCut->pLeaves[i]);
+        if (pObj == NULL || pObj != Vec_PtrEntry(pJob->vLeaves, i) || Abc_ObjLevel(pObj) != pJob->pLevels[i])
+            return 0;
+    }
+    for (i = 0; i < (int)pCut->nNodes; i++)
+        if (Abc_NtkObj(p->pNtk, pCut->pNodes[i]) == NULL)
+            return 0;
+    return Lpk_NodeMffcLabelCut(p, pCut) == (int)pCut->nNodes - (int)pCut->nNodesDup;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the jobs given to one thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Lpk_ResynthesizeParSolveJobs(Lpk_ParThData_t* pThData) {
+    Lpk_Man_t* p = pThData->p;
+    Lpk_Job_t* pJob;
+    int i;
+    for (i = pThData->iFirst; i < pThData->nJobs; i += pThData->nStep) {
+        pJob = pThData->pJobs + i;
+        p->pObj = Abc_NtkObj(p->pNtk, pJob->Id);
+        if (Lpk_ResynthesizeNodeCuts(p, pJob))
+            Lpk_ResynthesizeNodeEval(p, pJob, 0);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description [Sleeps until the main thread gives it the jobs of the next
+  round or asks it to quit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Lpk_ResynthesizeParWorkerThread(void* pArg) {
+    Lpk_ParThData_t* pThData = (Lpk_ParThData_t*)pArg;
+    pthread_mutex_t* pMutex = (pthread_mutex_t*)pThData->pMutex;
+    int status;
+    while (1) {
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        while (!pThData->fWorking)
+            pthread_cond_wait((pthread_cond_t*)pThData->pCondWork, pMutex);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+        if (pThData->pJobs == NULL) {
+            pThData->p->timeTotal = Abc_Clock();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
         }
+        Lpk_ResynthesizeParSolveJobs(pThData);
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        pThData->fWorking = 0;
+        pthread_cond_signal((pthread_cond_t*)pThData->pCondDone);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
     }
-    return 1;
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resynthesis for the nodes of one iteration with several threads.]
+
+  Description [The nodes are taken in the order of their IDs, up to
+  LPK_PAR_BATCH nodes in a round. The threads compute the cuts of the
+  nodes of a round and decompose them on the unchanged network. The main
+  thread then creates the decompositions in the order of the nodes. If the
+  network around a node has changed after the round started, or if the
+  cut should be given to the LUT minimizer, which is not reentrant, the
+  main thread resynthesizes the node again. The rounds do not depend on
+  the number of threads, so neither does the result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Lpk_ResynthesizePar(Lpk_Man_t* p, int nNodes, ProgressBar* pProgress) {
+    Lpk_ParThData_t ThData[LPK_PAR_THR_MAX];
+    pthread_t WorkerThread[LPK_PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t CondWork, CondDone;
+    Lpk_Job_t* pJobs = ABC_CALLOC(Lpk_Job_t, LPK_PAR_BATCH);
+    Lpk_Job_t* pJob;
+    Abc_Obj_t* pObj;
+    int nProcs = Abc_MinInt(p->pPars->nProcs, LPK_PAR_THR_MAX);
+    int i, iNode, status, fWorkToDo, nJobs, nRounds = 0, nNodesAll = 0, nRedo = 0;
+    abctime clk = Abc_Clock(), clkThreads = 0;
+    for (i = 0; i < LPK_PAR_BATCH; i++)
+        pJobs[i].vLeaves = Vec_PtrAlloc(32);
+    // start the threads
+    pthread_mutex_init(&Mutex, NULL);
+    pthread_cond_init(&CondWork, NULL);
+    pthread_cond_init(&CondDone, NULL);
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].Pars = *p->pPars;
+        ThData[i].Pars.fVeryVerbose = 0;
+        ThData[i].p = Lpk_ManStartThread(p, &ThData[i].Pars);
+        ThData[i].pJobs = pJobs;
+        ThData[i].nJobs = 0;
+        ThData[i].iFirst = i;
+        ThData[i].nStep = nProcs;
+        ThData[i].fWorking = 0;
+        ThData[i].pMutex = &Mutex;
+        ThData[i].pCondWork = &CondWork;
+        ThData[i].pCondDone = &CondDone;
+        status = pthread_create(WorkerThread + i, NULL, Lpk_ResynthesizeParWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    for (iNode = 0; iNode < nNodes;) {
+        // collect the nodes of this round
+        for (nJobs = 0; iNode < nNodes && nJobs < LPK_PAR_BATCH; iNode++) {
+            pObj = Abc_NtkObj(p->pNtk, iNode);
+            if (pObj == NULL || !Abc_ObjIsNode(pObj))
+                continue;
+            // skip all except the final node
+            if (p->pPars->fFirst && !Abc_ObjIsCo(Abc_ObjFanout0(pObj)))
+                continue;
+            // skip the nodes that did not change
+            if (p->pPars->fSatur && !Lpk_NodeHasChanged(p, iNode))
+                continue;
+            pJobs[nJobs++].Id = iNode;
+        }
+        if (pProgress)
+            Extra_ProgressBarUpdate(pProgress, iNode, NULL);
+        if (nJobs == 0)
+            continue;
+        nRounds++;
+        nNodesAll += nJobs;
+        // evaluate the nodes
+        status = pthread_mutex_lock(&Mutex);
+        assert(status == 0);
+        for (i = 0; i < nProcs; i++) {
+            ThData[i].nJobs = nJobs;
+            ThData[i].fWorking = 1;
+        }
+        pthread_cond_broadcast(&CondWork);
+        for (fWorkToDo = 1; fWorkToDo;) {
+            for (fWorkToDo = i = 0; i < nProcs; i++)
+                fWorkToDo |= ThData[i].fWorking;
+            if (fWorkToDo)
+                pthread_cond_wait(&CondDone, &Mutex);
+        }
+        status = pthread_mutex_unlock(&Mutex);
+        assert(status == 0);
+        // implement the results in the order of the nodes
+        for (i = 0; i < nJobs; i++) {
+            pJob = pJobs + i;
+            p->pObj = Abc_NtkObj(p->pNtk, pJob->Id);
+            if (p->pObj && pJob->Status == LPK_JOB_DEC && Lpk_ResynthesizeParCheck(p, pJob)) {
+                Lpk_ResynthesizeNodeImplement(p, pJob);
+                continue;
+            }
+            if (pJob->Status == LPK_JOB_DEC)
+                Lpk_DecomposeClean(pJob->vLeaves, (int)pJob->Cut.nLeaves);
+            // skip the nodes removed by the earlier jobs and the nodes without decomposition
+            if (p->pObj == NULL || pJob->Status == LPK_JOB_NONE)
+                continue;
+            nRedo++;
+            Lpk_ResynthesizeNodeNew(p);
+        }
+    }
+    // stop the threads
+    status = pthread_mutex_lock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        ThData[i].pJobs = NULL;
+        ThData[i].fWorking = 1;
+    }
+    pthread_cond_broadcast(&CondWork);
+    status = pthread_mutex_unlock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        pthread_join(WorkerThread[i], NULL);
+        clkThreads = Abc_MaxWord(clkThreads, ThData[i].p->timeTotal);
+        Lpk_ManStopThread(p, ThData[i].p);
+    }
+    // the main thread sleeps while the threads work, so add the longest thread to its runtime
+    p->timeTotal += clkThreads;
+    pthread_cond_destroy(&CondWork);
+    pthread_cond_destroy(&CondDone);
+    pthread_mutex_destroy(&Mutex);
+    if (p->pPars->fVerbose) {
+        printf("Parallel resynthesis with %d threads evaluated %d nodes in %d rounds (%d redone).  ", nProcs, nNodesAll, nRounds, nRedo);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk + clkThreads);
+    }
+    for (i = 0; i < LPK_PAR_BATCH; i++)
+        Vec_PtrFree(pJobs[i].vLeaves);
+    ABC_FREE(pJobs);
 }
 
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs resynthesis for one network.]
@@ -561,7 +955,6 @@ p->timeTruth3 += Abc_Clock() - clk;
 int Lpk_Resynthesize(Abc_Ntk_t* pNtk, Lpk_Par_t* pPars) {
     ProgressBar* pProgress = NULL; // Suppress "might be used uninitialized"
     Lpk_Man_t* p;
-    Abc_Obj_t* pObj;
     double Delta;
     //    int * pnFanouts, nObjMax;
     int i, Iter, nNodes, nNodesPrev;
@@ -636,26 +1029,10 @@ int Lpk_Resynthesize(Abc_Ntk_t* pNtk, Lpk_Par_t* pPars) {
         nNodes = Abc_NtkObjNumMax(pNtk);
         if (!pPars->fVeryVerbose)
             pProgress = Extra_ProgressBarStart(stdout, nNodes);
-        Abc_NtkForEachNode(pNtk, pObj, i) {
-            // skip all except the final node
-            if (pPars->fFirst) {
-                if (!Abc_ObjIsCo(Abc_ObjFanout0(pObj)))
-                    continue;
-            }
-            if (i >= nNodes)
-                break;
-            if (!pPars->fVeryVerbose)
-                Extra_ProgressBarUpdate(pProgress, i, NULL);
-            // skip the nodes that did not change
-            if (p->pPars->fSatur && !Lpk_NodeHasChanged(p, pObj->Id))
-                continue;
-            // resynthesize
-            p->pObj = pObj;
-            if (p->pPars->fOldAlgo)
-                Lpk_ResynthesizeNode(p);
-            else
-                Lpk_ResynthesizeNodeNew(p);
-        }
+        if (pPars->nProcs > 1 && !pPars->fOldAlgo)
+            Lpk_ResynthesizePar(p, nNodes, pProgress);
+        else
+            Lpk_ResynthesizeNodes(p, nNodes, pProgress);
         if (!pPars->fVeryVerbose)
             Extra_ProgressBarStop(pProgress);
 
@@ -703,7 +1080,7 @@ int Lpk_Resynthesize(Abc_Ntk_t* pNtk, Lpk_Par_t* pPars) {
                 printf(" %d=%d", i, p->nBlocks[i]);
         printf("\n");
 
-        p->timeTotal = Abc_Clock() - clk;
+        p->timeTotal += Abc_Clock() - clk;
         p->timeEval = p->timeEval - p->timeMap;
         p->timeOther = p->timeTotal - p->timeCuts - p->timeTruth - p->timeEval - p->timeMap;
         ABC_PRTP("Cuts  ", p->timeCuts, p->timeTotal);
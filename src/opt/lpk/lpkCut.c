@@ -127,29 +127,49 @@ CloudNode* Lpk_CutTruthBdd(Lpk_Man_t* p, Lpk_Cut_t* pCut) {
   SeeAlso     []
 
 ***********************************************************************/
-unsigned* Lpk_CutTruth_rec(Hop_Man_t* pMan, Hop_Obj_t* pObj, int nVars, Vec_Ptr_t* vTtNodes, int* piCount) {
+unsigned* Lpk_CutTruth_rec(Lpk_Man_t* p, Hop_Obj_t* pObj, int nVars, int* piCount) {
     unsigned *pTruth, *pTruth0, *pTruth1;
     assert(!Hop_IsComplement(pObj));
-    if (pObj->pData) {
-        assert(((unsigned)(ABC_PTRUINT_T)pObj->pData) & 0xffff0000);
-        return (unsigned*)pObj->pData;
-    }
+    if ((pTruth = (unsigned*)Vec_PtrEntry(p->vHopData, pObj->Id)))
+        return pTruth;
     // get the plan for a new truth table
-    pTruth = (unsigned*)Vec_PtrEntry(vTtNodes, (*piCount)++);
+    pTruth = (unsigned*)Vec_PtrEntry(p->vTtNodes, (*piCount)++);
     if (Hop_ObjIsConst1(pObj))
         Kit_TruthFill(pTruth, nVars);
     else {
         assert(Hop_ObjIsAnd(pObj));
         // compute the truth tables of the fanins
-        pTruth0 = Lpk_CutTruth_rec(pMan, Hop_ObjFanin0(pObj), nVars, vTtNodes, piCount);
-        pTruth1 = Lpk_CutTruth_rec(pMan, Hop_ObjFanin1(pObj), nVars, vTtNodes, piCount);
+        pTruth0 = Lpk_CutTruth_rec(p, Hop_ObjFanin0(pObj), nVars, piCount);
+        pTruth1 = Lpk_CutTruth_rec(p, Hop_ObjFanin1(pObj), nVars, piCount);
         // creat the truth table of the node
         Kit_TruthAndPhase(pTruth, pTruth0, pTruth1, nVars, Hop_ObjFaninC0(pObj), Hop_ObjFaninC1(pObj));
     }
-    pObj->pData = pTruth;
+    Vec_PtrWriteEntry(p->vHopData, pObj->Id, pTruth);
     return pTruth;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Cleans the truth tables of the local AIG.]
+
+  Description [The truth tables are kept in the manager rather than in
+  the AIG nodes, because the AIG is shared by the managers of all threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Lpk_CutTruthClean_rec(Lpk_Man_t* p, Hop_Obj_t* pObj) {
+    assert(!Hop_IsComplement(pObj));
+    assert(!Hop_ObjIsPo(pObj));
+    if (Hop_ObjIsAnd(pObj)) {
+        Lpk_CutTruthClean_rec(p, Hop_ObjFanin0(pObj));
+        Lpk_CutTruthClean_rec(p, Hop_ObjFanin1(pObj));
+    }
+    Vec_PtrWriteEntry(p->vHopData, pObj->Id, NULL);
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the truth able of one cut.]
@@ -173,37 +193,162 @@ unsigned* Lpk_CutTruth(Lpk_Man_t* p, Lpk_Cut_t* pCut, int fInv) {
 
     // initialize the leaves
     Lpk_CutForEachLeaf(p->pNtk, pCut, pObj, i)
-        pObj->pCopy
-        = (Abc_Obj_t*)Vec_PtrEntry(p->vTtElems, fInv ? pCut->nLeaves - 1 - i : i);
+        Vec_PtrWriteEntry(p->vCopies, pObj->Id, Vec_PtrEntry(p->vTtElems, fInv ? pCut->nLeaves - 1 - i : i));
 
     // construct truth table in the topological order
     Lpk_CutForEachNodeReverse(p->pNtk, pCut, pObj, i) {
         // get the local AIG
         pObjHop = Hop_Regular((Hop_Obj_t*)pObj->pData);
         // clean the data field of the nodes in the AIG subgraph
-        Hop_ObjCleanData_rec(pObjHop);
+        Lpk_CutTruthClean_rec(p, pObjHop);
         // set the initial truth tables at the fanins
         Abc_ObjForEachFanin(pObj, pFanin, k) {
-            assert(((unsigned)(ABC_PTRUINT_T)pFanin->pCopy) & 0xffff0000);
-            Hop_ManPi(pManHop, k)->pData = pFanin->pCopy;
+            assert(Vec_PtrEntry(p->vCopies, pFanin->Id) != NULL);
+            Vec_PtrWriteEntry(p->vHopData, Hop_ManPi(pManHop, k)->Id, Vec_PtrEntry(p->vCopies, pFanin->Id));
         }
         // compute the truth table of internal nodes
-        pTruth = Lpk_CutTruth_rec(pManHop, pObjHop, pCut->nLeaves, p->vTtNodes, &iCount);
+        pTruth = Lpk_CutTruth_rec(p, pObjHop, pCut->nLeaves, &iCount);
         if (Hop_IsComplement((Hop_Obj_t*)pObj->pData))
             Kit_TruthNot(pTruth, pTruth, pCut->nLeaves);
         // set the truth table at the node
-        pObj->pCopy = (Abc_Obj_t*)pTruth;
+        Vec_PtrWriteEntry(p->vCopies, pObj->Id, pTruth);
     }
 
     // make sure direct truth table is stored elsewhere (assuming the first call for direct truth!!!)
     if (fInv == 0) {
         pTruth = (unsigned*)Vec_PtrEntry(p->vTtNodes, iCount++);
-        Kit_TruthCopy(pTruth, (unsigned*)(ABC_PTRUINT_T)pObj->pCopy, pCut->nLeaves);
+        Kit_TruthCopy(pTruth, (unsigned*)Vec_PtrEntry(p->vCopies, pObj->Id), pCut->nLeaves);
     }
     assert(iCount <= Vec_PtrSize(p->vTtNodes));
     return pTruth;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the fanout count of the object.]
+
+  Description [The fanout counts of the network are not changed, because
+  the network is shared by the managers of all threads. The changed counts
+  are kept in the manager until Lpk_ManCleanRefs() is called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Lpk_ObjRefNum(Lpk_Man_t* p, Abc_Obj_t* pObj) {
+    int nRefs = Vec_IntEntry(p->vRefs, pObj->Id);
+    return nRefs >= 0 ? nRefs : Abc_ObjFanoutNum(pObj);
+}
+static inline void Lpk_ObjSetRefNum(Lpk_Man_t* p, Abc_Obj_t* pObj, int nRefs) {
+    assert(nRefs >= 0);
+    if (Vec_IntEntry(p->vRefs, pObj->Id) < 0)
+        Vec_IntPush(p->vRefsUsed, pObj->Id);
+    Vec_IntWriteEntry(p->vRefs, pObj->Id, nRefs);
+}
+static inline void Lpk_ManCleanRefs(Lpk_Man_t* p) {
+    int i, Id;
+    Vec_IntForEachEntry(p->vRefsUsed, Id, i)
+        Vec_IntWriteEntry(p->vRefs, Id, -1);
+    Vec_IntClear(p->vRefsUsed);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Dereferences the node's MFFC.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_NodeDeref_rec(Lpk_Man_t* p, Abc_Obj_t* pNode) {
+    Abc_Obj_t* pFanin;
+    int i, nRefs, Counter = 1;
+    if (Abc_ObjIsCi(pNode))
+        return 0;
+    Abc_ObjForEachFanin(pNode, pFanin, i) {
+        nRefs = Lpk_ObjRefNum(p, pFanin) - 1;
+        Lpk_ObjSetRefNum(p, pFanin, nRefs);
+        if (nRefs == 0)
+            Counter += Lpk_NodeDeref_rec(p, pFanin);
+    }
+    return Counter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Labels the nodes of the dereferenced MFFC.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Lpk_NodeMffcLabel_rec(Lpk_Man_t* p, Abc_Obj_t* pNode, int fTopmost, Vec_Ptr_t* vNodes) {
+    Abc_Obj_t* pFanin;
+    int i;
+    // skip the nodes outside of the MFFC
+    if (!fTopmost && (Abc_ObjIsCi(pNode) || Lpk_ObjRefNum(p, pNode) > 0))
+        return;
+    // skip visited nodes
+    if (Lpk_ObjIsTravIdCurrent(p, pNode))
+        return;
+    Lpk_ObjSetTravIdCurrent(p, pNode);
+    // recur on the children
+    Abc_ObjForEachFanin(pNode, pFanin, i)
+        Lpk_NodeMffcLabel_rec(p, pFanin, 0, vNodes);
+    // collect the internal node
+    if (vNodes)
+        Vec_PtrPush(vNodes, pNode);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Labels the MFFC of the node with the current traversal ID.]
+
+  Description [Works as Abc_NodeMffcLabel() but keeps the traversal IDs
+  and the changed fanout counts in the manager. Returns the MFFC size.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_NodeMffcLabel(Lpk_Man_t* p, Abc_Obj_t* pNode, Vec_Ptr_t* vNodes) {
+    int Count;
+    Lpk_ManPrepareMarks(p);
+    Count = Lpk_NodeDeref_rec(p, pNode);
+    Lpk_ManIncrementTravId(p);
+    Lpk_NodeMffcLabel_rec(p, pNode, 1, vNodes);
+    Lpk_ManCleanRefs(p);
+    return Count;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the size of the node's MFFC limited by the cut.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Lpk_NodeMffcLabelCut(Lpk_Man_t* p, Lpk_Cut_t* pCut) {
+    Abc_Obj_t* pLeaf;
+    int i;
+    Lpk_ManPrepareMarks(p);
+    Lpk_CutForEachLeaf(p->pNtk, pCut, pLeaf, i)
+        Lpk_ObjSetRefNum(p, pLeaf, Lpk_ObjRefNum(p, pLeaf) + 1);
+    return Lpk_NodeMffcLabel(p, p->pObj, NULL);
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if at least one entry has changed.]
@@ -226,17 +371,16 @@ void Lpk_NodeRecordImpact(Lpk_Man_t* p) {
         pCut = p->pCuts + i;
         for (k = 0; k < (int)pCut->nLeaves; k++) {
             pNode = Abc_NtkObj(p->pNtk, pCut->pLeaves[k]);
-            if (pNode->fMarkC)
+            if (Vec_IntEntry(p->vLeafNums, pNode->Id) >= 0)
                 continue;
-            pNode->fMarkC = 1;
+            Vec_IntWriteEntry(p->vLeafNums, pNode->Id, 0);
             Vec_PtrPush(vNodes, (void*)(ABC_PTRUINT_T)pNode->Id);
             Vec_PtrPush(vNodes, (void*)(ABC_PTRUINT_T)Abc_ObjFanoutNum(pNode));
         }
     }
     // clear the marks
     Vec_PtrForEachEntryDouble(Abc_Obj_t*, Abc_Obj_t*, vNodes, pNode, pNode2, i) {
-        pNode = Abc_NtkObj(p->pNtk, (int)(ABC_PTRUINT_T)pNode);
-        pNode->fMarkC = 0;
+        Vec_IntWriteEntry(p->vLeafNums, (int)(ABC_PTRUINT_T)pNode, -1);
         //        i++;
     }
     //printf( "%d ", Vec_PtrSize(vNodes) );
@@ -255,23 +399,25 @@ void Lpk_NodeRecordImpact(Lpk_Man_t* p) {
 ***********************************************************************/
 int Lpk_NodeCutsCheckDsd(Lpk_Man_t* p, Lpk_Cut_t* pCut) {
     Abc_Obj_t *pObj, *pFanin;
-    int i, k, nCands, fLeavesOnly, RetValue;
+    int i, k, iLeaf, nCands, fLeavesOnly, RetValue;
     assert(pCut->nLeaves > 0);
     // clear ref counters
     memset(p->pRefs, 0, sizeof(int) * pCut->nLeaves);
     // mark cut leaves
     Lpk_CutForEachLeaf(p->pNtk, pCut, pObj, i) {
-        assert(pObj->fMarkA == 0);
-        pObj->fMarkA = 1;
-        pObj->pCopy = (Abc_Obj_t*)(ABC_PTRUINT_T)i;
+        assert(Vec_IntEntry(p->vLeafNums, pObj->Id) == -1);
+        Vec_IntWriteEntry(p->vLeafNums, pObj->Id, i);
     }
     // ref leaves pointed from the internal nodes
     nCands = 0;
     Lpk_CutForEachNode(p->pNtk, pCut, pObj, i) {
         fLeavesOnly = 1;
-        Abc_ObjForEachFanin(pObj, pFanin, k) if (pFanin->fMarkA)
-            p->pRefs[(int)(ABC_PTRUINT_T)pFanin->pCopy]++;
-        else fLeavesOnly = 0;
+        Abc_ObjForEachFanin(pObj, pFanin, k) {
+            if ((iLeaf = Vec_IntEntry(p->vLeafNums, pFanin->Id)) >= 0)
+                p->pRefs[iLeaf]++;
+            else
+                fLeavesOnly = 0;
+        }
         if (fLeavesOnly)
             p->pCands[nCands++] = pObj->Id;
     }
@@ -280,8 +426,8 @@ int Lpk_NodeCutsCheckDsd(Lpk_Man_t* p, Lpk_Cut_t* pCut) {
     for (i = 0; i < nCands; i++) {
         pObj = Abc_NtkObj(p->pNtk, p->pCands[i]);
         Abc_ObjForEachFanin(pObj, pFanin, k) {
-            assert(pFanin->fMarkA == 1);
-            if (p->pRefs[(int)(ABC_PTRUINT_T)pFanin->pCopy] > 1)
+            assert(Vec_IntEntry(p->vLeafNums, pFanin->Id) >= 0);
+            if (p->pRefs[Vec_IntEntry(p->vLeafNums, pFanin->Id)] > 1)
                 break;
         }
         if (k == Abc_ObjFaninNum(pObj)) {
@@ -291,8 +437,7 @@ int Lpk_NodeCutsCheckDsd(Lpk_Man_t* p, Lpk_Cut_t* pCut) {
     }
     // unmark cut leaves
     Lpk_CutForEachLeaf(p->pNtk, pCut, pObj, i)
-        pObj->fMarkA
-        = 0;
+        Vec_IntWriteEntry(p->vLeafNums, pObj->Id, -1);
     return RetValue;
 }
 
@@ -456,7 +601,7 @@ void Lpk_NodeCutsOne(Lpk_Man_t* p, Lpk_Cut_t* pCut, int Node) {
     //    assert( Abc_ObjFaninNum(pObj) <= p->pPars->nLutSize );
 
     // if the node is not in the MFFC, check the limit
-    if (!Abc_NodeIsTravIdCurrent(pObj)) {
+    if (!Lpk_ObjIsTravIdCurrent(p, pObj)) {
         if ((int)pCut->nNodesDup == p->pPars->nLutsOver)
             return;
         assert((int)pCut->nNodesDup < p->pPars->nLutsOver);
@@ -520,7 +665,7 @@ void Lpk_NodeCutsOne(Lpk_Man_t* p, Lpk_Cut_t* pCut, int Node) {
     if (i == (int)pCutNew->nNodes) // new node
     {
         pCutNew->pNodes[pCutNew->nNodes++] = Node;
-        pCutNew->nNodesDup += !Abc_NodeIsTravIdCurrent(pObj);
+        pCutNew->nNodesDup += !Lpk_ObjIsTravIdCurrent(p, pObj);
     }
     // the number of nodes does not exceed MFFC plus duplications
     assert(pCutNew->nNodes <= p->nMffc + pCutNew->nNodesDup);
@@ -576,7 +721,7 @@ int Lpk_NodeCuts(Lpk_Man_t* p) {
 
     // mark the MFFC of the node with the current trav ID
     Vec_PtrClear(p->vTemp);
-    nMffc = p->nMffc = Abc_NodeMffcLabel(p->pObj, p->vTemp);
+    nMffc = p->nMffc = Lpk_NodeMffcLabel(p, p->pObj, p->vTemp);
     assert(nMffc > 0);
     if (nMffc == 1)
         return 0;
@@ -88,6 +88,14 @@ struct Lpk_Man_t_ {
     int pCands[LPK_SIZE_MAX]; // internal nodes pointing only to the leaves
     Vec_Ptr_t* vLeaves;
     Vec_Ptr_t* vTemp;
+    // private marks (several managers can work on the same network)
+    Vec_Int_t* vTravIds;  // the traversal IDs of the objects
+    int nTravIds;         // the current traversal ID
+    Vec_Int_t* vRefs;     // the fanout counts of the dereferenced objects (-1 if not changed)
+    Vec_Int_t* vRefsUsed; // the objects whose fanout counts are changed
+    Vec_Int_t* vLeafNums; // the number of each object among the cut leaves (-1 if not a leaf)
+    Vec_Ptr_t* vCopies;   // the truth tables of the objects
+    Vec_Ptr_t* vHopData;  // the truth tables of the AIG nodes of the local functions
     // truth table representation
     Vec_Ptr_t* vTtElems; // elementary truth tables
     Vec_Ptr_t* vTtNodes; // storage for temporary truth tables of the nodes
@@ -150,6 +158,23 @@ struct Lpk_Fun_t_ {
     unsigned pTruth[0];     // the truth table (contains room for three truth tables)
 };
 
+// resynthesis of one node
+typedef struct Lpk_Job_t_ Lpk_Job_t;
+struct Lpk_Job_t_ {
+    int Id;             // the node
+    int Status;         // the result (LPK_JOB_NONE, LPK_JOB_DEC, or LPK_JOB_LUTMIN)
+    int Required;       // the required level of the node
+    int iCut;           // the number of the cut used
+    Lpk_Cut_t Cut;      // the cut used
+    int pLevels[16];    // the levels of the cut leaves
+    Lpk_Fun_t* pFun;    // the decomposed function
+    Vec_Ptr_t* vLeaves; // the cut leaves followed by the decomposition
+};
+
+#    define LPK_JOB_NONE 0   // no decomposition is found
+#    define LPK_JOB_DEC 1    // the decomposition is found
+#    define LPK_JOB_LUTMIN 2 // the cut should be decomposed by the LUT minimizer
+
 // preliminary decomposition result
 typedef struct Lpk_Res_t_ Lpk_Res_t;
 struct Lpk_Res_t_ {
@@ -172,6 +197,10 @@ static inline unsigned* Lpk_FunTruth(Lpk_Fun_t* p, int Num) {
     return p->pTruth + Kit_TruthWordNum(p->nVars) * Num;
 }
 
+static inline void Lpk_ManIncrementTravId(Lpk_Man_t* p) { p->nTravIds++; }
+static inline int Lpk_ObjIsTravIdCurrent(Lpk_Man_t* p, Abc_Obj_t* pObj) { return Vec_IntEntry(p->vTravIds, pObj->Id) == p->nTravIds; }
+static inline void Lpk_ObjSetTravIdCurrent(Lpk_Man_t* p, Abc_Obj_t* pObj) { Vec_IntWriteEntry(p->vTravIds, pObj->Id, p->nTravIds); }
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -196,6 +225,9 @@ static inline unsigned* Lpk_FunTruth(Lpk_Fun_t* p, int Num) {
 ////////////////////////////////////////////////////////////////////////
 
 /*=== lpkAbcDec.c ============================================================*/
+extern Lpk_Fun_t* Lpk_DecomposeFun(Lpk_Man_t* pMan, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, unsigned* pTruth, unsigned* puSupps, int nLutK, int AreaLim, int DelayLim);
+extern void Lpk_DecomposeClean(Vec_Ptr_t* vLeaves, int nLeavesOld);
+extern Abc_Obj_t* Lpk_DecomposeImplement(Lpk_Man_t* pMan, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, int nLeaves, Lpk_Fun_t* pFun);
 extern Abc_Obj_t* Lpk_Decompose(Lpk_Man_t* pMan, Abc_Ntk_t* pNtk, Vec_Ptr_t* vLeaves, unsigned* pTruth, unsigned* puSupps, int nLutK, int AreaLim, int DelayLim);
 /*=== lpkAbcDsd.c ============================================================*/
 extern Lpk_Res_t* Lpk_DsdAnalize(Lpk_Man_t* pMan, Lpk_Fun_t* p, int nShared);
@@ -216,9 +248,12 @@ extern int Lpk_SuppToVars(unsigned uBoundSet, char* pVars);
 /*=== lpkCut.c =========================================================*/
 extern unsigned* Lpk_CutTruth(Lpk_Man_t* p, Lpk_Cut_t* pCut, int fInv);
 extern int Lpk_NodeCuts(Lpk_Man_t* p);
+extern int Lpk_NodeMffcLabel(Lpk_Man_t* p, Abc_Obj_t* pNode, Vec_Ptr_t* vNodes);
+extern int Lpk_NodeMffcLabelCut(Lpk_Man_t* p, Lpk_Cut_t* pCut);
 /*=== lpkMap.c =========================================================*/
 extern Lpk_Man_t* Lpk_ManStart(Lpk_Par_t* pPars);
 extern void Lpk_ManStop(Lpk_Man_t* p);
+extern void Lpk_ManPrepareMarks(Lpk_Man_t* p);
 /*=== lpkMap.c =========================================================*/
 extern If_Obj_t* Lpk_MapPrime(Lpk_Man_t* p, unsigned* pTruth, int nVars, If_Obj_t** ppLeaves);
 extern If_Obj_t* Lpk_MapTree_rec(Lpk_Man_t* p, Kit_DsdNtk_t* pNtk, If_Obj_t** ppLeaves, int iLit, If_Obj_t* pResult);
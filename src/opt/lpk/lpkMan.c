@@ -55,6 +55,12 @@ Lpk_Man_t* Lpk_ManStart(Lpk_Par_t* pPars) {
     p->vCover = Vec_IntAlloc(1 << 12);
     p->vLeaves = Vec_PtrAlloc(32);
     p->vTemp = Vec_PtrAlloc(32);
+    p->vTravIds = Vec_IntAlloc(0);
+    p->vRefs = Vec_IntAlloc(0);
+    p->vRefsUsed = Vec_IntAlloc(100);
+    p->vLeafNums = Vec_IntAlloc(0);
+    p->vCopies = Vec_PtrAlloc(0);
+    p->vHopData = Vec_PtrAlloc(0);
     for (i = 0; i < 8; i++)
         p->vSets[i] = Vec_IntAlloc(100);
     p->pDsdMan = Kit_DsdManAlloc(pPars->nVarsMax, 64);
@@ -110,12 +116,37 @@ void Lpk_ManStop(Lpk_Man_t* p) {
         Vec_VecFree(p->vVisited);
     Vec_PtrFree(p->vLeaves);
     Vec_PtrFree(p->vTemp);
+    Vec_IntFree(p->vTravIds);
+    Vec_IntFree(p->vRefs);
+    Vec_IntFree(p->vRefsUsed);
+    Vec_IntFree(p->vLeafNums);
+    Vec_PtrFree(p->vCopies);
+    Vec_PtrFree(p->vHopData);
     Vec_IntFree(p->vCover);
     Vec_PtrFree(p->vTtElems);
     Vec_PtrFree(p->vTtNodes);
     ABC_FREE(p);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Extends the private marks to the objects of the network.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Lpk_ManPrepareMarks(Lpk_Man_t* p) {
+    Vec_IntFillExtra(p->vTravIds, Abc_NtkObjNumMax(p->pNtk), 0);
+    Vec_IntFillExtra(p->vRefs, Abc_NtkObjNumMax(p->pNtk), -1);
+    Vec_IntFillExtra(p->vLeafNums, Abc_NtkObjNumMax(p->pNtk), -1);
+    Vec_PtrFillExtra(p->vCopies, Abc_NtkObjNumMax(p->pNtk), NULL);
+    Vec_PtrFillExtra(p->vHopData, ((Hop_Man_t*)p->pNtk->pManFunc)->nCreated, NULL);
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
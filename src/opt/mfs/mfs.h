@@ -53,6 +53,7 @@ struct Mfs_Par_t_ {
     int fDelay;       // performs optimization for delay
     int fPower;       // performs power-aware optimization
     int fGiaSat;      // use new SAT solver
+    int fUseSim;      // use simulation to filter resubstitution candidates
     int fVerbose;     // enable basic stats
     int fVeryVerbose; // enable detailed stats
 };
@@ -57,6 +57,7 @@ void Abc_NtkMfsParsDefault(Mfs_Par_t* pPars) {
     pPars->fMoreEffort = 0;
     pPars->fSwapEdge = 0;
     pPars->fOneHotness = 0;
+    pPars->fUseSim = 1;
     pPars->fVerbose = 0;
     pPars->fVeryVerbose = 0;
 }
@@ -234,6 +235,10 @@ int Abc_NtkMfsResub(Mfs_Man_t* p, Abc_Obj_t* pNode) {
         p->nMaxDivs++;
         return 1;
     }
+    // compute the care patterns of the node
+    clk = Abc_Clock();
+    Abc_NtkMfsSimCare(p, pNode);
+    p->timeSim += Abc_Clock() - clk;
     // compute the divisors of the window
     clk = Abc_Clock();
     p->vDivs = Abc_MfsComputeDivisors(p, pNode, Abc_ObjRequiredLevel(pNode) - 1);
@@ -441,6 +446,13 @@ int Abc_NtkMfs(Abc_Ntk_t* pNtk, Mfs_Par_t* pPars) {
     Abc_NtkLevel(pNtk);
     Abc_NtkStartReverseLevels(pNtk, pPars->nGrowthLevel);
 
+    // start simulation signatures (random patterns may violate the one-hotness of the latches)
+    if (pPars->fResub && pPars->fUseSim && p->pCare == NULL && !pPars->fOneHotness) {
+        clk2 = Abc_Clock();
+        Abc_NtkMfsSimStart(p);
+        p->timeSim += Abc_Clock() - clk2;
+    }
+
     // compute don't-cares for each node
     nNodes = 0;
     p->nTotalNodesBeg = nTotalNodesBeg;
@@ -512,6 +524,7 @@ int Abc_NtkMfs(Abc_Ntk_t* pNtk, Mfs_Par_t* pPars) {
 #endif
     }
     Abc_NtkStopReverseLevels(pNtk);
+    Abc_NtkMfsSimStop(p);
 
     // perform the sweeping
     if (!pPars->fResub) {
@@ -41,6 +41,7 @@
 ABC_NAMESPACE_HEADER_START
 
 #    define MFS_FANIN_MAX 12
+#    define MFS_SIM_WORDS 8
 
 typedef struct Mfs_Man_t_ Mfs_Man_t;
 struct Mfs_Man_t_ {
@@ -64,6 +65,19 @@ struct Mfs_Man_t_ {
     int nCexes;           // the numbe rof current counter-examples
     int nSatCalls;
     int nSatCexes;
+    // simulation signatures of the network
+    Vec_Wrd_t* vSims;             // the signatures of the objects
+    Vec_Wrd_t* vSimsAlt;          // the signatures with the node complemented
+    Vec_Wrd_t* vSimsTemp;         // the signatures of the AIG nodes of one function
+    Vec_Wrd_t* vSimsPend;         // the pending patterns of the CIs
+    Vec_Vec_t* vSimLevels;        // the levelized nodes to be resimulated
+    word pSimCare[MFS_SIM_WORDS]; // the care patterns of the current node
+    int nSimPend;                 // the number of pending patterns
+    int nSimNodes;                // the number of nodes since the last resimulation
+    int iSimGuided;               // the number of resimulations
+    int nSimCexes;                // the number of counter-examples derived by simulation
+    int nSimRemoves;              // the number of fanin removals disproved by simulation
+    int nSimUpdates;              // the number of incremental updates
     /*
     // intermediate AIG data
     Gia_Man_t *         pGia;      // replica of the AIG in the new package
@@ -125,6 +139,7 @@ struct Mfs_Man_t_ {
     abctime timeGia;
     abctime timeCnf;
     abctime timeSat;
+    abctime timeSim;
     abctime timeInt;
     abctime timeTotal;
 };
@@ -159,6 +174,14 @@ extern int Abc_NtkMfsEdgeSwapEval(Mfs_Man_t* p, Abc_Obj_t* pNode);
 extern int Abc_NtkMfsEdgePower(Mfs_Man_t* p, Abc_Obj_t* pNode);
 extern int Abc_NtkMfsResubNode(Mfs_Man_t* p, Abc_Obj_t* pNode);
 extern int Abc_NtkMfsResubNode2(Mfs_Man_t* p, Abc_Obj_t* pNode);
+/*=== mfsSim.c ==========================================================*/
+extern void Abc_NtkMfsSimStart(Mfs_Man_t* p);
+extern void Abc_NtkMfsSimStop(Mfs_Man_t* p);
+extern void Abc_NtkMfsSimUpdate(Mfs_Man_t* p, Abc_Obj_t* pNode);
+extern void Abc_NtkMfsSimCare(Mfs_Man_t* p, Abc_Obj_t* pNode);
+extern int Abc_NtkMfsSimCexes(Mfs_Man_t* p, Abc_Obj_t* pNode, int iFanin, int iFanin2);
+extern void Abc_NtkMfsSimSaveCex(Mfs_Man_t* p);
+extern void Abc_NtkMfsSimFlush(Mfs_Man_t* p);
 /*=== mfsSat.c ==========================================================*/
 extern int Abc_NtkMfsSolveSat(Mfs_Man_t* p, Abc_Obj_t* pNode);
 extern int Abc_NtkAddOneHotness(Mfs_Man_t* p);
@@ -115,6 +115,10 @@ void Mfs_ManPrint(Mfs_Man_t* p) {
         printf("Resub  %6d out of %6d (%6.2f %%)   ", p->nResubs, p->nTryResubs, 100.0 * p->nResubs / Abc_MaxInt(1, p->nTryResubs));
         printf("\n");
 
+        if (p->pPars->fUseSim)
+            printf("Simulation:  Cexes  %6d   Removes disproved %6d   Updates %6d   Guided words %d\n",
+                   p->nSimCexes, p->nSimRemoves, p->nSimUpdates, p->iSimGuided);
+
         printf("Reduction:   ");
         printf("Nodes  %6d out of %6d (%6.2f %%)   ", p->nTotalNodesBeg - p->nTotalNodesEnd, p->nTotalNodesBeg, 100.0 * (p->nTotalNodesBeg - p->nTotalNodesEnd) / Abc_MaxInt(1, p->nTotalNodesBeg));
         printf("Edges  %6d out of %6d (%6.2f %%)   ", p->nTotalEdgesBeg - p->nTotalEdgesEnd, p->nTotalEdgesBeg, 100.0 * (p->nTotalEdgesBeg - p->nTotalEdgesEnd) / Abc_MaxInt(1, p->nTotalEdgesBeg));
@@ -143,6 +147,7 @@ void Mfs_ManPrint(Mfs_Man_t* p) {
     ABC_PRTP("Aig", p->timeAig, p->timeTotal);
     ABC_PRTP("Gia", p->timeGia, p->timeTotal);
     ABC_PRTP("Cnf", p->timeCnf, p->timeTotal);
+    ABC_PRTP("Sim", p->timeSim, p->timeTotal);
     ABC_PRTP("Sat", p->timeSat - p->timeInt, p->timeTotal);
     ABC_PRTP("Int", p->timeInt, p->timeTotal);
     ABC_PRTP("ALL", p->timeTotal, p->timeTotal);
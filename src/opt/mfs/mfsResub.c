@@ -54,6 +54,8 @@ void Abc_NtkMfsUpdateNetwork(Mfs_Man_t* p, Abc_Obj_t* pObj, Vec_Ptr_t* vMfsFanin
     //printf( "Inserting node " ); Abc_ObjPrint( stdout, pObjNew );
     // update the level of the node
     Abc_NtkUpdate(pObj, pObjNew, p->vLevels);
+    // update the simulation signatures
+    Abc_NtkMfsSimUpdate(p, pObjNew);
 }
 
 /**Function*************************************************************
@@ -127,6 +129,7 @@ p->timeGia += Abc_Clock() - clk;
     if (fVeryVerbose)
         printf("S ");
     p->nSatCexes++;
+    Abc_NtkMfsSimSaveCex(p);
     // store the counter-example
     Vec_IntForEachEntry(p->vProjVarsSat, iVar, i) {
         pData = (unsigned*)Vec_PtrEntry(p->vDivCexes, i);
@@ -183,7 +186,12 @@ int Abc_NtkMfsSolveSatResub(Mfs_Man_t* p, Abc_Obj_t* pNode, int iFanin, int fOnl
         iVar = Vec_PtrSize(p->vDivs) - Abc_ObjFaninNum(pNode) + i;
         pCands[nCands++] = toLitCond(Vec_IntEntry(p->vProjVarsSat, iVar), 1);
     }
-    RetValue = Abc_NtkMfsTryResubOnce(p, pCands, nCands);
+    // simulation may prove that the fanin cannot be removed
+    if (Abc_NtkMfsSimCexes(p, pNode, iFanin, -1)) {
+        p->nSimRemoves++;
+        RetValue = 0;
+    } else
+        RetValue = Abc_NtkMfsTryResubOnce(p, pCands, nCands);
     if (RetValue == -1)
         return 0;
     if (RetValue == 1) {
@@ -326,7 +334,11 @@ int Abc_NtkMfsSolveSatResub2(Mfs_Man_t* p, Abc_Obj_t* pNode, int iFanin, int iFa
         iVar = Vec_PtrSize(p->vDivs) - Abc_ObjFaninNum(pNode) + i;
         pCands[nCands++] = toLitCond(Vec_IntEntry(p->vProjVarsSat, iVar), 1);
     }
-    RetValue = Abc_NtkMfsTryResubOnce(p, pCands, nCands);
+    if (Abc_NtkMfsSimCexes(p, pNode, iFanin, iFanin2)) {
+        p->nSimRemoves++;
+        RetValue = 0;
+    } else
+        RetValue = Abc_NtkMfsTryResubOnce(p, pCands, nCands);
     if (RetValue == -1)
         return 0;
     if (RetValue == 1) {
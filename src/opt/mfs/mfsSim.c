@@ -0,0 +1,375 @@
+/**CFile****************************************************************
+
+  FileName    [mfsSim.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [The good old minimization with complete don't-cares.]
+
+  Synopsis    [Simulation signatures used to filter resubstitution candidates.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: mfsSim.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "mfsInt.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the first MFS_SIM_RAND words are random; the remaining ones
+// are filled with the input patterns of the SAT counter-examples
+#define MFS_SIM_RAND 4
+// the max number of counter-examples derived from simulation
+#define MFS_SIM_CEX_MAX 64
+// the max number of full resimulations per pass over the network
+#define MFS_SIM_FLUSH_MAX 32
+
+static inline word* Mfs_ObjSim(Mfs_Man_t* p, Abc_Obj_t* pObj) { return Vec_WrdEntryP(p->vSims, MFS_SIM_WORDS * Abc_ObjId(pObj)); }
+static inline word* Mfs_ObjSimAlt(Mfs_Man_t* p, Abc_Obj_t* pObj) { return Vec_WrdEntryP(p->vSimsAlt, MFS_SIM_WORDS * Abc_ObjId(pObj)); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the local function of the node.]
+
+  Description [Computes words iWord to iWord+nWords-1 of the node's
+  signature into pRes. If fAlt is set, the fanins marked with the current
+  traversal ID contribute their alternative signatures.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkMfsSimNode(Mfs_Man_t* p, Abc_Obj_t* pNode, word* pRes, int iWord, int nWords, int fAlt) {
+    Hop_Man_t* pMan = (Hop_Man_t*)pNode->pNtk->pManFunc;
+    Hop_Obj_t* pRoot = Hop_Regular((Hop_Obj_t*)pNode->pData);
+    Hop_Obj_t* pObj;
+    Abc_Obj_t* pFanin;
+    Vec_Ptr_t* vNodes;
+    word *pSim, *pSim0, *pSim1, Mask0, Mask1;
+    int i, w, fCompl = Hop_IsComplement((Hop_Obj_t*)pNode->pData);
+    if (Hop_ObjIsConst1(pRoot)) {
+        for (w = iWord; w < iWord + nWords; w++)
+            pRes[w] = fCompl ? 0 : ~(word)0;
+        return;
+    }
+    Abc_ObjForEachFanin(pNode, pFanin, i) {
+        pSim = (fAlt && Abc_NodeIsTravIdCurrent(pFanin)) ? Mfs_ObjSimAlt(p, pFanin) : Mfs_ObjSim(p, pFanin);
+        Hop_IthVar(pMan, i)->pData = pSim;
+    }
+    vNodes = Hop_ManDfsNode(pMan, pRoot);
+    Vec_WrdFillExtra(p->vSimsTemp, MFS_SIM_WORDS * Vec_PtrSize(vNodes), 0);
+    Vec_PtrForEachEntry(Hop_Obj_t*, vNodes, pObj, i) {
+        pSim = Vec_WrdEntryP(p->vSimsTemp, MFS_SIM_WORDS * i);
+        pSim0 = (word*)Hop_ObjFanin0(pObj)->pData;
+        pSim1 = (word*)Hop_ObjFanin1(pObj)->pData;
+        Mask0 = Hop_ObjFaninC0(pObj) ? ~(word)0 : 0;
+        Mask1 = Hop_ObjFaninC1(pObj) ? ~(word)0 : 0;
+        if (Hop_ObjIsExor(pObj))
+            for (w = iWord; w < iWord + nWords; w++)
+                pSim[w] = (pSim0[w] ^ Mask0) ^ (pSim1[w] ^ Mask1);
+        else
+            for (w = iWord; w < iWord + nWords; w++)
+                pSim[w] = (pSim0[w] ^ Mask0) & (pSim1[w] ^ Mask1);
+        pObj->pData = pSim;
+    }
+    pSim = (word*)pRoot->pData;
+    for (w = iWord; w < iWord + nWords; w++)
+        pRes[w] = fCompl ? ~pSim[w] : pSim[w];
+    Vec_PtrFree(vNodes);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resimulates the given words of all nodes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkMfsSimNetwork(Mfs_Man_t* p, int iWord, int nWords) {
+    Vec_Ptr_t* vNodes;
+    Abc_Obj_t* pObj;
+    int i;
+    vNodes = Abc_NtkDfs(p->pNtk, 1);
+    Vec_PtrForEachEntry(Abc_Obj_t*, vNodes, pObj, i)
+        Abc_NtkMfsSimNode(p, pObj, Mfs_ObjSim(p, pObj), iWord, nWords, 0);
+    Vec_PtrFree(vNodes);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts simulation signatures of the network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimStart(Mfs_Man_t* p) {
+    Abc_Obj_t* pObj;
+    int i, w;
+    assert(p->vSims == NULL);
+    p->vSims = Vec_WrdStart(MFS_SIM_WORDS * Abc_NtkObjNumMax(p->pNtk));
+    p->vSimsAlt = Vec_WrdStart(MFS_SIM_WORDS * Abc_NtkObjNumMax(p->pNtk));
+    p->vSimsTemp = Vec_WrdAlloc(MFS_SIM_WORDS * 100);
+    p->vSimsPend = Vec_WrdStart(Abc_NtkObjNumMax(p->pNtk));
+    p->vSimLevels = Vec_VecAlloc(100);
+    Abc_RandomW(1);
+    Abc_NtkForEachCi(p->pNtk, pObj, i) {
+        for (w = 0; w < MFS_SIM_WORDS; w++)
+            Mfs_ObjSim(p, pObj)[w] = Abc_RandomW(0);
+        Vec_WrdWriteEntry(p->vSimsPend, Abc_ObjId(pObj), Abc_RandomW(0));
+    }
+    Abc_NtkMfsSimNetwork(p, 0, MFS_SIM_WORDS);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops simulation signatures of the network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimStop(Mfs_Man_t* p) {
+    if (p->vSims == NULL)
+        return;
+    Vec_WrdFreeP(&p->vSims);
+    Vec_WrdFreeP(&p->vSimsAlt);
+    Vec_WrdFreeP(&p->vSimsTemp);
+    Vec_WrdFreeP(&p->vSimsPend);
+    Vec_VecFree(p->vSimLevels);
+    p->vSimLevels = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the signatures after the node is replaced.]
+
+  Description [Resimulates the new node and propagates the changes
+  level by level through its transitive fanout. Propagation stops at
+  the nodes whose signatures did not change.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimUpdate(Mfs_Man_t* p, Abc_Obj_t* pNode) {
+    Vec_Ptr_t* vLevel;
+    Abc_Obj_t *pObj, *pFanout;
+    word pTemp[MFS_SIM_WORDS];
+    int i, k, m;
+    if (p->vSims == NULL)
+        return;
+    Vec_WrdFillExtra(p->vSims, MFS_SIM_WORDS * Abc_NtkObjNumMax(p->pNtk), 0);
+    Vec_WrdFillExtra(p->vSimsAlt, MFS_SIM_WORDS * Abc_NtkObjNumMax(p->pNtk), 0);
+    Abc_NtkIncrementTravId(p->pNtk);
+    Vec_VecClear(p->vSimLevels);
+    Vec_VecPush(p->vSimLevels, pNode->Level, pNode);
+    Abc_NodeSetTravIdCurrent(pNode);
+    Vec_VecForEachLevelStart(p->vSimLevels, vLevel, i, (int)pNode->Level)
+        Vec_PtrForEachEntry(Abc_Obj_t*, vLevel, pObj, k) {
+        Abc_NtkMfsSimNode(p, pObj, pTemp, 0, MFS_SIM_WORDS, 0);
+        if (pObj != pNode && !memcmp(pTemp, Mfs_ObjSim(p, pObj), sizeof(word) * MFS_SIM_WORDS))
+            continue;
+        memcpy(Mfs_ObjSim(p, pObj), pTemp, sizeof(word) * MFS_SIM_WORDS);
+        Abc_ObjForEachFanout(pObj, pFanout, m) {
+            if (!Abc_ObjIsNode(pFanout) || Abc_NodeIsTravIdCurrent(pFanout))
+                continue;
+            Abc_NodeSetTravIdCurrent(pFanout);
+            assert(pFanout->Level > pObj->Level);
+            Vec_VecPush(p->vSimLevels, pFanout->Level, pFanout);
+        }
+    }
+    p->nSimUpdates++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the care patterns of the node in the window.]
+
+  Description [A pattern is care if complementing the node changes
+  at least one root of the window.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimCare(Mfs_Man_t* p, Abc_Obj_t* pNode) {
+    Abc_Obj_t *pObj, *pFanin;
+    word *pSim, *pAlt;
+    int i, k, w, fStart = 0;
+    if (p->vSims == NULL)
+        return;
+    // fold the pending patterns into the signatures before the window is used
+    if (++p->nSimNodes >= Abc_NtkNodeNum(p->pNtk) / MFS_SIM_FLUSH_MAX && p->nSimPend == 64) {
+        Abc_NtkMfsSimFlush(p);
+        p->nSimNodes = 0;
+    }
+    Abc_NtkIncrementTravId(p->pNtk);
+    Abc_NodeSetTravIdCurrent(pNode);
+    pSim = Mfs_ObjSim(p, pNode);
+    pAlt = Mfs_ObjSimAlt(p, pNode);
+    for (w = 0; w < MFS_SIM_WORDS; w++)
+        pAlt[w] = ~pSim[w];
+    Vec_PtrForEachEntry(Abc_Obj_t*, p->vNodes, pObj, i) {
+        if (pObj == pNode) {
+            fStart = 1;
+            continue;
+        }
+        if (!fStart)
+            continue;
+        Abc_ObjForEachFanin(pObj, pFanin, k) if (Abc_NodeIsTravIdCurrent(pFanin)) break;
+        if (k == Abc_ObjFaninNum(pObj))
+            continue;
+        Abc_NtkMfsSimNode(p, pObj, Mfs_ObjSimAlt(p, pObj), 0, MFS_SIM_WORDS, 1);
+        Abc_NodeSetTravIdCurrent(pObj);
+    }
+    memset(p->pSimCare, 0, sizeof(word) * MFS_SIM_WORDS);
+    Vec_PtrForEachEntry(Abc_Obj_t*, p->vRoots, pObj, i) {
+        if (!Abc_NodeIsTravIdCurrent(pObj))
+            continue;
+        pSim = Mfs_ObjSim(p, pObj);
+        pAlt = Mfs_ObjSimAlt(p, pObj);
+        for (w = 0; w < MFS_SIM_WORDS; w++)
+            p->pSimCare[w] |= pSim[w] ^ pAlt[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives counter-examples for the divisors using simulation.]
+
+  Description [Looks for pairs of care patterns, in which the node has
+  different values while the remaining fanins (all fanins except iFanin
+  and iFanin2) have the same values. Each pair is recorded in the same
+  way as a SAT counter-example. Returns the number of pairs found. If it
+  is not zero, the remaining fanins alone are not enough.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkMfsSimCexes(Mfs_Man_t* p, Abc_Obj_t* pNode, int iFanin, int iFanin2) {
+    int pLast[2][256];
+    Abc_Obj_t *pFanin, *pDiv;
+    word *pSimNode, *pSimDiv;
+    unsigned* pData;
+    int nCexMax = Abc_MaxInt(1, Abc_MinInt(MFS_SIM_CEX_MAX, p->pPars->nWinMax / 2));
+    int b, i, k, Key, Value, Prev, nCexes = 0;
+    assert(p->nCexes == 0);
+    if (p->vSims == NULL || Abc_ObjFaninNum(pNode) > 9)
+        return 0;
+    memset(pLast, 0xFF, sizeof(pLast));
+    pSimNode = Mfs_ObjSim(p, pNode);
+    for (b = 0; b < 64 * MFS_SIM_WORDS && nCexes < nCexMax; b++) {
+        if (!Abc_TtGetBit(p->pSimCare, b))
+            continue;
+        Key = 0;
+        Abc_ObjForEachFanin(pNode, pFanin, i) if (i != iFanin && i != iFanin2)
+            Key = (Key << 1) | Abc_TtGetBit(Mfs_ObjSim(p, pFanin), b);
+        Value = Abc_TtGetBit(pSimNode, b);
+        Prev = pLast[!Value][Key];
+        pLast[Value][Key] = b;
+        if (Prev == -1)
+            continue;
+        // the divisors that do not distinguish the two patterns are ruled out
+        Vec_PtrForEachEntry(Abc_Obj_t*, p->vDivs, pDiv, k) {
+            pSimDiv = Mfs_ObjSim(p, pDiv);
+            if (Abc_TtGetBit(pSimDiv, Prev) != Abc_TtGetBit(pSimDiv, b))
+                continue;
+            pData = (unsigned*)Vec_PtrEntry(p->vDivCexes, k);
+            assert(Abc_InfoHasBit(pData, p->nCexes));
+            Abc_InfoXorBit(pData, p->nCexes);
+        }
+        p->nCexes++;
+        nCexes++;
+    }
+    p->nSimCexes += nCexes;
+    return nCexes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the input patterns of the last SAT counter-example.]
+
+  Description [Both copies of the window inputs are saved as pending
+  patterns, which are later simulated in one of the non-random words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimSaveCex(Mfs_Man_t* p) {
+    Abc_Obj_t* pObj;
+    word* pPend;
+    int i, c, iVar;
+    if (p->vSims == NULL)
+        return;
+    for (c = 0; c < 2 && p->nSimPend < 64; c++, p->nSimPend++)
+        Vec_PtrForEachEntry(Abc_Obj_t*, p->vSupp, pObj, i) {
+            iVar = p->pCnf->pVarNums[Aig_ManCi(p->pAigWin, i)->Id];
+            if (iVar < 0)
+                continue;
+            pPend = Vec_WrdEntryP(p->vSimsPend, Abc_ObjId(pObj));
+            if (sat_solver_var_value(p->pSat, iVar + c * p->pCnf->nVars) != Abc_TtGetBit(pPend, p->nSimPend))
+                Abc_TtXorBit(pPend, p->nSimPend);
+        }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the pending patterns.]
+
+  Description [The pending patterns replace one of the non-random words
+  of the CI signatures, after which this word is resimulated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkMfsSimFlush(Mfs_Man_t* p) {
+    Abc_Obj_t* pObj;
+    int i, iWord = MFS_SIM_RAND + p->iSimGuided++ % (MFS_SIM_WORDS - MFS_SIM_RAND);
+    Abc_NtkForEachCi(p->pNtk, pObj, i) {
+        Mfs_ObjSim(p, pObj)[iWord] = Vec_WrdEntry(p->vSimsPend, Abc_ObjId(pObj));
+        Vec_WrdWriteEntry(p->vSimsPend, Abc_ObjId(pObj), Abc_RandomW(0));
+    }
+    Abc_NtkMfsSimNetwork(p, iWord, 1);
+    p->nSimPend = 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -40,6 +40,14 @@ ABC_NAMESPACE_HEADER_START
 
 #    define RWR_LIMIT 1048576 / 4 // ((1 << 20)
 
+// the subgraphs of each NPN class are stored as fixed-size records of RWR_SUB_SIZE entries:
+// the number of internal nodes, the root edge, and the two fanin edges of each internal node,
+// where the leaves are nodes 0-3 and the internal nodes follow in topological order
+#    define RWR_SUB_NODES 16                     // the max number of internal nodes in a record
+#    define RWR_SUB_SIZE (2 + 2 * RWR_SUB_NODES) // the number of entries in a record
+#    define RWR_SUB_CONST 0x8000                 // marks the root edge of the constant record
+#    define RWR_SUB_OR 0x8000                    // marks the first fanin edge of an OR node
+
 typedef struct Rwr_Man_t_ Rwr_Man_t;
 typedef struct Rwr_Node_t_ Rwr_Node_t;
 
@@ -58,6 +66,14 @@ struct Rwr_Man_t_ {
     Rwr_Node_t** pTable;      // the hash table of nodes by their canonical form
     Vec_Vec_t* vClasses;      // the nodes of the equivalence classes
     Extra_MmFixed_t* pMmNode; // memory for nodes and cuts
+    // subgraph records used for evaluation
+    int* pSubBegs;         // the first record of each class (the last entry is the number of records)
+    unsigned short* pSubs; // the records of all classes
+    int fSubsShared;       // the records belong to the shared image
+    int* pSubScores;       // the number of uses, added nodes, and gain of each record
+    void* pGraphCur;       // the graph of the record being evaluated (temporary)
+    void* pGraphBest;      // the graph of the best record (temporary)
+    int fUse5;             // rewrite 5-input cuts decomposable around a 4-input function
     // statistical variables
     int nTravIds;    // the counter of traversal IDs
     int nConsidered; // the number of nodes considered
@@ -123,10 +139,16 @@ static inline Rwr_Node_t* Rwr_NotCond(Rwr_Node_t* p, int c) { return (Rwr_Node_t
 
 /*=== rwrDec.c ========================================================*/
 extern void Rwr_ManPreprocess(Rwr_Man_t* p);
+extern unsigned Rwr_SubTruth(unsigned short* pSub);
+extern int Rwr_SubCheck(unsigned short* pSub);
 /*=== rwrEva.c ========================================================*/
 extern int Rwr_NodeRewrite(Rwr_Man_t* p, Cut_Man_t* pManCut, Abc_Obj_t* pNode, int fUpdateLevel, int fUseZeros, int fPlaceEnable);
 extern void Rwr_ScoresClean(Rwr_Man_t* p);
 extern void Rwr_ScoresReport(Rwr_Man_t* p);
+/*=== rwrImg.c ========================================================*/
+extern int Rwr_ImgWrite(char* pFileName);
+extern int Rwr_ImgReadNpn(unsigned short** puCanons, char** puPhases, char** puPerms, unsigned char** puMap);
+extern int Rwr_ImgReadSubs(int** ppSubBegs, unsigned short** ppSubs);
 /*=== rwrLib.c ========================================================*/
 extern void Rwr_ManPrecompute(Rwr_Man_t* p);
 extern Rwr_Node_t* Rwr_ManAddVar(Rwr_Man_t* p, unsigned uTruth, int fPrecompute);
@@ -135,6 +157,7 @@ extern int Rwr_ManNodeVolume(Rwr_Man_t* p, Rwr_Node_t* p0, Rwr_Node_t* p1);
 extern void Rwr_ManIncTravId(Rwr_Man_t* p);
 /*=== rwrMan.c ========================================================*/
 extern Rwr_Man_t* Rwr_ManStart(int fPrecompute);
+extern Rwr_Man_t* Rwr_ManStartLib(unsigned short* puCanons, char* pPhases, char* pPerms, unsigned char* pMap);
 extern void Rwr_ManStop(Rwr_Man_t* p);
 extern void Rwr_ManPrintStats(Rwr_Man_t* p);
 extern void Rwr_ManPrintStatsFile(Rwr_Man_t* p);
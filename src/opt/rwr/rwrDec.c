@@ -29,6 +29,7 @@ ABC_NAMESPACE_IMPL_START
 
 static Dec_Graph_t* Rwr_NodePreprocess(Rwr_Man_t* p, Rwr_Node_t* pNode);
 static Dec_Edge_t Rwr_TravCollect_rec(Rwr_Man_t* p, Rwr_Node_t* pNode, Dec_Graph_t* pGraph);
+static void Rwr_GraphToSub(Dec_Graph_t* pGraph, unsigned short* pSub);
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -38,7 +39,9 @@ static Dec_Edge_t Rwr_TravCollect_rec(Rwr_Man_t* p, Rwr_Node_t* pNode, Dec_Graph
 
   Synopsis    [Preprocesses computed library of subgraphs.]
 
-  Description []
+  Description [Derives the subgraph records of each class, which are
+  stored one after another in the order of classes, so that the subgraphs
+  matching a cut are scanned without following the pointers of the forest.]
                
   SideEffects []
 
@@ -48,10 +51,9 @@ static Dec_Edge_t Rwr_TravCollect_rec(Rwr_Man_t* p, Rwr_Node_t* pNode, Dec_Graph
 void Rwr_ManPreprocess(Rwr_Man_t* p) {
     Dec_Graph_t* pGraph;
     Rwr_Node_t* pNode;
-    int i, k;
+    unsigned short* pSub;
+    int i, k, nSubs = 0;
     // put the nodes into the structure
-    p->pMapInv = ABC_ALLOC(unsigned short, 222);
-    memset(p->pMapInv, 0, sizeof(unsigned short) * 222);
     p->vClasses = Vec_VecStart(222);
     for (i = 0; i < p->nFuncs; i++) {
         if (p->pTable[i] == NULL)
@@ -61,15 +63,103 @@ void Rwr_ManPreprocess(Rwr_Man_t* p) {
             assert(pNode->uTruth == p->pTable[i]->uTruth);
             assert(p->pMap[pNode->uTruth] < 222); // Guaranteed to be >=0 b/c unsigned
             Vec_VecPush(p->vClasses, p->pMap[pNode->uTruth], pNode);
-            p->pMapInv[p->pMap[pNode->uTruth]] = p->puCanons[pNode->uTruth];
+            nSubs++;
+        }
+    }
+    // compute decomposition forms for each node and store them as records
+    p->pSubBegs = ABC_ALLOC(int, 223);
+    p->pSubs = ABC_ALLOC(unsigned short, nSubs * RWR_SUB_SIZE);
+    p->pSubBegs[0] = nSubs = 0;
+    for (i = 0; i < 222; i++) {
+        Vec_PtrForEachEntry(Rwr_Node_t*, Vec_VecEntry(p->vClasses, i), pNode, k) {
+            pGraph = Rwr_NodePreprocess(p, pNode);
+            assert(pNode->uTruth == (Dec_GraphDeriveTruth(pGraph) & 0xFFFF));
+            pSub = p->pSubs + RWR_SUB_SIZE * nSubs++;
+            Rwr_GraphToSub(pGraph, pSub);
+            assert(Rwr_SubCheck(pSub) && pNode->uTruth == Rwr_SubTruth(pSub));
+            Dec_GraphFree(pGraph);
         }
+        p->pSubBegs[i + 1] = nSubs;
+    }
+    Vec_VecFree(p->vClasses);
+    p->vClasses = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stores the decomposition graph as a subgraph record.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rwr_GraphToSub(Dec_Graph_t* pGraph, unsigned short* pSub) {
+    Dec_Node_t* pNode;
+    int i;
+    memset(pSub, 0, sizeof(unsigned short) * RWR_SUB_SIZE);
+    if (Dec_GraphIsConst(pGraph)) {
+        pSub[1] = RWR_SUB_CONST | Dec_GraphIsComplement(pGraph);
+        return;
+    }
+    assert(Dec_GraphLeaveNum(pGraph) == 4 && Dec_GraphNodeNum(pGraph) <= RWR_SUB_NODES);
+    pSub[0] = Dec_GraphNodeNum(pGraph);
+    pSub[1] = Dec_EdgeToInt(pGraph->eRoot);
+    Dec_GraphForEachNode(pGraph, pNode, i) {
+        pSub[2 + 2 * (i - 4)] = Dec_EdgeToInt(pNode->eEdge0) | (pNode->fNodeOr ? RWR_SUB_OR : 0);
+        pSub[3 + 2 * (i - 4)] = Dec_EdgeToInt(pNode->eEdge1);
     }
-    // compute decomposition forms for each node and verify them
-    Vec_VecForEachEntry(Rwr_Node_t*, p->vClasses, pNode, i, k) {
-        pGraph = Rwr_NodePreprocess(p, pNode);
-        pNode->pNext = (Rwr_Node_t*)pGraph;
-        assert(pNode->uTruth == (Dec_GraphDeriveTruth(pGraph) & 0xFFFF));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the subgraph record.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Rwr_SubTruth(unsigned short* pSub) {
+    unsigned uTruths[4 + RWR_SUB_NODES] = {0xAAAA, 0xCCCC, 0xF0F0, 0xFF00};
+    unsigned Edge0, Edge1;
+    int i;
+    if (pSub[1] & RWR_SUB_CONST)
+        return (pSub[1] & 1) ? 0 : 0xFFFF;
+    for (i = 0; i < (int)pSub[0]; i++) {
+        Edge0 = pSub[2 + 2 * i] & ~RWR_SUB_OR;
+        Edge1 = pSub[3 + 2 * i];
+        uTruths[4 + i] = (uTruths[Edge0 >> 1] ^ ((Edge0 & 1) ? 0xFFFF : 0)) & (uTruths[Edge1 >> 1] ^ ((Edge1 & 1) ? 0xFFFF : 0));
     }
+    return uTruths[pSub[1] >> 1] ^ ((pSub[1] & 1) ? 0xFFFF : 0);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks that the subgraph record is well-formed.]
+
+  Description [Returns 1 if the nodes only point to the leaves and the
+  preceding nodes, which makes the record safe to evaluate.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Rwr_SubCheck(unsigned short* pSub) {
+    int i;
+    if (pSub[1] & RWR_SUB_CONST)
+        return pSub[0] == 0 && (pSub[1] & ~RWR_SUB_CONST) <= 1;
+    if (pSub[0] > RWR_SUB_NODES)
+        return 0;
+    for (i = 0; i < (int)pSub[0]; i++)
+        if (((pSub[2 + 2 * i] & ~RWR_SUB_OR) >> 1) >= 4 + i || (pSub[3 + 2 * i] >> 1) >= 4 + i)
+            return 0;
+    return (pSub[1] >> 1) < 4 + pSub[0];
 }
 
 /**Function*************************************************************
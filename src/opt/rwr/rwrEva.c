@@ -28,7 +28,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Dec_Graph_t* Rwr_CutEvaluate(Rwr_Man_t* p, Abc_Obj_t* pRoot, Cut_Cut_t* pCut, Vec_Ptr_t* vFaninsCur, int nNodesSaved, int LevelMax, int* pGainBest, int fPlaceEnable);
+static int Rwr_CutEvaluate(Rwr_Man_t* p, Abc_Obj_t* pRoot, unsigned uTruth, int Top, int nNodesSaved, int LevelMax, int* pGainBest, int fPlaceEnable);
+static void Rwr_CutDeriveGraph(Rwr_Man_t* p, Dec_Graph_t* pGraph, int iSub, int Top);
+static int Rwr_CutDecompose5(unsigned uTruth, int* piVar, unsigned* puTruthG);
 static int Rwr_CutIsBoolean(Abc_Obj_t* pObj, Vec_Ptr_t* vLeaves);
 static int Rwr_CutCountNumNodes(Abc_Obj_t* pObj, Cut_Cut_t* pCut);
 static int Rwr_NodeGetDepth_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vLeaves);
@@ -57,14 +59,15 @@ static int Rwr_NodeGetDepth_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vLeaves);
 ***********************************************************************/
 int Rwr_NodeRewrite(Rwr_Man_t* p, Cut_Man_t* pManCut, Abc_Obj_t* pNode, int fUpdateLevel, int fUseZeros, int fPlaceEnable) {
     int fVeryVerbose = 0;
-    Dec_Graph_t* pGraph;
+    Dec_Graph_t* pGraphCur = (Dec_Graph_t*)p->pGraphCur;
     Cut_Cut_t* pCut; //, * pTemp;
     Abc_Obj_t* pFanin;
     unsigned uPhase;
     unsigned uTruthBest = 0; // Suppress "might be used uninitialized"
     unsigned uTruth;
     char* pPerm;
-    int Required, nNodesSaved;
+    int Required, nNodesSaved, iSub, iVar, Top;
+    int iSubBest = -1, TopBest = -1;
     int nNodesSaveCur = -1; // Suppress "might be used uninitialized"
     int i, GainCur = -1, GainBest = -1;
     abctime clk, clk2; //, Counter;
@@ -89,29 +92,41 @@ int Rwr_NodeRewrite(Rwr_Man_t* p, Cut_Man_t* pManCut, Abc_Obj_t* pNode, int fUpd
     // go through the cuts
     clk = Abc_Clock();
     for (pCut = pCut->pNext; pCut; pCut = pCut->pNext) {
-        // consider only 4-input cuts
-        if (pCut->nLeaves < 4)
+        // consider only 4-input cuts and, if requested, the decomposable 5-input cuts
+        if (pCut->nLeaves < 4 || (pCut->nLeaves == 5 && !p->fUse5))
             continue;
         //            Cut_CutPrint( pCut, 0 ), printf( "\n" );
+        if (pCut->nLeaves == 5) {
+            Top = Rwr_CutDecompose5(*Cut_CutReadTruth(pCut), &iVar, &uTruth);
+            if (Top == -1)
+                continue;
+        } else
+            Top = -1, iVar = 4, uTruth = 0xFFFF & *Cut_CutReadTruth(pCut);
 
         // get the fanin permutation
-        uTruth = 0xFFFF & *Cut_CutReadTruth(pCut);
         pPerm = p->pPerms4[(int)p->pPerms[uTruth]];
         uPhase = p->pPhases[uTruth];
         // collect fanins with the corresponding permutation/phase
         Vec_PtrClear(p->vFaninsCur);
         Vec_PtrFill(p->vFaninsCur, (int)pCut->nLeaves, 0);
         for (i = 0; i < (int)pCut->nLeaves; i++) {
-            pFanin = Abc_NtkObj(pNode->pNtk, pCut->pLeaves[(int)pPerm[i]]);
+            if (i == 4) // the variable of the top gate
+                pFanin = Abc_NtkObj(pNode->pNtk, pCut->pLeaves[iVar]);
+            else // skip the variable of the top gate among the leaves of the 4-input function
+                pFanin = Abc_NtkObj(pNode->pNtk, pCut->pLeaves[(int)pPerm[i] + ((int)pPerm[i] >= iVar)]);
             if (pFanin == NULL)
                 break;
-            pFanin = Abc_ObjNotCond(pFanin, ((uPhase & (1 << i)) > 0));
+            if (i < 4)
+                pFanin = Abc_ObjNotCond(pFanin, ((uPhase & (1 << i)) > 0));
             Vec_PtrWriteEntry(p->vFaninsCur, i, pFanin);
         }
         if (i != (int)pCut->nLeaves) {
             p->nCutsBad++;
             continue;
         }
+        // the output phase of the 4-input function is absorbed by the top gate
+        if (Top != -1)
+            Top ^= ((uPhase & (1 << 4)) > 0) << 1;
         p->nCutsGood++;
 
         {
@@ -145,17 +160,22 @@ int Rwr_NodeRewrite(Rwr_Man_t* p, Cut_Man_t* pManCut, Abc_Obj_t* pNode, int fUpd
 
         // evaluate the cut
         clk2 = Abc_Clock();
-        pGraph = Rwr_CutEvaluate(p, pNode, pCut, p->vFaninsCur, nNodesSaved, Required, &GainCur, fPlaceEnable);
+        Vec_PtrForEachEntry(Abc_Obj_t*, p->vFaninsCur, pFanin, i)
+            Dec_GraphNode(pGraphCur, i)
+                ->pFunc
+            = pFanin;
+        iSub = Rwr_CutEvaluate(p, pNode, uTruth, Top, nNodesSaved, Required, &GainCur, fPlaceEnable);
         p->timeEval += Abc_Clock() - clk2;
 
         // check if the cut is better than the current best one
-        if (pGraph != NULL && GainBest < GainCur) {
+        if (iSub != -1 && GainBest < GainCur) {
             // save this form
             nNodesSaveCur = nNodesSaved;
             GainBest = GainCur;
-            p->pGraph = pGraph;
-            p->fCompl = ((uPhase & (1 << 4)) > 0);
-            uTruthBest = 0xFFFF & *Cut_CutReadTruth(pCut);
+            iSubBest = iSub;
+            TopBest = Top;
+            p->fCompl = Top == -1 && ((uPhase & (1 << 4)) > 0);
+            uTruthBest = uTruth;
             // collect fanins in the
             Vec_PtrClear(p->vFanins);
             Vec_PtrForEachEntry(Abc_Obj_t*, p->vFaninsCur, pFanin, i)
@@ -201,7 +221,9 @@ int Rwr_NodeRewrite(Rwr_Man_t* p, Cut_Man_t* pManCut, Abc_Obj_t* pNode, int fUpd
             printf( "." );
 */
 
-    // copy the leaves
+    // derive the best subgraph and copy the leaves
+    Rwr_CutDeriveGraph(p, (Dec_Graph_t*)p->pGraphBest, iSubBest, TopBest);
+    p->pGraph = p->pGraphBest;
     Vec_PtrForEachEntry(Abc_Obj_t*, p->vFanins, pFanin, i)
         Dec_GraphNode((Dec_Graph_t*)p->pGraph, i)
             ->pFunc
@@ -234,41 +256,133 @@ int Rwr_NodeRewrite(Rwr_Man_t* p, Cut_Man_t* pManCut, Abc_Obj_t* pNode, int fUpd
     return GainBest;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if the 5-input function is a gate of one variable and a 4-input function.]
+
+  Description [Returns -1 if there is no such variable. Otherwise, returns
+  the top gate, which is an AND (XOR if bit 0 is set) of the variable
+  (complemented if bit 2 is set) and the 4-input function (complemented if
+  bit 1 is set), complemented if bit 3 is set. The variable and the truth
+  table of the 4-input function over the remaining variables are returned
+  in the arguments.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Rwr_CutDecompose5(unsigned uTruth, int* piVar, unsigned* puTruthG) {
+    unsigned uCof0, uCof1;
+    int v, m, k;
+    for (v = 0; v < 5; v++) {
+        // compute the cofactors with respect to the variable
+        uCof0 = uCof1 = 0;
+        for (m = k = 0; m < 32; m++) {
+            if (m & (1 << v))
+                continue;
+            uCof0 |= ((uTruth >> m) & 1) << k;
+            uCof1 |= ((uTruth >> (m | (1 << v))) & 1) << k;
+            k++;
+        }
+        *piVar = v;
+        if (uCof0 == uCof1)
+            continue;
+        if (uCof0 == 0 && uCof1 != 0xFFFF) // v & g
+            return *puTruthG = uCof1, 0;
+        if (uCof1 == 0 && uCof0 != 0xFFFF) // ~v & g
+            return *puTruthG = uCof0, 4;
+        if (uCof0 == 0xFFFF && uCof1 != 0) // ~(v & ~g)
+            return *puTruthG = uCof1, 2 | 8;
+        if (uCof1 == 0xFFFF && uCof0 != 0) // ~(~v & ~g)
+            return *puTruthG = uCof0, 4 | 2 | 8;
+        if (uCof0 == (0xFFFF & ~uCof1)) // v ^ g
+            return *puTruthG = uCof0, 1;
+    }
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the decomposition graph of the subgraph record.]
+
+  Description [If the top gate is given, it is added to the record over
+  the last leaf of the graph.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rwr_CutDeriveGraph(Rwr_Man_t* p, Dec_Graph_t* pGraph, int iSub, int Top) {
+    unsigned short* pSub = p->pSubs + RWR_SUB_SIZE * iSub;
+    Dec_Node_t* pNode;
+    Dec_Edge_t eRoot;
+    int i, nLeaves = (Top == -1) ? 4 : 5;
+    pGraph->nLeaves = pGraph->nSize = nLeaves;
+    pGraph->fConst = (pSub[1] & RWR_SUB_CONST) > 0;
+    if (pGraph->fConst) {
+        assert(Top == -1);
+        pGraph->eRoot = Dec_EdgeCreate(0, pSub[1] & 1);
+        return;
+    }
+    // the internal nodes of the record follow the leaves
+    for (i = 0; i < (int)pSub[0]; i++) {
+        pNode = Dec_GraphAppendNode(pGraph);
+        pNode->eEdge0 = Dec_IntToEdge(pSub[2 + 2 * i] & ~RWR_SUB_OR);
+        pNode->eEdge1 = Dec_IntToEdge(pSub[3 + 2 * i]);
+        if (pNode->eEdge0.Node >= 4)
+            pNode->eEdge0.Node += nLeaves - 4;
+        if (pNode->eEdge1.Node >= 4)
+            pNode->eEdge1.Node += nLeaves - 4;
+        pNode->fNodeOr = (pSub[2 + 2 * i] & RWR_SUB_OR) > 0;
+        pNode->fCompl0 = pNode->eEdge0.fCompl ^ pNode->fNodeOr;
+        pNode->fCompl1 = pNode->eEdge1.fCompl ^ pNode->fNodeOr;
+    }
+    eRoot = Dec_IntToEdge(pSub[1]);
+    if (eRoot.Node >= 4)
+        eRoot.Node += nLeaves - 4;
+    if (Top != -1) {
+        eRoot.fCompl ^= (Top >> 1) & 1;
+        if (Top & 1)
+            eRoot = Dec_GraphAddNodeXor(pGraph, Dec_EdgeCreate(4, (Top >> 2) & 1), eRoot, 0);
+        else
+            eRoot = Dec_GraphAddNodeAnd(pGraph, Dec_EdgeCreate(4, (Top >> 2) & 1), eRoot);
+        eRoot.fCompl ^= (Top >> 3) & 1;
+    }
+    Dec_GraphSetRoot(pGraph, eRoot);
+}
+
 /**Function*************************************************************
 
   Synopsis    [Evaluates the cut.]
 
-  Description []
+  Description [Scans the subgraph records of the class of the 4-input
+  function. The leaves of the current graph should be set by the caller.
+  Returns the best record or -1 if no record can be used.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Dec_Graph_t* Rwr_CutEvaluate(Rwr_Man_t* p, Abc_Obj_t* pRoot, Cut_Cut_t* pCut, Vec_Ptr_t* vFaninsCur, int nNodesSaved, int LevelMax, int* pGainBest, int fPlaceEnable) {
+int Rwr_CutEvaluate(Rwr_Man_t* p, Abc_Obj_t* pRoot, unsigned uTruth, int Top, int nNodesSaved, int LevelMax, int* pGainBest, int fPlaceEnable) {
     extern int Dec_GraphToNetworkCount(Abc_Obj_t * pRoot, Dec_Graph_t * pGraph, int NodeMax, int LevelMax);
-    Vec_Ptr_t* vSubgraphs;
-    Dec_Graph_t* pGraphBest = NULL; // Suppress "might be used uninitialized"
-    Dec_Graph_t* pGraphCur;
-    Rwr_Node_t *pNode, *pFanin;
-    int nNodesAdded, GainBest, i, k;
-    unsigned uTruth;
+    Dec_Graph_t* pGraphCur = (Dec_Graph_t*)p->pGraphCur;
+    int nNodesAdded, GainBest, i, iClass;
+    int iSubBest = -1;
     float CostBest; //, CostCur;
     // find the matching class of subgraphs
-    uTruth = 0xFFFF & *Cut_CutReadTruth(pCut);
-    vSubgraphs = Vec_VecEntry(p->vClasses, p->pMap[uTruth]);
-    p->nSubgraphs += vSubgraphs->nSize;
+    iClass = p->pMap[uTruth];
+    p->nSubgraphs += p->pSubBegs[iClass + 1] - p->pSubBegs[iClass];
     // determine the best subgraph
     GainBest = -1;
     CostBest = ABC_INFINITY;
-    Vec_PtrForEachEntry(Rwr_Node_t*, vSubgraphs, pNode, i) {
+    for (i = p->pSubBegs[iClass]; i < p->pSubBegs[iClass + 1]; i++) {
         // get the current graph
-        pGraphCur = (Dec_Graph_t*)pNode->pNext;
-        // copy the leaves
-        Vec_PtrForEachEntry(Rwr_Node_t*, vFaninsCur, pFanin, k)
-            Dec_GraphNode(pGraphCur, k)
-                ->pFunc
-            = pFanin;
+        if (Top != -1 && (p->pSubs[RWR_SUB_SIZE * i + 1] & RWR_SUB_CONST))
+            continue;
+        Rwr_CutDeriveGraph(p, pGraphCur, i, Top);
         // detect how many unlabeled nodes will be reused
         nNodesAdded = Dec_GraphToNetworkCount(pRoot, pGraphCur, nNodesSaved, LevelMax);
         if (nNodesAdded == -1)
@@ -315,21 +429,21 @@ Dec_Graph_t* Rwr_CutEvaluate(Rwr_Man_t* p, Abc_Obj_t* pRoot, Cut_Cut_t* pCut, Ve
             // count the gain at this node
             if (GainBest < nNodesSaved - nNodesAdded) {
                 GainBest = nNodesSaved - nNodesAdded;
-                pGraphBest = pGraphCur;
+                iSubBest = i;
 
                 // score the graph
-                if (nNodesSaved - nNodesAdded > 0) {
-                    pNode->nScore++;
-                    pNode->nGain += GainBest;
-                    pNode->nAdded += nNodesAdded;
+                if (nNodesSaved - nNodesAdded > 0 && p->pSubScores) {
+                    p->pSubScores[3 * i + 0]++;
+                    p->pSubScores[3 * i + 1] += nNodesAdded;
+                    p->pSubScores[3 * i + 2] += GainBest;
                 }
             }
         }
     }
     if (GainBest == -1)
-        return NULL;
+        return -1;
     *pGainBest = GainBest;
-    return pGraphBest;
+    return iSubBest;
 }
 
 /**Function*************************************************************
@@ -480,15 +594,8 @@ int Rwr_NodeGetDepth_rec(Abc_Obj_t* pObj, Vec_Ptr_t* vLeaves) {
 
 ***********************************************************************/
 void Rwr_ScoresClean(Rwr_Man_t* p) {
-    Vec_Ptr_t* vSubgraphs;
-    Rwr_Node_t* pNode;
-    int i, k;
-    for (i = 0; i < p->vClasses->nSize; i++) {
-        vSubgraphs = Vec_VecEntry(p->vClasses, i);
-        Vec_PtrForEachEntry(Rwr_Node_t*, vSubgraphs, pNode, k)
-            pNode->nScore
-            = pNode->nGain = pNode->nAdded = 0;
-    }
+    ABC_FREE(p->pSubScores);
+    p->pSubScores = ABC_CALLOC(int, 3 * p->pSubBegs[222]);
 }
 
 static int Gains[222];
@@ -526,39 +633,38 @@ int Rwr_ScoresCompare(int* pNum1, int* pNum2) {
 void Rwr_ScoresReport(Rwr_Man_t* p) {
     extern void Ivy_TruthDsdComputePrint(unsigned uTruth);
     int Perm[222];
-    Vec_Ptr_t* vSubgraphs;
-    Rwr_Node_t* pNode;
+    int* pScores;
     int i, iNew, k;
     unsigned uTruth;
     // collect total gains
-    assert(p->vClasses->nSize == 222);
-    for (i = 0; i < p->vClasses->nSize; i++) {
+    if (p->pSubScores == NULL)
+        return;
+    for (i = 0; i < 222; i++) {
         Perm[i] = i;
         Gains[i] = 0;
-        vSubgraphs = Vec_VecEntry(p->vClasses, i);
-        Vec_PtrForEachEntry(Rwr_Node_t*, vSubgraphs, pNode, k)
-            Gains[i]
-            += pNode->nGain;
+        for (k = p->pSubBegs[i]; k < p->pSubBegs[i + 1]; k++)
+            Gains[i] += p->pSubScores[3 * k + 2];
     }
     // sort the gains
     qsort(Perm, (size_t)222, sizeof(int), (int (*)(const void*, const void*))Rwr_ScoresCompare);
 
     // print classes
-    for (i = 0; i < p->vClasses->nSize; i++) {
+    for (i = 0; i < 222; i++) {
         iNew = Perm[i];
         if (Gains[iNew] == 0)
             break;
-        vSubgraphs = Vec_VecEntry(p->vClasses, iNew);
-        printf("CLASS %3d: Subgr = %3d. Total gain = %6d.  ", iNew, Vec_PtrSize(vSubgraphs), Gains[iNew]);
+        printf("CLASS %3d: Subgr = %3d. Total gain = %6d.  ", iNew, p->pSubBegs[iNew + 1] - p->pSubBegs[iNew], Gains[iNew]);
         uTruth = (unsigned)p->pMapInv[iNew];
         Extra_PrintBinary(stdout, &uTruth, 16);
         printf("  ");
         Ivy_TruthDsdComputePrint((unsigned)p->pMapInv[iNew] | ((unsigned)p->pMapInv[iNew] << 16));
-        Vec_PtrForEachEntry(Rwr_Node_t*, vSubgraphs, pNode, k) {
-            if (pNode->nScore == 0)
+        for (k = p->pSubBegs[iNew]; k < p->pSubBegs[iNew + 1]; k++) {
+            pScores = p->pSubScores + 3 * k;
+            if (pScores[0] == 0)
                 continue;
-            printf("    %2d: S=%5d. A=%5d. G=%6d. ", k, pNode->nScore, pNode->nAdded, pNode->nGain);
-            Dec_GraphPrint(stdout, (Dec_Graph_t*)pNode->pNext, NULL, NULL);
+            printf("    %2d: S=%5d. A=%5d. G=%6d. ", k - p->pSubBegs[iNew], pScores[0], pScores[1], pScores[2]);
+            Rwr_CutDeriveGraph(p, (Dec_Graph_t*)p->pGraphBest, k, -1);
+            Dec_GraphPrint(stdout, (Dec_Graph_t*)p->pGraphBest, NULL, NULL);
         }
     }
 }
@@ -0,0 +1,388 @@
+/**CFile****************************************************************
+
+  FileName    [rwrImg.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting package.]
+
+  Synopsis    [Binary image of the rewriting library shared by processes.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: rwrImg.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "rwr.h"
+#include "base/main/main.h"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#    endif
+
+#endif
+
+#if defined(_MSC_VER)
+#    include <windows.h>
+#    define Rwr_MemoryBarrier() MemoryBarrier()
+#else
+#    define Rwr_MemoryBarrier() __sync_synchronize()
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+/*
+    The image contains the tables of 4-input NPN classes, which otherwise
+    take most of the startup time of the rewriting managers, and the
+    subgraph records of the classes, which are evaluated by rewriting
+    without building the forest of subgraphs. It is written once, in the
+    native byte order, and mapped read-only, so that all processes using
+    the same file share one copy in the page cache. The layout is:
+        header       Rwr_ImgHead_t
+        canons       unsigned short [nFuncs]
+        phases       char           [nFuncs]
+        perms        char           [nFuncs]
+        classes      unsigned char  [nFuncs]
+        class begs   int            [RWR_IMG_CLASSES + 1]
+        records      unsigned short [nSubs * nSubSize]
+    The image to use is given by "set rwrimage <file>". If the file does
+    not exist, it is created by the first process needing it. An existing
+    file that is not a valid image is never overwritten.
+*/
+
+#define RWR_IMG_MAGIC 0x34525752 // "RWR4"
+#define RWR_IMG_VERSION 3
+#define RWR_IMG_CLASSES 222 // the number of 4-input NPN classes
+
+typedef struct Rwr_ImgHead_t_ Rwr_ImgHead_t;
+struct Rwr_ImgHead_t_ {
+    int Magic;         // the magic number
+    int Version;       // the format version
+    int nFuncs;        // the number of 4-input functions
+    int nSubs;         // the number of subgraph records
+    int nSubSize;      // the size of one record
+    unsigned Checksum; // the checksum of the tables and records
+};
+
+typedef struct Rwr_Img_t_ Rwr_Img_t;
+struct Rwr_Img_t_ {
+    char* pData;              // the image
+    size_t nSize;             // the image size
+    int fMapped;              // the image is memory-mapped
+    unsigned short* puCanons; // canonical forms
+    char* pPhases;            // canonical phases
+    char* pPerms;             // canonical permutations
+    unsigned char* pMap;      // mapping of functions into class numbers
+    int* pSubBegs;            // the first record of each class
+    unsigned short* pSubs;    // the subgraph records
+};
+
+// the image is shared by all threads and frames and stays mapped until the process ends
+static Rwr_Img_t* s_pRwrImg = NULL;
+static char* s_pRwrImgFailed = NULL; // the last file that could not be used
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_RwrImgMutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static inline size_t Rwr_ImgSize(Rwr_ImgHead_t* pHead) {
+    return sizeof(Rwr_ImgHead_t) + (size_t)pHead->nFuncs * 5 + sizeof(int) * (RWR_IMG_CLASSES + 1) + sizeof(unsigned short) * (size_t)pHead->nSubs * pHead->nSubSize;
+}
+static inline unsigned Rwr_ImgChecksum(unsigned Checksum, unsigned char* pData, size_t nSize) {
+    size_t i;
+    for (i = 0; i < nSize; i++)
+        Checksum = (Checksum ^ pData[i]) * 16777619; // FNV-1a
+    return Checksum;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the image of the rewriting library.]
+
+  Description [The file is first written under a temporary name and then
+  renamed, so that concurrent processes never see a partial image.
+  The subgraph records are derived by a rewriting manager started for
+  the tables being written.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Rwr_ImgWrite(char* pFileName) {
+    Rwr_ImgHead_t Head;
+    Rwr_Man_t* pMan;
+    unsigned short* puCanons;
+    char *pPhases, *pPerms, *pFileTemp;
+    unsigned char* pMap;
+    FILE* pFile;
+    size_t nWritten = 0;
+    memset(&Head, 0, sizeof(Rwr_ImgHead_t));
+    Head.Magic = RWR_IMG_MAGIC;
+    Head.Version = RWR_IMG_VERSION;
+    Head.nFuncs = (1 << 16);
+    Head.nSubSize = RWR_SUB_SIZE;
+    pFileTemp = ABC_ALLOC(char, strlen(pFileName) + 20);
+#ifdef _WIN32
+    sprintf(pFileTemp, "%s.tmp", pFileName);
+#else
+    sprintf(pFileTemp, "%s.%d", pFileName, (int)getpid());
+#endif
+    pFile = fopen(pFileTemp, "wb");
+    if (pFile == NULL) {
+        ABC_FREE(pFileTemp);
+        return 0;
+    }
+    Extra_Truth4VarNPN(&puCanons, &pPhases, &pPerms, &pMap);
+    pMan = Rwr_ManStartLib(puCanons, pPhases, pPerms, pMap);
+    Head.nSubs = pMan->pSubBegs[RWR_IMG_CLASSES];
+    Head.Checksum = 2166136261u;
+    Head.Checksum = Rwr_ImgChecksum(Head.Checksum, (unsigned char*)puCanons, sizeof(unsigned short) * Head.nFuncs);
+    Head.Checksum = Rwr_ImgChecksum(Head.Checksum, (unsigned char*)pPhases, Head.nFuncs);
+    Head.Checksum = Rwr_ImgChecksum(Head.Checksum, (unsigned char*)pPerms, Head.nFuncs);
+    Head.Checksum = Rwr_ImgChecksum(Head.Checksum, pMap, Head.nFuncs);
+    Head.Checksum = Rwr_ImgChecksum(Head.Checksum, (unsigned char*)pMan->pSubBegs, sizeof(int) * (RWR_IMG_CLASSES + 1));
+    Head.Checksum = Rwr_ImgChecksum(Head.Checksum, (unsigned char*)pMan->pSubs, sizeof(unsigned short) * Head.nSubs * Head.nSubSize);
+    nWritten += fwrite(&Head, 1, sizeof(Rwr_ImgHead_t), pFile);
+    nWritten += fwrite(puCanons, 1, sizeof(unsigned short) * Head.nFuncs, pFile);
+    nWritten += fwrite(pPhases, 1, Head.nFuncs, pFile);
+    nWritten += fwrite(pPerms, 1, Head.nFuncs, pFile);
+    nWritten += fwrite(pMap, 1, Head.nFuncs, pFile);
+    nWritten += fwrite(pMan->pSubBegs, 1, sizeof(int) * (RWR_IMG_CLASSES + 1), pFile);
+    nWritten += fwrite(pMan->pSubs, 1, sizeof(unsigned short) * Head.nSubs * Head.nSubSize, pFile);
+    fclose(pFile);
+    Rwr_ManStop(pMan);
+    ABC_FREE(puCanons);
+    ABC_FREE(pPhases);
+    ABC_FREE(pPerms);
+    ABC_FREE(pMap);
+    if (nWritten != Rwr_ImgSize(&Head) || rename(pFileTemp, pFileName) != 0) {
+        remove(pFileTemp);
+        ABC_FREE(pFileTemp);
+        return 0;
+    }
+    ABC_FREE(pFileTemp);
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the image of the rewriting library.]
+
+  Description [Returns NULL if the file cannot be read or is not a valid
+  image. Besides the header and the checksum, the tables are checked to be
+  in range and consistent, because they are used as array indices, and
+  each subgraph record is checked to be well-formed and to implement a
+  function of its class. Without mmap(), the file is read into memory.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Rwr_Img_t* Rwr_ImgLoad(char* pFileName) {
+    Rwr_Img_t* p;
+    Rwr_ImgHead_t* pHead;
+    char* pData = NULL;
+    size_t nSize = 0;
+    int i, k, fMapped = 0;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open(pFileName, O_RDONLY);
+    if (fd == -1)
+        return NULL;
+    if (fstat(fd, &Stat) == 0 && Stat.st_size >= (off_t)sizeof(Rwr_ImgHead_t)) {
+        pData = (char*)mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (pData == (char*)MAP_FAILED)
+            pData = NULL;
+        else
+            nSize = (size_t)Stat.st_size, fMapped = 1;
+    }
+    close(fd);
+#else
+    FILE* pFile = fopen(pFileName, "rb");
+    if (pFile == NULL)
+        return NULL;
+    fseek(pFile, 0, SEEK_END);
+    nSize = (size_t)ftell(pFile);
+    rewind(pFile);
+    if (nSize >= sizeof(Rwr_ImgHead_t)) {
+        pData = ABC_ALLOC(char, nSize);
+        if (fread(pData, 1, nSize, pFile) != nSize)
+            ABC_FREE(pData);
+    }
+    fclose(pFile);
+#endif
+    if (pData == NULL)
+        return NULL;
+    p = ABC_CALLOC(Rwr_Img_t, 1);
+    p->pData = pData;
+    p->nSize = nSize;
+    p->fMapped = fMapped;
+    // check the header
+    pHead = (Rwr_ImgHead_t*)pData;
+    if (pHead->Magic != RWR_IMG_MAGIC || pHead->Version != RWR_IMG_VERSION || pHead->nFuncs != (1 << 16) || pHead->nSubSize != RWR_SUB_SIZE || pHead->nSubs < 0 || pHead->nSubs > RWR_LIMIT || Rwr_ImgSize(pHead) != nSize)
+        goto finish;
+    if (pHead->Checksum != Rwr_ImgChecksum(2166136261u, (unsigned char*)pData + sizeof(Rwr_ImgHead_t), nSize - sizeof(Rwr_ImgHead_t)))
+        goto finish;
+    p->puCanons = (unsigned short*)(pData + sizeof(Rwr_ImgHead_t));
+    p->pPhases = (char*)(p->puCanons + pHead->nFuncs);
+    p->pPerms = p->pPhases + pHead->nFuncs;
+    p->pMap = (unsigned char*)(p->pPerms + pHead->nFuncs);
+    p->pSubBegs = (int*)(p->pMap + pHead->nFuncs);
+    p->pSubs = (unsigned short*)(p->pSubBegs + RWR_IMG_CLASSES + 1);
+    // check the tables
+    for (i = 0; i < pHead->nFuncs; i++)
+        if (p->pMap[i] >= RWR_IMG_CLASSES || (unsigned char)p->pPhases[i] >= 32 || (unsigned char)p->pPerms[i] >= 24 || p->puCanons[p->puCanons[i]] != p->puCanons[i])
+            goto finish;
+    // check the records
+    if (p->pSubBegs[0] != 0 || p->pSubBegs[RWR_IMG_CLASSES] != pHead->nSubs)
+        goto finish;
+    for (i = 0; i < RWR_IMG_CLASSES; i++) {
+        if (p->pSubBegs[i] > p->pSubBegs[i + 1])
+            goto finish;
+        for (k = p->pSubBegs[i]; k < p->pSubBegs[i + 1]; k++)
+            if (!Rwr_SubCheck(p->pSubs + RWR_SUB_SIZE * k) || p->pMap[Rwr_SubTruth(p->pSubs + RWR_SUB_SIZE * k)] != i)
+                goto finish;
+    }
+    return p;
+finish:
+#ifndef _WIN32
+    munmap(pData, nSize);
+#else
+    ABC_FREE(pData);
+#endif
+    ABC_FREE(p);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the image given by the "rwrimage" flag.]
+
+  Description [Creates the image file if it does not exist. Returns NULL
+  if the flag is not set or the image cannot be used, in which case the
+  callers compute the tables themselves. The image is published only
+  after it is completely initialized, and the barriers keep the other
+  threads from seeing the pointer before the contents of the image.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Rwr_Img_t* Rwr_ImgShared() {
+    Rwr_Img_t* p = s_pRwrImg;
+    char* pFileName;
+    Rwr_MemoryBarrier();
+    if (p)
+        return p;
+    pFileName = Abc_FrameReadFlag("rwrimage");
+    if (pFileName == NULL)
+        return NULL;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock(&s_RwrImgMutex);
+#endif
+    p = s_pRwrImg;
+    if (p == NULL && (s_pRwrImgFailed == NULL || strcmp(s_pRwrImgFailed, pFileName))) {
+        FILE* pFile = fopen(pFileName, "rb");
+        if (pFile != NULL) {
+            fclose(pFile);
+            p = Rwr_ImgLoad(pFileName);
+            if (p == NULL)
+                Abc_Print(1, "File \"%s\" is not a valid rewriting library image and will not be overwritten.\n", pFileName);
+        } else if (Rwr_ImgWrite(pFileName)) {
+            p = Rwr_ImgLoad(pFileName);
+            if (p == NULL)
+                Abc_Print(1, "Cannot use the rewriting library image \"%s\".\n", pFileName);
+        } else
+            Abc_Print(1, "Cannot write the rewriting library image \"%s\".\n", pFileName);
+        if (p == NULL) {
+            ABC_FREE(s_pRwrImgFailed);
+            s_pRwrImgFailed = Abc_UtilStrsav(pFileName);
+        } else {
+            Rwr_MemoryBarrier();
+            s_pRwrImg = p;
+        }
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock(&s_RwrImgMutex);
+#endif
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the tables of 4-input NPN classes from the image.]
+
+  Description [Returns 0 if the image is not available, in which case the
+  tables should be computed by Extra_Truth4VarNPN(). Otherwise, the tables
+  point into the shared image and should be neither changed nor freed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Rwr_ImgReadNpn(unsigned short** puCanons, char** puPhases, char** puPerms, unsigned char** puMap) {
+    Rwr_Img_t* p = Rwr_ImgShared();
+    if (p == NULL)
+        return 0;
+    *puCanons = p->puCanons;
+    *puPhases = p->pPhases;
+    *puPerms = p->pPerms;
+    *puMap = p->pMap;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the subgraph records of the classes from the image.]
+
+  Description [Returns 0 if the image is not available. Otherwise, the
+  records point into the shared image and should be neither changed nor
+  freed. The records are indexed by the classes of the tables returned by
+  Rwr_ImgReadNpn().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Rwr_ImgReadSubs(int** ppSubBegs, unsigned short** ppSubs) {
+    Rwr_Img_t* p = Rwr_ImgShared();
+    if (p == NULL)
+        return 0;
+    *ppSubBegs = p->pSubBegs;
+    *ppSubs = p->pSubs;
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -28,13 +28,15 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+static Rwr_Man_t* Rwr_ManAlloc(unsigned short* puCanons, char* pPhases, char* pPerms, unsigned char* pMap, int fPrecompute);
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    [Starts rewriting manager.]
+  Synopsis    [Allocates rewriting manager for the given NPN tables.]
 
   Description []
                
@@ -43,19 +45,20 @@ ABC_NAMESPACE_IMPL_START
   SeeAlso     []
 
 ***********************************************************************/
-Rwr_Man_t* Rwr_ManStart(int fPrecompute) {
-    Dec_Man_t* pManDec;
+Rwr_Man_t* Rwr_ManAlloc(unsigned short* puCanons, char* pPhases, char* pPerms, unsigned char* pMap, int fPrecompute) {
     Rwr_Man_t* p;
-    abctime clk = Abc_Clock();
-    clk = Abc_Clock();
+    int i;
     p = ABC_ALLOC(Rwr_Man_t, 1);
     memset(p, 0, sizeof(Rwr_Man_t));
     p->nFuncs = (1 << 16);
-    pManDec = (Dec_Man_t*)Abc_FrameReadManDec();
-    p->puCanons = pManDec->puCanons;
-    p->pPhases = pManDec->pPhases;
-    p->pPerms = pManDec->pPerms;
-    p->pMap = pManDec->pMap;
+    p->puCanons = puCanons;
+    p->pPhases = pPhases;
+    p->pPerms = pPerms;
+    p->pMap = pMap;
+    // the canonical forms of the classes
+    p->pMapInv = ABC_CALLOC(unsigned short, 222);
+    for (i = 0; i < p->nFuncs; i++)
+        p->pMapInv[p->pMap[i]] = p->puCanons[i];
     // initialize practical NPN classes
     p->pPractical = Rwr_ManGetPractical(p);
     // create the table
@@ -77,10 +80,35 @@ Rwr_Man_t* Rwr_ManStart(int fPrecompute) {
     p->vFanins = Vec_PtrAlloc(50);
     p->vFaninsCur = Vec_PtrAlloc(50);
     p->vNodesTemp = Vec_PtrAlloc(50);
+    p->pGraphCur = Dec_GraphCreate(5);
+    p->pGraphBest = Dec_GraphCreate(5);
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts rewriting manager.]
+
+  Description [The subgraph records are taken from the shared image of
+  the library when it is available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Rwr_Man_t* Rwr_ManStart(int fPrecompute) {
+    Dec_Man_t* pManDec;
+    Rwr_Man_t* p;
+    abctime clk = Abc_Clock();
+    pManDec = (Dec_Man_t*)Abc_FrameReadManDec();
+    p = Rwr_ManAlloc(pManDec->puCanons, pManDec->pPhases, pManDec->pPerms, pManDec->pMap, fPrecompute);
     if (fPrecompute) { // precompute subgraphs
         Rwr_ManPrecompute(p);
         //        Rwr_ManPrint( p );
         Rwr_ManWriteToArray(p);
+    } else if (pManDec->fNpnShared && Rwr_ImgReadSubs(&p->pSubBegs, &p->pSubs)) { // use the shared subgraphs
+        p->fSubsShared = 1;
     } else { // load saved subgraphs
         Rwr_ManLoadFromArray(p, 0);
         //        Rwr_ManPrint( p );
@@ -90,6 +118,26 @@ Rwr_Man_t* Rwr_ManStart(int fPrecompute) {
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts rewriting manager for the given NPN tables.]
+
+  Description [Used to derive the subgraph records of the library image
+  before the tables of the framework are available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Rwr_Man_t* Rwr_ManStartLib(unsigned short* puCanons, char* pPhases, char* pPerms, unsigned char* pMap) {
+    Rwr_Man_t* p;
+    p = Rwr_ManAlloc(puCanons, pPhases, pPerms, pMap, 0);
+    Rwr_ManLoadFromArray(p, 0);
+    Rwr_ManPreprocess(p);
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Stops rewriting manager.]
@@ -102,13 +150,13 @@ Rwr_Man_t* Rwr_ManStart(int fPrecompute) {
 
 ***********************************************************************/
 void Rwr_ManStop(Rwr_Man_t* p) {
-    if (p->vClasses) {
-        Rwr_Node_t* pNode;
-        int i, k;
-        Vec_VecForEachEntry(Rwr_Node_t*, p->vClasses, pNode, i, k)
-            Dec_GraphFree((Dec_Graph_t*)pNode->pNext);
+    if (!p->fSubsShared) {
+        ABC_FREE(p->pSubBegs);
+        ABC_FREE(p->pSubs);
     }
-    if (p->vClasses) Vec_VecFree(p->vClasses);
+    ABC_FREE(p->pSubScores);
+    Dec_GraphFree((Dec_Graph_t*)p->pGraphCur);
+    Dec_GraphFree((Dec_Graph_t*)p->pGraphBest);
     Vec_PtrFree(p->vNodesTemp);
     Vec_PtrFree(p->vForest);
     Vec_IntFree(p->vLevNums);
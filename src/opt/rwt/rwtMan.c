@@ -20,6 +20,7 @@
 
 #include "rwt.h"
 #include "bool/deco/deco.h"
+#include "base/main/main.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,10 +28,11 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static unsigned short* s_puCanons = NULL;
-static char* s_pPhases = NULL;
-static char* s_pPerms = NULL;
-static unsigned char* s_pMap = NULL;
+static ABC_THREAD_LOCAL unsigned short* s_puCanons = NULL;
+static ABC_THREAD_LOCAL char* s_pPhases = NULL;
+static ABC_THREAD_LOCAL char* s_pPerms = NULL;
+static ABC_THREAD_LOCAL unsigned char* s_pMap = NULL;
+static ABC_THREAD_LOCAL int s_fNpnShared = 0;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -48,7 +50,10 @@ static unsigned char* s_pMap = NULL;
 
 ***********************************************************************/
 void Rwt_ManGlobalStart() {
-    if (s_puCanons == NULL)
+    if (s_puCanons != NULL)
+        return;
+    s_fNpnShared = Abc_FrameReadNpnImage(&s_puCanons, &s_pPhases, &s_pPerms, &s_pMap);
+    if (!s_fNpnShared)
         Extra_Truth4VarNPN(&s_puCanons, &s_pPhases, &s_pPerms, &s_pMap);
 }
 
@@ -64,6 +69,11 @@ void Rwt_ManGlobalStart() {
 
 ***********************************************************************/
 void Rwt_ManGlobalStop() {
+    if (s_fNpnShared) {
+        s_puCanons = NULL, s_pPhases = NULL, s_pPerms = NULL, s_pMap = NULL;
+        s_fNpnShared = 0;
+        return;
+    }
     ABC_FREE(s_puCanons);
     ABC_FREE(s_pPhases);
     ABC_FREE(s_pPerms);
@@ -46,6 +46,7 @@ struct Sbd_Par_t_ {
     int nWinSizeMax;  // maximum window size (windowing)
     int nBTLimit;     // maximum number of SAT conflicts
     int nWords;       // simulation word count
+    int nProcs;       // the number of threads
     int fMapping;     // generate mapping
     int fMoreCuts;    // use several cuts
     int fFindDivs;    // perform divisor search
@@ -22,6 +22,17 @@
 #include "opt/dau/dau.h"
 #include "misc/tim/tim.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -29,6 +40,8 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 #define SBD_MAX_LUTSIZE 6
+#define SBD_PAR_THR_MAX 100
+#define SBD_PAR_BATCH 256 // the max number of windows solved in one round
 
 typedef struct Sbd_Man_t_ Sbd_Man_t;
 struct Sbd_Man_t_ {
@@ -46,6 +59,7 @@ struct Sbd_Man_t_ {
     int nLuts[6];         // 0=const, 1=1lut, 2=2lut, 3=3lut
     int nTried;
     int nUsed;
+    int nWinSkips;        // windows skipped as too large
     abctime timeWin;
     abctime timeCut;
     abctime timeCov;
@@ -64,6 +78,9 @@ struct Sbd_Man_t_ {
     Vec_Int_t* vRoots;     // TFO root nodes
     Vec_Int_t* vWinObjs;   // TFI + Pivot + sideTFI + TFO (including roots)
     Vec_Int_t* vObj2Var;   // SAT variables for the window (indexes of objects in vWinObjs)
+    Vec_Int_t* vTravIds;   // traversal IDs of the window objects
+    Vec_Str_t* vMarks;     // marks of the pivot and its TFO
+    int nTravIds;          // the current traversal ID
     Vec_Int_t* vDivSet;    // divisor variables
     Vec_Int_t* vDivVars;   // divisor variables
     Vec_Int_t* vDivValues; // SAT variables values for the divisor variables
@@ -81,6 +98,16 @@ static inline word* Sbd_ObjSim1(Sbd_Man_t* p, int i) { return Vec_WrdEntryP(p->v
 static inline word* Sbd_ObjSim2(Sbd_Man_t* p, int i) { return Vec_WrdEntryP(p->vSims[2], p->pPars->nWords * i); }
 static inline word* Sbd_ObjSim3(Sbd_Man_t* p, int i) { return Vec_WrdEntryP(p->vSims[3], p->pPars->nWords * i); }
 
+static inline void Sbd_ManIncrementTravId(Sbd_Man_t* p) {
+    Vec_IntFillExtra(p->vTravIds, Gia_ManObjNum(p->pGia), 0);
+    Vec_StrFillExtra(p->vMarks, Gia_ManObjNum(p->pGia), 0);
+    p->nTravIds++;
+}
+static inline int Sbd_ObjIsTravIdCurrent(Sbd_Man_t* p, int i) { return Vec_IntEntry(p->vTravIds, i) == p->nTravIds; }
+static inline void Sbd_ObjSetTravIdCurrent(Sbd_Man_t* p, int i) { Vec_IntWriteEntry(p->vTravIds, i, p->nTravIds); }
+static inline int Sbd_ObjMark(Sbd_Man_t* p, int i) { return (int)Vec_StrEntry(p->vMarks, i); }
+static inline void Sbd_ObjSetMark(Sbd_Man_t* p, int i, int fMark) { Vec_StrWriteEntry(p->vMarks, i, (char)fMark); }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -107,6 +134,7 @@ void Sbd_ParSetDefault(Sbd_Par_t* pPars) {
     pPars->nWinSizeMax = 2000;                                    // maximum window size (windowing)
     pPars->nBTLimit = 0;                                          // maximum number of SAT conflicts
     pPars->nWords = 1;                                            // simulation word count
+    pPars->nProcs = 1;                                            // the number of threads
     pPars->fMapping = 1;                                          // generate mapping
     pPars->fMoreCuts = 0;                                         // use several cuts
     pPars->fFindDivs = 0;                                         // perform divisor search
@@ -209,6 +237,8 @@ Sbd_Man_t* Sbd_ManStart(Gia_Man_t* pGia, Sbd_Par_t* pPars) {
     p->vRoots = Vec_IntAlloc(100);
     p->vWinObjs = Vec_IntAlloc(Gia_ManObjNum(pGia));
     p->vObj2Var = Vec_IntStart(Gia_ManObjNum(pGia));
+    p->vTravIds = Vec_IntStart(Gia_ManObjNum(pGia));
+    p->vMarks = Vec_StrStart(Gia_ManObjNum(pGia));
     p->vDivSet = Vec_IntAlloc(100);
     p->vDivVars = Vec_IntAlloc(100);
     p->vDivValues = Vec_IntAlloc(100);
@@ -250,6 +280,8 @@ void Sbd_ManStop(Sbd_Man_t* p) {
     Vec_IntFree(p->vRoots);
     Vec_IntFree(p->vWinObjs);
     Vec_IntFree(p->vObj2Var);
+    Vec_IntFree(p->vTravIds);
+    Vec_StrFree(p->vMarks);
     Vec_IntFree(p->vDivSet);
     Vec_IntFree(p->vDivVars);
     Vec_IntFree(p->vDivValues);
@@ -367,25 +399,29 @@ void Sbd_ManUpdateOrder(Sbd_Man_t* p, int Pivot) {
     //    printf( "Node %4d :  Win = %5d.   Divs = %5d.    D1 = %5d.  D2 = %5d.\n",
     //        Pivot, Vec_IntSize(p->vWinObjs), Vec_IntSize(p->vDivVars), Vec_IntSize(p->vDivVars)-p->DivCutoff, p->DivCutoff );
 }
-void Sbd_ManWindowSim_rec(Sbd_Man_t* p, int NodeInit) {
+int Sbd_ManWindowSim_rec(Sbd_Man_t* p, int NodeInit, int nLimit) {
     Gia_Obj_t* pObj;
     int Node = NodeInit;
     if (Vec_IntEntry(p->vMirrors, Node) >= 0)
         Node = Abc_Lit2Var(Vec_IntEntry(p->vMirrors, Node));
-    if (Gia_ObjIsTravIdCurrentId(p->pGia, Node))
-        return;
-    Gia_ObjSetTravIdCurrentId(p->pGia, Node);
+    if (Sbd_ObjIsTravIdCurrent(p, Node))
+        return 1;
+    Sbd_ObjSetTravIdCurrent(p, Node);
     pObj = Gia_ManObj(p->pGia, Node);
     if (Gia_ObjIsAnd(pObj)) {
-        Sbd_ManWindowSim_rec(p, Gia_ObjFaninId0(pObj, Node));
-        Sbd_ManWindowSim_rec(p, Gia_ObjFaninId1(pObj, Node));
+        if (!Sbd_ManWindowSim_rec(p, Gia_ObjFaninId0(pObj, Node), nLimit))
+            return 0;
+        if (!Sbd_ManWindowSim_rec(p, Gia_ObjFaninId1(pObj, Node), nLimit))
+            return 0;
     }
-    if (!pObj->fMark0) {
+    if (!Sbd_ObjMark(p, Node)) {
         Vec_IntWriteEntry(p->vObj2Var, Node, Vec_IntSize(p->vWinObjs));
         Vec_IntPush(p->vWinObjs, Node);
+        if (nLimit && Vec_IntSize(p->vWinObjs) > nLimit)
+            return 0;
     }
     if (Gia_ObjIsCi(pObj))
-        return;
+        return 1;
     // simulate
     assert(Gia_ObjIsAnd(pObj));
     if (Gia_ObjIsXor(pObj)) {
@@ -395,10 +431,10 @@ void Sbd_ManWindowSim_rec(Sbd_Man_t* p, int NodeInit) {
                   p->pPars->nWords,
                   Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj));
 
-        if (pObj->fMark0)
+        if (Sbd_ObjMark(p, Node))
             Abc_TtXor(Sbd_ObjSim1(p, Node),
-                      Gia_ObjFanin0(pObj)->fMark0 ? Sbd_ObjSim1(p, Gia_ObjFaninId0(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId0(pObj, Node)),
-                      Gia_ObjFanin1(pObj)->fMark0 ? Sbd_ObjSim1(p, Gia_ObjFaninId1(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId1(pObj, Node)),
+                      Sbd_ObjMark(p, Gia_ObjFaninId0(pObj, Node)) ? Sbd_ObjSim1(p, Gia_ObjFaninId0(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId0(pObj, Node)),
+                      Sbd_ObjMark(p, Gia_ObjFaninId1(pObj, Node)) ? Sbd_ObjSim1(p, Gia_ObjFaninId1(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId1(pObj, Node)),
                       p->pPars->nWords,
                       Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj));
     } else {
@@ -407,14 +443,15 @@ void Sbd_ManWindowSim_rec(Sbd_Man_t* p, int NodeInit) {
                        Sbd_ObjSim0(p, Gia_ObjFaninId1(pObj, Node)), Gia_ObjFaninC1(pObj),
                        p->pPars->nWords);
 
-        if (pObj->fMark0)
+        if (Sbd_ObjMark(p, Node))
             Abc_TtAndCompl(Sbd_ObjSim1(p, Node),
-                           Gia_ObjFanin0(pObj)->fMark0 ? Sbd_ObjSim1(p, Gia_ObjFaninId0(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId0(pObj, Node)), Gia_ObjFaninC0(pObj),
-                           Gia_ObjFanin1(pObj)->fMark0 ? Sbd_ObjSim1(p, Gia_ObjFaninId1(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId1(pObj, Node)), Gia_ObjFaninC1(pObj),
+                           Sbd_ObjMark(p, Gia_ObjFaninId0(pObj, Node)) ? Sbd_ObjSim1(p, Gia_ObjFaninId0(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId0(pObj, Node)), Gia_ObjFaninC0(pObj),
+                           Sbd_ObjMark(p, Gia_ObjFaninId1(pObj, Node)) ? Sbd_ObjSim1(p, Gia_ObjFaninId1(pObj, Node)) : Sbd_ObjSim0(p, Gia_ObjFaninId1(pObj, Node)), Gia_ObjFaninC1(pObj),
                            p->pPars->nWords);
     }
     if (Node != NodeInit)
         Abc_TtCopy(Sbd_ObjSim0(p, NodeInit), Sbd_ObjSim0(p, Node), p->pPars->nWords, Abc_LitIsCompl(Vec_IntEntry(p->vMirrors, NodeInit)));
+    return 1;
 }
 int Sbd_ManWindow(Sbd_Man_t* p, int Pivot) {
     abctime clk = Abc_Clock();
@@ -427,10 +464,12 @@ int Sbd_ManWindow(Sbd_Man_t* p, int Pivot) {
     Vec_IntWriteEntry(p->vObj2Var, 0, Vec_IntSize(p->vWinObjs));
     Vec_IntPush(p->vWinObjs, 0);
     // simulate TFI cone
-    Gia_ManIncrementTravId(p->pGia);
-    Gia_ObjSetTravIdCurrentId(p->pGia, 0);
-    Sbd_ManWindowSim_rec(p, Pivot);
-    if (p->pPars->nWinSizeMax && Vec_IntSize(p->vWinObjs) > p->pPars->nWinSizeMax) {
+    Sbd_ManIncrementTravId(p);
+    Sbd_ObjSetTravIdCurrent(p, 0);
+    // stop as soon as the window is too large
+    // the unvisited nodes are resimulated when they are in a window again
+    if (!Sbd_ManWindowSim_rec(p, Pivot, p->pPars->nWinSizeMax)) {
+        p->nWinSkips++;
         p->timeWin += Abc_Clock() - clk;
         return 0;
     }
@@ -438,21 +477,21 @@ int Sbd_ManWindow(Sbd_Man_t* p, int Pivot) {
     assert(Vec_IntSize(p->vDivVars) == Vec_IntSize(p->vDivValues));
     assert(Vec_IntSize(p->vDivVars) < Vec_IntSize(p->vWinObjs));
     // simulate node
-    Gia_ManObj(p->pGia, Pivot)->fMark0 = 1;
+    Sbd_ObjSetMark(p, Pivot, 1);
     Abc_TtCopy(Sbd_ObjSim1(p, Pivot), Sbd_ObjSim0(p, Pivot), p->pPars->nWords, 1);
     // mark TFO and simulate extended TFI without adding TFO nodes
     Vec_IntClear(p->vRoots);
     Vec_IntForEachEntry(p->vTfo, Node, i) {
-        Gia_ManObj(p->pGia, Abc_Lit2Var(Node))->fMark0 = 1;
+        Sbd_ObjSetMark(p, Abc_Lit2Var(Node), 1);
         if (!Abc_LitIsCompl(Node))
             continue;
-        Sbd_ManWindowSim_rec(p, Abc_Lit2Var(Node));
+        Sbd_ManWindowSim_rec(p, Abc_Lit2Var(Node), 0);
         Vec_IntPush(p->vRoots, Abc_Lit2Var(Node));
     }
     // add TFO nodes and remove marks
-    Gia_ManObj(p->pGia, Pivot)->fMark0 = 0;
+    Sbd_ObjSetMark(p, Pivot, 0);
     Vec_IntForEachEntry(p->vTfo, Node, i) {
-        Gia_ManObj(p->pGia, Abc_Lit2Var(Node))->fMark0 = 0;
+        Sbd_ObjSetMark(p, Abc_Lit2Var(Node), 0);
         Vec_IntWriteEntry(p->vObj2Var, Abc_Lit2Var(Node), Vec_IntSize(p->vWinObjs));
         Vec_IntPush(p->vWinObjs, Abc_Lit2Var(Node));
     }
@@ -499,7 +538,6 @@ int Sbd_ManCheckConst(Sbd_Man_t* p, int Pivot) {
     if (p->pSat == NULL) {
         //if ( p->pPars->fVerbose )
         //    printf( "Found stuck-at-%d node %d.\n", 0, Pivot );
-        Vec_IntWriteEntry(p->vLutLevs, Pivot, 0);
         p->nLuts[0]++;
         return 0;
     }
@@ -556,7 +594,6 @@ int Sbd_ManCheckConst(Sbd_Man_t* p, int Pivot) {
     if (RetValue >= 0) {
         if (p->pPars->fVeryVerbose)
             printf("Found stuck-at-%d node %d.\n", RetValue, Pivot);
-        Vec_IntWriteEntry(p->vLutLevs, Pivot, 0);
         p->nLuts[0]++;
         return RetValue;
     }
@@ -1099,7 +1136,6 @@ int Sbd_ManExplore2(Sbd_Man_t* p, int Pivot, word* pTruth) {
     if (RetValue >= 0) {
         if (p->pPars->fVeryVerbose)
             printf("Found stuck-at-%d node %d.\n", RetValue, Pivot);
-        Vec_IntWriteEntry(p->vLutLevs, Pivot, 0);
         p->nLuts[0]++;
         return RetValue;
     }
@@ -1445,35 +1481,52 @@ int Sbd_ManExploreCut(Sbd_Man_t* p, int Pivot, int nLeaves, int* pLeaves, int* p
     }
     return RetValue;
 }
-int Sbd_ManExplore3(Sbd_Man_t* p, int Pivot, int* pnStrs, Sbd_Str_t* Strs) {
+int Sbd_ManExplore3(Sbd_Man_t* p, int Pivot, int nCuts, int pCuts[][SBD_DIV_MAX + 1], int* pnStrs, Sbd_Str_t* Strs) {
     int FreeVar = Vec_IntSize(p->vWinObjs) + Vec_IntSize(p->vTfo) + Vec_IntSize(p->vRoots);
     int FreeVarStart = FreeVar;
-    int nSize, nLeaves, pLeaves[SBD_DIV_MAX];
+    int i;
     //sat_solver_delete_p( &p->pSat );
     abctime clk = Abc_Clock();
     p->pSat = Sbd_ManSatSolver(p->pSat, p->pGia, p->vMirrors, Pivot, p->vWinObjs, p->vObj2Var, p->vTfo, p->vRoots, 0);
     p->timeCnf += Abc_Clock() - clk;
+    for (i = 0; i < nCuts; i++)
+        if (Sbd_ManExploreCut(p, Pivot, pCuts[i][0], pCuts[i] + 1, pnStrs, Strs, &FreeVar))
+            return 1;
+    assert(FreeVar - FreeVarStart <= SBD_FVAR_MAX);
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the cuts tried by Sbd_ManExplore3().]
+
+  Description [Each cut is stored as the leaf count followed by the leaves.
+  The cuts are collected right after the cuts of the node are computed,
+  because the cut enumerator keeps the cuts of the last node only.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sbd_ManCollectCuts(Sbd_Man_t* p, int Pivot, int pCuts[][SBD_DIV_MAX + 1]) {
+    int nSize, nCuts = 0;
     // extract one cut
     if (p->pSrv) {
-        nLeaves = Sbd_ManCutServerFirst(p->pSrv, Pivot, pLeaves);
-        if (nLeaves == -1)
-            return 0;
-        assert(nLeaves <= p->pPars->nCutSize);
-        if (Sbd_ManExploreCut(p, Pivot, nLeaves, pLeaves, pnStrs, Strs, &FreeVar))
-            return 1;
-        return 0;
+        pCuts[0][0] = Sbd_ManCutServerFirst(p->pSrv, Pivot, pCuts[0] + 1);
+        assert(pCuts[0][0] <= p->pPars->nCutSize);
+        return (int)(pCuts[0][0] >= 0);
     }
-    // extract one cut
+    // extract one cut of each size
     for (nSize = p->pPars->nLutSize + 1; nSize <= p->pPars->nCutSize; nSize++) {
-        nLeaves = Sbd_StoObjBestCut(p->pSto, Pivot, nSize, pLeaves);
-        if (nLeaves == -1)
+        pCuts[nCuts][0] = Sbd_StoObjBestCut(p->pSto, Pivot, nSize, pCuts[nCuts] + 1);
+        if (pCuts[nCuts][0] == -1)
             continue;
-        assert(nLeaves == nSize);
-        if (Sbd_ManExploreCut(p, Pivot, nLeaves, pLeaves, pnStrs, Strs, &FreeVar))
-            return 1;
+        assert(pCuts[nCuts][0] == nSize);
+        nCuts++;
     }
-    assert(FreeVar - FreeVarStart <= SBD_FVAR_MAX);
-    return 0;
+    assert(nCuts <= SBD_DIV_MAX);
+    return nCuts;
 }
 
 /**Function*************************************************************
@@ -1706,7 +1759,7 @@ int Sbd_ManImplement(Sbd_Man_t* p, int Pivot, word Truth) {
     return 0;
 }
 
-int Sbd_ManImplement2(Sbd_Man_t* p, int Pivot, int nStrs, Sbd_Str_t* pStrs) {
+int Sbd_ManImplement2(Sbd_Man_t* p, int Pivot, int nLeaves, int* pLeaves, int nStrs, Sbd_Str_t* pStrs) {
     //Gia_Obj_t * pObj = NULL;
     int i, k, w, iLit, Node;
     int iObjLast = Gia_ManObjNum(p->pGia);
@@ -1714,8 +1767,8 @@ int Sbd_ManImplement2(Sbd_Man_t* p, int Pivot, int nStrs, Sbd_Str_t* pStrs) {
     int iNewLev;
     // collect leaf literals
     Vec_IntClear(p->vLits);
-    Vec_IntForEachEntry(p->vDivSet, Node, i) {
-        Node = Vec_IntEntry(p->vWinObjs, Node);
+    for (i = 0; i < nLeaves; i++) {
+        Node = pLeaves[i];
         if (Vec_IntEntry(p->vMirrors, Node) >= 0)
             Vec_IntPush(p->vLits, Vec_IntEntry(p->vMirrors, Node));
         else
@@ -1747,7 +1800,7 @@ int Sbd_ManImplement2(Sbd_Man_t* p, int Pivot, int nStrs, Sbd_Str_t* pStrs) {
         assert(Vec_IntEntry(p->vLits, Vec_IntSize(p->vLits) - nStrs + i) == -1);
         Vec_IntWriteEntry(p->vLits, Vec_IntSize(p->vLits) - nStrs + i, iLit);
     }
-    iLit = Vec_IntEntry(p->vLits, Vec_IntSize(p->vDivSet));
+    iLit = Vec_IntEntry(p->vLits, nLeaves);
     //assert( iObjLast == Gia_ManObjNum(p->pGia) || Abc_Lit2Var(iLit) == Gia_ManObjNum(p->pGia)-1 );
     // remember this function
     assert(Vec_IntEntry(p->vMirrors, Pivot) == -1);
@@ -1918,51 +1971,503 @@ Gia_Man_t* Sbd_ManDerive(Sbd_Man_t* pMan, Gia_Man_t* p, Vec_Int_t* vMirrors) {
 
   Synopsis    [Performs delay optimization for the given LUT size.]
 
-  Description []
+  Description [Sbd_NtkSolveWindow() looks for a better implementation of
+  the node whose window is computed. It returns -1 if nothing is found,
+  the constant value if the node is constant, and 2 if the structures
+  are found (their inputs are the divisors in p->vDivSet). The cuts are
+  collected on demand if they are not given.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Sbd_NtkPerformOne(Sbd_Man_t* p, int Pivot) {
-    Sbd_Str_t Strs[SBD_DIV_MAX];
+int Sbd_NtkSolveWindow(Sbd_Man_t* p, int Pivot, int nCuts, int pCuts[][SBD_DIV_MAX + 1], int* pnStrs, Sbd_Str_t* Strs) {
+    int pCutsNew[SBD_DIV_MAX][SBD_DIV_MAX + 1];
     word Truth = 0;
-    int RetValue, nStrs = 0;
-    if (!p->pSto && Sbd_ManMergeCuts(p, Pivot))
-        return;
-    if (!Sbd_ManWindow(p, Pivot))
-        return;
+    int RetValue;
     //if ( Vec_IntSize(p->vWinObjs) > 100 )
     //    printf( "Obj %d : Win = %d   TFO = %d.  Roots = %d.\n", Pivot, Vec_IntSize(p->vWinObjs), Vec_IntSize(p->vTfo), Vec_IntSize(p->vRoots) );
     p->nTried++;
     p->nUsed++;
     RetValue = Sbd_ManCheckConst(p, Pivot);
     if (RetValue >= 0) {
-        Vec_IntWriteEntry(p->vMirrors, Pivot, RetValue);
         //if ( p->pPars->fVerbose ) printf( "Node %5d:  Detected constant %d.\n", Pivot, RetValue );
-    } else if (p->pPars->fFindDivs && p->pPars->nLutNum >= 1 && Sbd_ManExplore2(p, Pivot, &Truth)) {
+        return RetValue;
+    }
+    if (p->pPars->fFindDivs && p->pPars->nLutNum >= 1 && Sbd_ManExplore2(p, Pivot, &Truth)) {
         int i;
         Strs->fLut = 1;
         Strs->nVarIns = Vec_IntSize(p->vDivSet);
         for (i = 0; i < Strs->nVarIns; i++)
             Strs->VarIns[i] = i;
         Strs->Res = Truth;
-        Sbd_ManImplement2(p, Pivot, 1, Strs);
+        *pnStrs = 1;
         //if ( p->pPars->fVerbose ) printf( "Node %5d:  Detected LUT%d\n", Pivot, p->pPars->nLutSize );
-    } else if (p->pPars->nLutNum >= 2 && Sbd_ManExplore3(p, Pivot, &nStrs, Strs)) {
-        Sbd_ManImplement2(p, Pivot, nStrs, Strs);
-        if (!p->pPars->fVerbose)
-            return;
-        //if ( Vec_IntSize(p->vDivSet) <= 4 )
-        //    printf( "Node %5d:  Detected %d\n", Pivot, p->pPars->nLutSize );
-        //else if ( Vec_IntSize(p->vDivSet) <= 6 || (Vec_IntSize(p->vDivSet) == 7 && nStrs == 2) )
-        //    printf( "Node %5d:  Detected %d%d\n", Pivot, p->pPars->nLutSize, p->pPars->nLutSize );
-        //else
-        //    printf( "Node %5d:  Detected %d%d%d\n", Pivot, p->pPars->nLutSize, p->pPars->nLutSize, p->pPars->nLutSize );
-    } else
-        p->nUsed--;
+        return 2;
+    }
+    if (p->pPars->nLutNum >= 2) {
+        if (pCuts == NULL) {
+            pCuts = pCutsNew;
+            nCuts = Sbd_ManCollectCuts(p, Pivot, pCuts);
+        }
+        if (Sbd_ManExplore3(p, Pivot, nCuts, pCuts, pnStrs, Strs))
+            return 2;
+    }
+    p->nUsed--;
+    return -1;
+}
+int Sbd_ManCollectLeaves(Sbd_Man_t* p, int* pLeaves) {
+    int i, Var;
+    assert(Vec_IntSize(p->vDivSet) <= SBD_DIV_MAX);
+    Vec_IntForEachEntry(p->vDivSet, Var, i)
+        pLeaves[i] = Vec_IntEntry(p->vWinObjs, Var);
+    return Vec_IntSize(p->vDivSet);
+}
+void Sbd_NtkPerformOne(Sbd_Man_t* p, int Pivot) {
+    Sbd_Str_t Strs[SBD_DIV_MAX];
+    int pLeaves[SBD_DIV_MAX];
+    int RetValue, nLeaves, nStrs = 0;
+    if (!p->pSto && Sbd_ManMergeCuts(p, Pivot))
+        return;
+    if (!Sbd_ManWindow(p, Pivot))
+        return;
+    RetValue = Sbd_NtkSolveWindow(p, Pivot, 0, NULL, &nStrs, Strs);
+    if (RetValue == 0 || RetValue == 1) {
+        Vec_IntWriteEntry(p->vLutLevs, Pivot, 0);
+        Vec_IntWriteEntry(p->vMirrors, Pivot, RetValue);
+    } else if (RetValue == 2) {
+        nLeaves = Sbd_ManCollectLeaves(p, pLeaves);
+        Sbd_ManImplement2(p, Pivot, nLeaves, pLeaves, nStrs, Strs);
+    }
+}
+void Sbd_NtkPerformNodes(Sbd_Man_t* p, Vec_Bit_t* vPath, int nNodesOld) {
+    Gia_Obj_t* pObj;
+    int Pivot;
+    Sbd_StoComputeCutsConst0(p->pSto, 0);
+    Gia_ManForEachObj(p->pGia, pObj, Pivot) {
+        if (Pivot >= nNodesOld)
+            break;
+        if (Gia_ObjIsCi(pObj))
+            Sbd_StoComputeCutsCi(p->pSto, Pivot, 0, 0);
+        else if (Gia_ObjIsAnd(pObj)) {
+            abctime clk = Abc_Clock();
+            int Delay = Sbd_StoComputeCutsNode(p->pSto, Pivot);
+            Sbd_StoSaveBestDelayCut(p->pSto, Pivot, Sbd_ObjCut(p, Pivot));
+            p->timeCut += Abc_Clock() - clk;
+            Vec_IntWriteEntry(p->vLutLevs, Pivot, Delay);
+            if (Delay > 1 && (!vPath || Vec_BitEntry(vPath, Pivot)))
+                Sbd_NtkPerformOne(p, Pivot);
+        }
+        //if ( nNodesOld != Gia_ManObjNum(pGia) )
+        //    break;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the window manager of one thread.]
+
+  Description [The manager shares the AIG, the mirrors, the LUT levels and
+  the TFOs with the original one. It has its own simulation info, traversal
+  IDs, window buffers and SAT solver. It does not modify the shared data
+  and records the resynthesis instead of performing it. The cuts are given
+  with the jobs, so the manager has no cut enumerator.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sbd_Man_t* Sbd_ManStartThread(Sbd_Man_t* pMan, Sbd_Par_t* pPars) {
+    int i, Id;
+    Sbd_Man_t* p = ABC_CALLOC(Sbd_Man_t, 1);
+    p->pPars = pPars;
+    p->pGia = pMan->pGia;
+    // shared data
+    p->vTfos = pMan->vTfos;
+    p->vLutLevs = pMan->vLutLevs;
+    p->vLutCuts = pMan->vLutCuts;
+    p->vMirrors = pMan->vMirrors;
+    // private data
+    for (i = 0; i < 4; i++)
+        p->vSims[i] = Vec_WrdStart(Gia_ManObjNum(p->pGia) * p->pPars->nWords);
+    Gia_ManForEachCiId(p->pGia, Id, i)
+        Abc_TtCopy(Sbd_ObjSim0(p, Id), Sbd_ObjSim0(pMan, Id), p->pPars->nWords, 0);
+    p->vCover = Vec_IntAlloc(100);
+    p->vLits = Vec_IntAlloc(100);
+    p->vLits2 = Vec_IntAlloc(100);
+    p->vRoots = Vec_IntAlloc(100);
+    p->vWinObjs = Vec_IntAlloc(1000);
+    p->vObj2Var = Vec_IntStart(Gia_ManObjNum(p->pGia));
+    p->vTravIds = Vec_IntStart(Gia_ManObjNum(p->pGia));
+    p->vMarks = Vec_StrStart(Gia_ManObjNum(p->pGia));
+    p->vDivSet = Vec_IntAlloc(100);
+    p->vDivVars = Vec_IntAlloc(100);
+    p->vDivValues = Vec_IntAlloc(100);
+    p->vDivLevels = Vec_WecAlloc(100);
+    p->vCounts[0] = Vec_IntAlloc(100);
+    p->vCounts[1] = Vec_IntAlloc(100);
+    p->vMatrix = Vec_WrdAlloc(100);
+    return p;
+}
+void Sbd_ManStopThread(Sbd_Man_t* pMan, Sbd_Man_t* p) {
+    int i;
+    pMan->nTried += p->nTried;
+    pMan->nUsed += p->nUsed;
+    pMan->nWinSkips += p->nWinSkips;
+    for (i = 0; i < 6; i++)
+        pMan->nLuts[i] += p->nLuts[i];
+    pMan->timeWin = Abc_MaxWord(pMan->timeWin, p->timeWin);
+    pMan->timeCov = Abc_MaxWord(pMan->timeCov, p->timeCov);
+    pMan->timeCnf = Abc_MaxWord(pMan->timeCnf, p->timeCnf);
+    pMan->timeSat = Abc_MaxWord(pMan->timeSat, p->timeSat);
+    pMan->timeQbf = Abc_MaxWord(pMan->timeQbf, p->timeQbf);
+    for (i = 0; i < 4; i++)
+        Vec_WrdFree(p->vSims[i]);
+    Vec_IntFree(p->vCover);
+    Vec_IntFree(p->vLits);
+    Vec_IntFree(p->vLits2);
+    Vec_IntFree(p->vRoots);
+    Vec_IntFree(p->vWinObjs);
+    Vec_IntFree(p->vObj2Var);
+    Vec_IntFree(p->vTravIds);
+    Vec_StrFree(p->vMarks);
+    Vec_IntFree(p->vDivSet);
+    Vec_IntFree(p->vDivVars);
+    Vec_IntFree(p->vDivValues);
+    Vec_WecFree(p->vDivLevels);
+    Vec_IntFree(p->vCounts[0]);
+    Vec_IntFree(p->vCounts[1]);
+    Vec_WrdFree(p->vMatrix);
+    sat_solver_delete_p(&p->pSat);
+    ABC_FREE(p);
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Sbd_NtkPerformPar(Sbd_Man_t* p, Vec_Bit_t* vPath, int nNodesOld) {
+    Sbd_NtkPerformNodes(p, vPath, nNodesOld);
+}
+
+#else // pthreads are used
+
+// resynthesis of one node
+typedef struct Sbd_ParJob_t_ Sbd_ParJob_t;
+struct Sbd_ParJob_t_ {
+    int Pivot;                               // the node
+    int Status;                              // -2 = solve again, -1 = no change, 0/1 = constant, 2 = structures
+    int nCuts;                               // the number of cuts to try
+    int pCuts[SBD_DIV_MAX][SBD_DIV_MAX + 1]; // the cuts (the leaf count followed by the leaves)
+    int nLeaves;                             // the number of the structure inputs
+    int pLeaves[SBD_DIV_MAX];                // the structure inputs
+    int nStrs;                               // the number of structures
+    Sbd_Str_t Strs[SBD_DIV_MAX];             // the structures
+    Vec_Int_t* vCis;                         // the CIs whose patterns are changed
+    Vec_Wrd_t* vCiSims;                      // the new patterns of these CIs
+};
+
+// information given to the thread
+typedef struct Sbd_ParThData_t_ Sbd_ParThData_t;
+struct Sbd_ParThData_t_ {
+    Sbd_Man_t* p;          // the private window and SAT solving manager
+    Sbd_Man_t* pMan;       // the main manager
+    Sbd_Par_t Pars;        // the private copy of the parameters
+    Sbd_ParJob_t* pJobs;   // the jobs of the current round (NULL to quit)
+    int nJobs;             // the number of jobs in the current round
+    int iFirst;            // the first job of this thread
+    int nStep;             // the distance between the jobs of this thread
+    Vec_Int_t* vJobIds;    // the job of each node of the current round (-1 if none)
+    Vec_Int_t* vCiUpdate;  // the CIs whose patterns were changed in the last round
+    int fWorking;          // set while the jobs are being solved (protected by the mutex)
+    void* pMutex;          // the mutex shared with the main thread
+    void* pCondWork;       // signaled by the main thread when the jobs are given
+    void* pCondDone;       // signaled by the thread when the jobs are solved
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the jobs given to one thread.]
+
+  Description [The window of a job is solved only if it does not contain
+  the node of an earlier job of the round. Otherwise, the result may depend
+  on the earlier job, and the node is solved again in the next round. The
+  patterns added to the CIs are recorded in the job and removed from the
+  private simulation info, so that each job starts from the same patterns,
+  no matter how the jobs are distributed among the threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sbd_NtkParSolveJobs(Sbd_ParThData_t* pThData) {
+    Sbd_Man_t* p = pThData->p;
+    Sbd_Man_t* pMan = pThData->pMan;
+    Sbd_ParJob_t* pJob;
+    int nWords = p->pPars->nWords;
+    int i, k, w, iObj, iJob, fWindow, nWinSkips;
+    // extend the simulation info to the new nodes
+    for (k = 0; k < 4; k++)
+        Vec_WrdFillExtra(p->vSims[k], Gia_ManObjNum(p->pGia) * nWords, 0);
+    Vec_IntFillExtra(p->vObj2Var, Gia_ManObjNum(p->pGia), 0);
+    // update the patterns changed in the last round
+    Vec_IntForEachEntry(pThData->vCiUpdate, iObj, k)
+        Abc_TtCopy(Sbd_ObjSim0(p, iObj), Sbd_ObjSim0(pMan, iObj), nWords, 0);
+    for (i = pThData->iFirst; i < pThData->nJobs; i += pThData->nStep) {
+        pJob = pThData->pJobs + i;
+        Vec_IntClear(pJob->vCis);
+        Vec_WrdClear(pJob->vCiSims);
+        nWinSkips = p->nWinSkips;
+        fWindow = Sbd_ManWindow(p, pJob->Pivot);
+        Vec_IntForEachEntry(p->vWinObjs, iObj, k) {
+            iJob = iObj < Vec_IntSize(pThData->vJobIds) ? Vec_IntEntry(pThData->vJobIds, iObj) : -1;
+            if (iJob >= 0 && iJob < i)
+                break;
+        }
+        if (k < Vec_IntSize(p->vWinObjs)) {
+            p->nWinSkips = nWinSkips;
+            pJob->Status = -2;
+            continue;
+        }
+        pJob->Status = -1;
+        if (!fWindow)
+            continue;
+        Gia_ManRandom(1);
+        pJob->Status = Sbd_NtkSolveWindow(p, pJob->Pivot, pJob->nCuts, pJob->pCuts, &pJob->nStrs, pJob->Strs);
+        if (pJob->Status == 2)
+            pJob->nLeaves = Sbd_ManCollectLeaves(p, pJob->pLeaves);
+        // record the new patterns and restore the old ones
+        Vec_IntForEachEntry(p->vWinObjs, iObj, k) {
+            if (!Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) || Abc_TtEqual(Sbd_ObjSim0(p, iObj), Sbd_ObjSim0(pMan, iObj), nWords))
+                continue;
+            Vec_IntPush(pJob->vCis, iObj);
+            for (w = 0; w < nWords; w++)
+                Vec_WrdPush(pJob->vCiSims, Sbd_ObjSim0(p, iObj)[w]);
+            Abc_TtCopy(Sbd_ObjSim0(p, iObj), Sbd_ObjSim0(pMan, iObj), nWords, 0);
+        }
+    }
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Thread solving the jobs.]
+
+  Description [Sleeps until the main thread gives it the jobs of the next
+  round or asks it to quit.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Sbd_NtkParWorkerThread(void* pArg) {
+    Sbd_ParThData_t* pThData = (Sbd_ParThData_t*)pArg;
+    pthread_mutex_t* pMutex = (pthread_mutex_t*)pThData->pMutex;
+    int status;
+    while (1) {
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        while (!pThData->fWorking)
+            pthread_cond_wait((pthread_cond_t*)pThData->pCondWork, pMutex);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+        if (pThData->pJobs == NULL) {
+            pThData->p->timeTotal = Abc_Clock();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        Sbd_NtkParSolveJobs(pThData);
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        pThData->fWorking = 0;
+        pthread_cond_signal((pthread_cond_t*)pThData->pCondDone);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs delay optimization with several threads.]
+
+  Description [The nodes are visited by logic levels, so the nodes of one
+  round are not in the TFI of each other. The main thread computes the
+  cuts of the nodes and gives the windows of up to SBD_PAR_BATCH nodes to
+  the threads, which solve them on the unchanged AIG. The main thread then
+  implements the results in the order of the nodes. A window containing
+  the node of an earlier job is solved again in the next round, after the
+  cuts of its node are recomputed. The rounds do not depend on the number
+  of threads, so neither does the result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sbd_NtkPerformPar(Sbd_Man_t* p, Vec_Bit_t* vPath, int nNodesOld) {
+    Sbd_ParThData_t ThData[SBD_PAR_THR_MAX];
+    pthread_t WorkerThread[SBD_PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t CondWork, CondDone;
+    Sbd_ParJob_t* pJobs = ABC_CALLOC(Sbd_ParJob_t, SBD_PAR_BATCH);
+    Vec_Wec_t* vLevels = Vec_WecStart(Gia_ManLevelNum(p->pGia) + 1);
+    Vec_Int_t* vJobIds = Vec_IntStartFull(nNodesOld);
+    Vec_Int_t* vCiUpdate = Vec_IntAlloc(100);
+    Vec_Int_t* vRedo = Vec_IntAlloc(SBD_PAR_BATCH);
+    Vec_Int_t* vLevel;
+    Gia_Obj_t* pObj;
+    int nProcs = Abc_MinInt(p->pPars->nProcs, SBD_PAR_THR_MAX);
+    int nWords = p->pPars->nWords;
+    int i, k, c, Lev, iObj, Pivot, Delay, status, fWorkToDo, nJobs, nRounds = 0, nWindows = 0, iHead;
+    abctime clk = Abc_Clock(), clkThreads = 0;
+    for (i = 0; i < SBD_PAR_BATCH; i++) {
+        pJobs[i].vCis = Vec_IntAlloc(0);
+        pJobs[i].vCiSims = Vec_WrdAlloc(0);
+    }
+    // start the threads
+    pthread_mutex_init(&Mutex, NULL);
+    pthread_cond_init(&CondWork, NULL);
+    pthread_cond_init(&CondDone, NULL);
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].Pars = *p->pPars;
+        ThData[i].Pars.fVeryVerbose = 0;
+        ThData[i].p = Sbd_ManStartThread(p, &ThData[i].Pars);
+        ThData[i].pMan = p;
+        ThData[i].pJobs = pJobs;
+        ThData[i].nJobs = 0;
+        ThData[i].iFirst = i;
+        ThData[i].nStep = nProcs;
+        ThData[i].vJobIds = vJobIds;
+        ThData[i].vCiUpdate = vCiUpdate;
+        ThData[i].fWorking = 0;
+        ThData[i].pMutex = &Mutex;
+        ThData[i].pCondWork = &CondWork;
+        ThData[i].pCondDone = &CondDone;
+        status = pthread_create(WorkerThread + i, NULL, Sbd_NtkParWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    // order the nodes by logic levels
+    Sbd_StoComputeCutsConst0(p->pSto, 0);
+    Gia_ManForEachCi(p->pGia, pObj, i)
+        Sbd_StoComputeCutsCi(p->pSto, Gia_ObjId(p->pGia, pObj), 0, 0);
+    Gia_ManForEachAnd(p->pGia, pObj, i)
+        Vec_WecPush(vLevels, Gia_ObjLevel(p->pGia, pObj), i);
+    Vec_WecForEachLevel(vLevels, vLevel, Lev) {
+        for (iHead = 0; iHead < Vec_IntSize(vLevel);) {
+            // compute the cuts and collect the nodes to be solved
+            nRounds++;
+            for (nJobs = 0, k = iHead; k < Vec_IntSize(vLevel) && nJobs < SBD_PAR_BATCH; k++) {
+                abctime clk2 = Abc_Clock();
+                Pivot = Vec_IntEntry(vLevel, k);
+                Delay = Sbd_StoComputeCutsNode(p->pSto, Pivot);
+                Sbd_StoSaveBestDelayCut(p->pSto, Pivot, Sbd_ObjCut(p, Pivot));
+                p->timeCut += Abc_Clock() - clk2;
+                Vec_IntWriteEntry(p->vLutLevs, Pivot, Delay);
+                if (Delay <= 1 || (vPath && !Vec_BitEntry(vPath, Pivot)))
+                    continue;
+                pJobs[nJobs].Pivot = Pivot;
+                pJobs[nJobs].nCuts = p->pPars->nLutNum >= 2 ? Sbd_ManCollectCuts(p, Pivot, pJobs[nJobs].pCuts) : 0;
+                Vec_IntWriteEntry(vJobIds, Pivot, nJobs++);
+            }
+            if (nJobs == 0) {
+                iHead = k;
+                continue;
+            }
+            nWindows += nJobs;
+            // solve the windows
+            status = pthread_mutex_lock(&Mutex);
+            assert(status == 0);
+            for (i = 0; i < nProcs; i++) {
+                ThData[i].nJobs = nJobs;
+                ThData[i].fWorking = 1;
+            }
+            pthread_cond_broadcast(&CondWork);
+            for (fWorkToDo = 1; fWorkToDo;) {
+                for (fWorkToDo = i = 0; i < nProcs; i++)
+                    fWorkToDo |= ThData[i].fWorking;
+                if (fWorkToDo)
+                    pthread_cond_wait(&CondDone, &Mutex);
+            }
+            status = pthread_mutex_unlock(&Mutex);
+            assert(status == 0);
+            // implement the results in the order of the nodes
+            Vec_IntClear(vCiUpdate);
+            Vec_IntClear(vRedo);
+            for (i = 0; i < nJobs; i++) {
+                Sbd_ParJob_t* pJob = pJobs + i;
+                Vec_IntWriteEntry(vJobIds, pJob->Pivot, -1);
+                Vec_IntForEachEntry(pJob->vCis, iObj, c) {
+                    Abc_TtCopy(Sbd_ObjSim0(p, iObj), Vec_WrdEntryP(pJob->vCiSims, c * nWords), nWords, 0);
+                    Vec_IntPush(vCiUpdate, iObj);
+                }
+                if (pJob->Status == -2)
+                    Vec_IntPush(vRedo, pJob->Pivot);
+                else if (pJob->Status == 0 || pJob->Status == 1) {
+                    Vec_IntWriteEntry(p->vLutLevs, pJob->Pivot, 0);
+                    Vec_IntWriteEntry(p->vMirrors, pJob->Pivot, pJob->Status);
+                } else if (pJob->Status == 2)
+                    Sbd_ManImplement2(p, pJob->Pivot, pJob->nLeaves, pJob->pLeaves, pJob->nStrs, pJob->Strs);
+            }
+            // queue the nodes to be solved again
+            assert(k - iHead >= Vec_IntSize(vRedo));
+            iHead = k - Vec_IntSize(vRedo);
+            Vec_IntForEachEntry(vRedo, Pivot, i)
+                Vec_IntWriteEntry(vLevel, iHead + i, Pivot);
+        }
+    }
+    // stop the threads
+    status = pthread_mutex_lock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        ThData[i].pJobs = NULL;
+        ThData[i].fWorking = 1;
+    }
+    pthread_cond_broadcast(&CondWork);
+    status = pthread_mutex_unlock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        pthread_join(WorkerThread[i], NULL);
+        clkThreads = Abc_MaxWord(clkThreads, ThData[i].p->timeTotal);
+        Sbd_ManStopThread(p, ThData[i].p);
+    }
+    // the main thread sleeps while the threads work, so add the longest thread to its runtime
+    p->timeTotal -= clkThreads;
+    pthread_cond_destroy(&CondWork);
+    pthread_cond_destroy(&CondDone);
+    pthread_mutex_destroy(&Mutex);
+    if (p->pPars->fVerbose) {
+        printf("Parallel resynthesis with %d threads solved %d windows in %d rounds.  ", nProcs, nWindows, nRounds);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk + clkThreads);
+    }
+    for (i = 0; i < SBD_PAR_BATCH; i++) {
+        Vec_IntFree(pJobs[i].vCis);
+        Vec_WrdFree(pJobs[i].vCiSims);
+    }
+    ABC_FREE(pJobs);
+    Vec_WecFree(vLevels);
+    Vec_IntFree(vJobIds);
+    Vec_IntFree(vCiUpdate);
+    Vec_IntFree(vRedo);
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs delay optimization for the given LUT size.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 Gia_Man_t* Sbd_NtkPerform(Gia_Man_t* pGia, Sbd_Par_t* pPars) {
     Gia_Man_t* pNew;
     Gia_Obj_t* pObj;
@@ -2009,33 +2514,17 @@ Gia_Man_t* Sbd_NtkPerform(Gia_Man_t* pGia, Sbd_Par_t* pPars) {
         Tim_ManStop((Tim_Man_t*)pGia->pManTime);
         pGia->pManTime = pTimOld;
         Vec_IntFree(vNodes);
-    } else {
-        Sbd_StoComputeCutsConst0(p->pSto, 0);
-        Gia_ManForEachObj(pGia, pObj, Pivot) {
-            if (Pivot >= nNodesOld)
-                break;
-            if (Gia_ObjIsCi(pObj))
-                Sbd_StoComputeCutsCi(p->pSto, Pivot, 0, 0);
-            else if (Gia_ObjIsAnd(pObj)) {
-                abctime clk = Abc_Clock();
-                int Delay = Sbd_StoComputeCutsNode(p->pSto, Pivot);
-                Sbd_StoSaveBestDelayCut(p->pSto, Pivot, Sbd_ObjCut(p, Pivot));
-                p->timeCut += Abc_Clock() - clk;
-                Vec_IntWriteEntry(p->vLutLevs, Pivot, Delay);
-                if (Delay > 1 && (!vPath || Vec_BitEntry(vPath, Pivot)))
-                    Sbd_NtkPerformOne(p, Pivot);
-            }
-            //if ( nNodesOld != Gia_ManObjNum(pGia) )
-            //    break;
-        }
-    }
+    } else if (pPars->nProcs > 1)
+        Sbd_NtkPerformPar(p, vPath, nNodesOld);
+    else
+        Sbd_NtkPerformNodes(p, vPath, nNodesOld);
     Vec_BitFreeP(&vPath);
     p->timeTotal = Abc_Clock() - p->timeTotal;
     if (p->pPars->fVerbose) {
         printf("K = %d. S = %d. N = %d. P = %d.  ",
                p->pPars->nLutSize, p->pPars->nLutNum, p->pPars->nCutSize, p->pPars->nCutNum);
-        printf("Try = %d. Use = %d.  C = %d. 1 = %d. 2 = %d. 3a = %d. 3b = %d.  Lev = %d.  ",
-               p->nTried, p->nUsed, p->nLuts[0], p->nLuts[1], p->nLuts[2], p->nLuts[3], p->nLuts[4], Sbd_ManDelay(p));
+        printf("Try = %d. Use = %d. Big = %d.  C = %d. 1 = %d. 2 = %d. 3a = %d. 3b = %d.  Lev = %d.  ",
+               p->nTried, p->nUsed, p->nWinSkips, p->nLuts[0], p->nLuts[1], p->nLuts[2], p->nLuts[3], p->nLuts[4], Sbd_ManDelay(p));
         Abc_PrintTime(1, "Time", p->timeTotal);
     }
     pNew = Sbd_ManDerive(p, pGia, p->vMirrors);
@@ -648,6 +648,7 @@ void Sbd_StoComputeCutsObj(Sbd_Sto_t* p, int iObj, int Delay, int Level) {
     if (iObj < Vec_IntSize(p->vDelays)) {
         Vec_IntWriteEntry(p->vDelays, iObj, Delay);
         Vec_IntWriteEntry(p->vLevels, iObj, Level);
+        Vec_IntClear(Vec_WecEntry(p->vCuts, iObj)); // the cuts may be recomputed
     } else {
         assert(iObj == Vec_IntSize(p->vDelays));
         assert(iObj == Vec_IntSize(p->vLevels));
@@ -200,6 +200,12 @@ finish:
         p->nResubs++;
     if (fSkipUpdate)
         return 0;
+    if (p->fDelayUpdate) {
+        p->iUpdFanin = f;
+        p->iUpdDivisor = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->uUpdTruth = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate(p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth);
     return 1;
@@ -258,17 +264,26 @@ int Sfm_NodeResubOne(Sfm_Ntk_t* p, int iNode) {
     p->nImproves++;
     if (fSkipUpdate)
         return 0;
+    if (p->fDelayUpdate) {
+        p->iUpdFanin = -1;
+        p->iUpdDivisor = -1;
+        p->uUpdTruth = uTruth;
+        return 1;
+    }
     // update truth table
     Vec_WrdWriteEntry(p->vTruths, iNode, uTruth);
     Sfm_TruthToCnf(uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t*)Vec_WecEntry(p->vCnfs, iNode));
     return 1;
 }
 int Sfm_NodeResub(Sfm_Ntk_t* p, int iNode) {
-    int i, iFanin;
     p->nNodesTried++;
     // prepare SAT solver
     if (!Sfm_NtkCreateWindow(p, iNode, p->pPars->fVeryVerbose))
         return 0;
+    return Sfm_NodeResubWindow(p, iNode);
+}
+int Sfm_NodeResubWindow(Sfm_Ntk_t* p, int iNode) {
+    int i, iFanin;
     if (!Sfm_NtkWindowToSolver(p))
         return 0;
     // try replacing area critical fanins
@@ -324,6 +339,37 @@ void Sfm_NtkPrint(Sfm_Ntk_t* p) {
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for the nodes in a topological order.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformNodes(Sfm_Ntk_t* p) {
+    int i, k, Counter = 0;
+    Sfm_NtkForEachNode(p, i) {
+        if (Sfm_ObjIsFixed(p, i))
+            continue;
+        if (p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax)
+            continue;
+        if (Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6)
+            continue;
+        for (k = 0; Sfm_NodeResub(p, i); k++) {
+            //            Counter++;
+            //            break;
+        }
+        Counter += (k > 0);
+        if (p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax)
+            break;
+    }
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -336,7 +382,7 @@ void Sfm_NtkPrint(Sfm_Ntk_t* p) {
 
 ***********************************************************************/
 int Sfm_NtkPerform(Sfm_Ntk_t* p, Sfm_Par_t* pPars) {
-    int i, k, Counter = 0;
+    int Counter;
     //Sfm_NtkPrint( p );
     p->timeTotal = Abc_Clock();
     if (pPars->fVerbose) {
@@ -351,21 +397,10 @@ int Sfm_NtkPerform(Sfm_Ntk_t* p, Sfm_Par_t* pPars) {
     //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits(&p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p));
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    Sfm_NtkForEachNode(p, i) {
-        if (Sfm_ObjIsFixed(p, i))
-            continue;
-        if (p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax)
-            continue;
-        if (Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6)
-            continue;
-        for (k = 0; Sfm_NodeResub(p, i); k++) {
-            //            Counter++;
-            //            break;
-        }
-        Counter += (k > 0);
-        if (pPars->nNodesMax && Counter >= pPars->nNodesMax)
-            break;
-    }
+    if (pPars->nProcs > 1)
+        Counter = Sfm_NtkPerformPar(p);
+    else
+        Counter = Sfm_NtkPerformNodes(p);
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits(&p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p));
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
     p->timeTotal = Abc_Clock() - p->timeTotal;
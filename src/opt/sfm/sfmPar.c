@@ -0,0 +1,549 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Resubstitution with several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SFM_PAR_THR_MAX 100
+#define SFM_PAR_BATCH 256   // the max number of windows solved in one round
+#define SFM_PAR_LOOK 4096   // the max number of queued nodes visited in one round
+
+// resubstitution of one node
+typedef struct Sfm_ParJob_t_ Sfm_ParJob_t;
+struct Sfm_ParJob_t_ {
+    int iNode;         // the node
+    int iPos;          // the position of the node in the queue
+    int fWindow;       // set if the window is computed
+    int nDivs;         // the number of divisors of the window
+    int nMaxDivs;      // the number of times the divisors of the window reached the limit
+    Vec_Int_t* vDivs;  // the divisors of the window
+    Vec_Int_t* vRoots; // the roots of the window
+    Vec_Int_t* vTfo;   // the TFO of the node in the window
+    Vec_Int_t* vOrder; // the objects of the window in a topological order
+    int iFanin;        // the fanin to replace (-1 if only the function changes; -2 if no change)
+    int iDiv;          // the new fanin (-1 if the fanin is removed)
+    word uTruth;       // the new function of the node
+};
+
+// information given to the thread
+typedef struct Sfm_ParThData_t_ Sfm_ParThData_t;
+struct Sfm_ParThData_t_ {
+    Sfm_Ntk_t* p;        // the private window and SAT solving manager
+    Sfm_Par_t Pars;      // the private copy of the parameters
+    Sfm_ParJob_t* pJobs; // the jobs of the current phase (NULL to quit)
+    int nJobs;           // the number of jobs in the current phase
+    int fSolve;          // set if the windows are solved rather than computed
+    int iFirst;          // the first job of this thread
+    int nStep;           // the distance between the jobs of this thread
+    int fWorking;        // set while the jobs are being solved (protected by the mutex)
+    void* pMutex;        // the mutex shared by the threads
+    void* pCondWork;     // signals the threads that the jobs are ready
+    void* pCondDone;     // signals the main thread that the jobs are done
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+int Sfm_NtkPerformPar(Sfm_Ntk_t* p) {
+    return Sfm_NtkPerformNodes(p);
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the window manager of one thread.]
+
+  Description [The manager shares the network with the original one and
+  has its own traversal IDs, SAT variable maps, window buffers and SAT
+  solver. It does not modify the network and records the resubstitution
+  instead of performing it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Sfm_Ntk_t* Sfm_NtkCreateThread(Sfm_Ntk_t* pNtk, Sfm_Par_t* pPars) {
+    Sfm_Ntk_t* p = ABC_CALLOC(Sfm_Ntk_t, 1);
+    p->pPars = pPars;
+    p->nObjs = pNtk->nObjs;
+    p->nPis = pNtk->nPis;
+    p->nPos = pNtk->nPos;
+    p->nNodes = pNtk->nNodes;
+    // shared data
+    p->vFixed = pNtk->vFixed;
+    p->vEmpty = pNtk->vEmpty;
+    p->vTruths = pNtk->vTruths;
+    p->vFanins = pNtk->vFanins;
+    p->vStarts = pNtk->vStarts;
+    p->vTruths2 = pNtk->vTruths2;
+    p->vFanouts = pNtk->vFanouts;
+    p->vLevels = pNtk->vLevels;
+    p->vLevelsR = pNtk->vLevelsR;
+    p->vCnfs = pNtk->vCnfs;
+    // private data
+    Vec_IntFill(&p->vCounts, p->nObjs, 0);
+    Vec_IntFill(&p->vTravIds, p->nObjs, 0);
+    Vec_IntFill(&p->vTravIds2, p->nObjs, 0);
+    Vec_IntFill(&p->vId2Var, 2 * p->nObjs, -1);
+    Vec_IntFill(&p->vVar2Id, 2 * p->nObjs, -1);
+    p->vCover = Vec_IntAlloc(1 << 16);
+    p->fDelayUpdate = 1;
+    Sfm_NtkPrepare(p);
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the manager of one thread and collects the statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkStopThread(Sfm_Ntk_t* pNtk, Sfm_Ntk_t* p) {
+    pNtk->nNodesTried += p->nNodesTried;
+    pNtk->nTotalDivs += p->nTotalDivs;
+    pNtk->nSatCalls += p->nSatCalls;
+    pNtk->nTimeOuts += p->nTimeOuts;
+    pNtk->nMaxDivs += p->nMaxDivs;
+    pNtk->nTryRemoves += p->nTryRemoves;
+    pNtk->nTryImproves += p->nTryImproves;
+    pNtk->nTryResubs += p->nTryResubs;
+    pNtk->nRemoves += p->nRemoves;
+    pNtk->nImproves += p->nImproves;
+    pNtk->nResubs += p->nResubs;
+    pNtk->timeWin = Abc_MaxWord(pNtk->timeWin, p->timeWin);
+    pNtk->timeDiv = Abc_MaxWord(pNtk->timeDiv, p->timeDiv);
+    pNtk->timeCnf = Abc_MaxWord(pNtk->timeCnf, p->timeCnf);
+    pNtk->timeSat = Abc_MaxWord(pNtk->timeSat, p->timeSat);
+    ABC_FREE(p->vCounts.pArray);
+    ABC_FREE(p->vTravIds.pArray);
+    ABC_FREE(p->vTravIds2.pArray);
+    ABC_FREE(p->vId2Var.pArray);
+    ABC_FREE(p->vVar2Id.pArray);
+    Vec_IntFree(p->vCover);
+    Vec_IntFreeP(&p->vNodes);
+    Vec_IntFreeP(&p->vDivs);
+    Vec_IntFreeP(&p->vRoots);
+    Vec_IntFreeP(&p->vTfo);
+    Vec_WrdFreeP(&p->vDivCexes);
+    Vec_IntFreeP(&p->vOrder);
+    Vec_IntFreeP(&p->vDivVars);
+    Vec_IntFreeP(&p->vDivIds);
+    Vec_IntFreeP(&p->vLits);
+    Vec_IntFreeP(&p->vValues);
+    Vec_WecFreeP(&p->vClauses);
+    Vec_IntFreeP(&p->vFaninMap);
+    if (p->pSat) sat_solver_delete(p->pSat);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the window of the node and saves it in the job.]
+
+  Description [The statistics of the window are saved in the job and
+  counted only if the window is solved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkParSaveWindow(Sfm_Ntk_t* p, Sfm_ParJob_t* pJob) {
+    int nTotalDivs = p->nTotalDivs;
+    int nMaxDivs = p->nMaxDivs;
+    pJob->fWindow = Sfm_NtkCreateWindow(p, pJob->iNode, 0);
+    pJob->nDivs = p->nTotalDivs - nTotalDivs;
+    pJob->nMaxDivs = p->nMaxDivs - nMaxDivs;
+    p->nTotalDivs = nTotalDivs;
+    p->nMaxDivs = nMaxDivs;
+    if (!pJob->fWindow)
+        return;
+    Vec_IntClear(pJob->vDivs);
+    Vec_IntClear(pJob->vRoots);
+    Vec_IntClear(pJob->vTfo);
+    Vec_IntClear(pJob->vOrder);
+    Vec_IntAppend(pJob->vDivs, p->vDivs);
+    Vec_IntAppend(pJob->vRoots, p->vRoots);
+    Vec_IntAppend(pJob->vTfo, p->vTfo);
+    Vec_IntAppend(pJob->vOrder, p->vOrder);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the window of the node saved in the job.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkParLoadWindow(Sfm_Ntk_t* p, Sfm_ParJob_t* pJob) {
+    assert(pJob->fWindow);
+    p->iPivotNode = pJob->iNode;
+    Vec_IntClear(p->vNodes);
+    Vec_IntClear(p->vDivs);
+    Vec_IntClear(p->vRoots);
+    Vec_IntClear(p->vTfo);
+    Vec_IntClear(p->vOrder);
+    Vec_IntAppend(p->vDivs, pJob->vDivs);
+    Vec_IntAppend(p->vRoots, pJob->vRoots);
+    Vec_IntAppend(p->vTfo, pJob->vTfo);
+    Vec_IntAppend(p->vOrder, pJob->vOrder);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the window of the node to the current round.]
+
+  Description [Returns 1 if the node is added, 0 if its window overlaps
+  with the window of a node added before, and -1 if the window cannot be
+  computed. The objects of the added windows are labeled by Stamp. The
+  primary inputs are never modified and may be shared by the windows.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkParAddWindow(Sfm_Ntk_t* p, Vec_Int_t* vStamps, int Stamp, Sfm_ParJob_t* pJob) {
+    int i, iObj;
+    if (!pJob->fWindow)
+        return -1;
+    Vec_IntForEachEntry(pJob->vOrder, iObj, i) if (!Sfm_ObjIsPi(p, iObj) && Vec_IntEntry(vStamps, iObj) == Stamp) return 0;
+    Vec_IntForEachEntry(pJob->vOrder, iObj, i) if (!Sfm_ObjIsPi(p, iObj))
+        Vec_IntWriteEntry(vStamps, iObj, Stamp);
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the jobs given to one thread.]
+
+  Description [Computes the windows of the jobs or solves the windows
+  computed before.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkParSolveJobs(Sfm_ParThData_t* pThData) {
+    Sfm_Ntk_t* p = pThData->p;
+    Sfm_ParJob_t* pJob;
+    int i;
+    for (i = pThData->iFirst; i < pThData->nJobs; i += pThData->nStep) {
+        pJob = pThData->pJobs + i;
+        if (!pThData->fSolve) {
+            Sfm_NtkParSaveWindow(p, pJob);
+            continue;
+        }
+        pJob->iFanin = -2;
+        p->nNodesTried++;
+        Sfm_NtkParLoadWindow(p, pJob);
+        if (!Sfm_NodeResubWindow(p, pJob->iNode))
+            continue;
+        pJob->iFanin = p->iUpdFanin;
+        pJob->iDiv = p->iUpdDivisor;
+        pJob->uTruth = p->uUpdTruth;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Thread solving the jobs.]
+
+  Description [Sleeps until the main thread gives it the jobs or asks it
+  to quit.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Sfm_NtkParWorkerThread(void* pArg) {
+    Sfm_ParThData_t* pThData = (Sfm_ParThData_t*)pArg;
+    pthread_mutex_t* pMutex = (pthread_mutex_t*)pThData->pMutex;
+    int status;
+    while (1) {
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        while (!pThData->fWorking)
+            pthread_cond_wait((pthread_cond_t*)pThData->pCondWork, pMutex);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+        if (pThData->pJobs == NULL) {
+            pThData->p->timeTotal = Abc_Clock();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        Sfm_NtkParSolveJobs(pThData);
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        pThData->fWorking = 0;
+        pthread_cond_signal((pthread_cond_t*)pThData->pCondDone);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Gives the jobs to the threads and waits until they are done.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkParRunJobs(Sfm_ParThData_t* ThData, int nProcs, Sfm_ParJob_t* pJobs, int nJobs, int fSolve) {
+    pthread_mutex_t* pMutex = (pthread_mutex_t*)ThData[0].pMutex;
+    int i, status, fWorkToDo;
+    status = pthread_mutex_lock(pMutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].pJobs = pJobs;
+        ThData[i].nJobs = nJobs;
+        ThData[i].fSolve = fSolve;
+        ThData[i].fWorking = 1;
+    }
+    pthread_cond_broadcast((pthread_cond_t*)ThData[0].pCondWork);
+    for (fWorkToDo = 1; fWorkToDo;) {
+        for (fWorkToDo = i = 0; i < nProcs; i++)
+            fWorkToDo |= ThData[i].fWorking;
+        if (fWorkToDo)
+            pthread_cond_wait((pthread_cond_t*)ThData[0].pCondDone, pMutex);
+    }
+    status = pthread_mutex_unlock(pMutex);
+    assert(status == 0);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution with several threads.]
+
+  Description [The nodes are queued in a topological order. In each round,
+  the threads compute the windows of the next queued nodes, and the main
+  thread selects the nodes whose windows do not share internal nodes with
+  the windows selected before. The skipped nodes stay in the queue for the
+  next round. The threads then solve the selected windows on the unchanged
+  network, each with its own SAT solver, and the resubstitutions are
+  performed by the main thread in the order of selection. Since an update
+  is limited to its window, it does not invalidate the results for the
+  other windows of the round. The updated nodes are queued again, as in
+  Sfm_NtkPerformNodes(). The rounds do not depend on the number of
+  threads, so neither does the result.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar(Sfm_Ntk_t* p) {
+    Sfm_ParThData_t ThData[SFM_PAR_THR_MAX];
+    pthread_t WorkerThread[SFM_PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t CondWork, CondDone;
+    Sfm_ParJob_t* pJobs = ABC_CALLOC(Sfm_ParJob_t, SFM_PAR_BATCH);
+    Sfm_ParJob_t* pCands = ABC_CALLOC(Sfm_ParJob_t, SFM_PAR_BATCH);
+    Vec_Int_t* vQueue = Vec_IntAlloc(p->nNodes);
+    Vec_Int_t* vStamps = Vec_IntStart(p->nObjs);
+    Vec_Int_t* vSkipped = Vec_IntAlloc(SFM_PAR_LOOK);
+    Vec_Int_t* vUpdated = Vec_IntAlloc(SFM_PAR_BATCH);
+    Vec_Str_t* vChanged = Vec_StrStart(p->nObjs);
+    int nProcs = Abc_MinInt(p->pPars->nProcs, SFM_PAR_THR_MAX);
+    int i, c, k, iNode, status, nJobs, nCands, nRounds = 0, nWindows = 0, iHead = 0, Counter = 0;
+    abctime clk = Abc_Clock(), clkThreads = 0;
+    for (i = 0; i < 2 * SFM_PAR_BATCH; i++) {
+        Sfm_ParJob_t* pJob = i < SFM_PAR_BATCH ? pJobs + i : pCands + i - SFM_PAR_BATCH;
+        pJob->vDivs = Vec_IntAlloc(100);
+        pJob->vRoots = Vec_IntAlloc(100);
+        pJob->vTfo = Vec_IntAlloc(100);
+        pJob->vOrder = Vec_IntAlloc(100);
+    }
+    // start the threads
+    pthread_mutex_init(&Mutex, NULL);
+    pthread_cond_init(&CondWork, NULL);
+    pthread_cond_init(&CondDone, NULL);
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].Pars = *p->pPars;
+        ThData[i].Pars.fVeryVerbose = 0;
+        ThData[i].p = Sfm_NtkCreateThread(p, &ThData[i].Pars);
+        ThData[i].pJobs = pJobs;
+        ThData[i].nJobs = 0;
+        ThData[i].fSolve = 0;
+        ThData[i].iFirst = i;
+        ThData[i].nStep = nProcs;
+        ThData[i].fWorking = 0;
+        ThData[i].pMutex = &Mutex;
+        ThData[i].pCondWork = &CondWork;
+        ThData[i].pCondDone = &CondDone;
+        status = pthread_create(WorkerThread + i, NULL, Sfm_NtkParWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    Sfm_NtkForEachNode(p, i)
+        Vec_IntPush(vQueue, i);
+    while (iHead < Vec_IntSize(vQueue)) {
+        // select the nodes with non-overlapping windows
+        nRounds++;
+        Vec_IntClear(vSkipped);
+        Vec_IntClear(vUpdated);
+        for (nJobs = 0, k = iHead; k < Vec_IntSize(vQueue) && k < iHead + SFM_PAR_LOOK && nJobs < SFM_PAR_BATCH;) {
+            // collect the next nodes and compute their windows
+            for (nCands = 0; k < Vec_IntSize(vQueue) && k < iHead + SFM_PAR_LOOK && nCands < SFM_PAR_BATCH; k++) {
+                iNode = Vec_IntEntry(vQueue, k);
+                if (Sfm_ObjIsFixed(p, iNode))
+                    continue;
+                if (p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax)
+                    continue;
+                if (Sfm_ObjFaninNum(p, iNode) < 2 || Sfm_ObjFaninNum(p, iNode) > 6)
+                    continue;
+                pCands[nCands].iNode = iNode;
+                pCands[nCands++].iPos = k;
+            }
+            Sfm_NtkParRunJobs(ThData, nProcs, pCands, nCands, 0);
+            // add the windows in the order of the nodes
+            for (c = 0; c < nCands; c++) {
+                status = Sfm_NtkParAddWindow(p, vStamps, nRounds, pCands + c);
+                if (status == 0)
+                    Vec_IntPush(vSkipped, pCands[c].iNode);
+                else if (status == 1) {
+                    p->nTotalDivs += pCands[c].nDivs;
+                    p->nMaxDivs += pCands[c].nMaxDivs;
+                    ABC_SWAP(Sfm_ParJob_t, pJobs[nJobs], pCands[c]);
+                    if (++nJobs == SFM_PAR_BATCH) {
+                        // the nodes after this one are visited in the next round
+                        k = pJobs[nJobs - 1].iPos + 1;
+                        break;
+                    }
+                }
+            }
+        }
+        nWindows += nJobs;
+        // solve the windows
+        Sfm_NtkParRunJobs(ThData, nProcs, pJobs, nJobs, 1);
+        // perform the resubstitutions in the order of selection
+        for (i = 0; i < nJobs; i++) {
+            Sfm_ParJob_t* pJob = pJobs + i;
+            if (pJob->iFanin == -2)
+                continue;
+            if (pJob->iFanin >= 0)
+                Sfm_NtkUpdate(p, pJob->iNode, pJob->iFanin, pJob->iDiv, pJob->uTruth);
+            else {
+                Vec_WrdWriteEntry(p->vTruths, pJob->iNode, pJob->uTruth);
+                Sfm_TruthToCnf(pJob->uTruth, NULL, Sfm_ObjFaninNum(p, pJob->iNode), p->vCover, (Vec_Str_t*)Vec_WecEntry(p->vCnfs, pJob->iNode));
+            }
+            if (!Vec_StrEntry(vChanged, pJob->iNode)) {
+                Vec_StrWriteEntry(vChanged, pJob->iNode, 1);
+                Counter++;
+            }
+            Vec_IntPush(vUpdated, pJob->iNode);
+        }
+        // queue the updated nodes followed by the skipped nodes
+        assert(k - iHead >= Vec_IntSize(vUpdated) + Vec_IntSize(vSkipped));
+        iHead = k - Vec_IntSize(vUpdated) - Vec_IntSize(vSkipped);
+        Vec_IntForEachEntry(vUpdated, iNode, i)
+            Vec_IntWriteEntry(vQueue, iHead + i, iNode);
+        Vec_IntForEachEntry(vSkipped, iNode, i)
+            Vec_IntWriteEntry(vQueue, iHead + Vec_IntSize(vUpdated) + i, iNode);
+        if (p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax)
+            break;
+    }
+    // stop the threads
+    status = pthread_mutex_lock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        ThData[i].pJobs = NULL;
+        ThData[i].fWorking = 1;
+    }
+    pthread_cond_broadcast(&CondWork);
+    status = pthread_mutex_unlock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        pthread_join(WorkerThread[i], NULL);
+        clkThreads = Abc_MaxWord(clkThreads, ThData[i].p->timeTotal);
+        Sfm_NtkStopThread(p, ThData[i].p);
+    }
+    // the main thread sleeps while the threads work, so the longest thread is added to the runtime
+    p->timeTotal -= clkThreads;
+    pthread_cond_destroy(&CondWork);
+    pthread_cond_destroy(&CondDone);
+    pthread_mutex_destroy(&Mutex);
+    if (p->pPars->fVerbose) {
+        printf("Parallel resubstitution with %d threads solved %d windows in %d rounds.  ", nProcs, nWindows, nRounds);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk + clkThreads);
+    }
+    for (i = 0; i < 2 * SFM_PAR_BATCH; i++) {
+        Sfm_ParJob_t* pJob = i < SFM_PAR_BATCH ? pJobs + i : pCands + i - SFM_PAR_BATCH;
+        Vec_IntFree(pJob->vDivs);
+        Vec_IntFree(pJob->vRoots);
+        Vec_IntFree(pJob->vTfo);
+        Vec_IntFree(pJob->vOrder);
+    }
+    ABC_FREE(pJobs);
+    ABC_FREE(pCands);
+    Vec_IntFree(vQueue);
+    Vec_IntFree(vStamps);
+    Vec_IntFree(vSkipped);
+    Vec_IntFree(vUpdated);
+    Vec_StrFree(vChanged);
+    return Counter;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
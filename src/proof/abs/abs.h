@@ -67,6 +67,7 @@ struct Abs_Par_t_ {
     int fDumpMabs;          // dumps the original AIG with abstraction map
     int fCallProver;        // calls the prover
     int fSimpProver;        // calls simplification before prover
+    int nProcs;             // the number of threads computing candidate refinements
     char* pFileVabs;        // dumps the abstracted model into this file
     int fVerbose;           // verbose flag
     int fVeryVerbose;       // print additional information
@@ -110,7 +111,7 @@ static inline int* Ga2_ObjLeavePtr(Gia_Man_t* p, Gia_Obj_t* pObj) { return Vec_I
 static inline unsigned Ga2_ObjTruth(Gia_Man_t* p, Gia_Obj_t* pObj) { return (unsigned)Vec_IntEntry(p->vMapping, Ga2_ObjOffset(p, pObj) + Ga2_ObjLeaveNum(p, pObj) + 1); }
 static inline int Ga2_ObjRefNum(Gia_Man_t* p, Gia_Obj_t* pObj) { return (unsigned)Vec_IntEntry(p->vMapping, Ga2_ObjOffset(p, pObj) + Ga2_ObjLeaveNum(p, pObj) + 2); }
 static inline Vec_Int_t* Ga2_ObjLeaves(Gia_Man_t* p, Gia_Obj_t* pObj) {
-    static Vec_Int_t v;
+    static ABC_THREAD_LOCAL Vec_Int_t v;
     v.nSize = Ga2_ObjLeaveNum(p, pObj), v.pArray = Ga2_ObjLeavePtr(p, pObj);
     return &v;
 }
@@ -52,8 +52,9 @@ struct Ga2_Man_t_ {
     int nMarked;          // total number of marked nodes and flops
     int fUseNewLine;      // remember that you used new line
     // refinement
-    Rnm_Man_t* pRnm; // refinement manager
-                     //    Rf2_Man_t *    pRf2;         // refinement manager
+    Rnm_Man_t* pRnm;      // refinement manager
+    Abs_RefPool_t* pPool; // threads computing candidate refinements
+                          //    Rf2_Man_t *    pRf2;         // refinement manager
     // SAT solver and variables
     Vec_Ptr_t* vId2Lit; // mapping, for each timeframe, of object ID into SAT literal
     sat_solver2* pSat;  // incremental SAT solver
@@ -374,6 +375,8 @@ Ga2_Man_t* Ga2_ManStart(Gia_Man_t* pGia, Abs_Par_t* pPars) {
     Vec_IntPush(p->vAbs, 0);
     // refinement
     p->pRnm = Rnm_ManStart(pGia);
+    if (pPars->nProcs > 1 && !pPars->fAddLayer)
+        p->pPool = Gia_GlaRefPoolStart(pGia, pPars->nProcs, pPars->fPropFanout, pPars->fNewRefine);
     //    p->pRf2      = Rf2_ManStart( pGia );
     // SAT solver and variables
     p->vId2Lit = Vec_PtrAlloc(1000);
@@ -457,6 +460,7 @@ void Ga2_ManStop(Ga2_Man_t* p) {
     Vec_IntFree(p->vLits);
     Vec_IntFree(p->vIsopMem);
     Rnm_ManStop(p->pRnm, 0);
+    Gia_GlaRefPoolStop(p->pPool, p->pPars->fVerbose);
     //    Rf2_ManStop( p->pRf2, p->pPars->fVerbose );
     ABC_FREE(p->pTable);
     ABC_FREE(p->pSopSizes);
@@ -1183,8 +1187,13 @@ Vec_Int_t* Ga2_ManRefine(Ga2_Man_t* p) {
         return vVec;
     }
     Ga2_GlaPrepareCexAndMap(p, &pCex, &vMap);
+    // alternative refinements are computed concurrently
+    if (p->pPool)
+        Gia_GlaRefPoolLaunch(p->pPool, pCex, vMap);
     //    Rf2_ManRefine( p->pRf2, pCex, vMap, p->pPars->fPropFanout, 1 );
     vVec = Rnm_ManRefine(p->pRnm, pCex, vMap, p->pPars->fPropFanout, p->pPars->fNewRefine, 1);
+    if (p->pPool)
+        vVec = Gia_GlaRefPoolSelect(p->pPool, p->pRnm, vVec);
     //    printf( "Refinement %d\n", Vec_IntSize(vVec) );
     Abc_CexFree(pCex);
     if (Vec_IntSize(vVec) == 0) {
@@ -1410,12 +1419,10 @@ int Gia_ManPerformGla(Gia_Man_t* pAig, Abs_Par_t* pPars) {
                       Ga2_GlaGetFileName(p, pPars->fDumpVabs));
         if (pPars->fDumpMabs) {
             {
-                char Command[1000];
                 Abc_FrameSetStatus(-1);
                 Abc_FrameSetCex(NULL);
                 Abc_FrameSetNFrames(-1);
-                sprintf(Command, "write_status %s", Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "glabs.aig"), ".status"));
-                Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), Command);
+                Abc_NtkWriteLogFile(Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "glabs.aig"), ".status"), NULL, -1, -1, NULL);
             }
             {
                 // create trivial abstraction map
@@ -1641,12 +1648,10 @@ int Gia_ManPerformGla(Gia_Man_t* pAig, Abs_Par_t* pPars) {
             if (p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim) {
                 // dump the model into file
                 if (p->pPars->fDumpVabs || p->pPars->fDumpMabs) {
-                    char Command[1000];
                     Abc_FrameSetStatus(-1);
                     Abc_FrameSetCex(NULL);
                     Abc_FrameSetNFrames(f);
-                    sprintf(Command, "write_status %s", Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "glabs.aig"), ".status"));
-                    Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), Command);
+                    Abc_NtkWriteLogFile(Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "glabs.aig"), ".status"), NULL, -1, f, NULL);
                     Ga2_GlaDumpAbsracted(p, pPars->fVerbose);
                 }
                 // call the prover
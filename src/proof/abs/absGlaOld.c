@@ -1715,12 +1715,10 @@ int Gia_ManPerformGlaOld(Gia_Man_t* pAig, Abs_Par_t* pPars, int fStartVta) {
 
             // dump the model into file
             if (p->pPars->fDumpVabs) {
-                char Command[1000];
                 Abc_FrameSetStatus(-1);
                 Abc_FrameSetCex(NULL);
                 Abc_FrameSetNFrames(f + 1);
-                sprintf(Command, "write_status %s", Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "glabs.aig"), ".status"));
-                Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), Command);
+                Abc_NtkWriteLogFile(Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "glabs.aig"), ".status"), NULL, -1, f + 1, NULL);
                 Gia_GlaDumpAbsracted(p, pPars->fVerbose);
             }
         }
@@ -19,8 +19,11 @@
 ***********************************************************************/
 
 #include "abs.h"
+#include "absRef.h"
 #include "proof/pdr/pdr.h"
 #include "proof/ssw/ssw.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
 
 #ifdef ABC_USE_PTHREADS
 
@@ -45,6 +48,11 @@ void Gia_GlaProveAbsracted(Gia_Man_t* p, int fSimpProver, int fVerbose) {}
 void Gia_GlaProveCancel(int fVerbose) {}
 int Gia_GlaProveCheck(int fVerbose) { return 0; }
 
+Abs_RefPool_t* Gia_GlaRefPoolStart(Gia_Man_t* pGia, int nProcs, int fPropFanout, int fNewRefine) { return NULL; }
+void Gia_GlaRefPoolStop(Abs_RefPool_t* p, int fVerbose) {}
+void Gia_GlaRefPoolLaunch(Abs_RefPool_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap) {}
+Vec_Int_t* Gia_GlaRefPoolSelect(Abs_RefPool_t* p, Rnm_Man_t* pRnm, Vec_Int_t* vPPis) { return vPPis; }
+
 #else // pthreads are used
 
 // information given to the thread
@@ -123,6 +131,9 @@ void* Abs_ProverThread(void* pArg) {
     // free memory
     Aig_ManStop(pThData->pAig);
     ABC_FREE(pThData);
+    // free the managers allocated by this thread
+    Cnf_ManFree();
+    Dar_LibStop();
     // quit this thread
     pthread_exit(NULL);
     assert(0);
@@ -197,6 +208,214 @@ int Gia_GlaProveCheck(int fVerbose) {
     return 1;
 }
 
+// Refinement worker pool: while the main thread computes the refinement
+// using the current heuristics, each worker computes a candidate refinement
+// for the same counter-example using a different combination of heuristics
+// (fanout propagation and PPI filtering) in its private copy of the AIG.
+
+#define ABS_REF_THR_MAX 3 // the number of alternative heuristics
+
+// information given to the refinement thread
+typedef struct Abs_RefThData_t_ {
+    Gia_Man_t* pGia;  // the private copy of the AIG
+    Rnm_Man_t* pRnm;  // the private refinement manager
+    int fPropFanout;  // propagate fanout implications
+    int fNewRefine;   // uses new refinement heuristics
+    Abc_Cex_t* pCex;  // the abstract counter-example
+    Vec_Int_t* vMap;  // mapping of CEX inputs into objects
+    Vec_Int_t* vPPis; // the candidate refinement
+    int fBlocks;      // the candidate refinement blocks the counter-example
+    int fStop;        // the thread should exit
+    int fWorking;     // the thread is computing refinement
+} Abs_RefThData_t;
+
+struct Abs_RefPool_t_ {
+    int nProcs;                              // the number of threads
+    Abs_RefThData_t ThData[ABS_REF_THR_MAX]; // the thread data
+    pthread_t WorkerThread[ABS_REF_THR_MAX]; // the threads
+    // statistics
+    int nCalls;                              // the number of refinements
+    int nWins[ABS_REF_THR_MAX + 1];          // the number of times each candidate was selected
+    int nSaved;                              // the number of objects saved by selection
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Computes a candidate refinement in the worker thread.]
+
+  Description [Waits until the main thread launches the refinement, computes
+  the refinement with the heuristics of this thread and checks whether it
+  blocks the counter-example. Exits when the pool is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Abs_RefWorkerThread(void* pArg) {
+    Abs_RefThData_t* pThData = (Abs_RefThData_t*)pArg;
+    volatile int* pPlace = &pThData->fWorking;
+    while (1) {
+        while (*pPlace == 0)
+            ;
+        assert(pThData->fWorking);
+        if (pThData->fStop) {
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        pThData->vPPis = Rnm_ManRefine(pThData->pRnm, pThData->pCex, pThData->vMap, pThData->fPropFanout, pThData->fNewRefine, 0);
+        pThData->fBlocks = Vec_IntSize(pThData->vPPis) > 0 && Rnm_ManCheckUsingTerSim(pThData->pGia, pThData->pCex, pThData->vMap, pThData->pRnm->vObjs, pThData->vPPis);
+        pThData->fWorking = 0;
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the refinement pool.]
+
+  Description [Creates nProcs - 1 workers (at most ABS_REF_THR_MAX), each with a
+  private copy of the AIG and its own refinement manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abs_RefPool_t* Gia_GlaRefPoolStart(Gia_Man_t* pGia, int nProcs, int fPropFanout, int fNewRefine) {
+    Abs_RefPool_t* p;
+    Gia_Obj_t* pObj;
+    int i, k, status;
+    assert(pGia->vMapping != NULL);
+    p = ABC_CALLOC(Abs_RefPool_t, 1);
+    p->nProcs = Abc_MinInt(nProcs - 1, ABS_REF_THR_MAX);
+    for (i = 0; i < p->nProcs; i++) {
+        Abs_RefThData_t* pThData = p->ThData + i;
+        // the copy has the same object IDs, so the PPIs can be exchanged directly
+        pThData->pGia = Gia_ManDup(pGia);
+        assert(Gia_ManObjNum(pThData->pGia) == Gia_ManObjNum(pGia));
+        pThData->pGia->vMapping = Vec_IntDup(pGia->vMapping);
+        Gia_ManForEachObj(pGia, pObj, k)
+            Gia_ManObj(pThData->pGia, k)->fPhase = pObj->fPhase;
+        pThData->pRnm = Rnm_ManStart(pThData->pGia);
+        pThData->fPropFanout = fPropFanout ^ ((i + 1) & 1);
+        pThData->fNewRefine = fNewRefine ^ (((i + 1) >> 1) & 1);
+        status = pthread_create(p->WorkerThread + i, NULL, Abs_RefWorkerThread, (void*)pThData);
+        assert(status == 0);
+    }
+    Gia_ManCleanValue(pGia);
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the refinement pool.]
+
+  Description [Terminates the workers, prints the statistics, and frees the
+  private copies.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_GlaRefPoolStop(Abs_RefPool_t* p, int fVerbose) {
+    int i;
+    if (p == NULL)
+        return;
+    for (i = 0; i < p->nProcs; i++) {
+        assert(!p->ThData[i].fWorking);
+        p->ThData[i].fStop = 1;
+        p->ThData[i].fWorking = 1;
+    }
+    for (i = 0; i < p->nProcs; i++)
+        pthread_join(p->WorkerThread[i], NULL);
+    if (fVerbose) {
+        Abc_Print(1, "Refinement pool: Calls = %d.  Selected:  main = %d", p->nCalls, p->nWins[0]);
+        for (i = 0; i < p->nProcs; i++)
+            Abc_Print(1, "  f%d r%d = %d", p->ThData[i].fPropFanout, p->ThData[i].fNewRefine, p->nWins[i + 1]);
+        Abc_Print(1, ".  Objects saved = %d.\n", p->nSaved);
+    }
+    for (i = 0; i < p->nProcs; i++) {
+        Rnm_ManStop(p->ThData[i].pRnm, 0);
+        Gia_ManStop(p->ThData[i].pGia);
+    }
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Launches the candidate refinements for the counter-example.]
+
+  Description [The workers run while the main thread computes its own refinement.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_GlaRefPoolLaunch(Abs_RefPool_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap) {
+    int i;
+    for (i = 0; i < p->nProcs; i++) {
+        assert(!p->ThData[i].fWorking);
+        p->ThData[i].pCex = pCex;
+        p->ThData[i].vMap = vMap;
+        p->ThData[i].vPPis = NULL;
+        p->ThData[i].fBlocks = 0;
+        p->ThData[i].fWorking = 1;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the refinement.]
+
+  Description [Waits for the workers and returns the smallest refinement that
+  blocks the counter-example, which is either vPPis computed by the main
+  thread or one of the candidates. The other refinements are freed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t* Gia_GlaRefPoolSelect(Abs_RefPool_t* p, Rnm_Man_t* pRnm, Vec_Int_t* vPPis) {
+    int i, iBest = 0, fBlocks, fBlocksMain, nSizeMain = Vec_IntSize(vPPis);
+    // wait for the threads to finish
+    for (i = 0; i < p->nProcs; i++) {
+        volatile int* pPlace = &p->ThData[i].fWorking;
+        while (*pPlace)
+            ;
+    }
+    // the empty refinement means that the counter-example is real
+    if (Vec_IntSize(vPPis) == 0) {
+        for (i = 0; i < p->nProcs; i++)
+            Vec_IntFreeP(&p->ThData[i].vPPis);
+        return vPPis;
+    }
+    // select the smallest refinement that blocks the counter-example
+    fBlocks = fBlocksMain = Rnm_ManCheckUsingTerSim(pRnm->pGia, pRnm->pCex, pRnm->vMap, pRnm->vObjs, vPPis);
+    for (i = 0; i < p->nProcs; i++) {
+        Abs_RefThData_t* pThData = p->ThData + i;
+        if (!pThData->fBlocks)
+            continue;
+        if (fBlocks && Vec_IntSize(pThData->vPPis) >= Vec_IntSize(vPPis))
+            continue;
+        ABC_SWAP(Vec_Int_t*, vPPis, pThData->vPPis);
+        fBlocks = 1;
+        iBest = i + 1;
+    }
+    for (i = 0; i < p->nProcs; i++)
+        Vec_IntFreeP(&p->ThData[i].vPPis);
+    p->nCalls++;
+    p->nWins[iBest]++;
+    if (fBlocksMain)
+        p->nSaved += nSizeMain - Vec_IntSize(vPPis);
+    return vPPis;
+}
+
 #endif // pthreads are used
 
 ////////////////////////////////////////////////////////////////////////
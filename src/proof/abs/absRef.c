@@ -563,16 +563,18 @@ void Rnm_ManJustify_rec(Rnm_Man_t* p, Gia_Obj_t* pObj, int f, Vec_Int_t* vSelect
 
 /**Function*************************************************************
 
-  Synopsis    [Performs refinement.]
+  Synopsis    [Checks the refinement using ternary simulation.]
 
-  Description []
+  Description [Returns 1 if the output is asserted by the counter-example
+  when the values of PPIs outside of vRes are replaced by X. In this case,
+  adding the PPIs in vRes to the abstraction blocks the counter-example.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Rnm_ManVerifyUsingTerSim(Gia_Man_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap, Vec_Int_t* vObjs, Vec_Int_t* vRes) {
+int Rnm_ManCheckUsingTerSim(Gia_Man_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap, Vec_Int_t* vObjs, Vec_Int_t* vRes) {
     Gia_Obj_t* pObj;
     int i, f, iBit = pCex->nRegs;
     Gia_ObjTerSimSet0(Gia_ManConst0(p));
@@ -608,7 +610,10 @@ void Rnm_ManVerifyUsingTerSim(Gia_Man_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap, Ve
         pObj->Value
         = 0;
     pObj = Gia_ManPo(p, 0);
-    if (!Gia_ObjTerSimGet1(pObj))
+    return Gia_ObjTerSimGet1(pObj);
+}
+void Rnm_ManVerifyUsingTerSim(Gia_Man_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap, Vec_Int_t* vObjs, Vec_Int_t* vRes) {
+    if (!Rnm_ManCheckUsingTerSim(p, pCex, vMap, vObjs, vRes))
         Abc_Print(1, "\nRefinement verification has failed!!!\n");
 }
 
@@ -48,6 +48,8 @@ struct Rnm_Obj_t_ {
     unsigned Prio : 24;   // priority (0 - highest)
 };
 
+typedef struct Abs_RefPool_t_ Abs_RefPool_t; // pool of refinement threads
+
 typedef struct Rnm_Man_t_ Rnm_Man_t; // refinement manager
 struct Rnm_Man_t_ {
     // user data
@@ -112,9 +114,15 @@ extern Rnm_Man_t* Rnm_ManStart(Gia_Man_t* pGia);
 extern void Rnm_ManStop(Rnm_Man_t* p, int fProfile);
 extern double Rnm_ManMemoryUsage(Rnm_Man_t* p);
 extern Vec_Int_t* Rnm_ManRefine(Rnm_Man_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap, int fPropFanout, int fNewRefinement, int fVerbose);
+extern int Rnm_ManCheckUsingTerSim(Gia_Man_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap, Vec_Int_t* vObjs, Vec_Int_t* vRes);
 /*=== absRefSelected.c ===========================================================*/
 extern Vec_Int_t* Rnm_ManFilterSelected(Rnm_Man_t* p, Vec_Int_t* vOldPPis);
 extern Vec_Int_t* Rnm_ManFilterSelectedNew(Rnm_Man_t* p, Vec_Int_t* vOldPPis);
+/*=== absPth.c ===========================================================*/
+extern Abs_RefPool_t* Gia_GlaRefPoolStart(Gia_Man_t* pGia, int nProcs, int fPropFanout, int fNewRefine);
+extern void Gia_GlaRefPoolStop(Abs_RefPool_t* p, int fVerbose);
+extern void Gia_GlaRefPoolLaunch(Abs_RefPool_t* p, Abc_Cex_t* pCex, Vec_Int_t* vMap);
+extern Vec_Int_t* Gia_GlaRefPoolSelect(Abs_RefPool_t* p, Rnm_Man_t* pRnm, Vec_Int_t* vPPis);
 
 ABC_NAMESPACE_HEADER_END
 
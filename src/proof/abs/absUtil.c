@@ -57,6 +57,7 @@ void Abs_ParSetDefaults(Abs_Par_t* p) {
     p->fUseTermVars = 0;       // use terminal variables
     p->fUseRollback = 0;       // use rollback to the starting number of frames
     p->fPropFanout = 1;        // propagate fanouts during refinement
+    p->nProcs = 1;             // the number of threads computing candidate refinements
     p->fVerbose = 0;           // verbose flag
     p->iFrame = -1;            // the number of frames covered
     p->iFrameProved = -1;      // the number of frames proved
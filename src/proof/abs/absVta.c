@@ -1506,12 +1506,10 @@ int Gia_VtaPerformInt(Gia_Man_t* pAig, Abs_Par_t* pPars) {
         }
         // dump the model
         if (p->pPars->fDumpVabs && (f & 1)) {
-            char Command[1000];
             Abc_FrameSetStatus(-1);
             Abc_FrameSetCex(NULL);
             Abc_FrameSetNFrames(f + 1);
-            sprintf(Command, "write_status %s", Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "vtabs.aig"), ".status"));
-            Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), Command);
+            Abc_NtkWriteLogFile(Extra_FileNameGenericAppend((char*)(p->pPars->pFileVabs ? p->pPars->pFileVabs : "vtabs.aig"), ".status"), NULL, -1, f + 1, NULL);
             Gia_VtaDumpAbsracted(p, pPars->fVerbose);
         }
         // check if the number of objects is below limit
@@ -138,6 +138,9 @@ struct Cec_ParCor_t_ {
     int nBTLimit;      // conflict limit at a node
     int nLevelMax;     // (scorr only) the max number of levels
     int nStepsMax;     // (scorr only) the max number of induction steps
+    int nProcs;        // (scorr only) the number of concurrent threads
+    abctime nTimeToStop;  // (scorr only) the time to interrupt the refinement (0 = no limit)
+    volatile int* pStop;  // (scorr only) interrupts the refinement when the flag is set
     int fLatchCorr;    // consider only latch outputs
     int fConstCorr;    // consider only constants
     int fUseRings;     // use rings
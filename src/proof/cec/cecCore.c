@@ -182,6 +182,7 @@ void Cec_ManCorSetDefaultParams(Cec_ParCor_t* p) {
     p->nBTLimit = 100;   // conflict limit at a node
     p->nLevelMax = -1;   // (scorr only) the max number of levels
     p->nStepsMax = -1;   // (scorr only) the max number of induction steps
+    p->nProcs = 1;       // (scorr only) the number of concurrent threads
     p->fLatchCorr = 0;   // consider only latch outputs
     p->fConstCorr = 0;   // consider only constants
     p->fUseRings = 1;    // combine classes into rings
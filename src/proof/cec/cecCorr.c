@@ -19,6 +19,19 @@
 ***********************************************************************/
 
 #include "cecInt.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -26,6 +39,20 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define PAR_THR_MAX 100
+
+// information given to the thread solving one partition of the SRM
+typedef struct Cec_CorThData_t_ Cec_CorThData_t;
+struct Cec_CorThData_t_ {
+    Gia_Man_t* pPart;       // the cones of the partition (NULL to quit)
+    Cec_ParCor_t* pPars;    // scorr parameters
+    Cec_ParSat_t* pParsSat; // SAT parameters
+    Vec_Int_t* vCexStore;   // resulting counter-examples
+    Vec_Str_t* vStatus;     // resulting status of the outputs
+    int iPart;              // the partition being solved
+    int fWorking;           // set while the partition is being solved
+};
+
 static void Gia_ManCorrSpecReduce_rec(Gia_Man_t* pNew, Gia_Man_t* p, Gia_Obj_t* pObj, int f, int nPrefix);
 
 ////////////////////////////////////////////////////////////////////////
@@ -823,7 +850,62 @@ int Cec_ManLSCorrAnalyzeDependence(Gia_Man_t* p, Vec_Int_t* vEquivs, Vec_Str_t*
 
 /**Function*************************************************************
 
-  Synopsis    [Internal procedure for register correspondence.]
+  Synopsis    [Solves the outputs of the speculatively reduced model.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Vec_Int_t* Cec_ManLSCorrSolve(Gia_Man_t* pSrm, Cec_ParCor_t* pPars, Cec_ParSat_t* pParsSat, Vec_Str_t** pvStatus) {
+    if (pPars->fUseCSat)
+        return Cbs_ManSolveMiterNc(pSrm, pPars->nBTLimit, pvStatus, 0, 0);
+    return Cec_ManSatSolveMiter(pSrm, pParsSat, pvStatus);
+}
+
+#ifndef ABC_USE_PTHREADS
+
+Vec_Int_t* Cec_ManLSCorrSolvePar(Gia_Man_t* pSrm, Cec_ParCor_t* pPars, Cec_ParSat_t* pParsSat, Vec_Str_t** pvStatus) {
+    return Cec_ManLSCorrSolve(pSrm, pPars, pParsSat, pvStatus);
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Partitions the outputs of the SRM for parallel solving.]
+
+  Description [The outputs are first clustered by the overlap of their
+  structural supports, which for the SRM are the register outputs and
+  the primary inputs of the unrolled frames. The clusters are then packed
+  in order into roughly 4*nProcs partitions of similar size, so that the
+  threads stay busy while each partition remains local.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t* Cec_ManLSCorrPartition(Gia_Man_t* pSrm, int nProcs) {
+    Vec_Wec_t *vClusters, *vParts;
+    Vec_Int_t *vCluster, *vPart = NULL;
+    int i, nPartSize = Abc_MaxInt(1, (Gia_ManPoNum(pSrm) + 4 * nProcs - 1) / (4 * nProcs));
+    vClusters = Gia_ManClusterOutputs(pSrm, nPartSize, 0);
+    vParts = Vec_WecAlloc(4 * nProcs);
+    Vec_WecForEachLevel(vClusters, vCluster, i) {
+        if (vPart == NULL || Vec_IntSize(vPart) + Vec_IntSize(vCluster) > nPartSize)
+            vPart = Vec_WecPushLevel(vParts);
+        Vec_IntAppend(vPart, vCluster);
+    }
+    Vec_WecFree(vClusters);
+    return vParts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Thread solving one partition of the SRM.]
 
   Description []
                
@@ -831,6 +913,137 @@ int Cec_ManLSCorrAnalyzeDependence(Gia_Man_t* p, Vec_Int_t* vEquivs, Vec_Str_t*
 
   SeeAlso     []
 
+***********************************************************************/
+void* Cec_ManLSCorrWorkerThread(void* pArg) {
+    Cec_CorThData_t* pThData = (Cec_CorThData_t*)pArg;
+    volatile int* pPlace = &pThData->fWorking;
+    while (1) {
+        while (*pPlace == 0)
+            ;
+        assert(pThData->fWorking);
+        if (pThData->pPart == NULL) {
+            // free the managers allocated by this thread
+            Cnf_ManFree();
+            Dar_LibStop();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        pThData->vCexStore = Cec_ManLSCorrSolve(pThData->pPart, pThData->pPars, pThData->pParsSat, &pThData->vStatus);
+        pThData->fWorking = 0;
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the SRM using several threads.]
+
+  Description [Each partition of the outputs is extracted with all the
+  inputs of the SRM, so that the counter-examples refer to the same
+  inputs and only the output numbers need to be remapped. The results
+  are merged into one status array and one counter-example store, which
+  are then used to refine the classes as in the sequential flow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t* Cec_ManLSCorrSolvePar(Gia_Man_t* pSrm, Cec_ParCor_t* pPars, Cec_ParSat_t* pParsSat, Vec_Str_t** pvStatus) {
+    Cec_CorThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Vec_Wec_t* vParts;
+    Vec_Int_t *vPart, *vCexStore, *vCexPart;
+    Vec_Str_t *vStatus, *vStatusPart;
+    int nProcs = Abc_MinInt(pPars->nProcs, PAR_THR_MAX);
+    int i, k, iOut, nLits, status, iPart = 0, fWorkToDo = 1;
+    if (nProcs < 2 || Gia_ManPoNum(pSrm) < 2 * nProcs)
+        return Cec_ManLSCorrSolve(pSrm, pPars, pParsSat, pvStatus);
+    vParts = Cec_ManLSCorrPartition(pSrm, nProcs);
+    vStatus = Vec_StrStart(Gia_ManPoNum(pSrm));
+    vCexStore = Vec_IntAlloc(10000);
+    // start the threads
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].pPart = NULL;
+        ThData[i].pPars = pPars;
+        ThData[i].pParsSat = pParsSat;
+        ThData[i].vCexStore = NULL;
+        ThData[i].vStatus = NULL;
+        ThData[i].iPart = -1;
+        ThData[i].fWorking = 0;
+        status = pthread_create(WorkerThread + i, NULL, Cec_ManLSCorrWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    // look at the threads
+    while (fWorkToDo) {
+        fWorkToDo = (iPart < Vec_WecSize(vParts));
+        for (i = 0; i < nProcs; i++) {
+            // check if this thread is working
+            if (ThData[i].fWorking) {
+                fWorkToDo = 1;
+                continue;
+            }
+            // check if this thread has recently finished
+            if (ThData[i].pPart != NULL) {
+                vPart = Vec_WecEntry(vParts, ThData[i].iPart);
+                vStatusPart = ThData[i].vStatus;
+                vCexPart = ThData[i].vCexStore;
+                Vec_IntForEachEntry(vPart, iOut, k)
+                    Vec_StrWriteEntry(vStatus, iOut, Vec_StrEntry(vStatusPart, k));
+                // copy the counter-examples while remapping the outputs
+                for (k = 0; k < Vec_IntSize(vCexPart); k += nLits + 2) {
+                    Vec_IntPush(vCexStore, Vec_IntEntry(vPart, Vec_IntEntry(vCexPart, k)));
+                    nLits = Vec_IntEntry(vCexPart, k + 1);
+                    Vec_IntPush(vCexStore, nLits);
+                    if (nLits == -1)
+                        nLits = 0;
+                    else
+                        Vec_IntPushArray(vCexStore, Vec_IntEntryP(vCexPart, k + 2), nLits);
+                }
+                Vec_StrFree(vStatusPart);
+                Vec_IntFree(vCexPart);
+                Gia_ManStop(ThData[i].pPart);
+                ThData[i].pPart = NULL;
+                ThData[i].iPart = -1;
+            }
+            if (iPart == Vec_WecSize(vParts))
+                continue;
+            // start solving the next partition
+            vPart = Vec_WecEntry(vParts, iPart);
+            ThData[i].pPart = Gia_ManDupCones(pSrm, Vec_IntArray(vPart), Vec_IntSize(vPart), 0);
+            ThData[i].iPart = iPart++;
+            ThData[i].fWorking = 1;
+            fWorkToDo = 1;
+        }
+    }
+    // stop the threads
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        ThData[i].fWorking = 1;
+    }
+    for (i = 0; i < nProcs; i++)
+        pthread_join(WorkerThread[i], NULL);
+    Vec_WecFree(vParts);
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Internal procedure for register correspondence.]
+
+  Description [Returns 0 if the refinement was stopped before reaching
+  the fixed point (the property output is gone or the refinement was
+  interrupted), in which case the classes are not proved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
 ***********************************************************************/
 int Cec_ManLSCorrespondenceClasses(Gia_Man_t* pAig, Cec_ParCor_t* pPars) {
     int nIterMax = 100000;
@@ -874,9 +1087,9 @@ int Cec_ManLSCorrespondenceClasses(Gia_Man_t* pAig, Cec_ParCor_t* pPars) {
     if (pPars->fUseCSat)
         pParsSat->nBTLimit = Abc_MinInt(pParsSat->nBTLimit, 1000);
     if (pPars->fVerbose) {
-        Abc_Print(1, "Obj = %7d. And = %7d. Conf = %5d. Fr = %d. Lcorr = %d. Ring = %d. CSat = %d.\n",
+        Abc_Print(1, "Obj = %7d. And = %7d. Conf = %5d. Fr = %d. Lcorr = %d. Ring = %d. CSat = %d. Threads = %d.\n",
                   Gia_ManObjNum(pAig), Gia_ManAndNum(pAig),
-                  pPars->nBTLimit, pPars->nFrames, pPars->fLatchCorr, pPars->fUseRings, pPars->fUseCSat);
+                  pPars->nBTLimit, pPars->nFrames, pPars->fLatchCorr, pPars->fUseRings, pPars->fUseCSat, pPars->nProcs);
         Cec_ManRefinedClassPrintStats(pAig, NULL, 0, Abc_Clock() - clk);
     }
     // check the base case
@@ -893,6 +1106,12 @@ int Cec_ManLSCorrespondenceClasses(Gia_Man_t* pAig, Cec_ParCor_t* pPars) {
     }
     // perform refinement of equivalence classes
     for (r = 0; r < nIterMax; r++) {
+        if ((pPars->pStop && *pPars->pStop) || (pPars->nTimeToStop && Abc_Clock() >= pPars->nTimeToStop)) {
+            if (pPars->fVerbose)
+                Abc_Print(1, "Signal correspondence is interrupted after %d refinement iterations.\n", r);
+            Cec_ManSimStop(pSim);
+            return 0;
+        }
         if (pPars->nStepsMax == r) {
             Cec_ManSimStop(pSim);
             Abc_Print(1, "Stopped signal correspondence after %d refiment iterations.\n", r);
@@ -912,10 +1131,7 @@ int Cec_ManLSCorrespondenceClasses(Gia_Man_t* pAig, Cec_ParCor_t* pPars) {
         //Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
         // found counter-examples to speculation
         clk2 = Abc_Clock();
-        if (pPars->fUseCSat)
-            vCexStore = Cbs_ManSolveMiterNc(pSrm, pPars->nBTLimit, &vStatus, 0, 0);
-        else
-            vCexStore = Cec_ManSatSolveMiter(pSrm, pParsSat, &vStatus);
+        vCexStore = Cec_ManLSCorrSolvePar(pSrm, pPars, pParsSat, &vStatus);
         Gia_ManStop(pSrm);
         clkSat += Abc_Clock() - clk2;
         if (Vec_IntSize(vCexStore) == 0) {
@@ -22,6 +22,7 @@
 #include "aig/gia/gia.h"
 #include "aig/gia/giaAig.h"
 #include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
 #include "sat/bsat/satSolver.h"
 #include "misc/util/utilTruth.h"
 //#include "bdd/cudd/cuddInt.h"
@@ -538,6 +539,9 @@ void* Cec_GiaSplitWorkerThread(void* pArg) {
             ;
         assert(pThData->fWorking);
         if (pThData->p == NULL) {
+            // free the managers allocated by this thread
+            Cnf_ManFree();
+            Dar_LibStop();
             pthread_exit(NULL);
             assert(0);
             return NULL;
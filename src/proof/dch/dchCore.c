@@ -55,6 +55,7 @@ void Dch_ManSetDefaultParams(Dch_Pars_t* p) {
     p->fVerbose = 0;        // verbose stats
     p->nNodesAhead = 1000;  // the lookahead in terms of nodes
     p->nCallsRecycle = 100; // calls to perform before recycling SAT solver
+    p->nProcs = 1;          // the number of concurrent threads
 }
 
 /**Function*************************************************************
@@ -98,7 +99,10 @@ Aig_Man_t* Dch_ComputeChoices(Aig_Man_t* pAig, Dch_Pars_t* pPars) {
     //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum(p->ppClasses);
     // perform SAT sweeping
-    Dch_ManSweep(p);
+    if (pPars->nProcs > 1)
+        Dch_ManSweepPar(p);
+    else
+        Dch_ManSweep(p);
     // free memory ahead of time
     p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop(p);
@@ -143,7 +147,10 @@ void Dch_ComputeEquivalences(Aig_Man_t* pAig, Dch_Pars_t* pPars) {
     //    Dch_ClassesPrint( p->ppClasses, 0 );
     p->nLits = Dch_ClassesLitNum(p->ppClasses);
     // perform SAT sweeping
-    Dch_ManSweep(p);
+    if (pPars->nProcs > 1)
+        Dch_ManSweepPar(p);
+    else
+        Dch_ManSweep(p);
     // free memory ahead of time
     p->timeTotal = Abc_Clock() - clkTotal;
     Dch_ManStop(p);
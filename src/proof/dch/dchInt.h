@@ -138,7 +138,15 @@ extern void Dch_ManStop(Dch_Man_t* p);
 extern void Dch_ManSatSolverRecycle(Dch_Man_t* p);
 /*=== dchSat.c ===================================================*/
 extern int Dch_NodesAreEquiv(Dch_Man_t* p, Aig_Obj_t* pObj1, Aig_Obj_t* pObj2);
+/*=== dchPar.c ===================================================*/
+extern void Dch_ManSweepPar(Dch_Man_t* p);
 /*=== dchSim.c ===================================================*/
+extern int Dch_NodeIsConstCex(void* p, Aig_Obj_t* pObj);
+extern int Dch_NodesAreEqualCex(void* p, Aig_Obj_t* pObj0, Aig_Obj_t* pObj1);
+extern unsigned Dch_NodeHash(void* p, Aig_Obj_t* pObj);
+extern int Dch_NodeIsConst(void* p, Aig_Obj_t* pObj);
+extern int Dch_NodesAreEqual(void* p, Aig_Obj_t* pObj0, Aig_Obj_t* pObj1);
+extern void Dch_PerformSimulation(Aig_Man_t* pAig, Vec_Ptr_t* vSims);
 extern Dch_Cla_t* Dch_CreateCandEquivClasses(Aig_Man_t* pAig, int nWords, int fVerbose);
 /*=== dchSimSat.c ===================================================*/
 extern void Dch_ManResimulateCex(Dch_Man_t* p, Aig_Obj_t* pObj, Aig_Obj_t* pRepr);
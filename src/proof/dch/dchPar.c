@@ -0,0 +1,333 @@
+/**CFile****************************************************************
+
+  FileName    [dchPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [SAT sweeping with several threads.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 29, 2008.]
+
+  Revision    [$Id: dchPar.c,v 1.00 2008/07/29 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "dchInt.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+#define DCH_PAR_BATCH 64 // the number of candidates given to one thread in one round
+
+// information given to the thread
+typedef struct Dch_ParThData_t_ Dch_ParThData_t;
+struct Dch_ParThData_t_ {
+    Dch_Man_t* p;          // the private SAT solving manager
+    Vec_Int_t* vPairs;     // pairs of node and representative IDs (NULL to quit)
+    Vec_Int_t* vStatus;    // the status of each pair (1 = proved, 0 = disproved, -1 = undecided)
+    Vec_Int_t* vCexes;     // the values of the CIs in each counter-example
+    volatile int fWorking; // set while the pairs are being solved
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using the counter-examples.]
+
+  Description [The counter-examples found by all threads in one round
+  are simulated together as bit-patterns of the CIs. The remaining bits
+  of the last word are filled with random patterns.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSimulateCexes(Dch_Man_t* p, Vec_Int_t* vCexes) {
+    Vec_Ptr_t* vSims;
+    Aig_Obj_t* pObj;
+    unsigned *pSim, *pCex;
+    int i, k, nCiWords = Abc_BitWordNum(Aig_ManCiNum(p->pAigTotal));
+    int nCexes = Vec_IntSize(vCexes) / nCiWords;
+    int nWords = Abc_BitWordNum(nCexes);
+    abctime clk = Abc_Clock();
+    vSims = Vec_PtrAllocSimInfo(Aig_ManObjNumMax(p->pAigTotal), nWords);
+    Aig_ManForEachCi(p->pAigTotal, pObj, i) {
+        pSim = (unsigned*)Vec_PtrEntry(vSims, pObj->Id);
+        for (k = 0; k < nWords; k++)
+            pSim[k] = Aig_ManRandom(0);
+        for (k = 0; k < nCexes; k++) {
+            pCex = (unsigned*)Vec_IntEntryP(vCexes, k * nCiWords);
+            if (Abc_InfoHasBit(pCex, i) != Abc_InfoHasBit(pSim, k))
+                Abc_InfoXorBit(pSim, k);
+        }
+    }
+    Dch_PerformSimulation(p->pAigTotal, vSims);
+    // refine the constant candidates and the classes
+    Dch_ClassesSetData(p->ppClasses, vSims, Dch_NodeHash, Dch_NodeIsConst, Dch_NodesAreEqual);
+    Vec_PtrClear(p->vSimRoots);
+    Aig_ManForEachObj(p->pAigTotal, pObj, i) if (Dch_ObjIsConst1Cand(p->pAigTotal, pObj))
+        Vec_PtrPush(p->vSimRoots, pObj);
+    Dch_ClassesRefineConst1Group(p->ppClasses, p->vSimRoots, 1);
+    Dch_ClassesRefine(p->ppClasses);
+    Dch_ClassesSetData(p->ppClasses, NULL, NULL, Dch_NodeIsConstCex, Dch_NodesAreEqualCex);
+    Vec_PtrFree(vSims);
+    p->timeSimSat += Abc_Clock() - clk;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+void Dch_ManSweepPar(Dch_Man_t* p) {
+    Dch_ManSweep(p);
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the SAT solving manager of one thread.]
+
+  Description [The thread solves the candidate pairs directly on the
+  shared AIG, which it does not modify.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dch_Man_t* Dch_ManCreateThread(Dch_Man_t* pMan) {
+    Dch_Man_t* p;
+    p = ABC_ALLOC(Dch_Man_t, 1);
+    memset(p, 0, sizeof(Dch_Man_t));
+    p->pPars = pMan->pPars;
+    p->pAigTotal = pMan->pAigTotal;
+    p->pAigFraig = pMan->pAigTotal;
+    p->nSatVars = 1;
+    p->pSatVars = ABC_CALLOC(int, Aig_ManObjNumMax(p->pAigTotal));
+    p->vUsedNodes = Vec_PtrAlloc(1000);
+    p->vFanins = Vec_PtrAlloc(100);
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the manager of one thread and collects the statistics.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManStopThread(Dch_Man_t* pMan, Dch_Man_t* p) {
+    pMan->nSatCalls += p->nSatCalls;
+    pMan->nSatProof += p->nSatProof;
+    pMan->nSatFailsReal += p->nSatFailsReal;
+    pMan->nSatCallsUnsat += p->nSatCallsUnsat;
+    pMan->nSatCallsSat += p->nSatCallsSat;
+    pMan->nRecycles += p->nRecycles;
+    pMan->nSatVars = Abc_MaxInt(pMan->nSatVars, p->nSatVars);
+    pMan->timeSat = Abc_MaxWord(pMan->timeSat, p->timeSat);
+    pMan->timeSatSat = Abc_MaxWord(pMan->timeSatSat, p->timeSatSat);
+    pMan->timeSatUnsat = Abc_MaxWord(pMan->timeSatUnsat, p->timeSatUnsat);
+    pMan->timeSatUndec = Abc_MaxWord(pMan->timeSatUndec, p->timeSatUndec);
+    if (p->pSat)
+        sat_solver_delete(p->pSat);
+    Vec_PtrFree(p->vUsedNodes);
+    Vec_PtrFree(p->vFanins);
+    ABC_FREE(p->pSatVars);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the candidate pairs given to one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSolvePairs(Dch_ParThData_t* pThData) {
+    Dch_Man_t* p = pThData->p;
+    Aig_Obj_t* pObj;
+    unsigned* pCex;
+    int i, k, iObj, iRepr, iVar, RetValue, nCiWords = Abc_BitWordNum(Aig_ManCiNum(p->pAigTotal));
+    Vec_IntClear(pThData->vStatus);
+    Vec_IntClear(pThData->vCexes);
+    Vec_IntForEachEntryDouble(pThData->vPairs, iObj, iRepr, i) {
+        RetValue = Dch_NodesAreEquiv(p, Aig_ManObj(p->pAigTotal, iRepr), Aig_ManObj(p->pAigTotal, iObj));
+        Vec_IntPush(pThData->vStatus, RetValue);
+        if (RetValue != 0)
+            continue;
+        // save the values of the CIs (the CIs outside of the cones get 0)
+        Vec_IntFillExtra(pThData->vCexes, Vec_IntSize(pThData->vCexes) + nCiWords, 0);
+        pCex = (unsigned*)Vec_IntEntryP(pThData->vCexes, Vec_IntSize(pThData->vCexes) - nCiWords);
+        Aig_ManForEachCi(p->pAigTotal, pObj, k) {
+            iVar = Dch_ObjSatNum(p, pObj);
+            if (iVar && sat_solver_var_value(p->pSat, iVar))
+                Abc_InfoSetBit(pCex, k);
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Thread solving the candidate pairs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Dch_ManSweepWorkerThread(void* pArg) {
+    Dch_ParThData_t* pThData = (Dch_ParThData_t*)pArg;
+    volatile int* pPlace = &pThData->fWorking;
+    while (1) {
+        while (*pPlace == 0)
+            ;
+        assert(pThData->fWorking);
+        if (pThData->vPairs == NULL) {
+            // free the managers allocated by this thread
+            Cnf_ManFree();
+            Dar_LibStop();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        Dch_ManSolvePairs(pThData);
+        pThData->fWorking = 0;
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs SAT sweeping with several threads.]
+
+  Description [The nodes are visited in the topological order, as in
+  Dch_ManSweep(), and each node is compared with its representative once.
+  In each round, the next candidates are divided into contiguous batches
+  solved by the threads, each keeping its own SAT solver across the rounds.
+  The counter-examples of all threads are then simulated together to refine
+  the classes before the next round. The proved equivalences are recorded
+  in the same way as by the sequential sweeping.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSweepPar(Dch_Man_t* p) {
+    Dch_ParThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Vec_Int_t* vCexes = Vec_IntAlloc(1000);
+    Aig_Obj_t *pObj, *pRepr;
+    int nProcs = Abc_MinInt(p->pPars->nProcs, PAR_THR_MAX);
+    int i, k, iObj, iRepr, status, fWorkToDo, nCands, nRounds = 0, iCur = 0;
+    abctime clk = Abc_Clock();
+    // start the threads
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].p = Dch_ManCreateThread(p);
+        ThData[i].vPairs = Vec_IntAlloc(2 * DCH_PAR_BATCH);
+        ThData[i].vStatus = Vec_IntAlloc(DCH_PAR_BATCH);
+        ThData[i].vCexes = Vec_IntAlloc(1000);
+        ThData[i].fWorking = 0;
+        status = pthread_create(WorkerThread + i, NULL, Dch_ManSweepWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    while (iCur < Aig_ManObjNumMax(p->pAigTotal)) {
+        // distribute the next candidates among the threads
+        for (i = 0; i < nProcs; i++)
+            Vec_IntClear(ThData[i].vPairs);
+        for (nCands = 0; iCur < Aig_ManObjNumMax(p->pAigTotal) && nCands < nProcs * DCH_PAR_BATCH; iCur++) {
+            pObj = Aig_ManObj(p->pAigTotal, iCur);
+            if (pObj == NULL || !Aig_ObjIsNode(pObj))
+                continue;
+            if ((pRepr = Aig_ObjRepr(p->pAigTotal, pObj)) == NULL)
+                continue;
+            Vec_IntPushTwo(ThData[nCands++ / DCH_PAR_BATCH].vPairs, pObj->Id, pRepr->Id);
+        }
+        if (nCands == 0)
+            break;
+        nRounds++;
+        for (i = 0; i < nProcs; i++)
+            if (Vec_IntSize(ThData[i].vPairs) > 0)
+                ThData[i].fWorking = 1;
+        // wait for the threads to finish
+        for (fWorkToDo = 1; fWorkToDo;)
+            for (fWorkToDo = i = 0; i < nProcs; i++)
+                fWorkToDo |= ThData[i].fWorking;
+        // record the proved equivalences and collect the counter-examples
+        Vec_IntClear(vCexes);
+        for (i = 0; i < nProcs; i++) {
+            Vec_IntForEachEntryDouble(ThData[i].vPairs, iObj, iRepr, k) if (Vec_IntEntry(ThData[i].vStatus, k / 2) == 1)
+                p->pReprsProved[iObj] = Aig_ManObj(p->pAigTotal, iRepr);
+            Vec_IntAppend(vCexes, ThData[i].vCexes);
+        }
+        if (Vec_IntSize(vCexes) > 0)
+            Dch_ManSimulateCexes(p, vCexes);
+    }
+    // stop the threads
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        Vec_IntFree(ThData[i].vPairs);
+        ThData[i].vPairs = NULL;
+        ThData[i].fWorking = 1;
+    }
+    for (i = 0; i < nProcs; i++) {
+        pthread_join(WorkerThread[i], NULL);
+        Dch_ManStopThread(p, ThData[i].p);
+        Vec_IntFree(ThData[i].vStatus);
+        Vec_IntFree(ThData[i].vCexes);
+    }
+    Vec_IntFree(vCexes);
+    if (p->pPars->fVerbose) {
+        Abc_Print(1, "Parallel sweeping with %d threads used %d rounds.  ", nProcs, nRounds);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    }
+    // update the representatives of the nodes (makes classes invalid)
+    ABC_FREE(p->pAigTotal->pReprs);
+    p->pAigTotal->pReprs = p->pReprsProved;
+    p->pReprsProved = NULL;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -181,16 +181,10 @@ int Dch_NodesAreEqual(void* p, Aig_Obj_t* pObj0, Aig_Obj_t* pObj1) {
 
 ***********************************************************************/
 void Dch_PerformRandomSimulation(Aig_Man_t* pAig, Vec_Ptr_t* vSims) {
-    unsigned *pSim, *pSim0, *pSim1;
+    unsigned* pSim;
     Aig_Obj_t* pObj;
     int i, k, nWords;
     nWords = (unsigned*)Vec_PtrEntry(vSims, 1) - (unsigned*)Vec_PtrEntry(vSims, 0);
-
-    // assign const 1 sim info
-    pObj = Aig_ManConst1(pAig);
-    pSim = Dch_ObjSim(vSims, pObj);
-    memset(pSim, 0xff, sizeof(unsigned) * nWords);
-
     // assign primary input random sim info
     Aig_ManForEachCi(pAig, pObj, i) {
         pSim = Dch_ObjSim(vSims, pObj);
@@ -198,6 +192,30 @@ void Dch_PerformRandomSimulation(Aig_Man_t* pAig, Vec_Ptr_t* vSims) {
             pSim[k] = Dch_ObjRandomSim();
         pSim[0] <<= 1;
     }
+    Dch_PerformSimulation(pAig, vSims);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the internal nodes.]
+
+  Description [Assumes that the sim info of the primary inputs is assigned.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_PerformSimulation(Aig_Man_t* pAig, Vec_Ptr_t* vSims) {
+    unsigned *pSim, *pSim0, *pSim1;
+    Aig_Obj_t* pObj;
+    int i, k, nWords;
+    nWords = (unsigned*)Vec_PtrEntry(vSims, 1) - (unsigned*)Vec_PtrEntry(vSims, 0);
+
+    // assign const 1 sim info
+    pObj = Aig_ManConst1(pAig);
+    pSim = Dch_ObjSim(vSims, pObj);
+    memset(pSim, 0xff, sizeof(unsigned) * nWords);
 
     // simulate AIG in the topological order
     Aig_ManForEachNode(pAig, pObj, i) {
@@ -337,7 +337,7 @@ extern Aig_Man_t* Fra_FraigInduction(Aig_Man_t* p, Fra_Ssw_t* pPars);
 /*=== fraIndVer.c =====================================================*/
 extern int Fra_InvariantVerify(Aig_Man_t* p, int nFrames, Vec_Int_t* vClauses, Vec_Int_t* vLits);
 /*=== fraLcr.c ========================================================*/
-extern Aig_Man_t* Fra_FraigLatchCorrespondence(Aig_Man_t* pAig, int nFramesP, int nConfMax, int fProve, int fVerbose, int* pnIter, float TimeLimit);
+extern Aig_Man_t* Fra_FraigLatchCorrespondence(Aig_Man_t* pAig, int nFramesP, int nSimFrames, int nConfMax, int fProve, int fVerbose, int* pnIter, float TimeLimit);
 /*=== fraMan.c ========================================================*/
 extern void Fra_ParamsDefault(Fra_Par_t* pParams);
 extern void Fra_ParamsDefaultSeq(Fra_Par_t* pParams);
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "fra.h"
+#include "aig/saig/saig.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,6 +39,8 @@ struct Fra_Lcr_t_ {
     int* pInToOutNum;  // mapping of PI num into the num of this PO in the partition
     // AIGs for the partitions
     Vec_Ptr_t* vFraigs;
+    // simulator used to refine the initial classes
+    Saig_SimCkp_t* pSimCkp;
     // other variables
     int fRefining;
     // parameters
@@ -183,6 +186,89 @@ void Fra_LcrAigPrepareTwo(Aig_Man_t* pAig, Fra_Man_t* p) {
         = p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Compares two registers using the current frame of the simulator.]
+
+  Description [Only the patterns satisfying the constraints are compared.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_LcrSimNodesAreEqual(Aig_Obj_t* pObj0, Aig_Obj_t* pObj1) {
+    Fra_Man_t* pTemp = (Fra_Man_t*)pObj0->pData;
+    Saig_SimCkp_t* pSim = ((Fra_Lcr_t*)pTemp->pBmc)->pSimCkp;
+    word* pSim0 = Saig_SimCkpObjSim(pSim, pObj0->Id);
+    word* pSim1 = Saig_SimCkpObjSim(pSim, pObj1->Id);
+    word* pValid = Saig_SimCkpValid(pSim);
+    int w;
+    for (w = 0; w < Saig_SimCkpWordNum(pSim); w++)
+        if ((pSim0[w] ^ pSim1[w]) & pValid[w])
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the constant register using the current frame of the simulator.]
+
+  Description [Only the patterns satisfying the constraints are checked.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fra_LcrSimNodeIsConst(Aig_Obj_t* pObj) {
+    Fra_Man_t* pTemp = (Fra_Man_t*)pObj->pData;
+    Saig_SimCkp_t* pSim = ((Fra_Lcr_t*)pTemp->pBmc)->pSimCkp;
+    word* pSim0 = Saig_SimCkpObjSim(pSim, pObj->Id);
+    word* pValid = Saig_SimCkpValid(pSim);
+    int w;
+    for (w = 0; w < Saig_SimCkpWordNum(pSim); w++)
+        if (pSim0[w] & pValid[w])
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refines the register classes using long simulation.]
+
+  Description [Simulates nSimFrames frames from the initial state keeping
+  only the register values at the checkpoints. Then replays the frames
+  starting from the first checkpoint and refines the classes using the
+  exact register values of each frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Fra_LcrRefineSimCkp(Fra_Lcr_t* p, int nSimFrames) {
+    int f, nLitsOld = Fra_ClassesCountLits(p->pCla);
+    abctime clk = Abc_Clock();
+    p->pSimCkp = Saig_SimCkpStart(p->pAig, 4, 0);
+    Saig_SimCkpRun(p->pSimCkp, nSimFrames, 1, 0);
+    p->pCla->pFuncNodeIsConst = Fra_LcrSimNodeIsConst;
+    p->pCla->pFuncNodesAreEqual = Fra_LcrSimNodesAreEqual;
+    for (f = 0; f < Saig_SimCkpFrameNum(p->pSimCkp); f++) {
+        Saig_SimCkpFrame(p->pSimCkp, f);
+        Fra_ClassesRefine(p->pCla);
+        Fra_ClassesRefine1(p->pCla, 1, NULL);
+    }
+    if (p->fVerbose) {
+        printf("Simulated %d frames with checkpoints (%.2f MB). Lits: %d -> %d.  ", nSimFrames,
+               Saig_SimCkpMemory(p->pSimCkp) / (1 << 20), nLitsOld, Fra_ClassesCountLits(p->pCla));
+        ABC_PRT("Time", Abc_Clock() - clk);
+    }
+    p->timeSim += Abc_Clock() - clk;
+    Saig_SimCkpStop(p->pSimCkp);
+    p->pSimCkp = NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Compares two nodes for equivalence after partitioned fraiging.]
@@ -486,14 +572,15 @@ void Fra_ClassNodesUnmark(Fra_Lcr_t* p) {
 
   Synopsis    [Performs choicing of the AIG.]
 
-  Description []
+  Description [If nSimFrames is positive, the initial classes are refined
+  by simulating this many frames with checkpoints.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t* Fra_FraigLatchCorrespondence(Aig_Man_t* pAig, int nFramesP, int nConfMax, int fProve, int fVerbose, int* pnIter, float TimeLimit) {
+Aig_Man_t* Fra_FraigLatchCorrespondence(Aig_Man_t* pAig, int nFramesP, int nSimFrames, int nConfMax, int fProve, int fVerbose, int* pnIter, float TimeLimit) {
     int nPartSize = 200;
     int fReprSelect = 0;
     Fra_Lcr_t* p;
@@ -542,6 +629,8 @@ Aig_Man_t* Fra_FraigLatchCorrespondence(Aig_Man_t* pAig, int nFramesP, int nConf
     // get preliminary info about equivalence classes
     pTemp->pCla = p->pCla = Fra_ClassesStart(p->pAig);
     Fra_ClassesPrepare(p->pCla, 1, 0);
+    if (nSimFrames > 0)
+        Fra_LcrRefineSimCkp(p, nSimFrames);
     p->pCla->pFuncNodeIsConst = Fra_LcrNodeIsConst;
     p->pCla->pFuncNodesAreEqual = Fra_LcrNodesAreEqual;
     Fra_SmlStop(pTemp->pSml);
@@ -93,7 +93,7 @@ void Fra_SecSetDefaultParams(Fra_Sec_t* p) {
 int Fra_FraigSec(Aig_Man_t* p, Fra_Sec_t* pParSec, Aig_Man_t** ppResult) {
     Ssw_Pars_t Pars2, *pPars2 = &Pars2;
     Fra_Ssw_t Pars, *pPars = &Pars;
-    Fra_Sml_t* pSml;
+    Saig_SimCkp_t* pSim;
     Aig_Man_t *pNew, *pTemp;
     int nFrames, RetValue, nIter;
     abctime clk, clkTotal = Abc_Clock();
@@ -183,7 +183,7 @@ int Fra_FraigSec(Aig_Man_t* p, Fra_Sec_t* pParSec, Aig_Man_t** ppResult) {
     }
 */
 
-        //    pNew = Fra_FraigLatchCorrespondence( pTemp = pNew, 0, 1000, 1, pParSec->fVeryVerbose, &nIter, TimeLeft );
+        //    pNew = Fra_FraigLatchCorrespondence( pTemp = pNew, 0, 0, 1000, 1, pParSec->fVeryVerbose, &nIter, TimeLeft );
         //Aig_ManDumpBlif( pNew, "ex.blif", NULL, NULL );
         Ssw_ManSetDefaultParamsLcorr(pPars2);
         pNew = Ssw_LatchCorrespondence(pTemp = pNew, pPars2);
@@ -399,14 +399,15 @@ int Fra_FraigSec(Aig_Man_t* p, Fra_Sec_t* pParSec, Aig_Man_t** ppResult) {
             // perform sequential simulation
             if (pNew->nRegs) {
                 clk = Abc_Clock();
-                pSml = Fra_SmlSimulateSeq(pNew, 0, 128 * nFrames, 1 + 16 / (1 + Aig_ManNodeNum(pNew) / 1000), 1);
+                pSim = Saig_SimCkpStart(pNew, 1 + 16 / (1 + Aig_ManNodeNum(pNew) / 1000), 0);
+                RetValue = Saig_SimCkpRun(pSim, 128 * nFrames, 1, 1);
                 if (pParSec->fVerbose) {
                     printf("Seq simulation  :     Latches = %5d. Nodes = %6d. ",
                            Aig_ManRegNum(pNew), Aig_ManNodeNum(pNew));
                     ABC_PRT("Time", Abc_Clock() - clk);
                 }
-                if (pSml->fNonConstOut) {
-                    pNew->pSeqModel = Fra_SmlGetCounterExample(pSml);
+                if (RetValue) {
+                    pNew->pSeqModel = Saig_SimCkpDeriveCex(pSim);
                     // transfer to the original manager
                     if (Saig_ManPiNum(p) != Saig_ManPiNum(pNew))
                         printf("The counter-example is invalid because of phase abstraction.\n");
@@ -416,7 +417,7 @@ int Fra_FraigSec(Aig_Man_t* p, Fra_Sec_t* pParSec, Aig_Man_t** ppResult) {
                         ABC_FREE(pNew->pSeqModel);
                     }
 
-                    Fra_SmlStop(pSml);
+                    Saig_SimCkpStop(pSim);
                     Aig_ManStop(pNew);
                     RetValue = 0;
                     if (!pParSec->fSilent) {
@@ -429,7 +430,7 @@ int Fra_FraigSec(Aig_Man_t* p, Fra_Sec_t* pParSec, Aig_Man_t** ppResult) {
                     }
                     return RetValue;
                 }
-                Fra_SmlStop(pSml);
+                Saig_SimCkpStop(pSim);
             }
         }
 
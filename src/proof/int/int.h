@@ -43,25 +43,30 @@ ABC_NAMESPACE_HEADER_START
 // simulation manager
 typedef struct Inter_ManParams_t_ Inter_ManParams_t;
 struct Inter_ManParams_t_ {
-    int nBTLimit;      // limit on the number of conflicts
-    int nFramesMax;    // the max number timeframes to unroll
-    int nSecLimit;     // time limit in seconds
-    int nFramesK;      // the number of timeframes to use in induction
-    int fRewrite;      // use additional rewriting to simplify timeframes
-    int fTransLoop;    // add transition into the init state under new PI var
-    int fUsePudlak;    // use Pudluk interpolation procedure
-    int fUseOther;     // use other undisclosed option
-    int fUseMiniSat;   // use MiniSat-1.14p instead of internal proof engine
-    int fCheckKstep;   // check using K-step induction
-    int fUseBias;      // bias decisions to global variables
-    int fUseBackward;  // perform backward interpolation
-    int fUseSeparate;  // solve each output separately
-    int fUseTwoFrames; // create the OR of two last timeframes
-    int fDropSatOuts;  // replace by 1 the solved outputs
-    int fDropInvar;    // dump inductive invariant into file
-    int fVerbose;      // print verbose statistics
-    int iFrameMax;     // the time frame reached
-    char* pFileName;   // file name to dump interpolant
+    int nBTLimit;          // limit on the number of conflicts
+    int nFramesMax;        // the max number timeframes to unroll
+    int nSecLimit;         // time limit in seconds
+    int nFramesK;          // the number of timeframes to use in induction
+    int fRewrite;          // use additional rewriting to simplify timeframes
+    int fTransLoop;        // add transition into the init state under new PI var
+    int fUsePudlak;        // use Pudluk interpolation procedure
+    int fUseOther;         // use other undisclosed option
+    int fUseMiniSat;       // use MiniSat-1.14p instead of internal proof engine
+    int fCheckKstep;       // check using K-step induction
+    int fUseBias;          // bias decisions to global variables
+    int fUseBackward;      // perform backward interpolation
+    int fUseSeparate;      // solve each output separately
+    int fUseTwoFrames;     // create the OR of two last timeframes
+    int fDropSatOuts;      // replace by 1 the solved outputs
+    int fDropInvar;        // dump inductive invariant into file
+    int fVerbose;          // print verbose statistics
+    int iFrameMax;         // the time frame reached
+    char* pFileName;       // file name to dump interpolant
+    int nProcs;            // the number of threads exploring different depths
+    int nFramesStart;      // the number of timeframes to start with
+    int nProofMemMax;      // the limit on proof-logging memory in MB (0 = no limit)
+    int RunId;             // interpolation id in this run
+    int (*pFuncStop)(int); // callback to terminate
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -75,6 +80,8 @@ struct Inter_ManParams_t_ {
 /*=== intCore.c ==========================================================*/
 extern void Inter_ManSetDefaultParams(Inter_ManParams_t* p);
 extern int Inter_ManPerformInterpolation(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int* piFrame);
+/*=== intPar.c ==========================================================*/
+extern int Inter_ManPerformInterpolationPar(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int* piFrame);
 
 ABC_NAMESPACE_HEADER_END
 
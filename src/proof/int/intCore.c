@@ -61,6 +61,9 @@ void Inter_ManSetDefaultParams(Inter_ManParams_t* p) {
     p->fDropSatOuts = 0;  // replace by 1 the solved outputs
     p->fVerbose = 0;      // print verbose statistics
     p->iFrameMax = -1;
+    p->nProcs = 1;        // the number of threads exploring different depths
+    p->nFramesStart = 1;  // the number of timeframes to start with
+    p->nProofMemMax = 0;  // the limit on proof-logging memory in MB
 }
 
 /**Function*************************************************************
@@ -83,6 +86,10 @@ int Inter_ManPerformInterpolation(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int
     abctime clk, clk2, clkTotal = Abc_Clock(), timeTemp = 0;
     abctime nTimeNewOut = pPars->nSecLimit ? pPars->nSecLimit * CLOCKS_PER_SEC + Abc_Clock() : 0;
 
+    // explore several unrolling depths concurrently
+    if (pPars->nProcs > 1)
+        return Inter_ManPerformInterpolationPar(pAig, pPars, piFrame);
+
     // enable ORing of the interpolants, if containment check is performed inductively with K > 1
     if (pPars->nFramesK > 1)
         pPars->fTransLoop = 1;
@@ -126,7 +133,7 @@ int Inter_ManPerformInterpolation(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int
 
     // derive interpolant
     *piFrame = -1;
-    p->nFrames = 1;
+    p->nFrames = Abc_MaxInt(1, pPars->nFramesStart);
     for (s = 0;; s++) {
         Cnf_Dat_t* pCnfInter2;
 
@@ -193,6 +200,12 @@ int Inter_ManPerformInterpolation(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int
                 Inter_CheckStop(pCheck);
                 return -1;
             }
+            if (pPars->pFuncStop && pPars->pFuncStop(pPars->RunId)) {
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop(p, 0);
+                Inter_CheckStop(pCheck);
+                return -1;
+            }
 
             // perform interpolation
             clk = Abc_Clock();
@@ -246,6 +259,12 @@ int Inter_ManPerformInterpolation(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int
                 {
                     if (pPars->fVerbose)
                         printf("Reached timeout (%d seconds).\n", pPars->nSecLimit);
+                } else if (p->fProofOut) {
+                    if (pPars->fVerbose)
+                        printf("Reached limit (%d MB) on proof-logging memory.\n", pPars->nProofMemMax);
+                } else if (pPars->pFuncStop && pPars->pFuncStop(pPars->RunId)) {
+                    if (pPars->fVerbose)
+                        printf("Interpolation was cancelled.\n");
                 } else {
                     assert(p->nConfCur >= p->nConfLimit);
                     if (pPars->fVerbose)
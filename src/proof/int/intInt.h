@@ -60,10 +60,12 @@ struct Inter_Man_t_ {
     Aig_Man_t* pInterNew;
     Vec_Ptr_t* vInters;
     // parameters
-    int nFrames;    // the number of timeframes
-    int nConfCur;   // the current number of conflicts
-    int nConfLimit; // the limit on the number of conflicts
-    int fVerbose;   // the verbosiness flag
+    int nFrames;              // the number of timeframes
+    int nConfCur;             // the current number of conflicts
+    int nConfLimit;           // the limit on the number of conflicts
+    int fVerbose;             // the verbosiness flag
+    int fProofOut;            // the last step exceeded the proof-logging memory
+    Inter_ManParams_t* pPars; // the parameters
     char* pFileName;
     // runtime
     abctime timeRwr;
@@ -207,6 +207,10 @@ int Inter_ManPerformOneStep(Inter_Man_t* p, int fUseBias, int fUseBackward, abct
     // set runtime limit
     if (nTimeNewOut)
         sat_solver_set_runtime_limit(pSat, nTimeNewOut);
+    // set the limit on proof logging and the termination callback
+    sat_solver_set_store_limit(pSat, p->pPars->nProofMemMax);
+    sat_solver_set_runid(pSat, p->pPars->RunId);
+    sat_solver_set_stop_func(pSat, p->pPars->pFuncStop);
 
     // collect global variables
     pGlobalVars = ABC_CALLOC(int, sat_solver_nvars(pSat));
@@ -229,6 +233,7 @@ int Inter_ManPerformOneStep(Inter_Man_t* p, int fUseBias, int fUseBackward, abct
     } else if (status == l_True) {
         RetValue = 0;
     } else {
+        p->fProofOut = sat_solver_store_mem_out(pSat);
         RetValue = -1;
     }
     sat_solver_delete(pSat);
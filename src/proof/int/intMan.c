@@ -51,6 +51,7 @@ Inter_Man_t* Inter_ManCreate(Aig_Man_t* pAig, Inter_ManParams_t* pPars) {
     p->nConfLimit = pPars->nBTLimit;
     p->fVerbose = pPars->fVerbose;
     p->pFileName = pPars->pFileName;
+    p->pPars = pPars;
     p->pAig = pAig;
     if (pPars->fDropInvar)
         p->vInters = Vec_PtrAlloc(100);
@@ -0,0 +1,246 @@
+/**CFile****************************************************************
+
+  FileName    [intPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Interpolation with several unrolling depths explored concurrently.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 24, 2008.]
+
+  Revision    [$Id: intPar.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "opt/dar/dar.h"
+#include "sat/bmc/bmc.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define PAR_THR_MAX 100
+#define PAR_RUN_MAX 1024
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the property in the first frames using BMC.]
+
+  Description [Returns 0 if the property fails (the counter-example is
+  stored in pAig->pSeqModel). Otherwise, returns -1 and sets *piFrameOk
+  to the last frame, in which the property is known to hold.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Inter_ManPerformBmcPrefix(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int nFrames, int* piFrameOk) {
+    Saig_ParBmc_t ParsBmc, *pParsBmc = &ParsBmc;
+    int RetValue;
+    Saig_ParBmcSetDefaultParams(pParsBmc);
+    pParsBmc->nFramesMax = nFrames;
+    pParsBmc->nConfLimit = pPars->nBTLimit;
+    pParsBmc->nTimeOut = pPars->nSecLimit;
+    pParsBmc->fSilent = 1;
+    RetValue = Saig_ManBmcScalable(pAig, pParsBmc);
+    *piFrameOk = pParsBmc->iFrame;
+    if (RetValue == 0) {
+        assert(pAig->pSeqModel != NULL);
+        return 0;
+    }
+    return -1;
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int Inter_ManPerformInterpolationPar(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int* piFrame) {
+    Inter_ManParams_t Pars = *pPars;
+    int RetValue;
+    Pars.nProcs = 1;
+    RetValue = Inter_ManPerformInterpolation(pAig, &Pars, piFrame);
+    pPars->iFrameMax = Pars.iFrameMax;
+    return RetValue;
+}
+
+#else // pthreads are used
+
+// information given to the thread
+typedef struct Inter_ThData_t_ {
+    Aig_Man_t* pAig;        // the private copy of the AIG
+    Inter_ManParams_t Pars; // the private copy of the parameters
+    int RetValue;           // the result of this thread
+    int iFrame;             // the frame of the counter-example
+    int fWinner;            // this thread has decided the problem first
+} Inter_ThData_t;
+
+// mutex to control access to shared variables
+static pthread_mutex_t g_IntMutex = PTHREAD_MUTEX_INITIALIZER;
+static volatile int g_nIntRunIds = 0;                 // the number of runs started
+static volatile int g_fIntRunStop[PAR_RUN_MAX] = {0}; // set to 1 when the run is decided
+
+// call back procedure for the interpolation engine
+static int Inter_ManParCallBackToStop(int RunId) {
+    return g_fIntRunStop[RunId % PAR_RUN_MAX];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem starting from one unrolling depth.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Inter_ManParWorkerThread(void* pArg) {
+    Inter_ThData_t* pThData = (Inter_ThData_t*)pArg;
+    int status;
+    pThData->RetValue = Inter_ManPerformInterpolation(pThData->pAig, &pThData->Pars, &pThData->iFrame);
+    if (pThData->RetValue != -1) {
+        status = pthread_mutex_lock(&g_IntMutex);
+        assert(status == 0);
+        if (!g_fIntRunStop[pThData->Pars.RunId % PAR_RUN_MAX]) {
+            g_fIntRunStop[pThData->Pars.RunId % PAR_RUN_MAX] = 1;
+            pThData->fWinner = 1;
+        }
+        status = pthread_mutex_unlock(&g_IntMutex);
+        assert(status == 0);
+    }
+    // free the managers allocated by this thread
+    Cnf_ManFree();
+    Dar_LibStop();
+    pthread_exit(NULL);
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs interpolation with several starting depths.]
+
+  Description [Thread k starts unrolling with nFramesStart + k timeframes
+  and increases the depth on spurious counter-examples as usual. The first
+  thread to prove or disprove the property cancels the others. Since
+  interpolation checks the property only in the last frame of the first
+  unrolling, the frames skipped by the deeper threads are checked by BMC
+  beforehand. Returns 1 if proved, 0 if failed, -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformInterpolationPar(Aig_Man_t* pAig, Inter_ManParams_t* pPars, int* piFrame) {
+    Inter_ThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    int i, status, RunId, iFrameOk, nFramesStart, nProcs, nSecLimit, RetValue = -1;
+    abctime clk = Abc_Clock();
+    nProcs = Abc_MinInt(pPars->nProcs, PAR_THR_MAX);
+    nFramesStart = Abc_MaxInt(1, pPars->nFramesStart);
+    *piFrame = -1;
+    // make sure the frames skipped by the deeper threads do not fail
+    if (Inter_ManPerformBmcPrefix(pAig, pPars, nFramesStart + nProcs - 1, &iFrameOk) == 0) {
+        *piFrame = pAig->pSeqModel->iFrame;
+        if (pPars->fVerbose)
+            printf("Found a real counterexample in frame %d while checking the first frames.\n", *piFrame);
+        return 0;
+    }
+    // the threads get the time left after BMC
+    nSecLimit = pPars->nSecLimit;
+    if (nSecLimit > 0) {
+        nSecLimit -= (int)((Abc_Clock() - clk) / CLOCKS_PER_SEC);
+        if (nSecLimit <= 0) {
+            if (pPars->fVerbose)
+                printf("Reached timeout (%d seconds) while checking the first frames.\n", pPars->nSecLimit);
+            return -1;
+        }
+    }
+    nProcs = Abc_MaxInt(1, Abc_MinInt(nProcs, iFrameOk - nFramesStart + 2));
+    // start the run
+    status = pthread_mutex_lock(&g_IntMutex);
+    assert(status == 0);
+    RunId = g_nIntRunIds++;
+    g_fIntRunStop[RunId % PAR_RUN_MAX] = 0;
+    status = pthread_mutex_unlock(&g_IntMutex);
+    assert(status == 0);
+    if (pPars->fVerbose)
+        printf("Running interpolation with %d threads starting with %d-%d timeframes.\n",
+               nProcs, nFramesStart, nFramesStart + nProcs - 1);
+    // start the threads
+    for (i = 0; i < nProcs; i++) {
+        memset(ThData + i, 0, sizeof(Inter_ThData_t));
+        ThData[i].pAig = Aig_ManDupSimple(pAig);
+        ThData[i].Pars = *pPars;
+        ThData[i].Pars.nProcs = 1;
+        ThData[i].Pars.nFramesStart = nFramesStart + i;
+        ThData[i].Pars.nSecLimit = nSecLimit;
+        ThData[i].Pars.fVerbose = 0;
+        ThData[i].Pars.RunId = RunId;
+        ThData[i].Pars.pFuncStop = Inter_ManParCallBackToStop;
+        ThData[i].RetValue = -1;
+        ThData[i].iFrame = -1;
+        status = pthread_create(WorkerThread + i, NULL, Inter_ManParWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    // wait for the threads to finish
+    for (i = 0; i < nProcs; i++)
+        pthread_join(WorkerThread[i], NULL);
+    // collect the results
+    pPars->iFrameMax = -1;
+    for (i = 0; i < nProcs; i++) {
+        pPars->iFrameMax = Abc_MaxInt(pPars->iFrameMax, ThData[i].Pars.iFrameMax);
+        if (ThData[i].fWinner) {
+            RetValue = ThData[i].RetValue;
+            *piFrame = ThData[i].iFrame;
+            if (RetValue == 0) {
+                ABC_FREE(pAig->pSeqModel);
+                pAig->pSeqModel = ThData[i].pAig->pSeqModel;
+                ThData[i].pAig->pSeqModel = NULL;
+            }
+            if (pPars->fVerbose) {
+                printf("Thread %d starting with %d timeframes has %s the property.  ",
+                       i, ThData[i].Pars.nFramesStart, RetValue ? "proved" : "disproved");
+                ABC_PRT("Time", Abc_Clock() - clk);
+            }
+        }
+        Aig_ManStop(ThData[i].pAig);
+    }
+    if (RetValue == -1 && pPars->fVerbose)
+        printf("None of the %d threads has decided the property.\n", nProcs);
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -71,6 +71,7 @@ struct Pdr_Par_t_ {
     int fStoreCex;                       // enable storing counter-examples in MO mode
     int fUseBridge;                      // use bridge interface
     int fUsePropOut;                     // use property output
+    int fSkipInv;                        // skip saving the invariant in the ABC frame (when running in a thread)
     int nFailOuts;                       // the number of failed outputs
     int nDropOuts;                       // the number of timed out outputs
     int nProveOuts;                      // the number of proved outputs
@@ -135,6 +135,9 @@ struct Pdr_Man_t_ {
     Vec_Int_t* vVisits;   // intermediate
     Vec_Int_t* vCi2Rem;   // CIs to be removed
     Vec_Int_t* vRes;      // final result
+    Vec_Int_t* vTsimCos;  // sorted roots of the cached ternary simulation cone
+    Vec_Int_t* vTsimMark; // cone stamp of each object
+    int nTsimStamp;       // stamp of the cached cone
     abctime* pTime4Outs;  // timeout per output
     Vec_Ptr_t* vInfCubes; // infinity clauses/cubes
     // statistics
@@ -155,6 +158,8 @@ struct Pdr_Man_t_ {
     int nQueLim;
     int nXsimRuns;
     int nXsimLits;
+    int nTsimReuses;
+    int nTsimRebuilds;
     // runtime
     abctime timeToStop;
     abctime timeToStopOne;
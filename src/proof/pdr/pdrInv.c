@@ -335,6 +335,7 @@ void Pdr_ManDumpClauses(Pdr_Man_t* p, char* pFileName, int fProved) {
     Vec_Int_t* vFlopCounts;
     Vec_Ptr_t* vCubes;
     Pdr_Set_t* pCube;
+    Abc_Ntk_t* pNtk;
     char** pNamesCi;
     int i, kStart, Count = 0;
     // create file
@@ -370,7 +371,8 @@ void Pdr_ManDumpClauses(Pdr_Man_t* p, char* pFileName, int fProved) {
     fprintf(pFile, ".o 1\n");
     fprintf(pFile, ".p %d\n", Count);
     // output flop names
-    pNamesCi = Abc_NtkCollectCioNames(Abc_FrameReadNtk(Abc_FrameReadGlobalFrame()), 0);
+    pNtk = Abc_FrameReadGlobalFrame() ? Abc_FrameReadNtk(Abc_FrameReadGlobalFrame()) : NULL;
+    pNamesCi = pNtk ? Abc_NtkCollectCioNames(pNtk, 0) : NULL;
     if (pNamesCi) {
         fprintf(pFile, ".ilb");
         for (i = 0; i < Aig_ManRegNum(p->pAig); i++)
@@ -259,6 +259,8 @@ Pdr_Man_t* Pdr_ManStart(Aig_Man_t* pAig, Pdr_Par_t* pPars, Vec_Int_t* vPrioInit)
     p->vVisits = Vec_IntAlloc(100); // intermediate
     p->vCi2Rem = Vec_IntAlloc(100); // CIs to be removed
     p->vRes = Vec_IntAlloc(100);    // final result
+    p->vTsimCos = Vec_IntAlloc(100); // cached cone roots
+    p->vTsimMark = Vec_IntStart(Aig_ManObjNumMax(pAig)); // cached cone marks
     p->pCnfMan = Cnf_ManStart();
     // ternary simulation
     p->pTxs3 = pPars->fNewXSim ? Txs3_ManStart(p, pAig, p->vPrio) : NULL;
@@ -308,6 +310,8 @@ void Pdr_ManStop(Pdr_Man_t* p) {
         ABC_PRTP("Generalize ", p->tGeneral, p->tTotal);
         ABC_PRTP("Push clause", p->tPush, p->tTotal);
         ABC_PRTP("Ternary sim", p->tTsim, p->tTotal);
+        if (!p->pPars->fNewXSim)
+            Abc_Print(1, "  cones    : reused =%6d  rebuilt =%6d\n", p->nTsimReuses, p->nTsimRebuilds);
         ABC_PRTP("Containment", p->tContain, p->tTotal);
         ABC_PRTP("CNF compute", p->tCnf, p->tTotal);
         ABC_PRTP("Refinement ", p->tAbs, p->tTotal);
@@ -358,6 +362,8 @@ void Pdr_ManStop(Pdr_Man_t* p) {
     Vec_IntFree(p->vVisits); // intermediate
     Vec_IntFree(p->vCi2Rem); // CIs to be removed
     Vec_IntFree(p->vRes);    // final result
+    Vec_IntFree(p->vTsimCos);  // cached cone roots
+    Vec_IntFree(p->vTsimMark); // cached cone marks
     Vec_PtrFreeP(&p->vInfCubes);
     ABC_FREE(p->pTime4Outs);
     if (p->vCexes)
@@ -56,6 +56,10 @@ static inline void Pdr_ManSimInfoSet(Aig_Man_t* p, Aig_Obj_t* pObj, int Value) {
     p->pTerSimData[Aig_ObjId(pObj) >> 4] ^= (Value << ((Aig_ObjId(pObj) & 15) << 1));
 }
 
+static inline int Pdr_ManObjInCone(Pdr_Man_t* p, Aig_Obj_t* pObj) {
+    return Vec_IntEntry(p->vTsimMark, Aig_ObjId(pObj)) == p->nTsimStamp;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -64,26 +68,27 @@ static inline void Pdr_ManSimInfoSet(Aig_Man_t* p, Aig_Obj_t* pObj, int Value) {
 
   Synopsis    [Marks the TFI cone and collects CIs and nodes.]
 
-  Description []
+  Description [Objects of the cached cone carry the current stamp and are
+  skipped, so only the part of the cone that is not yet cached is collected.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManCollectCone_rec(Aig_Man_t* pAig, Aig_Obj_t* pObj, Vec_Int_t* vCiObjs, Vec_Int_t* vNodes) {
+void Pdr_ManCollectCone_rec(Pdr_Man_t* p, Aig_Obj_t* pObj, Vec_Int_t* vCiObjs, Vec_Int_t* vNodes) {
     assert(!Aig_IsComplement(pObj));
-    if (Aig_ObjIsTravIdCurrent(pAig, pObj))
+    if (Aig_ObjIsTravIdCurrent(p->pAig, pObj) || Pdr_ManObjInCone(p, pObj))
         return;
-    Aig_ObjSetTravIdCurrent(pAig, pObj);
+    Aig_ObjSetTravIdCurrent(p->pAig, pObj);
     if (Aig_ObjIsCi(pObj)) {
         Vec_IntPush(vCiObjs, Aig_ObjId(pObj));
         return;
     }
-    Pdr_ManCollectCone_rec(pAig, Aig_ObjFanin0(pObj), vCiObjs, vNodes);
+    Pdr_ManCollectCone_rec(p, Aig_ObjFanin0(pObj), vCiObjs, vNodes);
     if (Aig_ObjIsCo(pObj))
         return;
-    Pdr_ManCollectCone_rec(pAig, Aig_ObjFanin1(pObj), vCiObjs, vNodes);
+    Pdr_ManCollectCone_rec(p, Aig_ObjFanin1(pObj), vCiObjs, vNodes);
     Vec_IntPush(vNodes, Aig_ObjId(pObj));
 }
 
@@ -91,22 +96,44 @@ void Pdr_ManCollectCone_rec(Aig_Man_t* pAig, Aig_Obj_t* pObj, Vec_Int_t* vCiObjs
 
   Synopsis    [Marks the TFI cone and collects CIs and nodes.]
 
-  Description []
+  Description [The cone of the previous call is kept in vCiObjs/vNodes
+  and stays marked in vTsimMark. If the new roots include all the old
+  ones, the cached cone is extended; otherwise, it is collected anew.
+  Returns the number of cached CIs and nodes in *pnCis and *pnNodes.
+  The cone depends only on the roots, not on the timeframe, so it is
+  reused across frames as well.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManCollectCone(Aig_Man_t* pAig, Vec_Int_t* vCoObjs, Vec_Int_t* vCiObjs, Vec_Int_t* vNodes) {
+void Pdr_ManCollectCone(Pdr_Man_t* p, Vec_Int_t* vCoObjs, Vec_Int_t* vCiObjs, Vec_Int_t* vNodes, int* pnCis, int* pnNodes) {
+    Vec_Int_t* vRoots = p->vVisits;
     Aig_Obj_t* pObj;
     int i;
-    Vec_IntClear(vCiObjs);
-    Vec_IntClear(vNodes);
-    Aig_ManIncrementTravId(pAig);
-    Aig_ObjSetTravIdCurrent(pAig, Aig_ManConst1(pAig));
-    Aig_ManForEachObjVec(vCoObjs, pAig, pObj, i)
-        Pdr_ManCollectCone_rec(pAig, pObj, vCiObjs, vNodes);
+    // sort the roots and compare them with the cached ones
+    Vec_IntClear(vRoots);
+    Vec_IntAppend(vRoots, vCoObjs);
+    Vec_IntSort(vRoots, 0);
+    if (Vec_IntSize(p->vTsimCos) == 0 || Vec_IntTwoCountCommon(p->vTsimCos, vRoots) < Vec_IntSize(p->vTsimCos)) {
+        Vec_IntClear(vCiObjs);
+        Vec_IntClear(vNodes);
+        p->nTsimStamp++;
+    }
+    *pnCis = Vec_IntSize(vCiObjs);
+    *pnNodes = Vec_IntSize(vNodes);
+    Vec_IntClear(p->vTsimCos);
+    Vec_IntAppend(p->vTsimCos, vRoots);
+    // collect the new part of the cone
+    Aig_ManIncrementTravId(p->pAig);
+    Aig_ObjSetTravIdCurrent(p->pAig, Aig_ManConst1(p->pAig));
+    Aig_ManForEachObjVec(vCoObjs, p->pAig, pObj, i)
+        Pdr_ManCollectCone_rec(p, pObj, vCiObjs, vNodes);
+    if (*pnCis == 0 && *pnNodes == 0)
+        p->nTsimRebuilds++;
+    else
+        p->nTsimReuses++;
 }
 
 /**Function*************************************************************
@@ -138,40 +165,95 @@ int Pdr_ManExtendOneEval(Aig_Man_t* pAig, Aig_Obj_t* pObj) {
     return Value;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Propagates the changed values through the marked cone.]
+
+  Description [Array vVis contains the IDs of the changed objects in
+  the increasing order. Since the IDs are topologically sorted, each 
+  node is reached after all its changed fanins have been updated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManSimDataPropagate(Pdr_Man_t* p, Vec_Int_t* vVis) {
+    Aig_Obj_t *pObj, *pFanout;
+    int i, k, iFanout = -1, Value;
+    Aig_ManForEachObjVec(vVis, p->pAig, pObj, i) {
+        Aig_ObjForEachFanout(p->pAig, pObj, pFanout, iFanout, k) {
+            if (!Pdr_ManObjInCone(p, pFanout))
+                continue;
+            Value = Pdr_ManSimInfoGet(p->pAig, pFanout);
+            if (Pdr_ManExtendOneEval(p->pAig, pFanout) == Value)
+                continue;
+            if (Aig_ObjIsNode(pFanout))
+                Vec_IntPushUniqueOrder(vVis, Aig_ObjId(pFanout));
+        }
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs ternary simulation for one design.]
 
-  Description []
+  Description [Incrementally updates the binary values of the cone.
+  The first nCisOld CIs and nNodesOld nodes belong to the cached cone,
+  whose values are still in place from the previous call; only the CIs
+  with changed values are propagated through it, in the event-driven 
+  manner. The remaining nodes are new and are simulated in full.
+  Returns 1 if the values of the COs match the expected ones.]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Pdr_ManSimDataInit(Aig_Man_t* pAig,
-                       Vec_Int_t* vCiObjs,
-                       Vec_Int_t* vCiVals,
-                       Vec_Int_t* vNodes,
-                       Vec_Int_t* vCoObjs,
-                       Vec_Int_t* vCoVals,
-                       Vec_Int_t* vCi2Rem) {
+int Pdr_ManSimDataUpdate(Pdr_Man_t* p,
+                         Vec_Int_t* vCiObjs,
+                         Vec_Int_t* vCiVals,
+                         Vec_Int_t* vNodes,
+                         Vec_Int_t* vCoObjs,
+                         Vec_Int_t* vCoVals,
+                         int nCisOld,
+                         int nNodesOld) {
+    Aig_Man_t* pAig = p->pAig;
+    Vec_Int_t* vVis = p->vVisits;
     Aig_Obj_t* pObj;
-    int i;
-    // set the CI values
+    int i, Value;
+    // update the CI values of the cached cone
     Pdr_ManSimInfoSet(pAig, Aig_ManConst1(pAig), PDR_ONE);
-    Aig_ManForEachObjVec(vCiObjs, pAig, pObj, i)
+    Vec_IntClear(vVis);
+    for (i = 0; i < nCisOld && ((pObj = Aig_ManObj(pAig, Vec_IntEntry(vCiObjs, i))), 1); i++) {
+        Value = Vec_IntEntry(vCiVals, i) ? PDR_ONE : PDR_ZER;
+        assert(Pdr_ManSimInfoGet(pAig, pObj) != PDR_UND);
+        if (Pdr_ManSimInfoGet(pAig, pObj) == Value)
+            continue;
+        Pdr_ManSimInfoSet(pAig, pObj, Value);
+        Vec_IntPush(vVis, Aig_ObjId(pObj));
+    }
+    // propagate the changes (or resimulate if too many of them)
+    if (16 * Vec_IntSize(vVis) < nNodesOld) {
+        Vec_IntSort(vVis, 0);
+        Pdr_ManSimDataPropagate(p, vVis);
+    } else if (Vec_IntSize(vVis) > 0)
+        for (i = 0; i < nNodesOld && ((pObj = Aig_ManObj(pAig, Vec_IntEntry(vNodes, i))), 1); i++)
+            Pdr_ManExtendOneEval(pAig, pObj);
+    // mark and simulate the new part of the cone
+    for (i = nCisOld; i < Vec_IntSize(vCiObjs) && ((pObj = Aig_ManObj(pAig, Vec_IntEntry(vCiObjs, i))), 1); i++) {
+        Vec_IntWriteEntry(p->vTsimMark, Aig_ObjId(pObj), p->nTsimStamp);
         Pdr_ManSimInfoSet(pAig, pObj, (Vec_IntEntry(vCiVals, i) ? PDR_ONE : PDR_ZER));
-    // set the FOs to remove
-    if (vCi2Rem != NULL)
-        Aig_ManForEachObjVec(vCi2Rem, pAig, pObj, i)
-            Pdr_ManSimInfoSet(pAig, pObj, PDR_UND);
-    // perform ternary simulation
-    Aig_ManForEachObjVec(vNodes, pAig, pObj, i)
+    }
+    for (i = nNodesOld; i < Vec_IntSize(vNodes) && ((pObj = Aig_ManObj(pAig, Vec_IntEntry(vNodes, i))), 1); i++) {
+        Vec_IntWriteEntry(p->vTsimMark, Aig_ObjId(pObj), p->nTsimStamp);
         Pdr_ManExtendOneEval(pAig, pObj);
+    }
     // transfer results to the output
-    Aig_ManForEachObjVec(vCoObjs, pAig, pObj, i)
+    Aig_ManForEachObjVec(vCoObjs, pAig, pObj, i) {
+        Vec_IntWriteEntry(p->vTsimMark, Aig_ObjId(pObj), p->nTsimStamp);
         Pdr_ManExtendOneEval(pAig, pObj);
+    }
     // check the results
     Aig_ManForEachObjVec(vCoObjs, pAig, pObj, i) if (Pdr_ManSimInfoGet(pAig, pObj) != (Vec_IntEntry(vCoVals, i) ? PDR_ONE : PDR_ZER)) return 0;
     return 1;
@@ -188,11 +270,12 @@ int Pdr_ManSimDataInit(Aig_Man_t* pAig,
   SeeAlso     []
 
 ***********************************************************************/
-int Pdr_ManExtendOne(Aig_Man_t* pAig, Aig_Obj_t* pObj, Vec_Int_t* vUndo, Vec_Int_t* vVis) {
+int Pdr_ManExtendOne(Pdr_Man_t* p, Aig_Obj_t* pObj, Vec_Int_t* vUndo, Vec_Int_t* vVis) {
+    Aig_Man_t* pAig = p->pAig;
     Aig_Obj_t* pFanout;
     int i, k, iFanout = -1, Value, Value2;
     assert(Saig_ObjIsLo(pAig, pObj));
-    assert(Aig_ObjIsTravIdCurrent(pAig, pObj));
+    assert(Pdr_ManObjInCone(p, pObj));
     // save original value
     Value = Pdr_ManSimInfoGet(pAig, pObj);
     assert(Value == PDR_ZER || Value == PDR_ONE);
@@ -205,7 +288,7 @@ int Pdr_ManExtendOne(Aig_Man_t* pAig, Aig_Obj_t* pObj, Vec_Int_t* vUndo, Vec_Int
     Vec_IntPush(vVis, Aig_ObjId(pObj));
     Aig_ManForEachObjVec(vVis, pAig, pObj, i) {
         Aig_ObjForEachFanout(pAig, pObj, pFanout, iFanout, k) {
-            if (!Aig_ObjIsTravIdCurrent(pAig, pFanout))
+            if (!Pdr_ManObjInCone(p, pFanout))
                 continue;
             assert(Aig_ObjId(pObj) < Aig_ObjId(pFanout));
             Value = Pdr_ManSimInfoGet(pAig, pFanout);
@@ -220,7 +303,8 @@ int Pdr_ManExtendOne(Aig_Man_t* pAig, Aig_Obj_t* pObj, Vec_Int_t* vUndo, Vec_Int
             if (Aig_ObjIsCo(pFanout))
                 return 0;
             assert(Aig_ObjIsNode(pFanout));
-            Vec_IntPushOrder(vVis, Aig_ObjId(pFanout));
+            // the values only change into X, so the order of visiting does not matter
+            Vec_IntPush(vVis, Aig_ObjId(pFanout));
         }
     }
     return 1;
@@ -230,21 +314,23 @@ int Pdr_ManExtendOne(Aig_Man_t* pAig, Aig_Obj_t* pObj, Vec_Int_t* vUndo, Vec_Int
 
   Synopsis    [Undoes the partial results of ternary simulation.]
 
-  Description []
+  Description [Restores the values recorded in vUndo starting from
+  entry iStart and removes these entries.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Pdr_ManExtendUndo(Aig_Man_t* pAig, Vec_Int_t* vUndo) {
+void Pdr_ManExtendUndo(Aig_Man_t* pAig, Vec_Int_t* vUndo, int iStart) {
     Aig_Obj_t* pObj;
     int i, Value;
-    Aig_ManForEachObjVec(vUndo, pAig, pObj, i) {
+    for (i = iStart; i < Vec_IntSize(vUndo) && ((pObj = Aig_ManObj(pAig, Vec_IntEntry(vUndo, i))), 1); i++) {
         Value = Vec_IntEntry(vUndo, ++i);
         assert(Pdr_ManSimInfoGet(pAig, pObj) == PDR_UND);
         Pdr_ManSimInfoSet(pAig, pObj, Value);
     }
+    Vec_IntShrink(vUndo, iStart);
 }
 
 /**Function*************************************************************
@@ -346,7 +432,7 @@ Pdr_Set_t* Pdr_ManTernarySim(Pdr_Man_t* p, int k, Pdr_Set_t* pCube) {
     Vec_Int_t* vCi2Rem = p->vCi2Rem; // CIs to be removed (CI obj IDs)
     Vec_Int_t* vRes = p->vRes;       // final result (flop literals)
     Aig_Obj_t* pObj;
-    int i, Entry, RetValue;
+    int i, Entry, RetValue, iUndo, nCisOld, nNodesOld;
     //abctime clk = Abc_Clock();
 
     // collect CO objects
@@ -373,18 +459,19 @@ Pdr_Set_t* Pdr_ManTernarySim(Pdr_Man_t* p, int k, Pdr_Set_t* pCube) {
         Abc_Print(1, " in frame %d.\n", k);
     }
 
-    // collect CI objects
-    Pdr_ManCollectCone(p->pAig, vCoObjs, vCiObjs, vNodes);
+    // collect CI objects (reusing the cone of the previous call)
+    Pdr_ManCollectCone(p, vCoObjs, vCiObjs, vNodes, &nCisOld, &nNodesOld);
     // collect values
     Pdr_ManCollectValues(p, k, vCiObjs, vCiVals);
     Pdr_ManCollectValues(p, k, vCoObjs, vCoVals);
-    // simulate for the first time
+    // simulate the changes since the previous call
     if (p->pPars->fVeryVerbose)
         Pdr_ManPrintCex(p->pAig, vCiObjs, vCiVals, NULL);
-    RetValue = Pdr_ManSimDataInit(p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL);
+    RetValue = Pdr_ManSimDataUpdate(p, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, nCisOld, nNodesOld);
     assert(RetValue);
 
     // iteratively remove flops
+    Vec_IntClear(vUndo);
     if (p->pPars->fFlopPrio) {
         // collect flops and sort them by priority
         Vec_IntClear(vRes);
@@ -401,11 +488,11 @@ Pdr_Set_t* Pdr_ManTernarySim(Pdr_Man_t* p, int k, Pdr_Set_t* pCube) {
         Vec_IntForEachEntry(vRes, Entry, i) {
             pObj = Aig_ManCi(p->pAig, Saig_ManPiNum(p->pAig) + Entry);
             assert(Saig_ObjIsLo(p->pAig, pObj));
-            Vec_IntClear(vUndo);
-            if (Pdr_ManExtendOne(p->pAig, pObj, vUndo, vVisits))
+            iUndo = Vec_IntSize(vUndo);
+            if (Pdr_ManExtendOne(p, pObj, vUndo, vVisits))
                 Vec_IntPush(vCi2Rem, Aig_ObjId(pObj));
             else
-                Pdr_ManExtendUndo(p->pAig, vUndo);
+                Pdr_ManExtendUndo(p->pAig, vUndo, iUndo);
         }
     } else {
         // try removing low-priority flops first
@@ -416,11 +503,11 @@ Pdr_Set_t* Pdr_ManTernarySim(Pdr_Man_t* p, int k, Pdr_Set_t* pCube) {
             Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
             if (Vec_IntEntry(vPrio, Entry))
                 continue;
-            Vec_IntClear(vUndo);
-            if (Pdr_ManExtendOne(p->pAig, pObj, vUndo, vVisits))
+            iUndo = Vec_IntSize(vUndo);
+            if (Pdr_ManExtendOne(p, pObj, vUndo, vVisits))
                 Vec_IntPush(vCi2Rem, Aig_ObjId(pObj));
             else
-                Pdr_ManExtendUndo(p->pAig, vUndo);
+                Pdr_ManExtendUndo(p->pAig, vUndo, iUndo);
         }
         // try removing high-priority flops next
         Aig_ManForEachObjVec(vCiObjs, p->pAig, pObj, i) {
@@ -429,18 +516,19 @@ Pdr_Set_t* Pdr_ManTernarySim(Pdr_Man_t* p, int k, Pdr_Set_t* pCube) {
             Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
             if (!Vec_IntEntry(vPrio, Entry))
                 continue;
-            Vec_IntClear(vUndo);
-            if (Pdr_ManExtendOne(p->pAig, pObj, vUndo, vVisits))
+            iUndo = Vec_IntSize(vUndo);
+            if (Pdr_ManExtendOne(p, pObj, vUndo, vVisits))
                 Vec_IntPush(vCi2Rem, Aig_ObjId(pObj));
             else
-                Pdr_ManExtendUndo(p->pAig, vUndo);
+                Pdr_ManExtendUndo(p->pAig, vUndo, iUndo);
         }
     }
 
     if (p->pPars->fVeryVerbose)
         Pdr_ManPrintCex(p->pAig, vCiObjs, vCiVals, vCi2Rem);
-    RetValue = Pdr_ManSimDataInit(p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, vCi2Rem);
-    assert(RetValue);
+    // the removed flops do not reach the COs by construction; restore the
+    // binary values of the cone to be reused in the next call
+    Pdr_ManExtendUndo(p->pAig, vUndo, 0);
 
     // derive the set of resulting registers
     Pdr_ManDeriveResult(p->pAig, vCiObjs, vCiVals, vCi2Rem, vRes, vPiLits);
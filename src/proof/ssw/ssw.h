@@ -40,8 +40,10 @@ typedef struct Ssw_Pars_t_ Ssw_Pars_t;
 struct Ssw_Pars_t_ {
     int nPartSize;      // size of the partition
     int nOverSize;      // size of the overlap between partitions
+    int nProcs;         // the number of threads solving the partitions
     int nFramesK;       // the induction depth
     int nFramesAddSim;  // the number of additional frames to simulate
+    int nSimFrames;     // the number of frames of signature-based simulation (0 = none)
     int fConstrs;       // treat the last nConstrs POs as seq constraints
     int fMergeFull;     // enables full merge when constraints are used
     int nMaxLevs;       // the max number of levels of nodes to consider
@@ -1086,6 +1086,42 @@ int Ssw_ClassesRefineConst1(Ssw_Cla_t* p, int fRecursive) {
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Refines the classes using long sequential simulation.]
+
+  Description [Simulates nFrames frames from the initial state with nWords
+  64-bit words per frame, keeping only one frame of simulation info, and
+  refines the classes using the signatures accumulated over all frames.
+  Resets the class manager's simulation callbacks on return.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_ClassesRefineSimCkp(Ssw_Cla_t* p, int nFrames, int nWords, int fVerbose) {
+    Saig_SimCkp_t* pSim;
+    int nLitsOld = Ssw_ClassesCand1Num(p) + Ssw_ClassesLitNum(p), nRefis;
+    abctime clk = Abc_Clock();
+    if (nFrames <= 0 || Saig_ManRegNum(p->pAig) == 0)
+        return 0;
+    pSim = Saig_SimCkpStart(p->pAig, nWords, 0);
+    Saig_SimCkpRun(pSim, nFrames, 1, 0);
+    Ssw_ClassesSetData(p, pSim, (unsigned (*)(void*, Aig_Obj_t*))Saig_SimCkpObjHash, (int (*)(void*, Aig_Obj_t*))Saig_SimCkpObjIsConst, (int (*)(void*, Aig_Obj_t*, Aig_Obj_t*))Saig_SimCkpObjsAreEqual);
+    nRefis = Ssw_ClassesRefineConst1(p, 1);
+    nRefis += Ssw_ClassesRefine(p, 1);
+    if (fVerbose) {
+        Abc_Print(1, "Sequential simulation of %d frames with %d words (%.2f MB). Lits: %d -> %d. ",
+                  nFrames, nWords, Saig_SimCkpMemory(pSim) / (1 << 20), nLitsOld, Ssw_ClassesCand1Num(p) + Ssw_ClassesLitNum(p));
+        ABC_PRT("Time", Abc_Clock() - clk);
+    }
+    Saig_SimCkpStop(pSim);
+    Ssw_ClassesSetData(p, NULL, NULL, NULL, NULL);
+    Ssw_ClassesCheck(p);
+    return nRefis;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -45,8 +45,10 @@ void Ssw_ManSetDefaultParams(Ssw_Pars_t* p) {
     memset(p, 0, sizeof(Ssw_Pars_t));
     p->nPartSize = 0;            // size of the partition
     p->nOverSize = 0;            // size of the overlap between partitions
+    p->nProcs = 1;               // the number of threads solving the partitions
     p->nFramesK = 1;             // the induction depth
     p->nFramesAddSim = 2;        // additional frames to simulate
+    p->nSimFrames = 0;           // frames of signature-based simulation
     p->fConstrs = 0;             // treat the last nConstrs POs as seq constraints
     p->fMergeFull = 0;           // enables full merge when constraints are used
     p->nBTLimit = 1000;          // conflict limit at a node
@@ -447,6 +449,10 @@ Aig_Man_t* Ssw_SignalCorrespondence(Aig_Man_t* pAig, Ssw_Pars_t* pPars) {
         // perform one round of seq simulation and generate candidate equivalence classes
         p->ppClasses = Ssw_ClassesPrepare(pAig, pPars->nFramesK, pPars->fLatchCorr, pPars->fConstCorr, pPars->fOutputCorr, pPars->nMaxLevs, pPars->fVerbose);
         //        p->ppClasses = Ssw_ClassesPrepareTargets( pAig );
+        // refine them further by long simulation that does not store all frames
+        // (the patterns violating the constraints are dropped by the simulator)
+        if (pPars->nSimFrames > 0)
+            Ssw_ClassesRefineSimCkp(p->ppClasses, pPars->nSimFrames, 4, pPars->fVerbose);
         if (pPars->fLatchCorrOpt)
             p->pSml = Ssw_SmlStart(pAig, 0, 2, 1);
         else if (pPars->fDynamic)
@@ -20,6 +20,19 @@
 
 #include "sswInt.h"
 #include "aig/ioa/ioa.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -27,10 +40,157 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define PAR_THR_MAX 100
+
+// information given to the thread solving one partition
+typedef struct Ssw_PartThData_t_ Ssw_PartThData_t;
+struct Ssw_PartThData_t_ {
+    Aig_Man_t* pPart; // the partition (NULL to quit)
+    Aig_Man_t* pNew;  // the reduced partition
+    Ssw_Pars_t Pars;  // private copy of the parameters
+    int* pMapBack;    // mapping of partition objects into the AIG
+    int iPart;        // the partition number
+    int nCountPis;    // the number of true PIs in the partition
+    int nCountRegs;   // the number of registers in the partition
+    int fWorking;     // set while the partition is being solved
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+#ifndef ABC_USE_PTHREADS
+
+int Ssw_SignalCorrespondencePartPar(Aig_Man_t* pAig, Vec_Ptr_t* vParts, Ssw_Pars_t* pPars, int fVerbose) {
+    return 0;
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Thread solving one partition.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Ssw_SignalCorrespondenceWorkerThread(void* pArg) {
+    Ssw_PartThData_t* pThData = (Ssw_PartThData_t*)pArg;
+    volatile int* pPlace = &pThData->fWorking;
+    while (1) {
+        while (*pPlace == 0)
+            ;
+        assert(pThData->fWorking);
+        if (pThData->pPart == NULL) {
+            // free the managers allocated by this thread
+            Cnf_ManFree();
+            Dar_LibStop();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        pThData->pNew = Ssw_SignalCorrespondence(pThData->pPart, &pThData->Pars);
+        pThData->fWorking = 0;
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the partitions using several threads.]
+
+  Description [The partitions are derived and their equivalences are
+  transferred back into the AIG by the calling thread, because both
+  operations use the traversal data of the shared AIG. Each thread runs
+  the complete signal correspondence (simulation, induction, refinement)
+  on its partition with its own SAT solver. Returns 1 if the partitions
+  have been solved; 0 if threads are not available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ssw_SignalCorrespondencePartPar(Aig_Man_t* pAig, Vec_Ptr_t* vParts, Ssw_Pars_t* pPars, int fVerbose) {
+    Ssw_PartThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    Ssw_PartThData_t* pThData;
+    Vec_Int_t* vPart;
+    int nProcs = Abc_MinInt(pPars->nProcs, PAR_THR_MAX);
+    int i, nClasses, status, iPart = 0, fWorkToDo = 1;
+    // start the threads
+    for (i = 0; i < nProcs; i++) {
+        memset(ThData + i, 0, sizeof(Ssw_PartThData_t));
+        ThData[i].Pars = *pPars;
+        ThData[i].iPart = -1;
+        status = pthread_create(WorkerThread + i, NULL, Ssw_SignalCorrespondenceWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    // look at the threads
+    while (fWorkToDo) {
+        fWorkToDo = (iPart < Vec_PtrSize(vParts));
+        for (i = 0; i < nProcs; i++) {
+            pThData = ThData + i;
+            // check if this thread is working
+            if (pThData->fWorking) {
+                fWorkToDo = 1;
+                continue;
+            }
+            // check if this thread has recently finished
+            if (pThData->pPart != NULL) {
+                nClasses = Aig_TransferMappedClasses(pAig, pThData->pPart, pThData->pMapBack);
+                if (fVerbose)
+                    Abc_Print(1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                              pThData->iPart, Vec_IntSize((Vec_Int_t*)Vec_PtrEntry(vParts, pThData->iPart)),
+                              Aig_ManCiNum(pThData->pPart) - Vec_IntSize((Vec_Int_t*)Vec_PtrEntry(vParts, pThData->iPart)),
+                              pThData->nCountPis, pThData->nCountRegs, Aig_ManNodeNum(pThData->pPart), pThData->Pars.nIters, nClasses);
+                Aig_ManStop(pThData->pNew);
+                Aig_ManStop(pThData->pPart);
+                ABC_FREE(pThData->pMapBack);
+                pThData->pNew = NULL;
+                pThData->pPart = NULL;
+            }
+            // derive the next partition with true PIs
+            while (iPart < Vec_PtrSize(vParts)) {
+                vPart = (Vec_Int_t*)Vec_PtrEntry(vParts, iPart);
+                pThData->iPart = iPart++;
+                pThData->pPart = Aig_ManRegCreatePart(pAig, vPart, &pThData->nCountPis, &pThData->nCountRegs, &pThData->pMapBack);
+                Aig_ManSetRegNum(pThData->pPart, pThData->pPart->nRegs);
+                // create the projection of 1-hot registers
+                if (pAig->vOnehots)
+                    pThData->pPart->vOnehots = Aig_ManRegProjectOnehots(pAig, pThData->pPart, pAig->vOnehots, fVerbose);
+                if (pThData->nCountPis > 0)
+                    break;
+                Aig_ManStop(pThData->pPart);
+                ABC_FREE(pThData->pMapBack);
+                pThData->pPart = NULL;
+            }
+            if (pThData->pPart == NULL)
+                continue;
+            pThData->fWorking = 1;
+            fWorkToDo = 1;
+        }
+    }
+    // stop the threads
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        ThData[i].fWorking = 1;
+    }
+    for (i = 0; i < nProcs; i++)
+        pthread_join(WorkerThread[i], NULL);
+    pPars->nIters = 0;
+    for (i = 0; i < nProcs; i++)
+        pPars->nIters = Abc_MaxInt(pPars->nIters, ThData[i].Pars.nIters);
+    return 1;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs partitioned sequential SAT sweeping.]
@@ -91,23 +251,25 @@ Aig_Man_t* Ssw_SignalCorrespondencePart(Aig_Man_t* pAig, Ssw_Pars_t* pPars) {
 
     // perform SSW with partitions
     Aig_ManReprStart(pAig, Aig_ManObjNumMax(pAig));
-    Vec_PtrForEachEntry(Vec_Int_t*, vResult, vPart, i) {
-        pTemp = Aig_ManRegCreatePart(pAig, vPart, &nCountPis, &nCountRegs, &pMapBack);
-        Aig_ManSetRegNum(pTemp, pTemp->nRegs);
-        // create the projection of 1-hot registers
-        if (pAig->vOnehots)
-            pTemp->vOnehots = Aig_ManRegProjectOnehots(pAig, pTemp, pAig->vOnehots, fVerbose);
-        // run SSW
-        if (nCountPis > 0) {
-            pNew = Ssw_SignalCorrespondence(pTemp, pPars);
-            nClasses = Aig_TransferMappedClasses(pAig, pTemp, pMapBack);
-            if (fVerbose)
-                Abc_Print(1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
-                          i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp) - Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses);
-            Aig_ManStop(pNew);
+    if (pPars->nProcs <= 1 || !Ssw_SignalCorrespondencePartPar(pAig, vResult, pPars, fVerbose)) {
+        Vec_PtrForEachEntry(Vec_Int_t*, vResult, vPart, i) {
+            pTemp = Aig_ManRegCreatePart(pAig, vPart, &nCountPis, &nCountRegs, &pMapBack);
+            Aig_ManSetRegNum(pTemp, pTemp->nRegs);
+            // create the projection of 1-hot registers
+            if (pAig->vOnehots)
+                pTemp->vOnehots = Aig_ManRegProjectOnehots(pAig, pTemp, pAig->vOnehots, fVerbose);
+            // run SSW
+            if (nCountPis > 0) {
+                pNew = Ssw_SignalCorrespondence(pTemp, pPars);
+                nClasses = Aig_TransferMappedClasses(pAig, pTemp, pMapBack);
+                if (fVerbose)
+                    Abc_Print(1, "%3d : Reg = %4d. PI = %4d. (True = %4d. Regs = %4d.) And = %5d. It = %3d. Cl = %5d.\n",
+                              i, Vec_IntSize(vPart), Aig_ManCiNum(pTemp) - Vec_IntSize(vPart), nCountPis, nCountRegs, Aig_ManNodeNum(pTemp), pPars->nIters, nClasses);
+                Aig_ManStop(pNew);
+            }
+            Aig_ManStop(pTemp);
+            ABC_FREE(pMapBack);
         }
-        Aig_ManStop(pTemp);
-        ABC_FREE(pMapBack);
     }
     // remap the AIG
     pNew = Aig_ManDupRepr(pAig, 0);
@@ -125,6 +125,8 @@ struct Bmc_AndPar_t_ {
     int nTimeOut;      // timeout in seconds
     int nLutSize;      // LUT size for cut computation
     int nProcs;        // the number of parallel solvers
+    int nShareSize;    // the max size of learnt clauses shared by parallel solvers
+    int nShareLbd;     // the max LBD of learnt clauses shared by parallel solvers
     int fLoadCnf;      // dynamic CNF loading
     int fDumpFrames;   // dump unrolled timeframes
     int fUseSynth;     // use synthesis
@@ -141,6 +143,9 @@ struct Bmc_AndPar_t_ {
     void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
 };
 
+// incremental BMC session (bmcBmcG.c)
+typedef struct Bmcg_Ses_t_ Bmcg_Ses_t;
+
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
 struct Bmc_BCorePar_t_ {
     int iFrame;        // timeframe
@@ -162,6 +167,11 @@ struct Bmc_MulPar_t_ {
     int fDumpFinal;
     int fVerbose;
     int fVeryVerbose;
+    int nProcs;          // the number of worker threads (0 or 1 = sequential)
+    int nGroupMax;       // the max number of outputs in one cluster
+    int nMemLimit;       // the memory limit for the concurrently solved clusters (in MB)
+    char* pStatusFile;   // the file name to write the live status
+    Vec_Int_t* vOutMap;  // status of each PO (0 = sat; 1 = unsat; -1 = undecided)
 };
 
 typedef struct Bmc_ParFf_t_ Bmc_ParFf_t;
@@ -204,6 +214,15 @@ extern void Saig_ParBmcSetDefaultParams(Saig_ParBmc_t* p);
 extern int Saig_ManBmcScalable(Aig_Man_t* pAig, Saig_ParBmc_t* pPars);
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int Gia_ManBmcPerform(Gia_Man_t* p, Bmc_AndPar_t* pPars);
+/*=== bmcBmcG.c ==========================================================*/
+extern Bmcg_Ses_t* Bmcg_SesStart(Gia_Man_t* pGia);
+extern void Bmcg_SesStop(Bmcg_Ses_t* p);
+extern void Bmcg_SesSetOutput(Bmcg_Ses_t* p, int iPo, int fActive);
+extern void Bmcg_SesSetConstraint(Bmcg_Ses_t* p, int iPo, int fActive);
+extern void Bmcg_SesExtend(Bmcg_Ses_t* p, int nFrames);
+extern int Bmcg_SesSolve(Bmcg_Ses_t* p, int nFrames, int nConfLimit);
+extern Abc_Cex_t* Bmcg_SesReadCex(Bmcg_Ses_t* p);
+extern int Bmcg_SesReadFrames(Bmcg_Ses_t* p);
 /*=== bmcCexCare.c ==========================================================*/
 extern Abc_Cex_t* Bmc_CexCareExtendToObjects(Gia_Man_t* p, Abc_Cex_t* pCex, Abc_Cex_t* pCexCare);
 extern Abc_Cex_t* Bmc_CexCareMinimize(Aig_Man_t* p, int nRealPis, Abc_Cex_t* pCex, int nTryCexes, int fCheck, int fVerbose);
@@ -222,6 +241,8 @@ extern int Bmc_CexVerify(Gia_Man_t* p, Abc_Cex_t* pCex, Abc_Cex_t* pCexCare);
 /*=== bmcICheck.c ==========================================================*/
 extern void Bmc_PerformICheck(Gia_Man_t* p, int nFramesMax, int nTimeOut, int fEmpty, int fVerbose);
 extern Vec_Int_t* Bmc_PerformISearch(Gia_Man_t* p, int nFramesMax, int nTimeOut, int fReverse, int fBackTopo, int fDump, int fVerbose);
+/*=== bmcKind.c ==========================================================*/
+extern int Bmc_KindPerform(Gia_Man_t* pGia, int nFramesMax, int nConfMax, int nTimeOut, int fStrengthen, int fVerbose);
 /*=== bmcUnroll.c ==========================================================*/
 extern Unr_Man_t* Unr_ManUnrollStart(Gia_Man_t* pGia, int fVerbose);
 extern Gia_Man_t* Unr_ManUnrollFrame(Unr_Man_t* p, int f);
@@ -21,6 +21,7 @@
 #include "bmc.h"
 #include "sat/cnf/cnf.h"
 #include "sat/glucose/AbcGlucose.h"
+#include "base/main/main.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -53,6 +54,21 @@ struct Bmcg_Man_t_ {
 
 static inline int* Bmcg_ManCopies(Bmcg_Man_t* p, int f) { return (int*)Vec_PtrEntry(&p->vGia2Fr, f); }
 
+struct Bmcg_Ses_t_ {
+    Bmc_AndPar_t Pars;     // parameters of the underlying manager
+    Bmcg_Man_t* pMan;      // incremental unfolding and the SAT solver
+    Gia_Man_t* pGia;       // private copy of the user's AIG
+    Vec_Int_t* vOutActs;   // activation variable of each output
+    Vec_Int_t* vOutFlags;  // outputs currently checked
+    Vec_Int_t* vConFlags;  // outputs currently treated as constraints
+    Vec_Wec_t* vConActs;   // constraint activation variables of each output in each frame
+    Vec_Int_t* vFrameActs; // property variable of each frame
+    Vec_Int_t* vAssumps;   // temporary assumptions
+    Abc_Cex_t* pCex;       // the last counter-example
+    int nFrames;           // the number of unfolded frames
+    int nFramesDone;       // the number of frames proved under the current setting
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -293,6 +309,8 @@ Abc_Cex_t* Bmcg_ManGenerateCex(Bmcg_Man_t* p, int i, int f, int s) {
         {
             int iCiId = Vec_IntEntry(&p->vCiMap, 2 * k + 0);
             int iFrame = Vec_IntEntry(&p->vCiMap, 2 * k + 1);
+            if (iFrame > f)
+                continue;
             Abc_InfoSetBit(pCex->pData, Gia_ManRegNum(p->pGia) + iFrame * Gia_ManPiNum(p->pGia) + iCiId);
         }
     }
@@ -413,6 +431,434 @@ int Bmcg_ManPerform(Gia_Man_t* pGia, Bmc_AndPar_t* pPars) {
     return Bmcg_ManPerformOne(pGia, pPars);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates a new SAT variable of the session.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmcg_SesNewVar(Bmcg_Ses_t* p) {
+    bmcg_sat_solver_set_nvars(p->pMan->pSats[0], p->pMan->nSatVars + 1);
+    return p->pMan->nSatVars++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a clause to the SAT solver of the session.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmcg_SesAddClause(Bmcg_Ses_t* p, int* pLits, int nLits) {
+    return bmcg_sat_solver_addclause(p->pMan->pSats[0], pLits, nLits);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT literal of the output in the frame.]
+
+  Description [Constant outputs are mapped to the literals of the
+  constant-0 SAT variable.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmcg_SesOutLit(Bmcg_Ses_t* p, int iPo, int f) {
+    Gia_Obj_t* pObj = Gia_ManCo(p->pMan->pFrames, f * Gia_ManPoNum(p->pGia) + iPo);
+    int iLit = Gia_ObjFaninLit0p(p->pMan->pFrames, pObj);
+    if (iLit < 2) // constant outputs use the constant-0 SAT variable
+        return iLit;
+    assert(Vec_IntEntry(&p->pMan->vFr2Sat, Gia_ObjId(p->pMan->pFrames, pObj)) > 0);
+    return Abc_Var2Lit(Vec_IntEntry(&p->pMan->vFr2Sat, Gia_ObjId(p->pMan->pFrames, pObj)), 0);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds activation variables of the constraint in the new frames.]
+
+  Description [The activation variable of each frame implies that the
+  constraint (the output that should be equal to 0) holds in this frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcg_SesAddConstraints(Bmcg_Ses_t* p, int iPo) {
+    Vec_Int_t* vActs = Vec_WecEntry(p->vConActs, iPo);
+    int f, iVar, pLits[2];
+    for (f = Vec_IntSize(vActs); f < p->nFrames; f++) {
+        pLits[1] = Abc_LitNot(Bmcg_SesOutLit(p, iPo, f));
+        if (pLits[1] == 1) { // the constraint holds trivially
+            Vec_IntPush(vActs, 0);
+            continue;
+        }
+        iVar = Bmcg_SesNewVar(p);
+        pLits[0] = Abc_Var2Lit(iVar, 1);
+        Bmcg_SesAddClause(p, pLits, 2 - (pLits[1] == 0));
+        Vec_IntPush(vActs, iVar);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the property variable of the frame.]
+
+  Description [The property variable implies that one of the active
+  outputs is asserted in this frame.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcg_SesAddFrame(Bmcg_Ses_t* p, int f) {
+    Vec_Int_t* vLits = p->vAssumps;
+    int i, iLit, iVar, pLits[2];
+    Vec_IntClear(vLits);
+    Vec_IntPush(vLits, Abc_Var2Lit(Bmcg_SesNewVar(p), 1));
+    for (i = 0; i < Gia_ManPoNum(p->pGia); i++) {
+        if ((iLit = Bmcg_SesOutLit(p, i, f)) == 0)
+            continue;
+        iVar = Bmcg_SesNewVar(p);
+        pLits[0] = Abc_Var2Lit(iVar, 1);
+        pLits[1] = Abc_Var2Lit(Vec_IntEntry(p->vOutActs, i), 0);
+        Bmcg_SesAddClause(p, pLits, 2);
+        pLits[1] = iLit; // a constant-1 output satisfies the clause through the constant-0 variable
+        Bmcg_SesAddClause(p, pLits, 2);
+        Vec_IntPush(vLits, Abc_Var2Lit(iVar, 0));
+    }
+    Bmcg_SesAddClause(p, Vec_IntArray(vLits), Vec_IntSize(vLits));
+    Vec_IntPush(p->vFrameActs, Abc_Lit2Var(Vec_IntEntry(vLits, 0)));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the session.]
+
+  Description [The session keeps the unfolding, the CNF, and the solver
+  between the calls. Each frame has a property variable implying that one
+  of the active outputs is asserted in this frame. The outputs are enabled
+  by their activation variables, while the constraints (the outputs that
+  should be equal to 0) are enabled in each frame by a separate variable,
+  so that the constraints of the frames beyond the checked one are not
+  imposed. Changing the setting only changes the assumptions. Returns NULL
+  if the AIG is combinational. The constraints recorded in the AIG become
+  active constraints, while the remaining outputs are checked.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmcg_Ses_t* Bmcg_SesStart(Gia_Man_t* pGia) {
+    Bmcg_Ses_t* p;
+    int i;
+    if (Gia_ManRegNum(pGia) == 0)
+        return NULL;
+    p = ABC_CALLOC(Bmcg_Ses_t, 1);
+    p->Pars.nFramesAdd = 1;
+    p->Pars.nLutSize = 6;
+    p->Pars.nProcs = 1;
+    p->Pars.fNotVerbose = 1;
+    p->pGia = Gia_ManDup(pGia);
+    p->pMan = Bmcg_ManStart(p->pGia, &p->Pars);
+    p->vOutActs = Vec_IntAlloc(Gia_ManPoNum(pGia));
+    p->vOutFlags = Vec_IntStart(Gia_ManPoNum(pGia));
+    p->vConFlags = Vec_IntStart(Gia_ManPoNum(pGia));
+    p->vConActs = Vec_WecStart(Gia_ManPoNum(pGia));
+    p->vFrameActs = Vec_IntAlloc(100);
+    p->vAssumps = Vec_IntAlloc(100);
+    for (i = 0; i < Gia_ManPoNum(pGia); i++) {
+        Vec_IntPush(p->vOutActs, Bmcg_SesNewVar(p));
+        if (i < Gia_ManPoNum(pGia) - pGia->nConstrs)
+            Vec_IntWriteEntry(p->vOutFlags, i, 1);
+        else
+            Vec_IntWriteEntry(p->vConFlags, i, 1);
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the session.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcg_SesStop(Bmcg_Ses_t* p) {
+    Bmcg_ManStop(p->pMan);
+    Gia_ManStop(p->pGia);
+    Vec_IntFree(p->vOutActs);
+    Vec_IntFree(p->vOutFlags);
+    Vec_IntFree(p->vConFlags);
+    Vec_WecFree(p->vConActs);
+    Vec_IntFree(p->vFrameActs);
+    Vec_IntFree(p->vAssumps);
+    Abc_CexFreeP(&p->pCex);
+    ABC_FREE(p);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Enables or disables the output.]
+
+  Description [Enabling an output invalidates the frames proved so far.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcg_SesSetOutput(Bmcg_Ses_t* p, int iPo, int fActive) {
+    assert(iPo >= 0 && iPo < Gia_ManPoNum(p->pGia));
+    if (fActive && !Vec_IntEntry(p->vOutFlags, iPo))
+        p->nFramesDone = 0;
+    Vec_IntWriteEntry(p->vOutFlags, iPo, fActive != 0);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Enables or disables the constraint.]
+
+  Description [Disabling a constraint invalidates the frames proved so far.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcg_SesSetConstraint(Bmcg_Ses_t* p, int iPo, int fActive) {
+    assert(iPo >= 0 && iPo < Gia_ManPoNum(p->pGia));
+    if (!fActive && Vec_IntEntry(p->vConFlags, iPo))
+        p->nFramesDone = 0;
+    Vec_IntWriteEntry(p->vConFlags, iPo, fActive != 0);
+    if (fActive)
+        Bmcg_SesAddConstraints(p, iPo);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the counter-example found by the last call.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t* Bmcg_SesReadCex(Bmcg_Ses_t* p) {
+    return p->pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of frames proved so far.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmcg_SesReadFrames(Bmcg_Ses_t* p) {
+    return p->nFramesDone;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Unfolds the design to have the given number of frames.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmcg_SesExtend(Bmcg_Ses_t* p, int nFrames) {
+    abctime clk;
+    int i;
+    for (; p->nFrames < nFrames; p->nFrames++) {
+        Cnf_Dat_t* pCnf = Bmcg_ManAddNewCnf(p->pMan, p->nFrames, 1);
+        if (pCnf) {
+            Bmcg_ManAddCnf(p->pMan, p->pMan->pSats[0], pCnf);
+            Cnf_DataFree(pCnf);
+        }
+        clk = Abc_Clock();
+        Bmcg_SesAddFrame(p, p->nFrames);
+        p->pMan->timeOth += Abc_Clock() - clk;
+    }
+    for (i = 0; i < Gia_ManPoNum(p->pGia); i++)
+        if (Vec_IntEntry(p->vConFlags, i))
+            Bmcg_SesAddConstraints(p, i);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the active outputs in the given number of frames.]
+
+  Description [Returns 0 if an output is asserted (the counter-example is
+  available through Bmcg_SesReadCex), 1 if no output is asserted in these
+  frames under the active constraints, and -1 if the conflict limit of one
+  frame (0 means no limit) is reached. The frames proved before are not
+  checked again unless the setting has been relaxed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmcg_SesSolve(Bmcg_Ses_t* p, int nFrames, int nConfLimit) {
+    bmcg_sat_solver* pSat = p->pMan->pSats[0];
+    abctime clk;
+    int f, g, i, iLit, iVar, status;
+    Abc_CexFreeP(&p->pCex);
+    Bmcg_SesExtend(p, nFrames);
+    for (f = p->nFramesDone; f < nFrames; f++) {
+        Vec_IntFill(p->vAssumps, 1, Abc_Var2Lit(Vec_IntEntry(p->vFrameActs, f), 0));
+        Vec_IntForEachEntry(p->vOutActs, iVar, i)
+            Vec_IntPush(p->vAssumps, Abc_Var2Lit(iVar, !Vec_IntEntry(p->vOutFlags, i)));
+        for (i = 0; i < Gia_ManPoNum(p->pGia); i++)
+            if (Vec_IntEntry(p->vConFlags, i))
+                for (g = 0; g <= f; g++)
+                    if ((iVar = Vec_IntEntry(Vec_WecEntry(p->vConActs, i), g)))
+                        Vec_IntPush(p->vAssumps, Abc_Var2Lit(iVar, 0));
+        clk = Abc_Clock();
+        bmcg_sat_solver_set_conflict_budget(pSat, nConfLimit);
+        status = bmcg_sat_solver_solve(pSat, Vec_IntArray(p->vAssumps), Vec_IntSize(p->vAssumps));
+        p->pMan->timeSat += Abc_Clock() - clk;
+        if (status == -1) {
+            p->nFramesDone = f + 1;
+            continue;
+        }
+        if (status == 0)
+            return -1;
+        for (i = 0; i < Gia_ManPoNum(p->pGia); i++) {
+            if (!Vec_IntEntry(p->vOutFlags, i))
+                continue;
+            iLit = Bmcg_SesOutLit(p, i, f);
+            if (bmcg_sat_solver_read_cex_varvalue(pSat, Abc_Lit2Var(iLit)) ^ Abc_LitIsCompl(iLit))
+                break;
+        }
+        assert(i < Gia_ManPoNum(p->pGia));
+        p->pCex = Bmcg_ManGenerateCex(p->pMan, i, f, 0);
+        return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the session on the current AIG of the framework.]
+
+  Description [Returns NULL if the current AIG is not defined or is
+  combinational.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Abc_FrameBmcStart(Abc_Frame_t* pAbc) {
+    Gia_Man_t* pGia = Abc_FrameReadGia(pAbc);
+    if (pGia == NULL) {
+        Abc_Print(-1, "Current network in ABC framework is not defined.\n");
+        return NULL;
+    }
+    if (Gia_ManRegNum(pGia) == 0) {
+        Abc_Print(-1, "Current network in ABC framework is combinational.\n");
+        return NULL;
+    }
+    return Bmcg_SesStart(pGia);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the session of the framework.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameBmcStop(void* pSes) {
+    Bmcg_SesStop((Bmcg_Ses_t*)pSes);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Enables or disables the output in the session of the framework.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameBmcSetOutput(void* pSes, int iPo, int fActive) {
+    Bmcg_SesSetOutput((Bmcg_Ses_t*)pSes, iPo, fActive);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Enables or disables the constraint in the session of the framework.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameBmcSetConstraint(void* pSes, int iPo, int fActive) {
+    Bmcg_SesSetConstraint((Bmcg_Ses_t*)pSes, iPo, fActive);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks the active outputs in the session of the framework.]
+
+  Description [The result is recorded as the problem status and the counter-example
+  of the framework. Since only a bounded number of frames is checked, the
+  status is undecided (-1) unless a counter-example is found.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameBmcSolve(Abc_Frame_t* pAbc, void* pSes, int nFrames, int nConfLimit) {
+    Bmcg_Ses_t* p = (Bmcg_Ses_t*)pSes;
+    Abc_Cex_t* pCex;
+    int RetValue = Bmcg_SesSolve(p, nFrames, nConfLimit);
+    Abc_FrameSetStatus(RetValue == 0 ? 0 : -1);
+    Abc_FrameSetNFrames(Bmcg_SesReadFrames(p));
+    pCex = p->pCex ? Abc_CexDup(p->pCex, -1) : NULL;
+    Abc_FrameReplaceCex(pAbc, &pCex);
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -61,8 +61,37 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 #define PAR_THR_MAX 100
+#define BMCS_RING_SIZE (1 << 16) // the number of entries in the clause-sharing ring of each solver
+
+#if defined(_MSC_VER)
+#    include <windows.h>
+#    define Bmcs_MemoryBarrier() MemoryBarrier()
+#else
+#    define Bmcs_MemoryBarrier() __sync_synchronize()
+#endif
+
+// the ring of learnt clauses written by one solver and read by all other solvers
+// (each clause is stored as its size followed by its literals; old clauses are overwritten)
+typedef struct Bmcs_Ring_t_ Bmcs_Ring_t;
+struct Bmcs_Ring_t_ {
+    int pData[BMCS_RING_SIZE]; // clause storage
+    volatile word iHead;       // the total number of entries written
+};
 
 typedef struct Bmcs_Man_t_ Bmcs_Man_t;
+
+// the clause-sharing endpoint of one solver
+typedef struct Bmcs_Share_t_ Bmcs_Share_t;
+struct Bmcs_Share_t_ {
+    Bmcs_Man_t* pMan;         // the BMC manager
+    int iSolver;              // the solver owning this endpoint
+    Bmcs_Ring_t Ring;         // learnt clauses exported by this solver
+    word pTails[PAR_THR_MAX]; // read positions in the rings of other solvers
+    Vec_Int_t vClause;        // the last imported clause
+    int nExported;            // the number of exported clauses
+    int nImported;            // the number of imported clauses
+};
+
 struct Bmcs_Man_t_ {
     Bmc_AndPar_t* pPars;                // parameters
     Gia_Man_t* pGia;                    // user's AIG
@@ -72,6 +101,7 @@ struct Bmcs_Man_t_ {
     Vec_Int_t vFr2Sat;                  // mapping of objects in pFrames into SAT variables
     Vec_Int_t vCiMap;                   // maps CIs of pFrames into CIs/frames of GIA
     bmc_sat_solver* pSats[PAR_THR_MAX]; // concurrent SAT solvers
+    Bmcs_Share_t* pShares[PAR_THR_MAX]; // clause-sharing endpoints of the solvers
     int nSatVars;                       // number of SAT variables used
     int nSatVarsOld;                    // number of SAT variables used
     int fStopNow;                       // signal when it is time to stop
@@ -384,9 +414,95 @@ void Bmcs_ManStop(Bmcs_Man_t* p) {
     for (i = 0; i < p->pPars->nProcs; i++)
         if (p->pSats[i])
             bmc_sat_solver_stop(p->pSats[i]);
+    for (i = 0; i < p->pPars->nProcs; i++)
+        if (p->pShares[i]) {
+            Vec_IntErase(&p->pShares[i]->vClause);
+            ABC_FREE(p->pShares[i]);
+        }
     ABC_FREE(p);
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Exchange of learnt clauses among concurrent solvers.]
+
+  Description [Each solver appends its short learnt clauses with low LBD
+  to its own ring, while the other solvers read them at decision level 0.
+  The ring has one writer and does not use locks: the reader validates
+  each clause after copying it and skips the clauses overwritten by the
+  writer in the meantime. The shared clauses are implied by the CNF,
+  which is the same in all solvers, so they remain valid in the later
+  timeframes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmcs_ManShareGuard(Bmcs_Man_t* p) { return BMCS_RING_SIZE - 2 * (p->pPars->nShareSize + 1); }
+void Bmcs_ManShareExport(void* pArg, int* pLits, int nLits, int Lbd) {
+    Bmcs_Share_t* pShare = (Bmcs_Share_t*)pArg;
+    Bmcs_Ring_t* pRing = &pShare->Ring;
+    word iHead = pRing->iHead;
+    int i;
+    if (nLits > pShare->pMan->pPars->nShareSize || Lbd > pShare->pMan->pPars->nShareLbd)
+        return;
+    pRing->pData[iHead++ % BMCS_RING_SIZE] = nLits;
+    for (i = 0; i < nLits; i++)
+        pRing->pData[iHead++ % BMCS_RING_SIZE] = pLits[i];
+    Bmcs_MemoryBarrier();
+    pRing->iHead = iHead;
+    pShare->nExported++;
+}
+int Bmcs_ManShareImport(void* pArg, int** ppLits) {
+    Bmcs_Share_t* pShare = (Bmcs_Share_t*)pArg;
+    Bmcs_Man_t* p = pShare->pMan;
+    int i, k, nLits;
+    for (k = 0; k < p->pPars->nProcs; k++) {
+        Bmcs_Ring_t* pRing = &p->pShares[k]->Ring;
+        word iTail = pShare->pTails[k], iHead = pRing->iHead;
+        if (k == pShare->iSolver || iTail == iHead)
+            continue;
+        Bmcs_MemoryBarrier();
+        if (iHead - iTail > (word)Bmcs_ManShareGuard(p)) {
+            // the writer has overwritten the unread clauses
+            pShare->pTails[k] = iHead;
+            continue;
+        }
+        nLits = pRing->pData[iTail % BMCS_RING_SIZE];
+        Vec_IntClear(&pShare->vClause);
+        for (i = 1; i <= nLits && i <= p->pPars->nShareSize; i++)
+            Vec_IntPush(&pShare->vClause, pRing->pData[(iTail + i) % BMCS_RING_SIZE]);
+        Bmcs_MemoryBarrier();
+        if (nLits <= 0 || nLits > p->pPars->nShareSize || pRing->iHead - iTail > (word)Bmcs_ManShareGuard(p)) {
+            // the clause could have been overwritten while it was copied
+            pShare->pTails[k] = pRing->iHead;
+            continue;
+        }
+        pShare->pTails[k] = iTail + nLits + 1;
+        pShare->nImported++;
+        *ppLits = Vec_IntArray(&pShare->vClause);
+        return nLits;
+    }
+    return -1;
+}
+void Bmcs_ManShareStart(Bmcs_Man_t* p) {
+#ifndef ABC_USE_EXT_SOLVERS
+    int i;
+    if (p->pPars->nShareSize <= 0 || p->pPars->nProcs < 2)
+        return;
+    assert(Bmcs_ManShareGuard(p) > 0);
+    for (i = 0; i < p->pPars->nProcs; i++) {
+        p->pShares[i] = ABC_CALLOC(Bmcs_Share_t, 1);
+        p->pShares[i]->pMan = p;
+        p->pShares[i]->iSolver = i;
+        Vec_IntGrow(&p->pShares[i]->vClause, p->pPars->nShareSize);
+    }
+    for (i = 0; i < p->pPars->nProcs; i++)
+        satoko_set_share(p->pSats[i], p->pShares[i], Bmcs_ManShareExport, Bmcs_ManShareImport);
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Incremental unfolding.]
@@ -562,6 +678,11 @@ void Bmcs_ManPrintTime(Bmcs_Man_t* p) {
     ABC_PRTP("SAT solving   ", p->timeSat, clkTotal);
     ABC_PRTP("Other         ", p->timeOth, clkTotal);
     ABC_PRTP("TOTAL         ", clkTotal, clkTotal);
+    if (p->pShares[0]) {
+        int i;
+        for (i = 0; i < p->pPars->nProcs; i++)
+            Abc_Print(1, "Solver %d shared %d learnt clauses and received %d learnt clauses.\n", i, p->pShares[i]->nExported, p->pShares[i]->nImported);
+    }
 }
 Abc_Cex_t* Bmcs_ManGenerateCex(Bmcs_Man_t* p, int i, int f, int s) {
     Abc_Cex_t* pCex = Abc_CexMakeTriv(Gia_ManRegNum(p->pGia), Gia_ManPiNum(p->pGia), Gia_ManPoNum(p->pGia), f * Gia_ManPoNum(p->pGia) + i);
@@ -750,6 +871,7 @@ int Bmcs_ManPerformMulti(Gia_Man_t* pGia, Bmc_AndPar_t* pPars) {
     Bmcs_Man_t* p = Bmcs_ManStart(pGia, pPars);
     int f, k = 0, i = Gia_ManPoNum(pGia), status, RetValue = -1, nClauses = 0, Solver = 0;
     Abc_CexFreeP(&pGia->pCexSeq);
+    Bmcs_ManShareStart(p);
     // start threads
     for (i = 0; i < pPars->nProcs; i++) {
         ThData[i].pSat = p->pSats[i];
@@ -826,6 +948,8 @@ int Bmcs_ManPerformMulti(Gia_Man_t* pGia, Bmc_AndPar_t* pPars) {
         ThData[i].pSat = NULL;
         ThData[i].fWorking = 1;
     }
+    for (i = 0; i < pPars->nProcs; i++)
+        pthread_join(WorkerThread[i], NULL);
     p->timeOth = Abc_Clock() - clkStart - p->timeUnf - p->timeCnf - p->timeSat;
     if (RetValue == -1 && !pPars->fNotVerbose)
         printf("No output failed in %d frames.  ", f + (k < pPars->nFramesAdd ? k + 1 : 0));
@@ -0,0 +1,573 @@
+/**CFile****************************************************************
+
+  FileName    [bmcKind.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [K-induction with concurrent base and step cases.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - June 20, 2005.]
+
+  Revision    [$Id: bmcKind.c,v 1.00 2005/06/20 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "sat/bsat/satSolver.h"
+#include "proof/cec/cec.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define KIND_CONF_STEP 1000 // conflicts between checking the stop flag
+
+typedef struct Bmc_KindMan_t_ Bmc_KindMan_t;
+typedef struct Bmc_KindSide_t_ Bmc_KindSide_t;
+
+struct Bmc_KindSide_t_ {
+    Bmc_KindMan_t* pMan; // the manager
+    sat_solver* pSat;    // the SAT solver of this side
+    Vec_Int_t* vLits;    // SAT literals of the objects in each frame
+    Vec_Int_t* vFails;   // SAT literal of the property failure in each frame
+    int fInit;           // uses the initial state (base case)
+    int fInvsUsed;       // the invariants are added to the frames
+    int fUnsat;          // the solver has become UNSAT
+    int nFrames;         // the number of unfolded frames
+};
+
+struct Bmc_KindMan_t_ {
+    Gia_Man_t* pGia;          // user's AIG
+    Gia_Man_t* pCopy;         // copy of the AIG used to detect invariants
+    int nFramesMax;           // the max number of frames
+    int nConfMax;             // the max number of conflicts in one call
+    int fVerbose;             // verbose output
+    abctime nTimeToStop;      // runtime limit
+    Bmc_KindSide_t Base;      // the base case (BMC)
+    Bmc_KindSide_t Step;      // the inductive step
+    Vec_Int_t* vInvs;         // proved equivalences (object, representative, phase)
+    int nUniques;             // the number of simple-path constraints
+    int iStepNext;            // the next depth of the step case
+    volatile int fInvsReady;  // the invariants are available
+    volatile int nBaseDone;   // the number of frames proved by the base case
+    volatile int iStepDepth;  // the depth when the step case holds (-1 if unknown)
+    volatile int fStepDone;   // the step case has finished
+    volatile int fStop;       // the workers should stop
+};
+
+static inline int Bmc_KindLit(Bmc_KindSide_t* p, int f, int iObj) { return Vec_IntEntry(p->vLits, f * Gia_ManObjNum(p->pMan->pGia) + iObj); }
+static inline int Bmc_KindNewLit(Bmc_KindSide_t* p) { return Abc_Var2Lit(sat_solver_addvar(p->pSat), 0); }
+static inline int Bmc_KindLitValue(Bmc_KindSide_t* p, int iLit) { return sat_solver_var_value(p->pSat, Abc_Lit2Var(iLit)) ^ Abc_LitIsCompl(iLit); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops one side of the induction.]
+
+  Description [SAT variable 0 is the constant 0, so that literals 0 and 1
+  of the unfolding are valid SAT literals.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KindSideStart(Bmc_KindMan_t* p, Bmc_KindSide_t* pSide, int fInit) {
+    int Lit = Abc_Var2Lit(sat_solver_addvar((pSide->pSat = sat_solver_new())), 1);
+    sat_solver_addclause(pSide->pSat, &Lit, &Lit + 1);
+    if (p->nTimeToStop)
+        sat_solver_set_runtime_limit(pSide->pSat, p->nTimeToStop);
+    pSide->pMan = p;
+    pSide->vLits = Vec_IntAlloc(10 * Gia_ManObjNum(p->pGia));
+    pSide->vFails = Vec_IntAlloc(100);
+    pSide->fInit = fInit;
+}
+void Bmc_KindSideStop(Bmc_KindSide_t* pSide) {
+    sat_solver_delete(pSide->pSat);
+    Vec_IntFree(pSide->vLits);
+    Vec_IntFree(pSide->vFails);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the invariants to one frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KindAddInvs(Bmc_KindSide_t* pSide, int f) {
+    Vec_Int_t* vInvs = pSide->pMan->vInvs;
+    int i, Lits[2];
+    for (i = 0; i < Vec_IntSize(vInvs) && !pSide->fUnsat; i += 3) {
+        Lits[0] = Bmc_KindLit(pSide, f, Vec_IntEntry(vInvs, i));
+        Lits[1] = Abc_LitNotCond(Bmc_KindLit(pSide, f, Vec_IntEntry(vInvs, i + 1)), Vec_IntEntry(vInvs, i + 2));
+        if (Lits[0] == Lits[1])
+            continue;
+        Lits[0] = Abc_LitNot(Lits[0]);
+        if (!sat_solver_addclause(pSide->pSat, Lits, Lits + 2))
+            pSide->fUnsat = 1;
+        Lits[0] = Abc_LitNot(Lits[0]);
+        Lits[1] = Abc_LitNot(Lits[1]);
+        if (!pSide->fUnsat && !sat_solver_addclause(pSide->pSat, Lits, Lits + 2))
+            pSide->fUnsat = 1;
+    }
+}
+void Bmc_KindUpdateInvs(Bmc_KindSide_t* pSide) {
+    int f;
+    if (pSide->fInvsUsed || !pSide->pMan->fInvsReady)
+        return;
+    pSide->fInvsUsed = 1;
+    for (f = 0; f < pSide->nFrames; f++)
+        Bmc_KindAddInvs(pSide, f);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Unfolds one more frame.]
+
+  Description [The frames of the base case start in the initial state,
+  while those of the step case start in a free state. The failure literal
+  of a frame is the disjunction of the outputs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KindAddFrame(Bmc_KindSide_t* pSide) {
+    Gia_Man_t* pGia = pSide->pMan->pGia;
+    Gia_Obj_t* pObj;
+    int f = pSide->nFrames++;
+    int i, iLit, iLit0, iLit1, Lits[2];
+    Vec_Int_t* vOuts = Vec_IntAlloc(Gia_ManPoNum(pGia) + 1);
+    Gia_ManForEachObj(pGia, pObj, i) {
+        if (i == 0)
+            iLit = 0;
+        else if (Gia_ObjIsPi(pGia, pObj))
+            iLit = Bmc_KindNewLit(pSide);
+        else if (Gia_ObjIsRo(pGia, pObj)) {
+            if (f == 0)
+                iLit = pSide->fInit ? 0 : Bmc_KindNewLit(pSide);
+            else
+                iLit = Bmc_KindLit(pSide, f - 1, Gia_ObjId(pGia, Gia_ObjRoToRi(pGia, pObj)));
+        } else if (Gia_ObjIsAnd(pObj)) {
+            iLit0 = Abc_LitNotCond(Bmc_KindLit(pSide, f, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj));
+            iLit1 = Abc_LitNotCond(Bmc_KindLit(pSide, f, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj));
+            if (iLit0 == 0 || iLit1 == 0 || iLit0 == Abc_LitNot(iLit1))
+                iLit = 0;
+            else if (iLit0 == 1 || iLit0 == iLit1)
+                iLit = iLit1;
+            else if (iLit1 == 1)
+                iLit = iLit0;
+            else {
+                iLit = Bmc_KindNewLit(pSide);
+                if (!pSide->fUnsat)
+                    sat_solver_add_and(pSide->pSat, Abc_Lit2Var(iLit), Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), Abc_LitIsCompl(iLit0), Abc_LitIsCompl(iLit1), 0);
+            }
+        } else {
+            assert(Gia_ObjIsCo(pObj));
+            iLit = Abc_LitNotCond(Bmc_KindLit(pSide, f, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj));
+            if (Gia_ObjIsPo(pGia, pObj) && iLit > 0)
+                Vec_IntPush(vOuts, iLit);
+        }
+        Vec_IntPush(pSide->vLits, iLit);
+    }
+    // create the failure literal
+    if (Vec_IntFind(vOuts, 1) >= 0)
+        iLit = 1;
+    else if (Vec_IntSize(vOuts) < 2)
+        iLit = Vec_IntSize(vOuts) ? Vec_IntEntry(vOuts, 0) : 0;
+    else {
+        iLit = Bmc_KindNewLit(pSide);
+        Lits[1] = iLit;
+        Vec_IntForEachEntry(vOuts, Lits[0], i) {
+            Lits[0] = Abc_LitNot(Lits[0]);
+            if (!pSide->fUnsat)
+                sat_solver_addclause(pSide->pSat, Lits, Lits + 2);
+        }
+        Vec_IntPush(vOuts, Abc_LitNot(iLit));
+        if (!pSide->fUnsat)
+            sat_solver_addclause(pSide->pSat, Vec_IntArray(vOuts), Vec_IntLimit(vOuts));
+    }
+    Vec_IntPush(pSide->vFails, iLit);
+    Vec_IntFree(vOuts);
+    if (pSide->fInvsUsed)
+        Bmc_KindAddInvs(pSide, f);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Asserts that the property holds in the given frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KindAssumeProperty(Bmc_KindSide_t* pSide, int f) {
+    int Lit = Abc_LitNot(Vec_IntEntry(pSide->vFails, f));
+    if (!pSide->fUnsat && !sat_solver_addclause(pSide->pSat, &Lit, &Lit + 1))
+        pSide->fUnsat = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks whether the property may fail in the given frame.]
+
+  Description [The solver is called with a small conflict limit, so that
+  the stop request of the other side is noticed in time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KindSolve(Bmc_KindSide_t* pSide, int f) {
+    Bmc_KindMan_t* p = pSide->pMan;
+    int Lit = Vec_IntEntry(pSide->vFails, f);
+    int status, nConfStart = sat_solver_nconflicts(pSide->pSat);
+    if (pSide->fUnsat || Lit == 0)
+        return l_False;
+    while (1) {
+        status = sat_solver_solve(pSide->pSat, &Lit, &Lit + 1, (ABC_INT64_T)KIND_CONF_STEP, 0, 0, 0);
+        if (status != l_Undef)
+            return status;
+        if (p->fStop || (p->nTimeToStop && Abc_Clock() >= p->nTimeToStop))
+            return l_Undef;
+        if (p->nConfMax && sat_solver_nconflicts(pSide->pSat) - nConfStart >= p->nConfMax)
+            return l_Undef;
+    }
+    return l_Undef;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the simple-path constraint for two equal states.]
+
+  Description [Returns 1 if two states of the current model are equal
+  and the constraint has been added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KindStatesAreEqual(Bmc_KindSide_t* pSide, int i, int k) {
+    Gia_Man_t* pGia = pSide->pMan->pGia;
+    Gia_Obj_t* pObj;
+    int r;
+    Gia_ManForEachRo(pGia, pObj, r) if (Bmc_KindLitValue(pSide, Bmc_KindLit(pSide, i, Gia_ObjId(pGia, pObj))) != Bmc_KindLitValue(pSide, Bmc_KindLit(pSide, k, Gia_ObjId(pGia, pObj)))) return 0;
+    return 1;
+}
+int Bmc_KindAddUniqueness(Bmc_KindSide_t* pSide) {
+    Gia_Man_t* pGia = pSide->pMan->pGia;
+    Gia_Obj_t* pObj;
+    Vec_Int_t* vDiffs;
+    int i = 0, k, r, iLitI, iLitK, iVar;
+    for (k = 1; k < pSide->nFrames; k++) {
+        for (i = 0; i < k; i++)
+            if (Bmc_KindStatesAreEqual(pSide, i, k))
+                break;
+        if (i < k)
+            break;
+    }
+    if (k >= pSide->nFrames) // also covers the case of no frames
+        return 0;
+    // require the states to differ in at least one register
+    vDiffs = Vec_IntAlloc(Gia_ManRegNum(pGia));
+    Gia_ManForEachRo(pGia, pObj, r) {
+        iLitI = Bmc_KindLit(pSide, i, Gia_ObjId(pGia, pObj));
+        iLitK = Bmc_KindLit(pSide, k, Gia_ObjId(pGia, pObj));
+        if (iLitI == iLitK)
+            continue;
+        iVar = sat_solver_addvar(pSide->pSat);
+        sat_solver_add_xor(pSide->pSat, iVar, Abc_Lit2Var(iLitI), Abc_Lit2Var(iLitK), Abc_LitIsCompl(iLitI) ^ Abc_LitIsCompl(iLitK));
+        Vec_IntPush(vDiffs, Abc_Var2Lit(iVar, 0));
+    }
+    if (!sat_solver_addclause(pSide->pSat, Vec_IntArray(vDiffs), Vec_IntLimit(vDiffs)))
+        pSide->fUnsat = 1;
+    Vec_IntFree(vDiffs);
+    pSide->pMan->nUniques++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one frame of the base case.]
+
+  Description [Returns 1 if the property holds in this frame, 0 if it
+  fails (the counter-example is stored in the AIG), and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KindBaseOne(Bmc_KindMan_t* p) {
+    Bmc_KindSide_t* pSide = &p->Base;
+    Gia_Man_t* pGia = p->pGia;
+    Gia_Obj_t* pObj;
+    int f = pSide->nFrames, g, i, status;
+    Bmc_KindUpdateInvs(pSide);
+    Bmc_KindAddFrame(pSide);
+    status = Bmc_KindSolve(pSide, f);
+    if (status == l_Undef)
+        return -1;
+    if (status == l_False) {
+        Bmc_KindAssumeProperty(pSide, f);
+        p->nBaseDone = f + 1;
+        return 1;
+    }
+    Abc_CexFreeP(&pGia->pCexSeq);
+    pGia->pCexSeq = Abc_CexAlloc(Gia_ManRegNum(pGia), Gia_ManPiNum(pGia), f + 1);
+    pGia->pCexSeq->iFrame = f;
+    Gia_ManForEachPo(pGia, pObj, i) if (Bmc_KindLitValue(pSide, Bmc_KindLit(pSide, f, Gia_ObjId(pGia, pObj)))) break;
+    assert(i < Gia_ManPoNum(pGia));
+    pGia->pCexSeq->iPo = i;
+    for (g = 0; g <= f; g++)
+        Gia_ManForEachPi(pGia, pObj, i) if (Bmc_KindLitValue(pSide, Bmc_KindLit(pSide, g, Gia_ObjId(pGia, pObj))))
+            Abc_InfoSetBit(pGia->pCexSeq->pData, Gia_ManRegNum(pGia) + g * Gia_ManPiNum(pGia) + i);
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the next depth of the step case.]
+
+  Description [Checks whether the property can fail in the last frame
+  of a path of free states where it holds in the previous frames. The
+  simple-path constraints are added only for the pairs of equal states
+  found in the counter-examples.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KindStepNext(Bmc_KindMan_t* p) {
+    Bmc_KindSide_t* pSide = &p->Step;
+    int k = p->iStepNext++, status;
+    if (p->nFramesMax && k >= p->nFramesMax) {
+        p->fStepDone = 1;
+        return;
+    }
+    if (k > 0)
+        Bmc_KindAssumeProperty(pSide, k - 1);
+    Bmc_KindUpdateInvs(pSide);
+    Bmc_KindAddFrame(pSide);
+    do
+        status = Bmc_KindSolve(pSide, k);
+    while (status == l_True && Bmc_KindAddUniqueness(pSide));
+    if (status == l_False)
+        p->iStepDepth = k;
+    if (status != l_True)
+        p->fStepDone = 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Detects invariants using signal correspondence.]
+
+  Description [The equivalences proved by induction hold in all reachable
+  states, so they are added to the frames of both sides. The detection
+  is interrupted by the runtime limit or when the workers are stopped,
+  in which case no invariants are used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_KindStrengthen(Bmc_KindMan_t* p) {
+    Cec_ParCor_t Pars, *pPars = &Pars;
+    Gia_Man_t* pCopy = p->pCopy;
+    Vec_Int_t* vInvs = Vec_IntAlloc(1000);
+    Gia_Obj_t *pObj, *pRepr;
+    int i;
+    Cec_ManCorSetDefaultParams(pPars);
+    pPars->nTimeToStop = p->nTimeToStop;
+    pPars->pStop = &p->fStop;
+    if (!Cec_ManLSCorrespondenceClasses(pCopy, pPars)) {
+        p->vInvs = vInvs;
+        p->fInvsReady = 1;
+        return;
+    }
+    assert(Gia_ManObjNum(pCopy) == Gia_ManObjNum(p->pGia));
+    Gia_ManSetPhase(pCopy);
+    Gia_ManForEachObj1(pCopy, pObj, i) {
+        if ((pRepr = Gia_ObjReprObj(pCopy, i)) == NULL)
+            continue;
+        Vec_IntPush(vInvs, i);
+        Vec_IntPush(vInvs, Gia_ObjId(pCopy, pRepr));
+        Vec_IntPush(vInvs, Gia_ObjPhaseReal(pObj) ^ Gia_ObjPhaseReal(pRepr));
+    }
+    p->vInvs = vInvs;
+    p->fInvsReady = 1;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Worker threads.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Bmc_KindStepThread(void* pArg) {
+    Bmc_KindMan_t* p = (Bmc_KindMan_t*)pArg;
+    while (!p->fStepDone && !p->fStop)
+        Bmc_KindStepNext(p);
+    // free the managers allocated by this thread
+    Cnf_ManFree();
+    Dar_LibStop();
+    pthread_exit(NULL);
+    return NULL;
+}
+void* Bmc_KindStrengthenThread(void* pArg) {
+    Bmc_KindStrengthen((Bmc_KindMan_t*)pArg);
+    // free the managers allocated by this thread
+    Cnf_ManFree();
+    Dar_LibStop();
+    pthread_exit(NULL);
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs k-induction.]
+
+  Description [The base case runs in the calling thread, while the step
+  case and the detection of invariants run in separate threads (without
+  pthreads, the step case is interleaved with the base case). The
+  property holds if the step case holds at depth k and the base case has
+  covered k frames. Returns 1 if the property holds, 0 if it fails (the
+  counter-example is in p->pCexSeq), and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_KindPerform(Gia_Man_t* pGia, int nFramesMax, int nConfMax, int nTimeOut, int fStrengthen, int fVerbose) {
+    abctime clk = Abc_Clock();
+    Bmc_KindMan_t* p = ABC_CALLOC(Bmc_KindMan_t, 1);
+    int RetValue = -1, status = 1;
+#ifdef ABC_USE_PTHREADS
+    pthread_t StepThread, StrThread;
+    int rc;
+#endif
+    assert(Gia_ManRegNum(pGia) > 0);
+    p->pGia = pGia;
+    p->nFramesMax = nFramesMax;
+    p->nConfMax = nConfMax;
+    p->fVerbose = fVerbose;
+    p->nTimeToStop = nTimeOut ? nTimeOut * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    p->iStepDepth = -1;
+    p->pCopy = fStrengthen ? Gia_ManDup(pGia) : NULL;
+    Bmc_KindSideStart(p, &p->Base, 1);
+    Bmc_KindSideStart(p, &p->Step, 0);
+    Abc_CexFreeP(&pGia->pCexSeq);
+#ifdef ABC_USE_PTHREADS
+    rc = pthread_create(&StepThread, NULL, Bmc_KindStepThread, (void*)p);
+    assert(rc == 0);
+    if (fStrengthen) {
+        rc = pthread_create(&StrThread, NULL, Bmc_KindStrengthenThread, (void*)p);
+        assert(rc == 0);
+    }
+#else
+    if (fStrengthen)
+        Bmc_KindStrengthen(p);
+#endif
+    while (!nFramesMax || p->Base.nFrames < nFramesMax) {
+#ifndef ABC_USE_PTHREADS
+        if (!p->fStepDone)
+            Bmc_KindStepNext(p);
+#endif
+        if (p->iStepDepth >= 0 && p->nBaseDone >= p->iStepDepth) {
+            RetValue = 1;
+            break;
+        }
+        if (p->fStepDone && p->iStepDepth == -1 && !nFramesMax)
+            break;
+        if ((status = Bmc_KindBaseOne(p)) != 1)
+            break;
+        if (fVerbose)
+            printf("Base case: frame %4d is done. Step case: %s. %9.2f sec\n", p->nBaseDone - 1,
+                   p->iStepDepth >= 0 ? "holds" : (p->fStepDone ? "failed" : "running"), 1.0 * (Abc_Clock() - clk) / CLOCKS_PER_SEC);
+    }
+    if (status == 0)
+        RetValue = 0;
+    p->fStop = (RetValue != -1 || status == -1);
+#ifdef ABC_USE_PTHREADS
+    pthread_join(StepThread, NULL);
+    // the invariants are not needed after the step case is over
+    p->fStop = 1;
+    if (fStrengthen)
+        pthread_join(StrThread, NULL);
+#else
+    while (!p->fStop && !p->fStepDone)
+        Bmc_KindStepNext(p);
+#endif
+    if (RetValue == -1 && status == 1 && p->iStepDepth >= 0 && p->nBaseDone >= p->iStepDepth)
+        RetValue = 1;
+    if (fVerbose) {
+        printf("Base case frames = %d. ", p->nBaseDone);
+        if (p->iStepDepth >= 0)
+            printf("Step case holds at depth %d. ", p->iStepDepth);
+        else
+            printf("Step case is not proved after %d frames. ", p->Step.nFrames);
+        printf("Simple-path constraints = %d. ", p->nUniques);
+        if (fStrengthen)
+            printf("Invariants = %d. ", p->vInvs ? Vec_IntSize(p->vInvs) / 3 : 0);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+    }
+    Bmc_KindSideStop(&p->Base);
+    Bmc_KindSideStop(&p->Step);
+    Vec_IntFreeP(&p->vInvs);
+    Gia_ManStopP(&p->pCopy);
+    ABC_FREE(p);
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -23,6 +23,21 @@
 #include "misc/extra/extra.h"
 #include "aig/gia/giaAig.h"
 #include "aig/ioa/ioa.h"
+#include "proof/pdr/pdr.h"
+#include "proof/int/int.h"
+#include "sat/cnf/cnf.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+#    endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -30,6 +45,36 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define PAR_THR_MAX 100
+#define BMC_MUL_MEM_FACTOR 16 // engine memory per byte of the cluster AIG (rough estimate)
+
+// one cluster of outputs scheduled for solving
+typedef struct Bmc_MulJob_t_ Bmc_MulJob_t;
+struct Bmc_MulJob_t_ {
+    Vec_Int_t* vOuts; // original indices of the outputs
+    Gia_Man_t* pGia;  // the extracted cones (NULL if not extracted yet)
+    int iCluster;     // the cluster this job came from
+    int iRound;       // the number of previous attempts
+    int TimeOut;      // runtime limit in seconds
+    int nMemory;      // estimated memory in MB
+};
+
+// information given to the worker thread
+typedef struct Bmc_MulThData_t_ Bmc_MulThData_t;
+struct Bmc_MulThData_t_ {
+    Aig_Man_t* pAig;    // the cones to solve (NULL to quit)
+    Bmc_MulJob_t* pJob; // the job being solved
+    Vec_Int_t* vStatus; // status of each output of the job
+    Vec_Ptr_t* vCexes;  // CEXes of the failed outputs of the job
+    int TimeOut;        // runtime limit in seconds
+    int TimePerOut;     // runtime limit per output in miliseconds
+    int iThread;        // thread number
+    int fWorking;       // set while the job is being solved (protected by the mutex)
+    void* pMutex;       // the mutex shared with the manager
+    void* pCondWork;    // signaled by the manager when a job is given
+    void* pCondDone;    // signaled by the worker when the job is solved
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -261,10 +306,482 @@ Vec_Ptr_t* Gia_ManMultiProveAig(Aig_Man_t* p, Bmc_MulPar_t* pPars) {
     Aig_ManStop(p);
     return vCexes;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Records the outputs solved by the last engine.]
+
+  Description [Moves the CEXes from pAig->vSeqModelVec into vCexes and
+  replaces the failed outputs by constant 0 so that the following engines
+  skip them. If vOutMap is given, the outputs marked there as proved are
+  recorded too. Returns the number of outputs still undecided.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManMultiProveUpdate(Aig_Man_t* pAig, Vec_Int_t* vStatus, Vec_Ptr_t* vCexes, Vec_Int_t* vOutMap) {
+    Abc_Cex_t* pCex;
+    int i, nLeft = 0;
+    for (i = 0; i < Saig_ManPoNum(pAig); i++) {
+        if (Vec_IntEntry(vStatus, i) != -1)
+            continue;
+        pCex = pAig->vSeqModelVec ? (Abc_Cex_t*)Vec_PtrEntry(pAig->vSeqModelVec, i) : NULL;
+        if (pCex != NULL) {
+            Vec_IntWriteEntry(vStatus, i, 0);
+            Vec_PtrWriteEntry(vCexes, i, pCex);
+            Vec_PtrWriteEntry(pAig->vSeqModelVec, i, NULL);
+            Aig_ObjPatchFanin0(pAig, Aig_ManCo(pAig, i), Aig_ManConst0(pAig));
+        } else if (vOutMap && Vec_IntEntry(vOutMap, i) == 1)
+            Vec_IntWriteEntry(vStatus, i, 1);
+        else
+            nLeft++;
+    }
+    if (pAig->vSeqModelVec)
+        Vec_PtrFreeFree(pAig->vSeqModelVec), pAig->vSeqModelVec = NULL;
+    ABC_FREE(pAig->pSeqModel);
+    return nLeft;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one cluster of outputs with a portfolio of engines.]
+
+  Description [Runs BMC for a quarter of the runtime limit, then PDR on
+  the outputs that did not fail. If only one output remains undecided,
+  PDR gets half of the remaining time and interpolation gets the rest.
+  Returns in vStatus the status of each output (0 = sat; 1 = unsat; 
+  -1 = undecided) and in vCexes the CEXes of the failed outputs, in
+  terms of the cluster AIG. This procedure is thread-safe.]
+               
+  SideEffects [Modifies pAig.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManMultiProveJob(Aig_Man_t* pAig, int TimeOut, int TimePerOut, Vec_Int_t* vStatus, Vec_Ptr_t* vCexes) {
+    Saig_ParBmc_t ParsBmc, *pParsBmc = &ParsBmc;
+    Pdr_Par_t ParsPdr, *pParsPdr = &ParsPdr;
+    Inter_ManParams_t ParsInt, *pParsInt = &ParsInt;
+    abctime clkStop = Abc_Clock() + (abctime)TimeOut * CLOCKS_PER_SEC;
+    Aig_Man_t* pOne;
+    Aig_Obj_t* pObj;
+    int i, iOut, Depth, TimeLeft, nLeft = 0, RetValue;
+    Vec_IntFill(vStatus, Saig_ManPoNum(pAig), -1);
+    Vec_PtrFill(vCexes, Saig_ManPoNum(pAig), NULL);
+    // skip the trivially proved outputs
+    Saig_ManForEachPo(pAig, pObj, i) {
+        if (Aig_ObjChild0(pObj) == Aig_ManConst0(pAig))
+            Vec_IntWriteEntry(vStatus, i, 1);
+        else
+            nLeft++;
+    }
+    // perform BMC
+    if (nLeft > 0) {
+        Saig_ParBmcSetDefaultParams(pParsBmc);
+        pParsBmc->fSolveAll = 1;
+        pParsBmc->fStoreCex = 1;
+        pParsBmc->fNotVerbose = 1;
+        pParsBmc->fSilent = 1;
+        pParsBmc->nTimeOut = Abc_MaxInt(1, TimeOut / 4);
+        pParsBmc->nTimeOutOne = TimePerOut;
+        Saig_ManBmcScalable(pAig, pParsBmc);
+        nLeft = Gia_ManMultiProveUpdate(pAig, vStatus, vCexes, NULL);
+    }
+    // perform PDR
+    TimeLeft = (int)((clkStop - Abc_Clock()) / CLOCKS_PER_SEC);
+    if (nLeft > 0 && TimeLeft > 0 && Saig_ManRegNum(pAig) > 0) {
+        Pdr_ManSetDefaultParams(pParsPdr);
+        pParsPdr->fSolveAll = 1;
+        pParsPdr->fStoreCex = 1;
+        pParsPdr->fNotVerbose = 1;
+        pParsPdr->fSilent = 1;
+        pParsPdr->fSkipInv = 1;
+        pParsPdr->nTimeOut = (nLeft == 1 && Saig_ManPiNum(pAig) > 0) ? Abc_MaxInt(1, TimeLeft / 2) : TimeLeft;
+        Pdr_ManSolve(pAig, pParsPdr);
+        nLeft = Gia_ManMultiProveUpdate(pAig, vStatus, vCexes, pParsPdr->vOutMap);
+        Vec_IntFreeP(&pParsPdr->vOutMap);
+    }
+    // perform interpolation on the last output
+    TimeLeft = (int)((clkStop - Abc_Clock()) / CLOCKS_PER_SEC);
+    if (nLeft == 1 && TimeLeft > 0 && Saig_ManRegNum(pAig) > 0 && Saig_ManPiNum(pAig) > 0) {
+        iOut = Vec_IntFind(vStatus, -1);
+        pOne = Aig_ManDupOneOutput(pAig, iOut, 1);
+        Inter_ManSetDefaultParams(pParsInt);
+        pParsInt->nSecLimit = TimeLeft;
+        RetValue = Inter_ManPerformInterpolation(pOne, pParsInt, &Depth);
+        if (RetValue == 1)
+            Vec_IntWriteEntry(vStatus, iOut, 1);
+        else if (RetValue == 0 && pOne->pSeqModel) {
+            pOne->pSeqModel->iPo = iOut;
+            Vec_IntWriteEntry(vStatus, iOut, 0);
+            Vec_PtrWriteEntry(vCexes, iOut, pOne->pSeqModel);
+            pOne->pSeqModel = NULL;
+        }
+        Aig_ManStop(pOne);
+    }
+}
+
+#ifndef ABC_USE_PTHREADS
+
+Vec_Ptr_t* Gia_ManMultiProvePar(Gia_Man_t* p, Bmc_MulPar_t* pPars) {
+    printf("Multi-threaded proving requires ABC to be compiled with pthreads.\n");
+    return NULL;
+}
+
+#else // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the live status file.]
+
+  Description [The file is first written under a temporary name and then
+  renamed, so that a reader never sees a partially written status.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManMultiProveWriteStatus(char* pFileName, Vec_Int_t* vStatus, Bmc_MulThData_t* pThData, int nProcs, int nQueued, int nTime) {
+    char* pFileTemp = ABC_ALLOC(char, strlen(pFileName) + 5);
+    Bmc_MulJob_t* pJob;
+    FILE* pFile;
+    int i, Status;
+    sprintf(pFileTemp, "%s.tmp", pFileName);
+    pFile = fopen(pFileTemp, "wb");
+    if (pFile == NULL) {
+        printf("Cannot open file \"%s\" for writing.\n", pFileTemp);
+        ABC_FREE(pFileTemp);
+        return;
+    }
+    fprintf(pFile, "# time = %d sec  outputs = %d  sat = %d  unsat = %d  undecided = %d  queued jobs = %d\n",
+            nTime, Vec_IntSize(vStatus), Vec_IntCountEntry(vStatus, 0), Vec_IntCountEntry(vStatus, 1), Vec_IntCountEntry(vStatus, -1), nQueued);
+    for (i = 0; i < nProcs; i++) {
+        pJob = pThData[i].pJob;
+        if (pJob == NULL)
+            fprintf(pFile, "# worker %2d : idle\n", i);
+        else
+            fprintf(pFile, "# worker %2d : cluster = %d  outputs = %d  round = %d  timeout = %d sec  memory = %d MB\n",
+                    i, pJob->iCluster, Vec_IntSize(pJob->vOuts), pJob->iRound, pThData[i].TimeOut, pJob->nMemory);
+    }
+    Vec_IntForEachEntry(vStatus, Status, i)
+        fprintf(pFile, "%d %s\n", i, Status == 0 ? "sat" : (Status == 1 ? "unsat" : "undecided"));
+    fclose(pFile);
+    if (rename(pFileTemp, pFileName))
+        printf("Cannot rename file \"%s\" into \"%s\".\n", pFileTemp, pFileName);
+    ABC_FREE(pFileTemp);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Job management.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_MulJob_t* Bmc_MulJobAlloc(Vec_Int_t* vOuts, int iCluster, int iRound, int TimeOut) {
+    Bmc_MulJob_t* pJob = ABC_CALLOC(Bmc_MulJob_t, 1);
+    pJob->vOuts = Vec_IntDup(vOuts);
+    pJob->iCluster = iCluster;
+    pJob->iRound = iRound;
+    pJob->TimeOut = TimeOut;
+    return pJob;
+}
+void Bmc_MulJobFree(Bmc_MulJob_t* pJob) {
+    Gia_ManStopP(&pJob->pGia);
+    Vec_IntFree(pJob->vOuts);
+    ABC_FREE(pJob);
+}
+void Bmc_MulJobExtract(Gia_Man_t* p, Bmc_MulJob_t* pJob) {
+    if (pJob->pGia)
+        return;
+    pJob->pGia = Gia_ManDupCones(p, Vec_IntArray(pJob->vOuts), Vec_IntSize(pJob->vOuts), 0);
+    pJob->nMemory = 1 + (int)(BMC_MUL_MEM_FACTOR * Gia_ManMemory(pJob->pGia) / (1 << 20));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description [Sleeps until the manager gives it a job or asks it to quit
+  by giving a job without the AIG.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void* Gia_ManMultiProveWorkerThread(void* pArg) {
+    Bmc_MulThData_t* pThData = (Bmc_MulThData_t*)pArg;
+    pthread_mutex_t* pMutex = (pthread_mutex_t*)pThData->pMutex;
+    int status;
+    while (1) {
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        while (!pThData->fWorking)
+            pthread_cond_wait((pthread_cond_t*)pThData->pCondWork, pMutex);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+        if (pThData->pAig == NULL) {
+            // free the managers allocated by this thread
+            Cnf_ManFree();
+            Dar_LibStop();
+            pthread_exit(NULL);
+            assert(0);
+            return NULL;
+        }
+        Gia_ManMultiProveJob(pThData->pAig, pThData->TimeOut, pThData->TimePerOut, pThData->vStatus, pThData->vCexes);
+        status = pthread_mutex_lock(pMutex);
+        assert(status == 0);
+        pThData->fWorking = 0;
+        pthread_cond_signal((pthread_cond_t*)pThData->pCondDone);
+        status = pthread_mutex_unlock(pMutex);
+        assert(status == 0);
+    }
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves multi-output properties using several threads.]
+
+  Description [Clusters the outputs by cone overlap and keeps a queue
+  of clusters. Each idle worker takes the next cluster and solves it
+  with the BMC/PDR/interpolation portfolio. The outputs that remain
+  undecided are queued again as one job with a larger runtime limit.
+  A new job is not started while the estimated memory of the running
+  jobs would exceed the limit, or after the global timeout, or when no
+  output has been solved during the gap timeout while some job finished.
+  The manager thread holds the mutex except while it sleeps waiting for
+  a job to finish. It updates the status file after each completed job
+  and dumps the cones of the undecided outputs, if requested. Returns
+  the CEXes of the failed outputs (in terms of the original AIG) and the
+  status of each output in pPars->vOutMap.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t* Gia_ManMultiProvePar(Gia_Man_t* p, Bmc_MulPar_t* pPars) {
+    Bmc_MulThData_t ThData[PAR_THR_MAX];
+    pthread_t WorkerThread[PAR_THR_MAX];
+    pthread_mutex_t Mutex;
+    pthread_cond_t CondWork, CondDone;
+    Vec_Wec_t* vGroups;
+    Vec_Int_t *vGroup, *vLeft;
+    Vec_Ptr_t *vQueue, *vCexes;
+    Vec_Int_t* vStatus;
+    Bmc_MulJob_t* pJob;
+    Abc_Cex_t* pCex;
+    time_t timeStart = time(NULL), timeSolved = timeStart;
+    abctime clkStart = Abc_Clock();
+    int nProcs = Abc_MinInt(pPars->nProcs, PAR_THR_MAX);
+    int i, k, iOut, Status, status, iHead = 0, nMemUsed, nJobsDone = 0;
+    int fWorkToDo = 1, fTimeOut = 0, fGapOut = 0, fChanged = 1, fStarted, fFinished, nJobsIdle = 0;
+    assert(nProcs >= 1);
+    // create the jobs
+    vGroups = Gia_ManClusterOutputs(p, pPars->nGroupMax, pPars->fVerbose);
+    vQueue = Vec_PtrAlloc(2 * Vec_WecSize(vGroups));
+    Vec_WecForEachLevel(vGroups, vGroup, i)
+        Vec_PtrPush(vQueue, Bmc_MulJobAlloc(vGroup, i, 0, pPars->TimeOutLoc));
+    Vec_WecFree(vGroups);
+    vCexes = Vec_PtrStart(Gia_ManPoNum(p));
+    vStatus = Vec_IntStartFull(Gia_ManPoNum(p));
+    vLeft = Vec_IntAlloc(100);
+    if (pPars->fVerbose)
+        printf("MultiProve: Threads = %d. Clusters = %d. Max cluster = %d. Memory limit = %d MB. Status file = %s.\n",
+               nProcs, Vec_PtrSize(vQueue), pPars->nGroupMax, pPars->nMemLimit, pPars->pStatusFile ? pPars->pStatusFile : "none");
+    // start the threads
+    pthread_mutex_init(&Mutex, NULL);
+    pthread_cond_init(&CondWork, NULL);
+    pthread_cond_init(&CondDone, NULL);
+    status = pthread_mutex_lock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        ThData[i].pAig = NULL;
+        ThData[i].pJob = NULL;
+        ThData[i].vStatus = Vec_IntAlloc(100);
+        ThData[i].vCexes = Vec_PtrAlloc(100);
+        ThData[i].TimeOut = 0;
+        ThData[i].TimePerOut = pPars->TimePerOut;
+        ThData[i].iThread = i;
+        ThData[i].fWorking = 0;
+        ThData[i].pMutex = &Mutex;
+        ThData[i].pCondWork = &CondWork;
+        ThData[i].pCondDone = &CondDone;
+        status = pthread_create(WorkerThread + i, NULL, Gia_ManMultiProveWorkerThread, (void*)(ThData + i));
+        assert(status == 0);
+    }
+    // look at the threads
+    while (fWorkToDo) {
+        fStarted = fFinished = 0;
+        fTimeOut = pPars->TimeOutGlo && (int)(time(NULL) - timeStart) >= pPars->TimeOutGlo;
+        fGapOut = pPars->TimeOutGap && nJobsIdle > 0 && (int)(time(NULL) - timeSolved) >= pPars->TimeOutGap;
+        fWorkToDo = !fTimeOut && !fGapOut && iHead < Vec_PtrSize(vQueue);
+        nMemUsed = 0;
+        for (i = 0; i < nProcs; i++)
+            if (ThData[i].fWorking)
+                nMemUsed += ThData[i].pJob->nMemory;
+        for (i = 0; i < nProcs; i++) {
+            // check if this thread is working
+            if (ThData[i].fWorking) {
+                fWorkToDo = 1;
+                continue;
+            }
+            // check if this thread has recently finished
+            if ((pJob = ThData[i].pJob) != NULL) {
+                Vec_IntClear(vLeft);
+                Vec_IntForEachEntry(pJob->vOuts, iOut, k) {
+                    Status = Vec_IntEntry(ThData[i].vStatus, k);
+                    if (Status == -1) {
+                        Vec_IntPush(vLeft, iOut);
+                        continue;
+                    }
+                    Vec_IntWriteEntry(vStatus, iOut, Status);
+                    pCex = (Abc_Cex_t*)Vec_PtrEntry(ThData[i].vCexes, k);
+                    if (pCex == NULL)
+                        continue;
+                    Vec_PtrWriteEntry(vCexes, iOut, Abc_CexDup(pCex, Gia_ManRegNum(p)));
+                    ((Abc_Cex_t*)Vec_PtrEntry(vCexes, iOut))->iPo = iOut;
+                    Abc_CexFree(pCex);
+                }
+                if (pPars->fVeryVerbose) {
+                    printf("Worker %2d : Cluster %5d (round %2d) : Outputs = %5d. Solved = %5d. ", i, pJob->iCluster, pJob->iRound,
+                           Vec_IntSize(pJob->vOuts), Vec_IntSize(pJob->vOuts) - Vec_IntSize(vLeft));
+                    Abc_PrintTime(1, "Time", Abc_Clock() - clkStart);
+                }
+                // remember when an output was solved last time
+                if (Vec_IntSize(vLeft) < Vec_IntSize(pJob->vOuts))
+                    timeSolved = time(NULL), nJobsIdle = 0;
+                else
+                    nJobsIdle++;
+                // reschedule the unsolved outputs with a larger budget
+                if (Vec_IntSize(vLeft) > 0)
+                    Vec_PtrPush(vQueue, Bmc_MulJobAlloc(vLeft, pJob->iCluster, pJob->iRound + 1, pJob->TimeOut + pJob->TimeOut * pPars->TimeOutInc / 100));
+                Aig_ManStop(ThData[i].pAig);
+                ThData[i].pAig = NULL;
+                ThData[i].pJob = NULL;
+                Bmc_MulJobFree(pJob);
+                fChanged = 1;
+                fFinished = 1;
+                nJobsDone++;
+                if (!fTimeOut && !fGapOut && iHead < Vec_PtrSize(vQueue))
+                    fWorkToDo = 1;
+            }
+            if (fTimeOut || fGapOut || iHead == Vec_PtrSize(vQueue))
+                continue;
+            // skip the job if it does not fit into memory together with the running ones
+            pJob = (Bmc_MulJob_t*)Vec_PtrEntry(vQueue, iHead);
+            Bmc_MulJobExtract(p, pJob);
+            if (pPars->nMemLimit && nMemUsed > 0 && nMemUsed + pJob->nMemory > pPars->nMemLimit)
+                continue;
+            // start a new job
+            Vec_PtrWriteEntry(vQueue, iHead++, NULL);
+            ThData[i].pJob = pJob;
+            ThData[i].pAig = Gia_ManToAigSimple(pJob->pGia);
+            Gia_ManStopP(&pJob->pGia);
+            ThData[i].TimeOut = pJob->TimeOut;
+            if (pPars->TimeOutGlo)
+                ThData[i].TimeOut = Abc_MaxInt(1, Abc_MinInt(ThData[i].TimeOut, pPars->TimeOutGlo - (int)(time(NULL) - timeStart)));
+            nMemUsed += pJob->nMemory;
+            ThData[i].fWorking = 1;
+            fWorkToDo = 1;
+            fChanged = 1;
+            fStarted = 1;
+        }
+        if (fStarted)
+            pthread_cond_broadcast(&CondWork);
+        if (fChanged && pPars->pStatusFile)
+            Gia_ManMultiProveWriteStatus(pPars->pStatusFile, vStatus, ThData, nProcs, Vec_PtrSize(vQueue) - iHead, (int)(time(NULL) - timeStart));
+        fChanged = 0;
+        // sleep until a job is solved, unless the last pass has changed something
+        if (fWorkToDo && !fStarted && !fFinished) {
+            for (i = 0; i < nProcs; i++)
+                if (ThData[i].pJob && !ThData[i].fWorking)
+                    break;
+            if (i == nProcs)
+                pthread_cond_wait(&CondDone, &Mutex);
+        }
+    }
+    if (fTimeOut)
+        printf("Global timeout (%d sec) is reached.\n", pPars->TimeOutGlo);
+    else if (fGapOut)
+        printf("Gap timeout (%d sec) is reached.\n", pPars->TimeOutGap);
+    // stop the threads
+    for (i = 0; i < nProcs; i++) {
+        assert(!ThData[i].fWorking);
+        assert(ThData[i].pAig == NULL);
+        ThData[i].fWorking = 1;
+    }
+    pthread_cond_broadcast(&CondWork);
+    status = pthread_mutex_unlock(&Mutex);
+    assert(status == 0);
+    for (i = 0; i < nProcs; i++) {
+        pthread_join(WorkerThread[i], NULL);
+        Vec_IntFree(ThData[i].vStatus);
+        Vec_PtrFree(ThData[i].vCexes);
+    }
+    pthread_cond_destroy(&CondWork);
+    pthread_cond_destroy(&CondDone);
+    pthread_mutex_destroy(&Mutex);
+    if (pPars->pStatusFile)
+        Gia_ManMultiProveWriteStatus(pPars->pStatusFile, vStatus, ThData, nProcs, Vec_PtrSize(vQueue) - iHead, (int)(time(NULL) - timeStart));
+    if (pPars->fVerbose) {
+        printf("MultiProve: Outputs = %d. SAT = %d. UNSAT = %d. UNDEC = %d. Jobs = %d.  ", Vec_IntSize(vStatus),
+               Vec_IntCountEntry(vStatus, 0), Vec_IntCountEntry(vStatus, 1), Vec_IntCountEntry(vStatus, -1), nJobsDone);
+        Abc_PrintTime(1, "Time", Abc_Clock() - clkStart);
+    }
+    if (pPars->fDumpFinal && Vec_IntCountEntry(vStatus, -1) == 0)
+        printf("Final AIG is not dumped because all outputs are solved.\n");
+    else if (pPars->fDumpFinal) {
+        Gia_Man_t* pLeft;
+        char* pFileName = Extra_FileNameGenericAppend(p->pName, "_out.aig");
+        Vec_IntClear(vLeft);
+        Vec_IntForEachEntry(vStatus, Status, i)
+            if (Status == -1)
+                Vec_IntPush(vLeft, i);
+        pLeft = Gia_ManDupCones(p, Vec_IntArray(vLeft), Vec_IntSize(vLeft), 0);
+        Gia_AigerWrite(pLeft, pFileName, 0, 0, 0);
+        Gia_ManStop(pLeft);
+        printf("Final AIG was dumped into file \"%s\".\n", pFileName);
+    }
+    // cleanup
+    Vec_PtrForEachEntryStart(Bmc_MulJob_t*, vQueue, pJob, i, iHead)
+        Bmc_MulJobFree(pJob);
+    Vec_PtrFree(vQueue);
+    Vec_IntFree(vLeft);
+    Vec_IntFreeP(&pPars->vOutMap);
+    pPars->vOutMap = vStatus;
+    return vCexes;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Gia_ManMultiProve(Gia_Man_t* p, Bmc_MulPar_t* pPars) {
     Aig_Man_t* pAig;
     if (p->vSeqModelVec)
         Vec_PtrFreeFree(p->vSeqModelVec), p->vSeqModelVec = NULL;
+    if (pPars->nProcs > 1 && (p->vSeqModelVec = Gia_ManMultiProvePar(p, pPars)))
+        return Vec_PtrCountZero(p->vSeqModelVec) == Vec_PtrSize(p->vSeqModelVec) ? -1 : 0;
     pAig = Gia_ManToAig(p, 0);
     p->vSeqModelVec = Gia_ManMultiProveAig(pAig, pPars); // deletes pAig
     assert(Vec_PtrSize(p->vSeqModelVec) == Gia_ManPoNum(p));
@@ -1866,6 +1866,8 @@ int sat_solver_solve_internal(sat_solver* s) {
             break;
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
+        if (sat_solver_store_mem_out(s))
+            break;
     }
     if (s->verbosity >= 1)
         printf("==============================================================================\n");
@@ -2269,4 +2271,11 @@ void* sat_solver_store_release(sat_solver* s) {
     return pTemp;
 }
 
+int sat_solver_store_mem_out(sat_solver* s) {
+    Sto_Man_t* pStore = (Sto_Man_t*)s->pStore;
+    if (pStore == NULL || s->nStoreMemLimit == 0)
+        return 0;
+    return (double)pStore->nChunks * pStore->nChunkSize > (double)s->nStoreMemLimit * (1 << 20);
+}
+
 ABC_NAMESPACE_IMPL_END
@@ -86,6 +86,7 @@ extern void sat_solver_store_free(sat_solver* s);
 extern void sat_solver_store_mark_roots(sat_solver* s);
 extern void sat_solver_store_mark_clauses_a(sat_solver* s);
 extern void* sat_solver_store_release(sat_solver* s);
+extern int sat_solver_store_mem_out(sat_solver* s);
 
 //=================================================================================================
 // Solver representation:
@@ -185,6 +186,7 @@ struct sat_solver_t {
     // clause store
     void* pStore;
     int fSolved;
+    int nStoreMemLimit; // limit on the clause store in MB (0 = no limit)
 
     // trace recording
     FILE* pFile;
@@ -279,6 +281,12 @@ static inline abctime sat_solver_set_runtime_limit(sat_solver* s, abctime Limit)
     return nRuntimeLimit;
 }
 
+static inline int sat_solver_set_store_limit(sat_solver* s, int nMemLimitMb) {
+    int nStoreMemLimit = s->nStoreMemLimit;
+    s->nStoreMemLimit = nMemLimitMb;
+    return nStoreMemLimit;
+}
+
 static inline int sat_solver_set_random(sat_solver* s, int fNotUseRandom) {
     int fNotUseRandomOld = s->fNotUseRandom;
     s->fNotUseRandom = fNotUseRandom;
@@ -53,6 +53,7 @@ char* Sto_ManMemoryFetch(Sto_Man_t* p, int nBytes) {
         *(char**)pMem = p->pChunkLast;
         p->pChunkLast = pMem;
         p->nChunkUsed = sizeof(char*);
+        p->nChunks++;
     }
     pMem = p->pChunkLast + p->nChunkUsed;
     p->nChunkUsed += nBytes;
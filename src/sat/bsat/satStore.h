@@ -89,6 +89,7 @@ struct Sto_Man_t_ {
     // memory management
     int nChunkSize;   // the number of bytes in a chunk
     int nChunkUsed;   // the number of bytes used in the last chunk
+    int nChunks;      // the number of allocated chunks
     char* pChunkLast; // the last memory chunk
 };
 
@@ -144,6 +144,10 @@ extern void Cnf_CollectLeaves(Aig_Obj_t* pRoot, Vec_Ptr_t* vSuper, int fStopComp
 extern void Cnf_ComputeClauses(Aig_Man_t* p, Aig_Obj_t* pRoot, Vec_Ptr_t* vLeaves, Vec_Ptr_t* vNodes, Vec_Int_t* vMap, Vec_Int_t* vCover, Vec_Int_t* vClauses);
 extern void Cnf_DeriveFastMark(Aig_Man_t* p);
 extern Cnf_Dat_t* Cnf_DeriveFast(Aig_Man_t* p, int nOutputs);
+/*=== cnfFile.c ========================================================*/
+extern Cnf_Dat_t* Cnf_DataParseDimacs(char* pBeg, char* pEnd);
+extern Cnf_Dat_t* Cnf_DataReadFromFile(char* pFileName);
+extern void Cnf_DataWriteIntoFile(Cnf_Dat_t* p, char* pFileName, int fReadable, Vec_Int_t* vForAlls, Vec_Int_t* vExists);
 /*=== cnfMan.c ========================================================*/
 extern Cnf_Man_t* Cnf_ManStart();
 extern void Cnf_ManStop(Cnf_Man_t* p);
@@ -155,7 +159,6 @@ extern void Cnf_DataLift(Cnf_Dat_t* p, int nVarsPlus);
 extern void Cnf_DataCollectFlipLits(Cnf_Dat_t* p, int iFlipVar, Vec_Int_t* vFlips);
 extern void Cnf_DataLiftAndFlipLits(Cnf_Dat_t* p, int nVarsPlus, Vec_Int_t* vLits);
 extern void Cnf_DataPrint(Cnf_Dat_t* p, int fReadable);
-extern void Cnf_DataWriteIntoFile(Cnf_Dat_t* p, char* pFileName, int fReadable, Vec_Int_t* vForAlls, Vec_Int_t* vExists);
 extern void* Cnf_DataWriteIntoSolver(Cnf_Dat_t* p, int nFrames, int fInit);
 extern void* Cnf_DataWriteIntoSolverInt(void* pSat, Cnf_Dat_t* p, int nFrames, int fInit);
 extern int Cnf_DataWriteOrClause(void* pSat, Cnf_Dat_t* pCnf);
@@ -175,7 +178,6 @@ extern Vec_Ptr_t* Cnf_ManScanMapping(Cnf_Man_t* p, int fCollect, int fPreorder);
 extern Vec_Int_t* Cnf_DataCollectCiSatNums(Cnf_Dat_t* pCnf, Aig_Man_t* p);
 extern Vec_Int_t* Cnf_DataCollectCoSatNums(Cnf_Dat_t* pCnf, Aig_Man_t* p);
 extern unsigned char* Cnf_DataDeriveLitPolarities(Cnf_Dat_t* p);
-extern Cnf_Dat_t* Cnf_DataReadFromFile(char* pFileName);
 /*=== cnfWrite.c ========================================================*/
 extern Vec_Int_t* Cnf_ManWriteCnfMapping(Cnf_Man_t* p, Vec_Ptr_t* vMapped);
 extern void Cnf_SopConvertToVector(char* pSop, int nCubes, Vec_Int_t* vCover);
@@ -26,7 +26,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Cnf_Man_t* s_pManCnf = NULL;
+// each thread uses its own manager, which it frees by calling Cnf_ManFree() before exiting
+static ABC_THREAD_LOCAL Cnf_Man_t* s_pManCnf = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -0,0 +1,543 @@
+/**CFile****************************************************************
+
+  FileName    [cnfFile.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Reading and writing CNF in DIMACS format.]
+
+  Author      [Alan Mishchenko]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - April 28, 2007.]
+
+  Revision    [$Id: cnfFile.c,v 1.00 2007/04/28 00:00:00 alanmi Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "misc/zlib/zlib.h"
+
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <unistd.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#    ifdef _WIN32
+#        include "../lib/pthread.h"
+#    else
+#        include <pthread.h>
+#    endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CNF_BUFFER_SIZE (1 << 20)   // the size of the output buffer
+#define CNF_READ_BLOCK (1 << 20)    // the size of the block read from gzip file
+#define CNF_THREAD_MAX 8            // the max number of threads formatting clauses
+#define CNF_THREAD_CLAS (1 << 18)   // the number of clauses formatted by one thread in one round
+#define CNF_THREAD_MIN (1 << 20)    // the min number of clauses to use threads
+
+// the loaded file contents
+typedef struct Cnf_File_t_ Cnf_File_t;
+struct Cnf_File_t_ {
+    char* pBeg;   // the first char
+    char* pEnd;   // the char following the last one
+    size_t nSize; // the size of the mapped/allocated region
+    int fMapped;  // the contents are memory-mapped
+};
+
+// the output stream
+typedef struct Cnf_Out_t_ Cnf_Out_t;
+struct Cnf_Out_t_ {
+    FILE* pFile;   // the plain-text file
+    gzFile pGz;    // the gzipped file
+    char* pBuffer; // the output buffer
+    int nUsed;     // the number of chars in the buffer
+    int fError;    // the write error happened
+};
+
+static inline int Cnf_Lit2Dimacs(int Lit) { return Abc_LitIsCompl(Lit) ? -(Abc_Lit2Var(Lit) + 1) : Abc_Lit2Var(Lit) + 1; }
+static inline int Cnf_Lit2Readable(int Lit) { return Abc_LitIsCompl(Lit) ? -Abc_Lit2Var(Lit) : Abc_Lit2Var(Lit); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the file into memory.]
+
+  Description [Files ending in ".gz" are decompressed using zlib. Other
+  files are memory-mapped when the platform allows it and read otherwise.
+  The contents are not zero-terminated.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_FileLoadGz(char* pFileName, Cnf_File_t* pFile) {
+    gzFile pGz = gzopen(pFileName, "rb");
+    size_t nSize = 0, nCap = CNF_READ_BLOCK;
+    char* pBuffer;
+    int nRead;
+    if (pGz == NULL)
+        return 0;
+    pBuffer = ABC_ALLOC(char, nCap);
+    while ((nRead = gzread(pGz, pBuffer + nSize, (unsigned)(nCap - nSize))) > 0) {
+        nSize += nRead;
+        if (nSize == nCap)
+            pBuffer = ABC_REALLOC(char, pBuffer, (nCap *= 2));
+    }
+    gzclose(pGz);
+    if (nRead < 0) {
+        ABC_FREE(pBuffer);
+        return 0;
+    }
+    pFile->pBeg = pBuffer;
+    pFile->pEnd = pBuffer + nSize;
+    pFile->nSize = nCap;
+    pFile->fMapped = 0;
+    return 1;
+}
+static int Cnf_FileLoad(char* pFileName, Cnf_File_t* pFile) {
+    FILE* pPlain;
+    long nSize;
+    memset(pFile, 0, sizeof(Cnf_File_t));
+    if (strlen(pFileName) > 3 && !strcmp(pFileName + strlen(pFileName) - 3, ".gz"))
+        return Cnf_FileLoadGz(pFileName, pFile);
+#ifndef _WIN32
+    {
+        struct stat Stat;
+        int fd = open(pFileName, O_RDONLY);
+        if (fd == -1)
+            return 0;
+        if (fstat(fd, &Stat) == 0 && Stat.st_size > 0) {
+            void* pData = mmap(NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (pData != MAP_FAILED) {
+#    ifdef MADV_SEQUENTIAL
+                madvise(pData, (size_t)Stat.st_size, MADV_SEQUENTIAL);
+#    endif
+                close(fd);
+                pFile->pBeg = (char*)pData;
+                pFile->pEnd = pFile->pBeg + Stat.st_size;
+                pFile->nSize = (size_t)Stat.st_size;
+                pFile->fMapped = 1;
+                return 1;
+            }
+        }
+        close(fd);
+    }
+#endif
+    // fall back on reading the file
+    pPlain = fopen(pFileName, "rb");
+    if (pPlain == NULL)
+        return 0;
+    fseek(pPlain, 0, SEEK_END);
+    nSize = ftell(pPlain);
+    rewind(pPlain);
+    pFile->pBeg = ABC_ALLOC(char, nSize + 1);
+    pFile->pEnd = pFile->pBeg + fread(pFile->pBeg, 1, nSize, pPlain);
+    pFile->nSize = nSize + 1;
+    fclose(pPlain);
+    return 1;
+}
+static void Cnf_FileUnload(Cnf_File_t* pFile) {
+#ifndef _WIN32
+    if (pFile->fMapped) {
+        munmap(pFile->pBeg, pFile->nSize);
+        return;
+    }
+#endif
+    ABC_FREE(pFile->pBeg);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Tokenizer of the DIMACS text.]
+
+  Description [The text is given by its boundaries and does not have to
+  be zero-terminated, which allows for parsing memory-mapped files.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Cnf_CharIsSpace(char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v'; }
+static inline char* Cnf_SkipSpaces(char* pCur, char* pEnd) {
+    while (pCur < pEnd && Cnf_CharIsSpace(*pCur))
+        pCur++;
+    return pCur;
+}
+static inline char* Cnf_SkipLine(char* pCur, char* pEnd) {
+    char* pNext = (char*)memchr(pCur, '\n', pEnd - pCur);
+    return pNext ? pNext + 1 : pEnd;
+}
+static inline char* Cnf_ReadInt(char* pCur, char* pEnd, int* pValue, int* pfError) {
+    ABC_UINT64_T Value = 0;
+    unsigned Digit;
+    int fNeg = 0;
+    char* pStart;
+    if (pCur < pEnd && (*pCur == '-' || *pCur == '+'))
+        fNeg = (*pCur++ == '-');
+    pStart = pCur;
+    while (pCur < pEnd && (Digit = (unsigned)(*pCur - '0')) < 10) {
+        Value = Value * 10 + Digit;
+        pCur++;
+    }
+    if (pCur == pStart || pCur - pStart > 10 || Value > 0x7FFFFFFF || (pCur < pEnd && !Cnf_CharIsSpace(*pCur)))
+        *pfError = 1;
+    *pValue = fNeg ? -(int)Value : (int)Value;
+    return pCur;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses CNF in DIMACS format.]
+
+  Description [Returns CNF with literals represented as (2 * (Var - 1) +
+  Sign), or NULL if parsing failed. Clauses are stored contiguously,
+  which is the representation used by Cnf_Dat_t with pMan == NULL.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t* Cnf_DataParseDimacs(char* pBeg, char* pEnd) {
+    Cnf_Dat_t* pCnf = NULL;
+    Vec_Int_t* vClas = NULL;
+    Vec_Int_t* vLits = NULL;
+    char* pCur = pBeg;
+    int nVars = -1, nClas = -1, Value, Lit, Entry, i, fError = 0, iClaStart = -1, nBound;
+    while (1) {
+        pCur = Cnf_SkipSpaces(pCur, pEnd);
+        if (pCur == pEnd)
+            break;
+        if (*pCur == '%') // end-of-data marker used in some benchmark sets
+            break;
+        if (*pCur == 'c') {
+            pCur = Cnf_SkipLine(pCur, pEnd);
+            continue;
+        }
+        if (*pCur == 'p') {
+            pCur = Cnf_SkipSpaces(pCur + 1, pEnd);
+            if (pEnd - pCur < 4 || strncmp(pCur, "cnf", 3) || !Cnf_CharIsSpace(pCur[3])) {
+                printf("Incorrect input file.\n");
+                goto finish;
+            }
+            pCur = Cnf_ReadInt(Cnf_SkipSpaces(pCur + 3, pEnd), pEnd, &nVars, &fError);
+            pCur = Cnf_ReadInt(Cnf_SkipSpaces(pCur, pEnd), pEnd, &nClas, &fError);
+            if (fError || nVars < 0 || nClas < 0) {
+                printf("Incorrect parameters.\n");
+                goto finish;
+            }
+            pCur = Cnf_SkipLine(pCur, pEnd);
+            if (vClas == NULL) {
+                // each clause and each literal take at least two chars, so
+                // the remaining file bounds the declared sizes
+                nBound = (int)Abc_MinWord((word)(pEnd - pCur) / 2, (word)(1 << 30));
+                vClas = Vec_IntAlloc(Abc_MinInt(nClas, nBound) + 1);
+                vLits = Vec_IntAlloc(Abc_MaxInt((int)Abc_MinWord((word)nClas * 4, (word)nBound), 16));
+            }
+            continue;
+        }
+        if (vClas == NULL) {
+            printf("There is no parameter line.\n");
+            goto finish;
+        }
+        pCur = Cnf_ReadInt(pCur, pEnd, &Value, &fError);
+        if (fError) {
+            printf("Cannot parse literal at offset %ld.\n", (long)(pCur - pBeg));
+            goto finish;
+        }
+        if (Value == 0) {
+            if (iClaStart == -1) // empty clause
+                Vec_IntPush(vClas, Vec_IntSize(vLits));
+            iClaStart = -1;
+            continue;
+        }
+        if (iClaStart == -1)
+            Vec_IntPush(vClas, (iClaStart = Vec_IntSize(vLits)));
+        // compare in 64 bits because 2 * (|Value| - 1) may not fit into int
+        if ((ABC_INT64_T)Abc_AbsInt(Value) > (ABC_INT64_T)nVars) {
+            printf("Literal %d is out-of-bound for %d variables.\n", Value, nVars);
+            goto finish;
+        }
+        Lit = (Value > 0) ? Abc_Var2Lit(Value - 1, 0) : Abc_Var2Lit(-Value - 1, 1);
+        Vec_IntPush(vLits, Lit);
+    }
+    if (vClas == NULL) {
+        printf("There is no parameter line.\n");
+        goto finish;
+    }
+    if (iClaStart != -1) {
+        printf("There is no zero-terminator in the last clause.\n");
+        goto finish;
+    }
+    if (Vec_IntSize(vClas) != nClas)
+        printf("Warning! The number of clauses (%d) is different from declaration (%d).\n", Vec_IntSize(vClas), nClas);
+    Vec_IntPush(vClas, Vec_IntSize(vLits));
+    // create
+    pCnf = ABC_CALLOC(Cnf_Dat_t, 1);
+    pCnf->nVars = nVars;
+    pCnf->nClauses = Vec_IntSize(vClas) - 1;
+    pCnf->nLiterals = Vec_IntSize(vLits);
+    pCnf->pClauses = ABC_ALLOC(int*, Vec_IntSize(vClas));
+    pCnf->pClauses[0] = Vec_IntReleaseArray(vLits);
+    Vec_IntForEachEntry(vClas, Entry, i)
+        pCnf->pClauses[i]
+        = pCnf->pClauses[0] + Entry;
+finish:
+    Vec_IntFreeP(&vClas);
+    Vec_IntFreeP(&vLits);
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads CNF in DIMACS format from file.]
+
+  Description [Handles plain and gzipped files.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t* Cnf_DataReadFromFile(char* pFileName) {
+    Cnf_Dat_t* pCnf;
+    Cnf_File_t File;
+    if (!Cnf_FileLoad(pFileName, &File)) {
+        printf("Cannot open file \"%s\" for reading.\n", pFileName);
+        return NULL;
+    }
+    pCnf = Cnf_DataParseDimacs(File.pBeg, File.pEnd);
+    Cnf_FileUnload(&File);
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Buffered output.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_OutFlush(Cnf_Out_t* p, char* pData, int nData) {
+    if (nData == 0 || p->fError)
+        return;
+    if (p->pGz)
+        p->fError |= (gzwrite(p->pGz, pData, (unsigned)nData) != nData);
+    else
+        p->fError |= (fwrite(pData, 1, nData, p->pFile) != (size_t)nData);
+}
+static inline void Cnf_OutReserve(Cnf_Out_t* p, int nChars) {
+    if (p->nUsed + nChars > CNF_BUFFER_SIZE) {
+        Cnf_OutFlush(p, p->pBuffer, p->nUsed);
+        p->nUsed = 0;
+    }
+}
+static inline char* Cnf_PrintInt(char* pBuffer, int Value) {
+    char Digits[12];
+    int nDigits = 0;
+    unsigned Abs = Value < 0 ? -(unsigned)Value : (unsigned)Value;
+    if (Value < 0)
+        *pBuffer++ = '-';
+    do
+        Digits[nDigits++] = (char)('0' + Abs % 10);
+    while ((Abs /= 10));
+    while (nDigits)
+        *pBuffer++ = Digits[--nDigits];
+    *pBuffer++ = ' ';
+    return pBuffer;
+}
+static void Cnf_OutString(Cnf_Out_t* p, char* pStr) {
+    int nChars = strlen(pStr);
+    Cnf_OutReserve(p, nChars);
+    memcpy(p->pBuffer + p->nUsed, pStr, nChars);
+    p->nUsed += nChars;
+}
+static void Cnf_OutVars(Cnf_Out_t* p, char* pPrefix, Vec_Int_t* vVars, int fReadable) {
+    int i, VarId;
+    Cnf_OutString(p, pPrefix);
+    Vec_IntForEachEntry(vVars, VarId, i) {
+        Cnf_OutReserve(p, 12);
+        p->nUsed = Cnf_PrintInt(p->pBuffer + p->nUsed, fReadable ? VarId : VarId + 1) - p->pBuffer;
+    }
+    Cnf_OutString(p, "0\n");
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Formats the given range of clauses.]
+
+  Description [Returns the pointer following the last char written. The
+  buffer should have at least 12 chars for each literal and 2 chars for
+  each clause.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char* Cnf_DataFormatClauses(Cnf_Dat_t* p, int iStart, int iStop, int fReadable, char* pBuffer) {
+    int *pLit, *pStop, i;
+    for (i = iStart; i < iStop; i++) {
+        for (pLit = p->pClauses[i], pStop = p->pClauses[i + 1]; pLit < pStop; pLit++)
+            pBuffer = Cnf_PrintInt(pBuffer, fReadable ? Cnf_Lit2Readable(*pLit) : Cnf_Lit2Dimacs(*pLit));
+        *pBuffer++ = '0';
+        *pBuffer++ = '\n';
+    }
+    return pBuffer;
+}
+static inline int Cnf_DataFormatSize(Cnf_Dat_t* p, int iStart, int iStop) {
+    return 12 * (int)(p->pClauses[iStop] - p->pClauses[iStart]) + 2 * (iStop - iStart);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Formats clauses in parallel.]
+
+  Description [Clauses are divided into rounds. In each round, every
+  thread formats its own consecutive range into its own buffer, and the
+  buffers are written in order, so the output does not depend on the
+  number of threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+typedef struct Cnf_FmtData_t_ {
+    Cnf_Dat_t* p;
+    int iStart;
+    int iStop;
+    int fReadable;
+    char* pBuffer;
+    int nBufSize;
+    int nUsed;
+} Cnf_FmtData_t;
+static void* Cnf_DataFormatThread(void* pArg) {
+    Cnf_FmtData_t* pData = (Cnf_FmtData_t*)pArg;
+    int nSize = Cnf_DataFormatSize(pData->p, pData->iStart, pData->iStop);
+    if (pData->nBufSize < nSize) {
+        pData->pBuffer = ABC_REALLOC(char, pData->pBuffer, nSize);
+        pData->nBufSize = nSize;
+    }
+    pData->nUsed = Cnf_DataFormatClauses(pData->p, pData->iStart, pData->iStop, pData->fReadable, pData->pBuffer) - pData->pBuffer;
+    return NULL;
+}
+static void Cnf_DataWriteClausesParallel(Cnf_Out_t* pOut, Cnf_Dat_t* p, int fReadable, int nThreads) {
+    Cnf_FmtData_t ThData[CNF_THREAD_MAX];
+    pthread_t WorkerThread[CNF_THREAD_MAX];
+    int i, iStart = 0, nLaunched, status;
+    memset(ThData, 0, sizeof(ThData));
+    while (iStart < p->nClauses) {
+        for (nLaunched = 0; nLaunched < nThreads && iStart < p->nClauses; nLaunched++) {
+            ThData[nLaunched].p = p;
+            ThData[nLaunched].fReadable = fReadable;
+            ThData[nLaunched].iStart = iStart;
+            ThData[nLaunched].iStop = iStart = Abc_MinInt(iStart + CNF_THREAD_CLAS, p->nClauses);
+            status = pthread_create(WorkerThread + nLaunched, NULL, Cnf_DataFormatThread, (void*)(ThData + nLaunched));
+            assert(status == 0);
+        }
+        for (i = 0; i < nLaunched; i++) {
+            pthread_join(WorkerThread[i], NULL);
+            Cnf_OutFlush(pOut, ThData[i].pBuffer, ThData[i].nUsed);
+        }
+    }
+    for (i = 0; i < nThreads; i++)
+        ABC_FREE(ThData[i].pBuffer);
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF into a file.]
+
+  Description [Files ending in ".gz" are compressed using zlib.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_DataWriteIntoFile(Cnf_Dat_t* p, char* pFileName, int fReadable, Vec_Int_t* vForAlls, Vec_Int_t* vExists) {
+    Cnf_Out_t Out, *pOut = &Out;
+    char Header[100];
+    int i, iStop, fParallel = 0;
+    memset(pOut, 0, sizeof(Cnf_Out_t));
+    if (strlen(pFileName) > 3 && !strncmp(pFileName + strlen(pFileName) - 3, ".gz", 3))
+        pOut->pGz = gzopen(pFileName, "wb");
+    else
+        pOut->pFile = fopen(pFileName, "w");
+    if (pOut->pFile == NULL && pOut->pGz == NULL) {
+        printf("Cnf_WriteIntoFile(): Output file cannot be opened.\n");
+        return;
+    }
+    pOut->pBuffer = ABC_ALLOC(char, CNF_BUFFER_SIZE);
+    Cnf_OutString(pOut, "c Result of efficient AIG-to-CNF conversion using package CNF\n");
+    sprintf(Header, "p cnf %d %d\n", p->nVars, p->nClauses);
+    Cnf_OutString(pOut, Header);
+    if (vForAlls)
+        Cnf_OutVars(pOut, "a ", vForAlls, fReadable);
+    if (vExists)
+        Cnf_OutVars(pOut, "e ", vExists, fReadable);
+#ifdef ABC_USE_PTHREADS
+    if (p->nClauses >= CNF_THREAD_MIN) {
+        Cnf_OutFlush(pOut, pOut->pBuffer, pOut->nUsed);
+        pOut->nUsed = 0;
+        Cnf_DataWriteClausesParallel(pOut, p, fReadable, CNF_THREAD_MAX);
+        fParallel = 1; // a write error is reported below
+    }
+#endif
+    for (i = 0; !fParallel && i < p->nClauses; i = iStop) {
+        // collect the clauses that fit into the buffer
+        for (iStop = i + 1; iStop < p->nClauses && Cnf_DataFormatSize(p, i, iStop + 1) <= CNF_BUFFER_SIZE; iStop++)
+            ;
+        Cnf_OutReserve(pOut, Cnf_DataFormatSize(p, i, iStop));
+        if (Cnf_DataFormatSize(p, i, iStop) > CNF_BUFFER_SIZE) // very long clause
+        {
+            char* pTemp = ABC_ALLOC(char, Cnf_DataFormatSize(p, i, iStop));
+            Cnf_OutFlush(pOut, pTemp, Cnf_DataFormatClauses(p, i, iStop, fReadable, pTemp) - pTemp);
+            ABC_FREE(pTemp);
+            continue;
+        }
+        pOut->nUsed = Cnf_DataFormatClauses(p, i, iStop, fReadable, pOut->pBuffer + pOut->nUsed) - pOut->pBuffer;
+    }
+    Cnf_OutString(pOut, "\n");
+    Cnf_OutFlush(pOut, pOut->pBuffer, pOut->nUsed);
+    if (pOut->fError)
+        printf("Cnf_WriteIntoFile(): Writing into file \"%s\" has failed.\n", pFileName);
+    if (pOut->pGz)
+        gzclose(pOut->pGz);
+    else
+        fclose(pOut->pFile);
+    ABC_FREE(pOut->pBuffer);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
@@ -21,7 +21,6 @@
 #include "cnf.h"
 #include "sat/bsat/satSolver.h"
 #include "sat/bsat/satSolver2.h"
-#include "misc/zlib/zlib.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -29,9 +28,6 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static inline int Cnf_Lit2Var(int Lit) { return (Lit & 1) ? -(Lit >> 1) - 1 : (Lit >> 1) + 1; }
-static inline int Cnf_Lit2Var2(int Lit) { return (Lit & 1) ? -(Lit >> 1) : (Lit >> 1); }
-
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -245,94 +241,6 @@ void Cnf_DataPrint(Cnf_Dat_t* p, int fReadable) {
     fprintf(pFile, "\n");
 }
 
-/**Function*************************************************************
-
-  Synopsis    [Writes CNF into a file.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-void Cnf_DataWriteIntoFileGz(Cnf_Dat_t* p, char* pFileName, int fReadable, Vec_Int_t* vForAlls, Vec_Int_t* vExists) {
-    gzFile pFile;
-    int *pLit, *pStop, i, VarId;
-    pFile = gzopen(pFileName, "wb");
-    if (pFile == NULL) {
-        printf("Cnf_WriteIntoFile(): Output file cannot be opened.\n");
-        return;
-    }
-    gzprintf(pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n");
-    gzprintf(pFile, "p cnf %d %d\n", p->nVars, p->nClauses);
-    if (vForAlls) {
-        gzprintf(pFile, "a ");
-        Vec_IntForEachEntry(vForAlls, VarId, i)
-            gzprintf(pFile, "%d ", fReadable ? VarId : VarId + 1);
-        gzprintf(pFile, "0\n");
-    }
-    if (vExists) {
-        gzprintf(pFile, "e ");
-        Vec_IntForEachEntry(vExists, VarId, i)
-            gzprintf(pFile, "%d ", fReadable ? VarId : VarId + 1);
-        gzprintf(pFile, "0\n");
-    }
-    for (i = 0; i < p->nClauses; i++) {
-        for (pLit = p->pClauses[i], pStop = p->pClauses[i + 1]; pLit < pStop; pLit++)
-            gzprintf(pFile, "%d ", fReadable ? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit));
-        gzprintf(pFile, "0\n");
-    }
-    gzprintf(pFile, "\n");
-    gzclose(pFile);
-}
-
-/**Function*************************************************************
-
-  Synopsis    [Writes CNF into a file.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-void Cnf_DataWriteIntoFile(Cnf_Dat_t* p, char* pFileName, int fReadable, Vec_Int_t* vForAlls, Vec_Int_t* vExists) {
-    FILE* pFile;
-    int *pLit, *pStop, i, VarId;
-    if (!strncmp(pFileName + strlen(pFileName) - 3, ".gz", 3)) {
-        Cnf_DataWriteIntoFileGz(p, pFileName, fReadable, vForAlls, vExists);
-        return;
-    }
-    pFile = fopen(pFileName, "w");
-    if (pFile == NULL) {
-        printf("Cnf_WriteIntoFile(): Output file cannot be opened.\n");
-        return;
-    }
-    fprintf(pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n");
-    fprintf(pFile, "p cnf %d %d\n", p->nVars, p->nClauses);
-    if (vForAlls) {
-        fprintf(pFile, "a ");
-        Vec_IntForEachEntry(vForAlls, VarId, i)
-            fprintf(pFile, "%d ", fReadable ? VarId : VarId + 1);
-        fprintf(pFile, "0\n");
-    }
-    if (vExists) {
-        fprintf(pFile, "e ");
-        Vec_IntForEachEntry(vExists, VarId, i)
-            fprintf(pFile, "%d ", fReadable ? VarId : VarId + 1);
-        fprintf(pFile, "0\n");
-    }
-    for (i = 0; i < p->nClauses; i++) {
-        for (pLit = p->pClauses[i], pStop = p->pClauses[i + 1]; pLit < pStop; pLit++)
-            fprintf(pFile, "%d ", fReadable ? Cnf_Lit2Var2(*pLit) : Cnf_Lit2Var(*pLit));
-        fprintf(pFile, "0\n");
-    }
-    fprintf(pFile, "\n");
-    fclose(pFile);
-}
-
 /**Function*************************************************************
 
   Synopsis    [Writes CNF into a file.]
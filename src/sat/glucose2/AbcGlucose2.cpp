@@ -680,50 +680,31 @@ void glucose2_print_stats(SimpSolver& s, abctime clk) {
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Loads CNF in DIMACS format into the solver.]
 
-  Description []
+  Description [Returns 0 if the file cannot be read or parsed.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Glucose_ReadDimacs(char* pFileName, SimpSolver& s) {
+int Glucose_ReadDimacs(char* pFileName, SimpSolver& s) {
     vec<Lit>* lits = &s.user_lits;
-    char* pBuffer = Extra_FileReadContents(pFileName);
-    char* pTemp;
-    int fComp, Var, VarMax = 0;
-    lits->clear();
-    for (pTemp = pBuffer; *pTemp; pTemp++) {
-        if (*pTemp == 'c' || *pTemp == 'p') {
-            while (*pTemp != '\n')
-                pTemp++;
-            continue;
-        }
-        while (*pTemp == ' ' || *pTemp == '\t' || *pTemp == '\r' || *pTemp == '\n')
-            pTemp++;
-        fComp = 0;
-        if (*pTemp == '-')
-            fComp = 1, pTemp++;
-        if (*pTemp == '+')
-            pTemp++;
-        Var = atoi(pTemp);
-        if (Var == 0) {
-            if (lits->size() > 0) {
-                s.addVar(VarMax);
-                s.addClause(*lits);
-                lits->clear();
-            }
-        } else {
-            Var--;
-            VarMax = Abc_MaxInt(VarMax, Var);
-            lits->push(toLit(Abc_Var2Lit(Var, fComp)));
-        }
-        while (*pTemp >= '0' && *pTemp <= '9')
-            pTemp++;
+    Cnf_Dat_t* pCnf = Cnf_DataReadFromFile(pFileName);
+    int *pLit, *pStop, i;
+    if (pCnf == NULL)
+        return 0;
+    if (pCnf->nVars > 0)
+        s.addVar(pCnf->nVars - 1);
+    for (i = 0; i < pCnf->nClauses; i++) {
+        lits->clear();
+        for (pLit = pCnf->pClauses[i], pStop = pCnf->pClauses[i + 1]; pLit < pStop; pLit++)
+            lits->push(toLit(*pLit));
+        s.addClause(*lits);
     }
-    ABC_FREE(pBuffer);
+    Cnf_DataFree(pCnf);
+    return 1;
 }
 
 /**Function*************************************************************
@@ -747,7 +728,10 @@ void Glucose2_SolveCnf(char* pFileName, Glucose2_Pars* pPars) {
     //    gzFile in = gzopen(pFilename, "rb");
     //    parse_DIMACS(in, S);
     //    gzclose(in);
-    Glucose_ReadDimacs(pFileName, S);
+    if (!Glucose_ReadDimacs(pFileName, S)) {
+        printf("Glucose2_SolveCnf(): Cannot read CNF from file \"%s\".\n", pFileName);
+        return;
+    }
 
     if (pPars->verb) {
         printf("c ============================[ Problem Statistics ]=============================\n");
@@ -19,7 +19,8 @@ struct clause {
     unsigned f_mark : 1;
     unsigned f_reallocd : 1;
     unsigned f_deletable : 1;
-    unsigned lbd : 28;
+    unsigned f_vivified : 1;
+    unsigned lbd : 27;
     unsigned size;
     union {
         unsigned lit;
@@ -0,0 +1,657 @@
+//===--- inproc.c -----------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "solver.h"
+#include "utils/mem.h"
+#include "utils/sort.h"
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_IMPL_START
+
+/* Inprocessing runs at decision level 0 between restarts and consists of
+ * three techniques applied in order:
+ *  - vivification: each clause is probed by assigning its literals to false
+ *    one by one; literals implied false are removed and the probing stops as
+ *    soon as propagation derives a conflict or satisfies the clause;
+ *  - backward subsumption and self-subsuming resolution among the original
+ *    clauses, using literal occurrence lists built for the round;
+ *  - bounded variable elimination (BVE) of variables which are not frozen,
+ *    not assumed and whose elimination does not increase the n.of clauses.
+ *
+ * Eliminated clauses are kept on a stack. When the solver finds a model the
+ * values of the eliminated variables are reconstructed from this stack. When
+ * an eliminated variable is used again (new clause, assumption, freezing) its
+ * clauses are added back, which keeps the solver usable incrementally.
+ */
+
+//===------------------------------------------------------------------------===
+// Clause helpers
+//===------------------------------------------------------------------------===
+static inline int clause_is_sat(solver_t* s, struct clause* clause) {
+    unsigned i;
+    for (i = 0; i < clause->size; i++)
+        if (lit_value(s, clause->data[i].lit) == SATOKO_LIT_TRUE)
+            return 1;
+    return 0;
+}
+
+static inline void clause_remove_lits_stats(solver_t* s, struct clause* clause, unsigned n_lits) {
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= n_lits;
+    else
+        s->stats.n_original_lits -= n_lits;
+}
+
+/* Deletes a clause that is not watched */
+static inline void clause_drop(solver_t* s, unsigned cref) {
+    struct clause* clause = clause_fetch(s, cref);
+    clause_remove_lits_stats(s, clause, clause->size);
+    clause->f_mark = 1;
+    cdb_remove(s->all_clauses, clause);
+}
+
+static inline void clause_delete(solver_t* s, unsigned cref) {
+    clause_unwatch(s, cref);
+    clause_drop(s, cref);
+}
+
+/* Replaces the literals of a not watched clause by a shorter sequence */
+static inline void clause_shrink(solver_t* s, unsigned cref, unsigned* lits, unsigned size) {
+    struct clause* clause = clause_fetch(s, cref);
+    unsigned n_removed = clause->size - size;
+    clause_act_t act = 0;
+
+    assert(size > 1 && size <= clause->size);
+    if (clause->f_learnt)
+        act = clause->data[clause->size].act;
+    memmove(&(clause->data[0].lit), lits, sizeof(unsigned) * size);
+    clause->size = size;
+    if (clause->f_learnt) {
+        clause->data[size].act = act;
+        if (clause->lbd > size)
+            clause->lbd = size;
+    }
+    clause_remove_lits_stats(s, clause, n_removed);
+    s->all_clauses->wasted += n_removed;
+}
+
+/* Adds a unit at decision level 0 and propagates it */
+static inline int solver_add_unit(solver_t* s, unsigned lit) {
+    assert(solver_dlevel(s) == 0);
+    if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+        return SATOKO_OK;
+    if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+        return SATOKO_ERR;
+    solver_enqueue(s, lit, UNDEF);
+    return solver_propagate(s) == UNDEF ? SATOKO_OK : SATOKO_ERR;
+}
+
+/* Removes satisfied clauses and literals falsified at level 0 */
+static inline void solver_inproc_clean(solver_t* s, vec_uint_t* crefs) {
+    unsigned i, j, cref;
+
+    vec_uint_foreach(crefs, cref, i) {
+        struct clause* clause = clause_fetch(s, cref);
+        unsigned* lits = &(clause->data[0].lit);
+        unsigned k, n;
+
+        if (clause->f_mark)
+            continue;
+        if (clause_is_sat(s, clause)) {
+            clause_delete(s, cref);
+            continue;
+        }
+        /* Watched literals of a clause which is not satisfied are not false
+         * after propagation, so only the others have to be checked */
+        for (k = n = 2; k < clause->size; k++)
+            if (lit_value(s, lits[k]) != SATOKO_LIT_FALSE)
+                lits[n++] = lits[k];
+        if (n < clause->size) {
+            clause_unwatch(s, cref);
+            clause_shrink(s, cref, lits, n);
+            clause_watch(s, cref);
+        }
+    }
+    j = 0;
+    vec_uint_foreach(crefs, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(crefs, j++, cref);
+    vec_uint_shrink(crefs, j);
+}
+
+static inline void solver_inproc_compact(solver_t* s) {
+    unsigned i, j, cref;
+
+    j = 0;
+    vec_uint_foreach(s->originals, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(s->originals, j++, cref);
+    vec_uint_shrink(s->originals, j);
+    j = 0;
+    vec_uint_foreach(s->learnts, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(s->learnts, j++, cref);
+    vec_uint_shrink(s->learnts, j);
+}
+
+static inline void solver_inproc_order(solver_t* s) {
+    unsigned var;
+    vec_uint_t* vars = vec_uint_alloc(vec_char_size(s->assigns));
+
+    for (var = 0; var < vec_char_size(s->assigns); var++)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_eliminated(s, var))
+            vec_uint_push_back(vars, var);
+    heap_build(s->var_order, vars);
+    vec_uint_free(vars);
+}
+
+//===------------------------------------------------------------------------===
+// Vivification
+//===------------------------------------------------------------------------===
+/* Returns SATOKO_ERR if the problem became UNSAT at level 0 */
+static inline int solver_vivify_clause(solver_t* s, unsigned cref) {
+    struct clause* clause = clause_fetch(s, cref);
+    unsigned* lits = &(clause->data[0].lit);
+    unsigned i, size = clause->size, f_sat = 0;
+
+    clause_unwatch(s, cref);
+    vec_uint_clear(s->temp_lits);
+    for (i = 0; i < size; i++) {
+        unsigned lit = lits[i];
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+            /* Satisfied at level 0 or implied by the negation of the
+             * literals probed so far */
+            f_sat = (solver_dlevel(s) == 0);
+            vec_uint_push_back(s->temp_lits, lit);
+            break;
+        }
+        if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        vec_uint_push_back(s->temp_lits, lit);
+        vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+        solver_enqueue(s, lit_compl(lit), UNDEF);
+        if (solver_propagate(s) != UNDEF)
+            break;
+    }
+    solver_cancel_until(s, 0);
+    clause->f_vivified = 1;
+    if (f_sat) {
+        clause_drop(s, cref);
+        return SATOKO_OK;
+    }
+    if (vec_uint_size(s->temp_lits) == size) {
+        clause_watch(s, cref);
+        return SATOKO_OK;
+    }
+    s->stats.n_vivified_lits += size - vec_uint_size(s->temp_lits);
+    if (vec_uint_size(s->temp_lits) == 1) {
+        clause_drop(s, cref);
+        return solver_add_unit(s, vec_uint_at(s->temp_lits, 0));
+    }
+    clause_shrink(s, cref, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
+    clause_watch(s, cref);
+    return SATOKO_OK;
+}
+
+static int solver_vivify(solver_t* s, vec_uint_t* crefs, unsigned max_lbd) {
+    long limit = s->stats.n_propagations + s->opts.inproc_effort;
+    unsigned i, cref;
+
+    vec_uint_foreach(crefs, cref, i) {
+        struct clause* clause = clause_fetch(s, cref);
+        if (s->stats.n_propagations > limit)
+            break;
+        if (clause->f_mark || clause->f_vivified || clause->size <= 2)
+            continue;
+        if (clause->f_learnt && clause->lbd > max_lbd)
+            continue;
+        if (solver_vivify_clause(s, cref) == SATOKO_ERR)
+            return SATOKO_ERR;
+    }
+    return SATOKO_OK;
+}
+
+//===------------------------------------------------------------------------===
+// Occurrence lists
+//===------------------------------------------------------------------------===
+/* Builds occurrence lists of the original clauses: the clauses of literal
+ * 'lit' are stored in 'occs' from 'occ_beg[lit]' to 'occ_beg[lit + 1]' */
+static void solver_occ_build(solver_t* s, vec_uint_t* occ_beg, vec_uint_t* occs) {
+    unsigned n_lits = 2 * vec_char_size(s->assigns);
+    unsigned i, k, cref, total = 0;
+    unsigned* beg;
+
+    vec_uint_resize(occ_beg, n_lits + 1);
+    beg = vec_uint_data(occ_beg);
+    memset(beg, 0, sizeof(unsigned) * (n_lits + 1));
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause* clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        for (k = 0; k < clause->size; k++)
+            beg[clause->data[k].lit + 1]++;
+    }
+    for (i = 1; i <= n_lits; i++)
+        beg[i] += beg[i - 1];
+    total = beg[n_lits];
+    vec_uint_resize(occs, total);
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause* clause = clause_fetch(s, cref);
+        if (clause->f_mark)
+            continue;
+        for (k = 0; k < clause->size; k++)
+            vec_uint_assign(occs, beg[clause->data[k].lit]++, cref);
+    }
+    /* Shift the starting points back */
+    for (i = n_lits; i > 0; i--)
+        beg[i] = beg[i - 1];
+    beg[0] = 0;
+}
+
+static inline unsigned occ_size(vec_uint_t* occ_beg, unsigned lit) {
+    return vec_uint_at(occ_beg, lit + 1) - vec_uint_at(occ_beg, lit);
+}
+
+//===------------------------------------------------------------------------===
+// Subsumption
+//===------------------------------------------------------------------------===
+static int clause_size_compare(const void* p1, const void* p2) {
+    return ((const struct clause*)p1)->size < ((const struct clause*)p2)->size;
+}
+
+/* Removes literal 'lit' from clause 'cref'.
+ * Returns SATOKO_ERR if the problem became UNSAT at level 0 */
+static inline int solver_strengthen(solver_t* s, unsigned cref, unsigned lit) {
+    struct clause* clause = clause_fetch(s, cref);
+    unsigned* lits = &(clause->data[0].lit);
+    unsigned k, n;
+
+    clause_unwatch(s, cref);
+    for (k = n = 0; k < clause->size; k++)
+        if (lits[k] != lit)
+            lits[n++] = lits[k];
+    assert(n + 1 == clause->size);
+    s->stats.n_strengthened++;
+    if (n == 1) {
+        clause_drop(s, cref);
+        return solver_add_unit(s, lits[0]);
+    }
+    clause_shrink(s, cref, lits, n);
+    /* Move non-false literals into the watched positions */
+    for (k = n = 0; k < clause->size && n < 2; k++)
+        if (lit_value(s, lits[k]) != SATOKO_LIT_FALSE) {
+            stk_swap(unsigned, lits[n], lits[k]);
+            n++;
+        }
+    if (n == 0)
+        return SATOKO_ERR;
+    if (n == 1) {
+        clause_drop(s, cref);
+        return solver_add_unit(s, lits[0]);
+    }
+    clause_watch(s, cref);
+    return SATOKO_OK;
+}
+
+static int solver_subsume(solver_t* s, vec_uint_t* occ_beg, vec_uint_t* occs, vec_uint_t* lit_marks) {
+    unsigned n_clauses = vec_uint_size(s->originals);
+    struct clause** clauses = satoko_alloc(struct clause*, n_clauses);
+    long steps = 0;
+    unsigned i, j, k, cref;
+    int RetValue = SATOKO_OK;
+
+    vec_uint_foreach(s->originals, cref, i)
+        clauses[i]
+        = clause_fetch(s, cref);
+    satoko_sort((void**)clauses, n_clauses, clause_size_compare);
+    for (i = 0; i < n_clauses && steps < (long)s->opts.inproc_effort && RetValue == SATOKO_OK; i++) {
+        struct clause* clause = clauses[i];
+        unsigned* lits = &(clause->data[0].lit);
+        unsigned best = UNDEF, best_size = UNDEF, stamp;
+
+        if (clause->f_mark)
+            continue;
+        stamp = ++s->cur_stamp;
+        for (k = 0; k < clause->size; k++) {
+            unsigned n = occ_size(occ_beg, lits[k]) + occ_size(occ_beg, lit_compl(lits[k]));
+            vec_uint_assign(lit_marks, lits[k], stamp);
+            if (n < best_size) {
+                best_size = n;
+                best = lits[k];
+            }
+        }
+        for (k = 0; k < 2 && RetValue == SATOKO_OK; k++) {
+            unsigned lit = k ? lit_compl(best) : best;
+            for (j = vec_uint_at(occ_beg, lit); j < vec_uint_at(occ_beg, lit + 1); j++) {
+                unsigned d_cref = vec_uint_at(occs, j);
+                struct clause* other = clause_fetch(s, d_cref);
+                unsigned* d_lits = &(other->data[0].lit);
+                unsigned n_same = 0, n_neg = 0, neg_lit = UNDEF, m;
+
+                if (other == clause || other->f_mark || other->size < clause->size)
+                    continue;
+                steps += other->size;
+                for (m = 0; m < other->size; m++) {
+                    if (vec_uint_at(lit_marks, d_lits[m]) == stamp)
+                        n_same++;
+                    else if (vec_uint_at(lit_marks, lit_compl(d_lits[m])) == stamp) {
+                        n_neg++;
+                        neg_lit = d_lits[m];
+                    }
+                }
+                if (n_same == clause->size) {
+                    clause_delete(s, d_cref);
+                    s->stats.n_subsumed++;
+                } else if (n_neg == 1 && n_same + 1 == clause->size) {
+                    if (solver_strengthen(s, d_cref, neg_lit) == SATOKO_ERR) {
+                        RetValue = SATOKO_ERR;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    satoko_free(clauses);
+    return RetValue;
+}
+
+//===------------------------------------------------------------------------===
+// Bounded variable elimination
+//===------------------------------------------------------------------------===
+/* Computes the resolvent of two clauses on 'var' into 'res'.
+ * Returns 0 if the resolvent is a tautology */
+static inline int clause_resolve(solver_t* s, unsigned var, struct clause* pos, struct clause* neg, vec_uint_t* lit_marks, vec_uint_t* res) {
+    unsigned stamp = ++s->cur_stamp;
+    unsigned k, lit;
+
+    vec_uint_clear(res);
+    for (k = 0; k < pos->size; k++) {
+        lit = pos->data[k].lit;
+        if (lit2var(lit) == var)
+            continue;
+        vec_uint_assign(lit_marks, lit, stamp);
+        vec_uint_push_back(res, lit);
+    }
+    for (k = 0; k < neg->size; k++) {
+        lit = neg->data[k].lit;
+        if (lit2var(lit) == var || vec_uint_at(lit_marks, lit) == stamp)
+            continue;
+        if (vec_uint_at(lit_marks, lit_compl(lit)) == stamp)
+            return 0;
+        vec_uint_push_back(res, lit);
+    }
+    return 1;
+}
+
+/* Collects not deleted clauses of literal 'lit' */
+static inline void solver_occ_collect(solver_t* s, vec_uint_t* occ_beg, vec_uint_t* occs, unsigned lit, vec_uint_t* crefs) {
+    unsigned j;
+    vec_uint_clear(crefs);
+    for (j = vec_uint_at(occ_beg, lit); j < vec_uint_at(occ_beg, lit + 1); j++)
+        if (!clause_fetch(s, vec_uint_at(occs, j))->f_mark)
+            vec_uint_push_back(crefs, vec_uint_at(occs, j));
+}
+
+/* Checks whether elimination of 'var' does not increase the n.of clauses */
+static inline int solver_bve_check(solver_t* s, unsigned var, vec_uint_t* pos, vec_uint_t* neg, vec_uint_t* lit_marks, vec_uint_t* res, long* steps) {
+    unsigned i, j, n_res = 0;
+
+    for (i = 0; i < vec_uint_size(pos); i++)
+        for (j = 0; j < vec_uint_size(neg); j++) {
+            struct clause* c_pos = clause_fetch(s, vec_uint_at(pos, i));
+            struct clause* c_neg = clause_fetch(s, vec_uint_at(neg, j));
+            *steps += c_pos->size + c_neg->size;
+            if (!clause_resolve(s, var, c_pos, c_neg, lit_marks, res))
+                continue;
+            if (vec_uint_size(res) > s->opts.bve_max_clause_sz)
+                return 0;
+            if (++n_res > vec_uint_size(pos) + vec_uint_size(neg))
+                return 0;
+        }
+    return 1;
+}
+
+static inline void solver_elim_save(solver_t* s, vec_uint_t* crefs) {
+    unsigned i, k, cref;
+    vec_uint_foreach(crefs, cref, i) {
+        struct clause* clause = clause_fetch(s, cref);
+        vec_uint_push_back(s->elim_clauses, clause->size);
+        for (k = 0; k < clause->size; k++)
+            vec_uint_push_back(s->elim_clauses, clause->data[k].lit);
+    }
+}
+
+/* Eliminates 'var' by replacing its clauses with their resolvents.
+ * Returns SATOKO_ERR if the problem became UNSAT at level 0 */
+static int solver_bve_var(solver_t* s, unsigned var, vec_uint_t* pos, vec_uint_t* neg, vec_uint_t* lit_marks, vec_uint_t* res, vec_char_t* touched) {
+    unsigned i, j, k, lit, cref;
+
+    /* Add resolvents; new units are propagated after the round */
+    for (i = 0; i < vec_uint_size(pos); i++)
+        for (j = 0; j < vec_uint_size(neg); j++) {
+            if (!clause_resolve(s, var, clause_fetch(s, vec_uint_at(pos, i)), clause_fetch(s, vec_uint_at(neg, j)), lit_marks, res))
+                continue;
+            for (k = 0; k < vec_uint_size(res); k++) {
+                lit = vec_uint_at(res, k);
+                if (lit_value(s, lit) == SATOKO_LIT_TRUE)
+                    break;
+                if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+                    vec_uint_drop(res, k--);
+            }
+            if (k < vec_uint_size(res))
+                continue;
+            if (vec_uint_size(res) == 0)
+                return SATOKO_ERR;
+            if (vec_uint_size(res) == 1)
+                solver_enqueue(s, vec_uint_at(res, 0), UNDEF);
+            else
+                clause_watch(s, solver_clause_create(s, res, 0));
+        }
+    /* Save and remove the clauses of the variable */
+    vec_uint_push_back(s->elim_vars, var);
+    vec_uint_push_back(s->elim_lim, vec_uint_size(s->elim_clauses));
+    solver_elim_save(s, pos);
+    solver_elim_save(s, neg);
+    for (i = 0; i < 2; i++) {
+        vec_uint_t* crefs = i ? neg : pos;
+        vec_uint_foreach(crefs, cref, j) {
+            struct clause* clause = clause_fetch(s, cref);
+            for (k = 0; k < clause->size; k++)
+                vec_char_assign(touched, lit2var(clause->data[k].lit), 1);
+            clause_delete(s, cref);
+        }
+    }
+    vec_char_assign(s->eliminated, var, 1);
+    s->n_eliminated++;
+    s->stats.n_eliminated++;
+    return SATOKO_OK;
+}
+
+static int solver_bve(solver_t* s, vec_uint_t* occ_beg, vec_uint_t* occs, vec_uint_t* lit_marks) {
+    unsigned n_vars = vec_char_size(s->assigns);
+    vec_char_t* touched = vec_char_init(n_vars, 0);
+    vec_uint_t* pos = vec_uint_alloc(0);
+    vec_uint_t* neg = vec_uint_alloc(0);
+    vec_uint_t* res = vec_uint_alloc(0);
+    unsigned i, var, n_occ, n_elim = s->n_eliminated;
+    long steps = 0;
+    int RetValue = SATOKO_OK;
+
+    /* Assumptions and variables in the current cone are kept */
+    vec_uint_foreach(s->assumptions, var, i)
+        vec_char_assign(touched, lit2var(var), 1);
+    /* Try the variables with fewer occurrences first */
+    for (n_occ = 1; n_occ <= s->opts.bve_max_occ && RetValue == SATOKO_OK; n_occ++) {
+        for (var = 0; var < n_vars && steps < (long)s->opts.inproc_effort; var++) {
+            unsigned lit = var2lit(var, 0);
+            if (vec_char_at(touched, var) || var_frozen(s, var) || var_eliminated(s, var) || var_value(s, var) != SATOKO_VAR_UNASSING)
+                continue;
+            if (occ_size(occ_beg, lit) + occ_size(occ_beg, lit_compl(lit)) != n_occ)
+                continue;
+            solver_occ_collect(s, occ_beg, occs, lit, pos);
+            solver_occ_collect(s, occ_beg, occs, lit_compl(lit), neg);
+            if (!solver_bve_check(s, var, pos, neg, lit_marks, res, &steps))
+                continue;
+            if (solver_bve_var(s, var, pos, neg, lit_marks, res, touched) == SATOKO_ERR) {
+                RetValue = SATOKO_ERR;
+                break;
+            }
+        }
+    }
+    /* Learnt clauses with eliminated variables are removed */
+    if (s->n_eliminated > n_elim) {
+        unsigned cref, k;
+        vec_uint_foreach(s->learnts, cref, i) {
+            struct clause* clause = clause_fetch(s, cref);
+            if (clause->f_mark)
+                continue;
+            for (k = 0; k < clause->size; k++)
+                if (var_eliminated(s, lit2var(clause->data[k].lit)))
+                    break;
+            if (k < clause->size)
+                clause_delete(s, cref);
+        }
+    }
+    vec_char_free(touched);
+    vec_uint_free(pos);
+    vec_uint_free(neg);
+    vec_uint_free(res);
+    return RetValue;
+}
+
+//===------------------------------------------------------------------------===
+// Solver external functions
+//===------------------------------------------------------------------------===
+int solver_inprocess(solver_t* s) {
+    vec_uint_t* occ_beg = vec_uint_alloc(0);
+    vec_uint_t* occs = vec_uint_alloc(0);
+    vec_uint_t* lit_marks;
+    unsigned i, lit;
+    int RetValue = SATOKO_ERR;
+
+    assert(solver_dlevel(s) == 0);
+    assert(!solver_has_marks(s));
+    s->n_inproc_rounds++;
+    s->n_rst_next = s->n_rst_inproc + s->opts.inproc_restarts * s->n_inproc_rounds;
+    s->stats.n_inprocess++;
+    if (solver_propagate(s) != UNDEF)
+        goto finish;
+    /* Reasons of level 0 assignments are never used by conflict analysis */
+    vec_uint_foreach(s->trail, lit, i)
+        vec_uint_assign(s->reasons, lit2var(lit), UNDEF);
+    lit_marks = vec_uint_init(2 * vec_char_size(s->assigns), 0);
+    solver_inproc_clean(s, s->originals);
+    solver_inproc_clean(s, s->learnts);
+    /* Only learnt clauses likely to be kept by the reduction are vivified */
+    if (solver_vivify(s, s->learnts, 6) == SATOKO_ERR)
+        goto finish_marks;
+    if (solver_vivify(s, s->originals, 0) == SATOKO_ERR)
+        goto finish_marks;
+    solver_inproc_compact(s);
+    solver_occ_build(s, occ_beg, occs);
+    if (solver_subsume(s, occ_beg, occs, lit_marks) == SATOKO_ERR)
+        goto finish_marks;
+    if (!s->opts.no_bve) {
+        solver_inproc_clean(s, s->originals);
+        solver_occ_build(s, occ_beg, occs);
+        if (solver_bve(s, occ_beg, occs, lit_marks) == SATOKO_ERR)
+            goto finish_marks;
+    }
+    solver_inproc_compact(s);
+    if (solver_propagate(s) != UNDEF)
+        goto finish_marks;
+    solver_inproc_order(s);
+    RetValue = SATOKO_OK;
+finish_marks:
+    vec_uint_free(lit_marks);
+finish:
+    vec_uint_free(occ_beg);
+    vec_uint_free(occs);
+    if (RetValue == SATOKO_ERR) {
+        vec_uint_clear(s->final_conflict);
+        return RetValue;
+    }
+    if (cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+        solver_garbage_collect(s);
+    if (s->opts.verbose) {
+        printf("inprocess: Vivified %ld lits, subsumed %ld, strengthened %ld, eliminated %u vars\n",
+               s->stats.n_vivified_lits, s->stats.n_subsumed, s->stats.n_strengthened, s->n_eliminated);
+        fflush(stdout);
+    }
+    return RetValue;
+}
+
+/* Assigns eliminated variables (in the reverse order of elimination) so that
+ * their removed clauses are satisfied by the model stored in 'polarity' */
+void solver_extend_model(solver_t* s) {
+    unsigned b, i, k;
+
+    for (b = vec_uint_size(s->elim_vars); b-- > 0;) {
+        unsigned var = vec_uint_at(s->elim_vars, b);
+        unsigned end = b + 1 < vec_uint_size(s->elim_lim) ? vec_uint_at(s->elim_lim, b + 1) : vec_uint_size(s->elim_clauses);
+        if (var == UNDEF)
+            continue;
+        for (i = vec_uint_at(s->elim_lim, b); i < end; i += 1 + vec_uint_at(s->elim_clauses, i)) {
+            unsigned size = vec_uint_at(s->elim_clauses, i);
+            unsigned* lits = vec_uint_at_ptr(s->elim_clauses, i + 1);
+            unsigned pivot = UNDEF;
+            for (k = 0; k < size; k++) {
+                if (vec_char_at(s->polarity, lit2var(lits[k])) == lit_polarity(lits[k]))
+                    break;
+                if (lit2var(lits[k]) == var)
+                    pivot = lits[k];
+            }
+            if (k == size) {
+                assert(pivot != UNDEF);
+                vec_char_assign(s->polarity, var, lit_polarity(pivot));
+            }
+        }
+    }
+}
+
+/* Adds back the clauses removed by eliminating 'var'.
+ * Returns SATOKO_ERR if the problem became UNSAT at level 0 */
+int solver_restore_var(solver_t* s, unsigned var) {
+    unsigned b, i, end;
+    int RetValue = SATOKO_OK;
+
+    assert(var_eliminated(s, var));
+    for (b = vec_uint_size(s->elim_vars); b-- > 0;)
+        if (vec_uint_at(s->elim_vars, b) == var)
+            break;
+    assert(b < vec_uint_size(s->elim_vars));
+    vec_char_assign(s->eliminated, var, 0);
+    s->n_eliminated--;
+    solver_cancel_until(s, 0);
+    if (!heap_in_heap(s->var_order, var))
+        heap_insert(s->var_order, var);
+    end = b + 1 < vec_uint_size(s->elim_lim) ? vec_uint_at(s->elim_lim, b + 1) : vec_uint_size(s->elim_clauses);
+    /* The clauses may contain variables eliminated later, which are restored
+     * recursively by satoko_add_clause() */
+    for (i = vec_uint_at(s->elim_lim, b); i < end; i += 1 + vec_uint_at(s->elim_clauses, i))
+        if (satoko_add_clause(s, (int*)vec_uint_at_ptr(s->elim_clauses, i + 1), (int)vec_uint_at(s->elim_clauses, i)) == SATOKO_ERR) {
+            s->status = SATOKO_ERR;
+            RetValue = SATOKO_ERR;
+            break;
+        }
+    /* The entry is released only now, so that restoring the variables above
+     * it does not shrink the stack under the loop */
+    vec_uint_assign(s->elim_vars, b, UNDEF);
+    /* Drop the restored entries at the top of the stack */
+    while (vec_uint_size(s->elim_vars) && vec_uint_at(s->elim_vars, vec_uint_size(s->elim_vars) - 1) == UNDEF) {
+        vec_uint_shrink(s->elim_clauses, vec_uint_pop_back(s->elim_lim));
+        vec_uint_pop_back(s->elim_vars);
+    }
+    return RetValue;
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -66,6 +66,13 @@ struct satoko_opts {
     float garbage_max_ratio;
     char verbose;
     char no_simplify;
+
+    /* Inprocessing (vivification, subsumption, variable elimination) */
+    unsigned inproc_restarts;   /* N.of restarts before the first round, increased after each round (0 = no inprocessing) */
+    unsigned inproc_effort;     /* Limit on the n.of steps of each technique in one round */
+    unsigned bve_max_occ;       /* Max n.of occurrences of an eliminated variable */
+    unsigned bve_max_clause_sz; /* Max size of a resolvent */
+    char no_bve;                /* Disables variable elimination */
 };
 
 typedef struct satoko_stats satoko_stats_t;
@@ -82,6 +89,12 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    unsigned n_inprocess;
+    unsigned n_eliminated;
+    long n_vivified_lits;
+    long n_subsumed;
+    long n_strengthened;
 };
 
 //===------------------------------------------------------------------------===
@@ -104,6 +117,13 @@ extern int satoko_solve_assumptions_limit(satoko_t* s, int* plits, int nlits, in
 extern int satoko_minimize_assumptions(satoko_t* s, int* plits, int nlits, int nconflim);
 extern void satoko_mark_cone(satoko_t*, int*, int);
 extern void satoko_unmark_cone(satoko_t*, int*, int);
+/* Procedure to protect a variable from elimination during inprocessing.
+ * - Eliminated variables are restored automatically when they appear in a
+ *   new clause or an assumption, so freezing is only needed to avoid the
+ *   overhead of restoring the variables which are going to be used again.
+ */
+extern void satoko_set_frozen(satoko_t*, int, int);
+extern int satoko_elim_varnum(satoko_t*);
 
 extern void satoko_rollback(satoko_t*);
 extern void satoko_bookmark(satoko_t*);
@@ -137,6 +157,14 @@ extern int satoko_conflictnum(satoko_t*);
 extern void satoko_set_stop(satoko_t*, int*);
 extern void satoko_set_stop_func(satoko_t* s, int (*fnct)(int));
 extern void satoko_set_runid(satoko_t*, int);
+/* Procedure to connect the solver to a clause-sharing channel.
+ * - The export callback receives each learnt clause, its size and LBD.
+ * - The import callback is called at decision level 0 and returns the
+ *   size of the next clause learnt by another solver (or -1 if there is
+ *   none); the clause literals are returned through the second argument.
+ * - Imported clauses should be implied by the clauses of this solver.
+ */
+extern void satoko_set_share(satoko_t*, void*, void (*)(void*, int*, int, int), int (*)(void*, int**));
 extern int satoko_read_cex_varvalue(satoko_t*, int);
 extern abctime satoko_set_runtime_limit(satoko_t*, abctime);
 extern char satoko_var_polarity(satoko_t*, unsigned);
@@ -339,10 +339,45 @@ static inline void solver_handle_conflict(solver_t* s, unsigned confl_cref) {
         clause_watch(s, cref);
     }
     solver_enqueue(s, vec_uint_at(s->temp_lits, 0), cref);
+    if (s->pFuncExport)
+        s->pFuncExport(s->pShare, (int*)vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits), lbd);
     var_act_decay(s);
     clause_act_decay(s);
 }
 
+/* Adds clauses learnt by other solvers. Literals assigned at level 0 are
+ * simplified away, so the remaining ones are unassigned and can be watched.
+ * Returns the number of new units or -1 if an imported clause is falsified.
+ */
+static inline int solver_import_clauses(solver_t* s) {
+    unsigned n_vars = vec_char_size(s->assigns);
+    int n_units = 0;
+    int* lits;
+    int size, i;
+
+    assert(solver_dlevel(s) == 0);
+    while ((size = s->pFuncImport(s->pShare, &lits)) >= 0) {
+        vec_uint_clear(s->temp_lits);
+        for (i = 0; i < size; i++) {
+            unsigned lit = (unsigned)lits[i];
+            if (lit2var(lit) >= n_vars || var_eliminated(s, lit2var(lit)) || lit_value(s, lit) == SATOKO_LIT_TRUE)
+                break;
+            if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING)
+                vec_uint_push_back(s->temp_lits, lit);
+        }
+        if (i < size)
+            continue;
+        if (vec_uint_size(s->temp_lits) == 0)
+            return -1;
+        if (vec_uint_size(s->temp_lits) == 1) {
+            solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
+            n_units++;
+        } else
+            clause_watch(s, solver_clause_create(s, s->temp_lits, 1));
+    }
+    return n_units;
+}
+
 static inline void solver_analyze_final(solver_t* s, unsigned lit) {
     unsigned i;
 
@@ -376,7 +411,7 @@ static inline void solver_analyze_final(solver_t* s, unsigned lit) {
     // solver_debug_check_unsat(s);
 }
 
-static inline void solver_garbage_collect(solver_t* s) {
+void solver_garbage_collect(solver_t* s) {
     unsigned i;
     unsigned* array;
     struct cdb* new_cdb = cdb_alloc(cdb_capacity(s->all_clauses) - cdb_wasted(s->all_clauses));
@@ -476,6 +511,7 @@ unsigned solver_clause_create(solver_t* s, vec_uint_t* lits, unsigned f_learnt)
     clause->f_mark = 0;
     clause->f_reallocd = 0;
     clause->f_deletable = f_learnt;
+    clause->f_vivified = 0;
     clause->size = vec_uint_size(lits);
     memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * vec_uint_size(lits));
 
@@ -609,8 +645,10 @@ char solver_search(solver_t* s) {
         if (confl_cref != UNDEF) {
             s->stats.n_conflicts++;
             s->stats.n_conflicts_all++;
-            if (solver_dlevel(s) == 0)
+            if (solver_dlevel(s) == 0) {
+                s->status = SATOKO_ERR;
                 return SATOKO_UNSAT;
+            }
             /* Restart heuristic */
             b_queue_push(s->bq_trail, vec_uint_size(s->trail));
             if (solver_block_rst(s))
@@ -626,6 +664,15 @@ char solver_search(solver_t* s) {
                 solver_cancel_until(s, 0);
                 return SATOKO_UNDEC;
             }
+            if (s->pFuncImport && solver_dlevel(s) == 0) {
+                int n_units = solver_import_clauses(s);
+                if (n_units < 0) {
+                    s->status = SATOKO_ERR;
+                    return SATOKO_UNSAT;
+                }
+                if (n_units > 0)
+                    continue;
+            }
             if (!s->opts.no_simplify && solver_dlevel(s) == 0)
                 satoko_simplify(s);
 
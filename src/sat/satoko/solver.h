@@ -98,12 +98,28 @@ struct solver_t_ {
     /* Temporary data used for solving cones */
     vec_char_t* marks;
 
+    /* Inprocessing */
+    vec_char_t* frozen;        /* Variables protected from elimination */
+    vec_char_t* eliminated;    /* Variables removed by variable elimination */
+    vec_uint_t* elim_vars;     /* Eliminated variables in the order of elimination (UNDEF if restored) */
+    vec_uint_t* elim_lim;      /* Beginning of the removed clauses of each eliminated variable */
+    vec_uint_t* elim_clauses;  /* Removed clauses, each stored as its size followed by its literals */
+    unsigned n_eliminated;     /* N.of currently eliminated variables */
+    unsigned n_rst_inproc;     /* N.of restarts since the solver was created */
+    unsigned n_rst_next;       /* N.of restarts triggering the next inprocessing round */
+    unsigned n_inproc_rounds;  /* N.of inprocessing rounds done */
+
     /* Callbacks to stop the solver */
     abctime nRuntimeLimit;
     int* pstop;
     int RunId;
     int (*pFuncStop)(int);
 
+    /* Callbacks to exchange learnt clauses with other solvers */
+    void* pShare;
+    void (*pFuncExport)(void*, int*, int, int);
+    int (*pFuncImport)(void*, int**);
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -113,6 +129,12 @@ extern unsigned solver_clause_create(solver_t*, vec_uint_t*, unsigned);
 extern char solver_search(solver_t*);
 extern void solver_cancel_until(solver_t*, unsigned);
 extern unsigned solver_propagate(solver_t*);
+extern void solver_garbage_collect(solver_t*);
+
+/* Inprocessing */
+extern int solver_inprocess(solver_t*);
+extern void solver_extend_model(solver_t*);
+extern int solver_restore_var(solver_t*, unsigned);
 
 /* Debuging */
 extern void solver_debug_check(solver_t*, int);
@@ -152,6 +174,12 @@ static inline void var_set_mark(solver_t* s, unsigned var) {
 static inline void var_clean_mark(solver_t* s, unsigned var) {
     vec_char_assign(s->marks, var, 0);
 }
+static inline int var_frozen(solver_t* s, unsigned var) {
+    return (int)vec_char_at(s->frozen, var);
+}
+static inline int var_eliminated(solver_t* s, unsigned var) {
+    return (int)vec_char_at(s->eliminated, var);
+}
 //===------------------------------------------------------------------------===
 // Inline lit functions
 //===------------------------------------------------------------------------===
@@ -205,6 +233,17 @@ static inline int solver_stop(satoko_t* s) {
     return s->pstop && *s->pstop;
 }
 
+/* Inprocessing is triggered after a growing number of restarts. It is not
+ * used when solving cones or when the solver is bookmarked for rollback,
+ * because both rely on the clause and variable sets staying unchanged */
+static inline int solver_inproc_due(satoko_t* s) {
+    if (s->opts.inproc_restarts == 0 || s->opts.no_simplify || solver_has_marks(s) || s->book_vars)
+        return 0;
+    if (s->n_rst_next == 0)
+        s->n_rst_next = s->opts.inproc_restarts;
+    return ++s->n_rst_inproc >= s->n_rst_next;
+}
+
 //===------------------------------------------------------------------------===
 // Inline clause functions
 //===------------------------------------------------------------------------===
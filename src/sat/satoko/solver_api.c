@@ -26,7 +26,7 @@ static inline void solver_rebuild_order(solver_t* s) {
     vec_uint_t* vars = vec_uint_alloc(vec_char_size(s->assigns));
 
     for (var = 0; var < vec_char_size(s->assigns); var++)
-        if (var_value(s, var) == SATOKO_VAR_UNASSING)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_eliminated(s, var))
             vec_uint_push_back(vars, var);
     heap_build(s->var_order, vars);
     vec_uint_free(vars);
@@ -75,6 +75,13 @@ static inline void print_stats(solver_t* s) {
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inprocess) {
+        printf("inprocessing  : %10d\n", s->stats.n_inprocess);
+        printf("vivified lits : %10ld\n", s->stats.n_vivified_lits);
+        printf("subsumed      : %10ld\n", s->stats.n_subsumed);
+        printf("strengthened  : %10ld\n", s->stats.n_strengthened);
+        printf("eliminated    : %10d\n", s->stats.n_eliminated);
+    }
 }
 
 //===------------------------------------------------------------------------===
@@ -120,6 +127,12 @@ solver_t* satoko_create() {
     s->last_dlevel = vec_uint_alloc(0);
     /* Misc temporary */
     s->stamps = vec_uint_alloc(0);
+    /* Inprocessing */
+    s->frozen = vec_char_alloc(0);
+    s->eliminated = vec_char_alloc(0);
+    s->elim_vars = vec_uint_alloc(0);
+    s->elim_lim = vec_uint_alloc(0);
+    s->elim_clauses = vec_uint_alloc(0);
     return s;
 }
 
@@ -146,6 +159,11 @@ void satoko_destroy(solver_t* s) {
     vec_uint_free(s->stack);
     vec_uint_free(s->last_dlevel);
     vec_uint_free(s->stamps);
+    vec_char_free(s->frozen);
+    vec_char_free(s->eliminated);
+    vec_uint_free(s->elim_vars);
+    vec_uint_free(s->elim_lim);
+    vec_uint_free(s->elim_clauses);
     if (s->marks)
         vec_char_free(s->marks);
     satoko_free(s);
@@ -180,6 +198,12 @@ void satoko_default_opts(satoko_opts_t* opts) {
     opts->clause_min_lbd_bin_resol = 6;
 
     opts->garbage_max_ratio = (float)0.3;
+    /* Inprocessing */
+    opts->inproc_restarts = 0;
+    opts->inproc_effort = 1000000;
+    opts->bve_max_occ = 16;
+    opts->bve_max_clause_sz = 20;
+    opts->no_bve = 0;
 }
 
 /**
@@ -234,6 +258,8 @@ int satoko_add_variable(solver_t* s, char sign) {
     vec_uint_push_back(s->reasons, UNDEF);
     vec_uint_push_back(s->stamps, 0);
     vec_char_push_back(s->seen, 0);
+    vec_char_push_back(s->frozen, 0);
+    vec_char_push_back(s->eliminated, 0);
     heap_insert(s->var_order, var);
     if (s->marks)
         vec_char_push_back(s->marks, 0);
@@ -246,6 +272,11 @@ int satoko_add_clause(solver_t* s, int* lits, int size) {
     unsigned max_var;
     unsigned cref;
 
+    if (s->n_eliminated)
+        for (i = 0; i < (unsigned)size; i++)
+            if (lit2var(lits[i]) < vec_char_size(s->eliminated) && var_eliminated(s, lit2var(lits[i])))
+                if (solver_restore_var(s, lit2var(lits[i])) == SATOKO_ERR)
+                    return SATOKO_ERR;
     qsort((void*)lits, (size_t)size, sizeof(unsigned), stk_uint_compare);
     max_var = lit2var(lits[size - 1]);
     while (max_var >= vec_act_size(s->activity))
@@ -285,9 +316,13 @@ int satoko_add_clause(solver_t* s, int* lits, int size) {
 
 void satoko_assump_push(solver_t* s, int lit) {
     assert(lit2var(lit) < (unsigned)satoko_varnum(s));
+    if (var_eliminated(s, lit2var(lit)))
+        solver_restore_var(s, lit2var(lit)); // a failure is recorded in s->status
     // printf("[Satoko] Push assumption: %d\n", lit);
     vec_uint_push_back(s->assumptions, lit);
-    vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
+    /* The polarity of an assigned variable holds its value in the model */
+    if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING)
+        vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
 }
 
 void satoko_assump_pop(solver_t* s) {
@@ -304,9 +339,10 @@ int satoko_solve(solver_t* s) {
     solver_clean_stats(s);
     //if (s->opts.verbose)
     //    print_opts(s);
+    /* The problem was found UNSAT at level 0, whatever the assumptions are */
     if (s->status == SATOKO_ERR) {
-        printf("Satoko in inconsistent state\n");
-        return SATOKO_UNDEC;
+        vec_uint_clear(s->final_conflict);
+        return SATOKO_UNSAT;
     }
 
     if (!s->opts.no_simplify)
@@ -321,7 +357,13 @@ int satoko_solve(solver_t* s) {
             break;
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
+        if (status == SATOKO_UNDEC && solver_inproc_due(s) && solver_inprocess(s) == SATOKO_ERR) {
+            s->status = SATOKO_ERR;
+            status = SATOKO_UNSAT;
+        }
     }
+    if (status == SATOKO_SAT && s->n_eliminated)
+        solver_extend_model(s);
     if (s->opts.verbose)
         print_stats(s);
 
@@ -466,6 +508,12 @@ void satoko_reset(satoko_t* s) {
     vec_uint_clear(s->stack);
     vec_uint_clear(s->last_dlevel);
     vec_uint_clear(s->stamps);
+    vec_char_clear(s->frozen);
+    vec_char_clear(s->eliminated);
+    vec_uint_clear(s->elim_vars);
+    vec_uint_clear(s->elim_lim);
+    vec_uint_clear(s->elim_clauses);
+    s->n_eliminated = 0;
     s->status = SATOKO_OK;
     s->var_act_inc = VAR_ACT_INIT_INC;
     s->clause_act_inc = CLAUSE_ACT_INIT_INC;
@@ -522,6 +570,8 @@ void satoko_rollback(satoko_t* s) {
     vec_char_shrink(s->assigns, s->book_vars);
     vec_char_shrink(s->seen, s->book_vars);
     vec_char_shrink(s->polarity, s->book_vars);
+    vec_char_shrink(s->frozen, s->book_vars);
+    vec_char_shrink(s->eliminated, s->book_vars);
     solver_rebuild_order(s);
     /* Rewind solver and cancel level 0 assignments to the trail */
     solver_cancel_until(s, 0);
@@ -554,6 +604,17 @@ void satoko_unmark_cone(satoko_t* s, int* pvars, int n_vars) {
         var_clean_mark(s, pvars[i]);
 }
 
+void satoko_set_frozen(satoko_t* s, int var, int freeze) {
+    assert(var >= 0 && var < satoko_varnum(s));
+    if (freeze && var_eliminated(s, var))
+        solver_restore_var(s, var); // a failure is recorded in s->status
+    vec_char_assign(s->frozen, var, (char)(freeze != 0));
+}
+
+int satoko_elim_varnum(satoko_t* s) {
+    return s->n_eliminated;
+}
+
 void satoko_write_dimacs(satoko_t* s, char* fname, int wrt_lrnt, int zero_var) {
     FILE* file;
     unsigned i;
@@ -622,6 +683,12 @@ void satoko_set_runid(satoko_t* s, int id) {
     s->RunId = id;
 }
 
+void satoko_set_share(satoko_t* s, void* pshare, void (*fexport)(void*, int*, int, int), int (*fimport)(void*, int**)) {
+    s->pShare = pshare;
+    s->pFuncExport = fexport;
+    s->pFuncImport = fimport;
+}
+
 int satoko_read_cex_varvalue(satoko_t* s, int ivar) {
     return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;
 }
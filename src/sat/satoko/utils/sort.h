@@ -29,6 +29,8 @@ static inline void select_sort(void** data, unsigned size, int (*comp_fn)(const
 }
 
 static void satoko_sort(void** data, unsigned size, int (*comp_fn)(const void*, const void*)) {
+    if (size < 2) /* also avoids (size - 1) wrapping around in select_sort() */
+        return;
     if (size <= 15)
         select_sort(data, size, comp_fn);
     else {
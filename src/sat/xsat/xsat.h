@@ -40,6 +40,7 @@ typedef struct xSAT_Solver_t_ xSAT_Solver_t;
 ////////////////////////////////////////////////////////////////////////
 /*=== xsatCnfReader.c ================================================*/
 extern int xSAT_SolverParseDimacs(FILE*, xSAT_Solver_t**);
+extern int xSAT_SolverReadDimacs(char*, xSAT_Solver_t**);
 
 /*=== xsatSolverAPI.c ================================================*/
 extern xSAT_Solver_t* xSAT_SolverCreate();
@@ -22,10 +22,9 @@
 ////////////////////////////////////////////////////////////////////////
 ///                          INCLUDES                                ///
 ////////////////////////////////////////////////////////////////////////
-#include <ctype.h>
-
 #include "misc/util/abc_global.h"
 #include "misc/vec/vecInt.h"
+#include "sat/cnf/cnf.h"
 
 #include "xsatSolver.h"
 
@@ -66,155 +65,78 @@ char* xSAT_FileRead(FILE* pFile) {
 
 /**Function*************************************************************
 
-  Synopsis    []
-
-  Description []
-
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-static void skipLine(char** pIn) {
-    while (1) {
-        if (**pIn == 0)
-            return;
-        if (**pIn == '\n') {
-            (*pIn)++;
-            return;
-        }
-        (*pIn)++;
-    }
-}
-
-/**Function*************************************************************
-
-  Synopsis    []
-
-  Description []
-
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-static int xSAT_ReadInt(char** pIn) {
-    int val = 0;
-    int neg = 0;
-
-    for (; isspace(**pIn); (*pIn)++)
-        ;
-    if (**pIn == '-')
-        neg = 1,
-        (*pIn)++;
-    else if (**pIn == '+')
-        (*pIn)++;
-    if (!isdigit(**pIn))
-        fprintf(stderr, "PARSE ERROR! Unexpected char: %c\n", **pIn),
-            exit(1);
-    while (isdigit(**pIn))
-        val = val * 10 + (**pIn - '0'),
-        (*pIn)++;
-    return neg ? -val : val;
-}
-
-/**Function*************************************************************
+  Synopsis    [Loads the parsed CNF into a new solver.]
 
-  Synopsis    []
-
-  Description []
+  Description [Returns FALSE upon immediate conflict.]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static void xSAT_ReadClause(char** pIn, xSAT_Solver_t* p, Vec_Int_t* vLits) {
-    int token, var, sign;
-
-    Vec_IntClear(vLits);
-    while (1) {
-        token = xSAT_ReadInt(pIn);
-        if (token == 0)
+static int xSAT_SolverLoadCnf(Cnf_Dat_t* pCnf, xSAT_Solver_t** pS) {
+    xSAT_Solver_t* p = xSAT_SolverCreate();
+    Vec_Int_t* vLits = Vec_IntAlloc(100);
+    int i, RetValue = 1;
+    *pS = p;
+    for (i = 0; i < pCnf->nClauses; i++) {
+        Vec_IntClear(vLits);
+        Vec_IntPushArray(vLits, pCnf->pClauses[i], pCnf->pClauses[i + 1] - pCnf->pClauses[i]);
+        if (!xSAT_SolverAddClause(p, vLits)) {
+            RetValue = 0;
             break;
-        var = abs(token) - 1;
-        sign = (token > 0);
-        Vec_IntPush(vLits, xSAT_Var2Lit(var, !sign));
+        }
     }
+    Vec_IntFree(vLits);
+    return RetValue ? xSAT_SolverSimplify(p) : 0;
 }
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Starts the solver and reads the DIMAC file.]
 
-  Description []
+  Description [Returns FALSE upon immediate conflict.]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static int xSAT_ParseDimacs(char* pText, xSAT_Solver_t** pS) {
-    xSAT_Solver_t* p = NULL;
-    Vec_Int_t* vLits = NULL;
-    char* pIn = pText;
-    int nVars, nClas;
-    while (1) {
-        for (; isspace(*pIn); pIn++)
-            ;
-        if (*pIn == 0)
-            break;
-        else if (*pIn == 'c')
-            skipLine(&pIn);
-        else if (*pIn == 'p') {
-            pIn++;
-            for (; isspace(*pIn); pIn++)
-                ;
-            for (; !isspace(*pIn); pIn++)
-                ;
-
-            nVars = xSAT_ReadInt(&pIn);
-            nClas = xSAT_ReadInt(&pIn);
-            skipLine(&pIn);
-
-            /* start the solver */
-            p = xSAT_SolverCreate();
-            /* allocate the vector */
-            vLits = Vec_IntAlloc(nVars);
-        } else {
-            if (p == NULL) {
-                printf("There is no parameter line.\n");
-                exit(1);
-            }
-            xSAT_ReadClause(&pIn, p, vLits);
-            if (!xSAT_SolverAddClause(p, vLits)) {
-                Vec_IntPrint(vLits);
-                return 0;
-            }
-        }
-    }
-    Vec_IntFree(vLits);
-    *pS = p;
-    return xSAT_SolverSimplify(p);
+int xSAT_SolverParseDimacs(FILE* pFile, xSAT_Solver_t** p) {
+    Cnf_Dat_t* pCnf;
+    char* pText;
+    int Value = 0;
+    pText = xSAT_FileRead(pFile);
+    pCnf = Cnf_DataParseDimacs(pText, pText + strlen(pText));
+    ABC_FREE(pText);
+    if (pCnf == NULL)
+        return 0;
+    Value = xSAT_SolverLoadCnf(pCnf, p);
+    Cnf_DataFree(pCnf);
+    return Value;
 }
 
 /**Function*************************************************************
 
   Synopsis    [Starts the solver and reads the DIMAC file.]
 
-  Description [Returns FALSE upon immediate conflict.]
+  Description [The file is memory-mapped or, if its name ends in ".gz",
+  decompressed. Returns FALSE upon immediate conflict or parsing error;
+  in the latter case, the solver is not created.]
 
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int xSAT_SolverParseDimacs(FILE* pFile, xSAT_Solver_t** p) {
-    char* pText;
+int xSAT_SolverReadDimacs(char* pFileName, xSAT_Solver_t** p) {
+    Cnf_Dat_t* pCnf = Cnf_DataReadFromFile(pFileName);
     int Value;
-    pText = xSAT_FileRead(pFile);
-    Value = xSAT_ParseDimacs(pText, p);
-    ABC_FREE(pText);
+    *p = NULL;
+    if (pCnf == NULL)
+        return 0;
+    Value = xSAT_SolverLoadCnf(pCnf, p);
+    Cnf_DataFree(pCnf);
     return Value;
 }
 